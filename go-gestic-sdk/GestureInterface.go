@@ -10,8 +10,25 @@ type GestureInterface interface {
 	Close()
 	FirmwareVersion() (string, error)
 	DataStream() chan GestureMessage
+	UseFields(fields DataField)
 }
 
+// DataField selects which parts of a GestureMessage are filled in. Fields
+// that are not selected are not streamed by the device at all.
+type DataField int
+
+const (
+	FieldRawCICSignals DataField = 1 << iota
+	FieldSignalDeviation
+	FieldPosition
+	FieldGesture
+	FieldTouch // Touch, Tap and DoubleTap
+	FieldAirWheel
+
+	FieldAll = FieldRawCICSignals | FieldSignalDeviation | FieldPosition |
+		FieldGesture | FieldTouch | FieldAirWheel
+)
+
 type GestureMessage struct {
 	Time            time.Time
 	RawCICSignals   Signal
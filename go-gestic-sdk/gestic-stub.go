@@ -22,6 +22,9 @@ func (g *GestIC) FirmwareVersion() (string, error) {
 	return "FAKE", nil
 }
 
+func (g *GestIC) UseFields(fields DataField) {
+}
+
 func (g *GestIC) getCurrentMessage() GestureMessage {
 	msg := GestureMessage{}
 
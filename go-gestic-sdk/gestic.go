@@ -18,7 +18,31 @@ import (
 )
 
 type GestIC struct {
-	impl *C.gestic_t
+	impl     *C.gestic_t
+	fields   DataField
+	watchdog C.gestic_watchdog_stats_t
+}
+
+// Mapping of DataField to the output mask of the device
+var fieldMasks = map[DataField]C.gestic_data_mask_t{
+	FieldRawCICSignals:   C.gestic_data_mask_cic,
+	FieldSignalDeviation: C.gestic_data_mask_sd,
+	FieldPosition:        C.gestic_data_mask_position,
+	FieldGesture:         C.gestic_data_mask_gesture,
+	FieldTouch:           C.gestic_data_mask_touch,
+	FieldAirWheel:        C.gestic_data_mask_airwheel,
+}
+
+// Output mask of the device for fields
+func fieldMask(fields DataField) C.gestic_data_mask_t {
+	var mask C.gestic_data_mask_t
+
+	for field, fieldMask := range fieldMasks {
+		if fields&field != 0 {
+			mask |= fieldMask
+		}
+	}
+	return mask
 }
 
 func Version() string {
@@ -40,8 +64,17 @@ func Open() (GestureInterface, error) {
 		return nil, errors.New("Could not connect to GestIC device")
 	}
 
-	// default to everything. TODO: add func to configure this
-	C.gestic_set_output_enable_mask(g.impl, C.gestic_data_mask_all, C.gestic_data_mask_all, C.gestic_data_mask_all, 100)
+	// Only stream what getCurrentMessage actually reads, see UseFields
+	g.fields = FieldAll
+	C.gestic_data_mask_use(g.impl, fieldMask(g.fields))
+	C.gestic_set_auto_output_mask(g.impl, 1, C.gestic_data_mask_all, 100)
+
+	// Only stream touch info after two seconds (at 200 frames per second)
+	// without a hand near the sensor
+	C.gestic_set_presence_policy(g.impl, 400, C.gestic_data_mask_touch, 0, 100)
+
+	// Reset and reconfigure the device after 200ms without data
+	C.gestic_set_watchdog(g.impl, 40, 100)
 
 	return g, nil
 }
@@ -68,29 +101,66 @@ func (g *GestIC) FirmwareVersion() (string, error) {
 	return trimmed, nil
 }
 
+// UseFields selects the parts of GestureMessage that are filled in by
+// DataStream. The output of the device is narrowed to match on the next
+// update, deselected fields keep their zero value.
+func (g *GestIC) UseFields(fields DataField) {
+	used := fieldMask(fields)
+
+	C.gestic_data_mask_release(g.impl, fieldMask(FieldAll)&^used)
+	C.gestic_data_mask_use(g.impl, used)
+	g.fields = fields
+}
+
 func (g *GestIC) getCurrentMessage() GestureMessage {
 	msg := GestureMessage{
 		Time: time.Now(),
 	}
 
-	cic := C.gestic_get_cic(g.impl, 0)
-	dev := C.gestic_get_sd(g.impl, 0)
-	for i := 0; i < 5; i++ {
-		msg.RawCICSignals.Channels[i] = float32(cic.channel[i])
-		msg.SignalDeviation.Channels[i] = float32(dev.channel[i])
+	if g.fields&FieldRawCICSignals != 0 {
+		cic := C.gestic_get_cic(g.impl, 0)
+		for i := 0; i < 5; i++ {
+			msg.RawCICSignals.Channels[i] = float32(cic.channel[i])
+		}
 	}
 
-	pos := C.gestic_get_position(g.impl, 0)
-	msg.Position.X = int(pos.x)
-	msg.Position.Y = int(pos.y)
-	msg.Position.Z = int(pos.z)
+	if g.fields&FieldSignalDeviation != 0 {
+		dev := C.gestic_get_sd(g.impl, 0)
+		for i := 0; i < 5; i++ {
+			msg.SignalDeviation.Channels[i] = float32(dev.channel[i])
+		}
+	}
 
-	ges := C.gestic_get_gesture(g.impl, 0)
-	msg.Gesture.Gesture = GestureType(ges.gesture)
-	msg.Gesture.EdgeFlick = ((ges.flags & C.gestic_gesture_edge_flick) != 0)
-	msg.Gesture.InProgress = ((ges.flags & C.gestic_gesture_in_progress) != 0)
-	msg.Gesture.CountSinceLast = int(ges.last_event)
+	if g.fields&FieldPosition != 0 {
+		pos := C.gestic_get_position(g.impl, 0)
+		msg.Position.X = int(pos.x)
+		msg.Position.Y = int(pos.y)
+		msg.Position.Z = int(pos.z)
+	}
 
+	if g.fields&FieldGesture != 0 {
+		ges := C.gestic_get_gesture(g.impl, 0)
+		msg.Gesture.Gesture = GestureType(ges.gesture)
+		msg.Gesture.EdgeFlick = ((ges.flags & C.gestic_gesture_edge_flick) != 0)
+		msg.Gesture.InProgress = ((ges.flags & C.gestic_gesture_in_progress) != 0)
+		msg.Gesture.CountSinceLast = int(ges.last_event)
+	}
+
+	if g.fields&FieldTouch != 0 {
+		g.getTouch(&msg)
+	}
+
+	if g.fields&FieldAirWheel != 0 {
+		air := C.gestic_get_air_wheel(g.impl, 0)
+		msg.AirWheel.Counter = int(air.counter)
+		msg.AirWheel.Active = (air.active != 0)
+		msg.AirWheel.CountSinceLast = int(air.last_event)
+	}
+
+	return msg
+}
+
+func (g *GestIC) getTouch(msg *GestureMessage) {
 	tch := C.gestic_get_touch(g.impl, 0)
 	msg.Touch.North = ((tch.flags & C.gestic_touch_north) != 0)
 	msg.Touch.South = ((tch.flags & C.gestic_touch_south) != 0)
@@ -112,13 +182,6 @@ func (g *GestIC) getCurrentMessage() GestureMessage {
 	msg.DoubleTap.West = ((tch.tap_flags & C.gestic_double_tap_west) != 0)
 	msg.DoubleTap.Center = ((tch.tap_flags & C.gestic_double_tap_center) != 0)
 	msg.DoubleTap.CountSinceLast = int(tch.last_tap_event)
-
-	air := C.gestic_get_air_wheel(g.impl, 0)
-	msg.AirWheel.Counter = int(air.counter)
-	msg.AirWheel.Active = (air.active != 0)
-	msg.AirWheel.CountSinceLast = int(air.last_event)
-
-	return msg
 }
 
 func (g *GestIC) dataStreamUpdate() (error, bool) {
@@ -128,12 +191,27 @@ func (g *GestIC) dataStreamUpdate() (error, bool) {
 	case C.GESTIC_NO_ERROR:
 		return nil, false
 	case C.GESTIC_NO_DATA:
+		g.checkWatchdog()
 		return fmt.Errorf("No data."), false
 	default:
 		return fmt.Errorf("Error while updating data stream: %d", res), true
 	}
 }
 
+// checkWatchdog logs the attempts of the SDK to restore a stalled device
+func (g *GestIC) checkWatchdog() {
+	var stats C.gestic_watchdog_stats_t
+
+	C.gestic_get_watchdog_stats(g.impl, &stats)
+	if stats.recoveries != g.watchdog.recoveries {
+		log.Printf("Device stalled, recovered in %dms", stats.last_recovery)
+	}
+	if stats.failures != g.watchdog.failures {
+		log.Printf("Device stalled, recovery failed")
+	}
+	g.watchdog = stats
+}
+
 func (g *GestIC) DataStream() chan GestureMessage {
 	c := make(chan GestureMessage, 16)
 
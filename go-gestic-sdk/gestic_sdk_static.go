@@ -4,13 +4,24 @@ package gestic
 
 /*
 #cgo CFLAGS: -I../sdk/api/include -DGESTIC_HAS_DYNAMIC
+#cgo LDFLAGS: -lpthread
 #include <gestic_api.h>
 #include "../sdk/api/src/core.c"
 #include "../sdk/api/src/flash.c"
 #include "../sdk/api/src/fw_version.c"
+#include "../sdk/api/src/output.c"
+#include "../sdk/api/src/sensorlog.c"
+#include "../sdk/api/src/capture.c"
+#include "../sdk/api/src/enz.c"
+#include "../sdk/api/src/crc.c"
+#include "../sdk/api/src/trace.c"
+#include "../sdk/api/src/metrics.c"
+#include "../sdk/api/src/watchdog.c"
+#include "../sdk/api/src/profile.c"
 #include "../sdk/api/src/rtc.c"
 #include "../sdk/api/src/stream.c"
 #include "../sdk/api/src/io/cdserial_linux.c"
+#include "../sdk/api/src/io/i2c_linux.c"
 #include "../sdk/api/src/io/serial.c"
 #include "../sdk/api/src/dynamic/depr_stream.c"
 #include "../sdk/api/src/dynamic/dynamic.c"
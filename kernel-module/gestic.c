@@ -74,6 +74,10 @@ static bool spammy_debug = 0;
 module_param(spammy_debug, bool, 0);
 MODULE_PARM_DESC(spammy_debug, "Enables an extremely verbose spammy debug mode");
 
+static int reset_timeout_ms = 20;
+module_param(reset_timeout_ms, int, 0644);
+MODULE_PARM_DESC(reset_timeout_ms, "Upper bound for the chip to assert TS after a reset");
+
 static int i2c_delay_read = 5;
 static int i2c_delay_write = 0;
 #define post_i2c_delay(delay) msleep((delay) << 1)
@@ -101,12 +105,22 @@ static struct i2c_board_info gestic_boardinfo = {
 };
 
 
+// waits until the chip asserts TS with its first message after a reset
+static void gestic_wait_ready(void)
+{
+  long remaining = wait_event_timeout(read_queue, gpio_get_value(GESTIC_GPIO_TS) == 0,
+                                      msecs_to_jiffies(reset_timeout_ms));
+
+  if (GESTIC_DEBUG) printk(KERN_INFO "GestIC: ready after reset: %s\n", remaining ? "yes" : "timed out");
+}
+
 static void gestic_reset(void)
 {
   gpio_direction_output(GESTIC_GPIO_MCLR, 0);
-  msleep(5);
+  // msleep would round up to jiffies, which is 10ms+ on HZ=100
+  usleep_range(5000, 6000);
   gpio_direction_output(GESTIC_GPIO_MCLR, 1);
-  msleep(20);
+  gestic_wait_ready();
 }
 
 
@@ -118,8 +132,10 @@ static int gestic_open(struct inode *i, struct file *f)
   
   // gestic_reset();
   // just make sure we're not in reset state.
-  gpio_direction_output(GESTIC_GPIO_MCLR, 1);
-  msleep(20);
+  if (gpio_get_value(GESTIC_GPIO_MCLR) == 0) {
+    gpio_direction_output(GESTIC_GPIO_MCLR, 1);
+    gestic_wait_ready();
+  }
 
   return 0;
 }
@@ -84,6 +84,9 @@ typedef struct gestic_struct gestic_t;
 #   define GESTIC_HAS_SERIAL_IO
 #   define GESTIC_USE_IO_CDC_SERIAL
 #   define GESTIC_USE_MSG_EXTRACT
+#   ifdef __linux__
+#       define GESTIC_HAS_BACKENDS
+#   endif
 #else
 #   error "Unknown IO implementation selected"
 #endif
@@ -113,6 +116,8 @@ extern "C" {
  *                                  This error is specific to systems that provide automatic
  *                                  device detection
  * GESTIC_BAD_PARAM_ERROR         - Parameter of a function call was invalid in that context
+ * GESTIC_BAD_IMAGE_ERROR         - A firmware image or its archive is malformed.
+ *                                  See <gestic_load_enz>
  * GESTIC_NO_IMPLEMENTATION_ERROR - The implementation of the called function is missing or incomplete
  */
 
@@ -127,6 +132,7 @@ typedef enum {
     GESTIC_IO_OPEN_ERROR = -18,
     GESTIC_IO_ENUM_ERROR = -19,
     GESTIC_BAD_PARAM_ERROR = -32,
+    GESTIC_BAD_IMAGE_ERROR = -33,
     GESTIC_NO_IMPLEMENTATION_ERROR = -48
 } gestic_error_t;
 
@@ -252,6 +258,470 @@ GESTIC_API int CDECL gestic_set_logger(gestic_t *gestic,
 
 #endif
 
+/* ======== Section: Metrics ======== */
+
+#ifndef GESTIC_NO_METRICS
+
+/* Constant: GESTIC_METRICS_BUCKETS
+ *
+ * Count of buckets of a <gestic_histogram_t>.
+ */
+#define GESTIC_METRICS_BUCKETS 20
+
+/* Struct: gestic_histogram_t
+ *
+ * Distribution of durations in microseconds.
+ *
+ * buckets - Count of durations per bucket. A duration is counted in the first
+ *           bucket whose bound (see <gestic_metrics_bound>) is not below it.
+ * count   - Count of all durations
+ * sum     - Sum of all durations in microseconds
+ */
+typedef struct {
+    unsigned int buckets[GESTIC_METRICS_BUCKETS];
+    unsigned int count;
+    unsigned long long sum;
+} gestic_histogram_t;
+
+/* Struct: gestic_metrics_t
+ *
+ * Counters of the communication with the device since <gestic_initialize>.
+ *
+ * bytes_read     - Bytes read from the device
+ * messages       - Received messages indexed by message id
+ * resyncs        - Times the message framing was lost and data was skipped
+ * bad_sizes      - Messages with an invalid size
+ * skipped_frames - Frames that were received but not fetched by
+ *                  <gestic_data_stream_update>
+ * retries        - Messages sent again by <gestic_send_message>
+ * timeouts       - Attempts of <gestic_send_message> without a response
+ * decode_time    - Time to handle each received message
+ * command_rtt    - Time from sending a message until its response
+ *
+ * The counters wrap around on overflow.
+ */
+typedef struct {
+    unsigned long long bytes_read;
+    unsigned int messages[256];
+    unsigned int resyncs;
+    unsigned int bad_sizes;
+    unsigned int skipped_frames;
+    unsigned int retries;
+    unsigned int timeouts;
+    gestic_histogram_t decode_time;
+    gestic_histogram_t command_rtt;
+} gestic_metrics_t;
+
+/* Function: gestic_get_metrics
+ *
+ * Copies the current state of the metrics.
+ *
+ * metrics - Pointer where to store the metrics
+ *
+ * The metrics are updated without locking, this function could be called
+ * from any thread. Each counter is read atomically, but the counters might
+ * be from slightly different points in time.
+ *
+ * See also:
+ *    <gestic_format_metrics>
+ */
+GESTIC_API void CDECL gestic_get_metrics(gestic_t *gestic,
+                                         gestic_metrics_t *metrics);
+
+/* Function: gestic_metrics_bound
+ *
+ * Returns the upper bound of a bucket of <gestic_histogram_t> in
+ * microseconds. The last bucket is unbounded and returns 0.
+ *
+ * The bounds grow in steps of 1, 2 and 5 from 1 us to 1 s.
+ */
+GESTIC_API unsigned int CDECL gestic_metrics_bound(int bucket);
+
+/* Function: gestic_format_metrics
+ *
+ * Formats metrics in the Prometheus text exposition format.
+ *
+ * metrics - The metrics as retrieved with <gestic_get_metrics>
+ * labels  - Labels added to every sample, e.g. "device=\"sphere\"", or NULL
+ * buffer  - Buffer for the text
+ * size    - Size of buffer in bytes
+ *
+ * Returns the length of the complete text without the terminating 0. The text
+ * was truncated if this is not less than size.
+ *
+ * Durations are reported in seconds.
+ *
+ * See also:
+ *    <gestic_write_metrics>
+ */
+GESTIC_API int CDECL gestic_format_metrics(const gestic_metrics_t *metrics,
+                                           const char *labels,
+                                           char *buffer,
+                                           int size);
+
+#ifdef __linux__
+
+/* Function: gestic_write_metrics
+ *
+ * Writes the current metrics to a file for the textfile collector of the
+ * Prometheus node exporter.
+ *
+ * path   - The file to write, should end in .prom
+ * labels - Labels added to every sample or NULL
+ *
+ * Returns 0 on success, <GESTIC_IO_ERROR> if the file could not be written or
+ * <GESTIC_BAD_PARAM_ERROR> if path is too long.
+ *
+ * The text is written to a temporary file next to path that replaces path
+ * afterwards, so the collector never reads a partial file.
+ *
+ * See also:
+ *    <gestic_format_metrics>
+ */
+GESTIC_API int CDECL gestic_write_metrics(gestic_t *gestic,
+                                          const char *path,
+                                          const char *labels);
+
+#endif
+
+#endif
+
+/* ======== Section: Trace ======== */
+
+/* Define: GESTIC_TRACE_LEVEL
+ *
+ * Events up to this level are recorded in the trace ring: 0 none, 1 errors,
+ * 2 commands, 3 every message. Defaults to 2 on Linux and Windows and to 0
+ * on other targets, which opt in by defining it.
+ */
+#ifdef GESTIC_NO_TRACE
+#   undef GESTIC_TRACE_LEVEL
+#   define GESTIC_TRACE_LEVEL 0
+#elif !defined(GESTIC_TRACE_LEVEL)
+#   if defined(_WIN32) || defined(__linux__)
+#       define GESTIC_TRACE_LEVEL 2
+#   else
+#       define GESTIC_TRACE_LEVEL 0
+#   endif
+#endif
+
+#if GESTIC_TRACE_LEVEL > 0
+#   define GESTIC_HAS_TRACE
+#endif
+
+#ifdef GESTIC_HAS_TRACE
+
+/* Enumeration: gestic_trace_event_t
+ *
+ * Events recorded in the trace ring and their arguments.
+ *
+ * gestic_trace_message     - A message was received (id, size)
+ * gestic_trace_frame       - Sensor data was decoded (frame counter,
+ *                            DataOutputConfigMask)
+ * gestic_trace_cmd_sent    - <gestic_send_message> wrote a message (id,
+ *                            attempt, timeout in ms)
+ * gestic_trace_cmd_ack     - The device answered it (id, error, response time
+ *                            in us)
+ * gestic_trace_cmd_timeout - An attempt got no response (id, attempt, timeout
+ *                            in ms)
+ * gestic_trace_param       - A runtime parameter was set (param, arg0, arg1)
+ * gestic_trace_resync      - The message framing was lost (bytes left in the
+ *                            input, 0, 0)
+ * gestic_trace_bad_size    - A message had an invalid size (id, size, 0)
+ * gestic_trace_reset       - The device was reset (error, 0, 0)
+ * gestic_trace_recovery    - The watchdog restored the device (duration in ms,
+ *                            error, 0)
+ *
+ * The values are part of the dump format and are never reused.
+ */
+typedef enum {
+    gestic_trace_message = 1,
+    gestic_trace_frame = 2,
+    gestic_trace_cmd_sent = 3,
+    gestic_trace_cmd_ack = 4,
+    gestic_trace_cmd_timeout = 5,
+    gestic_trace_param = 6,
+    gestic_trace_resync = 7,
+    gestic_trace_bad_size = 8,
+    gestic_trace_reset = 9,
+    gestic_trace_recovery = 10
+} gestic_trace_event_t;
+
+/* Struct: gestic_trace_entry_t
+ *
+ * An entry of the trace ring.
+ *
+ * seq   - Position of the entry in the sequence of all entries, counting from 1
+ * time  - Microseconds of a monotonic clock, wraps around after 71 minutes
+ * event - The <gestic_trace_event_t>
+ * level - The level the event is recorded at (1 error, 2 info, 3 debug)
+ * args  - Event specific arguments
+ */
+typedef struct {
+    unsigned int seq;
+    unsigned int time;
+    unsigned short event;
+    unsigned short level;
+    int args[3];
+} gestic_trace_entry_t;
+
+/* Struct: gestic_trace_header_t
+ *
+ * Header of a trace dump as written by <gestic_write_trace>, followed by
+ * count <gestic_trace_entry_t>-entries, oldest first, in host byte order.
+ *
+ * magic      - "GTRC"
+ * version    - Version of the format, currently 1
+ * entry_size - sizeof(gestic_trace_entry_t)
+ * count      - Number of entries in the dump
+ */
+typedef struct {
+    char magic[4];
+    unsigned short version;
+    unsigned short entry_size;
+    unsigned int count;
+} gestic_trace_header_t;
+
+/* Function: gestic_read_trace
+ *
+ * Copies the latest entries of the trace ring.
+ *
+ * entries - Buffer for the entries
+ * count   - Capacity of entries
+ *
+ * Returns the number of copied entries, oldest first.
+ *
+ * The SDK records events without locking into a ring of GESTIC_TRACE_SIZE
+ * entries per instance. Which events are recorded is selected at compile
+ * time with <GESTIC_TRACE_LEVEL>: 0 disables the trace, 1 records
+ * errors, 2 adds commands and 3 every message. Entries that are overwritten
+ * while they are copied are left out.
+ *
+ * See also:
+ *    <gestic_write_trace>
+ */
+GESTIC_API int CDECL gestic_read_trace(gestic_t *gestic,
+                                       gestic_trace_entry_t *entries,
+                                       int count);
+
+#ifdef __linux__
+
+/* Function: gestic_write_trace
+ *
+ * Dumps the trace ring to a file that could be decoded with the tracedump
+ * tool.
+ *
+ * path - The file to write
+ *
+ * Returns 0 on success or <GESTIC_IO_ERROR>.
+ *
+ * See also:
+ *    <gestic_trace_header_t>, <gestic_read_trace>
+ */
+GESTIC_API int CDECL gestic_write_trace(gestic_t *gestic, const char *path);
+
+#endif
+
+#endif
+
+/* ======== Section: Checksums ======== */
+
+/* Flashing, capture files and sensor logs depend on gestic_crc32 */
+#ifndef GESTIC_NO_CRC32
+
+/* Function: gestic_crc32
+ *
+ * Computes the CRC-32 as used by the firmware update messages.
+ *
+ * crc  - The CRC of the preceding data or 0 for the first part
+ * data - Ptr to the data
+ * size - Count of bytes in data
+ *
+ * Returns the CRC of the data. Passing it on as crc of the next call
+ * continues the calculation over data split into several parts.
+ *
+ * This is the common CRC-32 (reflected polynomial 0xEDB88320) as known
+ * from zlib or Ethernet.
+ *
+ * See also:
+ *    <Firmware Version and Update>, <gestic_flash_write>
+ */
+GESTIC_API unsigned int CDECL gestic_crc32(unsigned int crc, const void *data,
+                                           int size);
+
+#elif !defined(GESTIC_NO_FLASH)
+#   error "GESTIC_NO_CRC32 requires GESTIC_NO_FLASH"
+#endif
+
+/* ======== Section: Capture ======== */
+
+#if !defined(GESTIC_NO_CAPTURE) && !defined(GESTIC_NO_CRC32) && \
+    defined(__linux__)
+#   define GESTIC_HAS_CAPTURE
+#endif
+
+#ifdef GESTIC_HAS_CAPTURE
+
+/* Define: GESTIC_CAPTURE_CHUNK
+ *
+ * Maximum size of the records of a chunk in a capture file.
+ */
+#ifndef GESTIC_CAPTURE_CHUNK
+#define GESTIC_CAPTURE_CHUNK 65536
+#endif
+
+/* Enumeration: gestic_capture_direction_t
+ *
+ * gestic_capture_received - Message received from the device
+ * gestic_capture_sent     - Message sent to the device
+ */
+typedef enum {
+    gestic_capture_received = 0,
+    gestic_capture_sent = 1
+} gestic_capture_direction_t;
+
+/* Struct: gestic_capture_header_t
+ *
+ * Header at the start of a capture file as written by <gestic_start_capture>.
+ * All values are stored in host byte order.
+ *
+ * magic       - "GCAP"
+ * version     - Version of the format, currently 1
+ * header_size - sizeof(gestic_capture_header_t)
+ * chunk_size  - Maximum size of the records of a chunk
+ * start_time  - Wall clock time the capture started at in microseconds since
+ *               1970
+ *
+ * The header is followed by chunks that start with a <gestic_capture_chunk_t>.
+ * Each record in a chunk consists of 6 bytes
+ *
+ * - Microseconds since the time of the chunk (32 bits)
+ * - The <gestic_capture_direction_t> (8 bits)
+ * - Size of the message (8 bits)
+ *
+ * followed by the message itself without the leading 0xFE 0xFF.
+ *
+ * A capture that was stopped with <gestic_stop_capture> ends with one
+ * <gestic_capture_index_t> per chunk and a <gestic_capture_trailer_t>.
+ * Otherwise the chunks could still be found one after the other.
+ */
+typedef struct {
+    char magic[4];
+    unsigned short version;
+    unsigned short header_size;
+    unsigned int chunk_size;
+    unsigned int reserved;
+    unsigned long long start_time;
+} gestic_capture_header_t;
+
+/* Struct: gestic_capture_chunk_t
+ *
+ * Header of a chunk of records in a capture file.
+ *
+ * magic - "GCHK"
+ * size  - Size of the records following the header in bytes
+ * count - Number of records
+ * frame - Frame counter after the first record of the chunk was processed
+ * time  - Microseconds of the first record since the start of the capture
+ * crc   - <gestic_crc32> of the records
+ */
+typedef struct {
+    char magic[4];
+    unsigned int size;
+    unsigned int count;
+    unsigned int frame;
+    unsigned long long time;
+    unsigned int crc;
+    unsigned int reserved;
+} gestic_capture_chunk_t;
+
+/* Struct: gestic_capture_index_t
+ *
+ * Entry of the index at the end of a capture file.
+ *
+ * offset - Position of the <gestic_capture_chunk_t> in the file
+ * time   - time of the chunk
+ * frame  - frame of the chunk
+ * count  - count of the chunk
+ */
+typedef struct {
+    unsigned long long offset;
+    unsigned long long time;
+    unsigned int frame;
+    unsigned int count;
+} gestic_capture_index_t;
+
+/* Struct: gestic_capture_trailer_t
+ *
+ * Last bytes of a complete capture file.
+ *
+ * magic  - "GIDX"
+ * count  - Number of <gestic_capture_index_t>-entries, one per chunk
+ * offset - Position of the first entry in the file
+ */
+typedef struct {
+    char magic[4];
+    unsigned int count;
+    unsigned long long offset;
+} gestic_capture_trailer_t;
+
+/* Struct: gestic_capture_stats_t
+ *
+ * records - Records that were captured
+ * dropped - Records that were dropped because the writer fell behind
+ * chunks  - Chunks written to the file
+ * bytes   - Size of the file
+ */
+typedef struct {
+    unsigned int records;
+    unsigned int dropped;
+    unsigned int chunks;
+    unsigned long long bytes;
+} gestic_capture_stats_t;
+
+/* Function: gestic_start_capture
+ *
+ * Records every message that is received from or sent to the device in a
+ * capture file.
+ *
+ * path - The file to write, an existing file is replaced
+ *
+ * Returns 0 on success, <GESTIC_IO_OPEN_ERROR> if the file could not be
+ * created or <GESTIC_IO_ERROR>.
+ *
+ * Messages are copied into chunks in memory that a background thread appends
+ * to the file, so the thread receiving messages never waits for the disk.
+ * Chunks are written when they are full and at least once a second. If the
+ * writer falls behind by GESTIC_CAPTURE_BUFFERS (4) chunks messages are
+ * dropped and counted instead.
+ *
+ * With GESTIC_SYNC_THREADING the capture could be started and stopped while
+ * another thread receives messages. Otherwise no other thread is allowed to
+ * use gestic meanwhile.
+ *
+ * See also:
+ *    <gestic_capture_header_t>, <gestic_stop_capture>
+ */
+GESTIC_API int CDECL gestic_start_capture(gestic_t *gestic, const char *path);
+
+/* Function: gestic_stop_capture
+ *
+ * Writes the outstanding records and the index and closes the capture file.
+ *
+ * stats - Optional ptr receiving statistics of the capture
+ *
+ * Returns 0 on success or <GESTIC_IO_ERROR> if a write failed.
+ *
+ * <gestic_cleanup> stops a running capture, too.
+ *
+ * See also:
+ *    <gestic_start_capture>
+ */
+GESTIC_API int CDECL gestic_stop_capture(gestic_t *gestic,
+                                         gestic_capture_stats_t *stats);
+
+#endif
+
 /* ======== Section: Connection Handling ======== */
 
 /* Function: gestic_open
@@ -263,11 +733,109 @@ GESTIC_API int CDECL gestic_set_logger(gestic_t *gestic,
  *
  * The connection has to be closed with <gestic_close> after use.
  *
+ * On Linux the device defaults to /dev/gestic and can be overridden with the
+ * environment variable GESTIC_DEVICE (e.g. to connect to the simulator).
+ * GESTIC_DEVICE accepts the same URIs as <gestic_open_uri>.
+ *
  * See also:
- *    <gestic_initialize>, <gestic_close>
+ *    <gestic_initialize>, <gestic_close>, <gestic_open_uri>
  */
 GESTIC_API int CDECL gestic_open(gestic_t *gestic);
 
+#ifdef GESTIC_HAS_BACKENDS
+
+/* Function: gestic_open_uri
+ *
+ * Opens a connection like <gestic_open> but selects the kind of connection
+ * at runtime.
+ *
+ * uri - Source of the messages, one of
+ *
+ * dev:PATH                  - Device of the kernel module, e.g. dev:/dev/gestic.
+ *                             The prefix might be omitted.
+ * tty:PATH[?baud=N]         - Serial port or pty (e.g. of the simulator)
+ *                             that is switched to raw mode.
+ * unix:PATH                 - Unix domain stream socket that talks the
+ *                             protocol of the kernel module.
+ * replay:PATH[?speed=N|max] - Replays a capture file of
+ *                             <gestic_start_capture> or a capture of the
+ *                             data that was read from the kernel module
+ *                             (e.g. with cat). The received messages of a
+ *                             capture file are paced by the times they were
+ *                             recorded at, the Sensor_Data_Output messages
+ *                             of the raw data by their time stamps. Both at
+ *                             N times the recorded speed (default 1) or as
+ *                             fast as possible with max.
+ * i2c:PATH[?OPTIONS]        - I2C bus of the device through i2c-dev (e.g.
+ *                             i2c:/dev/i2c-1) with the TS/MCLR handshake
+ *                             done via the GPIO character device instead
+ *                             of the kernel module. Options (joined by &)
+ *                             are addr=0x42, chip=/dev/gpiochip3, ts=10,
+ *                             mclr=4 and wait=0 (milliseconds a read
+ *                             blocks for TS).
+ *
+ * tty connections accept the options raw=0 to keep the line settings,
+ * lowlatency=0 to keep ASYNC_LOW_LATENCY off and dtr=0 to leave DTR
+ * untouched. All of them are enabled by default.
+ *
+ * Returns 0 on success or a negative value on error.
+ * <GESTIC_BAD_PARAM_ERROR> is returned for unknown schemes or options.
+ *
+ * A replay acknowledges every message written to it with System_Status so
+ * that configuration of the data output succeeds. Requested messages are
+ * not answered.
+ *
+ * Note:
+ *    Only available on Linux.
+ *
+ * See also:
+ *    <gestic_open>, <gestic_close>
+ */
+GESTIC_API int CDECL gestic_open_uri(gestic_t *gestic, const char *uri);
+
+/* Struct: gestic_read_latency_t
+ *
+ * Per-message read latency in microseconds as measured since
+ * <gestic_measure_read_latency> was called.
+ *
+ * The latency of a message is the time from its data becoming readable
+ * (e.g. poll() waking up or the assertion of TS) until it was extracted.
+ *
+ * messages - Count of measured messages
+ * min      - Minimal latency
+ * average  - Average latency
+ * max      - Maximal latency
+ */
+typedef struct {
+    int messages;
+    int min;
+    int average;
+    int max;
+} gestic_read_latency_t;
+
+/* Function: gestic_measure_read_latency
+ *
+ * Enables or disables the measurement of the read latency of messages.
+ *
+ * enable - Whether to measure, the results are reset in any case
+ *
+ * See also:
+ *    <gestic_get_read_latency>
+ */
+GESTIC_API void CDECL gestic_measure_read_latency(gestic_t *gestic, int enable);
+
+/* Function: gestic_get_read_latency
+ *
+ * Fills latency with the results of the measurement.
+ *
+ * See also:
+ *    <gestic_measure_read_latency>
+ */
+GESTIC_API void CDECL gestic_get_read_latency(gestic_t *gestic,
+                                              gestic_read_latency_t *latency);
+
+#endif
+
 /* Function: gestic_close
  *
  * Closes the connection to the device associated with gestic that was
@@ -283,9 +851,26 @@ GESTIC_API void CDECL gestic_close(gestic_t *gestic);
  *
  * Resetting the hardware is done by signaling the reset line of the chip.
  * This requires support by the hardware connection.
+ *
+ * See also:
+ *    <gestic_reset_and_wait>
  */
 GESTIC_API int CDECL gestic_reset(gestic_t *gestic);
 
+/* Function: gestic_reset_and_wait
+ *
+ * Resets the chip like <gestic_reset> and waits until it is ready again.
+ *
+ * timeout - Upper bound in milliseconds for the chip to come up
+ *
+ * The chip counts as ready as soon as it announces itself with
+ * Fw_Version_Info or a System_Status with <gestic_system_WakeupHappened>.
+ *
+ * Returns 0 on success, <GESTIC_NO_RESPONSE_ERROR> if the chip did not
+ * announce itself within timeout or another negative value on error.
+ */
+GESTIC_API int CDECL gestic_reset_and_wait(gestic_t *gestic, int timeout);
+
 /* ======== Section: Communication Related Enums ======== */
 
 
@@ -424,6 +1009,12 @@ typedef enum {
  * If <wait_response> returns an error this function retries up to three times
  * before it in turn returns an error to the caller.
  *
+ * Once response times for the type of msg were measured the timeout is derived
+ * from them instead (see <gestic_set_timeout_limits>). Each retry doubles the
+ * timeout of the previous attempt. Messages that write the flash, i.e.
+ * <gestic_param_makePersistent> and the Fw_Update_* messages, always use
+ * timeout.
+ *
  * See also:
  *    <wait_response>, <gestic_set_param>, <gestic_trigger_action>
  */
@@ -432,6 +1023,80 @@ GESTIC_API int CDECL gestic_send_message(gestic_t *gestic,
                                          int size,
                                          int timeout);
 
+#ifndef GESTIC_NO_ADAPTIVE_TIMEOUT
+
+/* Struct: gestic_rtt_stats_t
+ *
+ * Response times of one message type as measured by <gestic_send_message>.
+ *
+ * msg_id   - The type of the sent messages
+ * samples  - Count of measured response times
+ * srtt     - Smoothed response time in microseconds
+ * rttvar   - Smoothed mean deviation of the response time in microseconds
+ * min      - Shortest response time in microseconds
+ * max      - Longest response time in microseconds
+ * last     - Last response time in microseconds
+ * timeout  - Timeout of the first attempt in milliseconds
+ * retries  - Count of messages that had to be sent again
+ * failures - Count of messages that failed after all retries
+ *
+ * Only responses to the first attempt are measured as later responses can not
+ * be told apart from late responses to an earlier attempt.
+ */
+typedef struct {
+    int msg_id;
+    int samples;
+    int srtt;
+    int rttvar;
+    int min;
+    int max;
+    int last;
+    int timeout;
+    int retries;
+    int failures;
+} gestic_rtt_stats_t;
+
+/* Function: gestic_set_timeout_limits
+ *
+ * Sets the range of timeouts derived from measured response times.
+ *
+ * floor   - Shortest timeout in milliseconds (default 10)
+ * ceiling - Longest timeout in milliseconds (default 1000), 0 disables
+ *           adaptive timeouts
+ *
+ * The timeout of a message type is its smoothed response time plus four times
+ * its deviation, limited to floor and ceiling. Until the first response was
+ * measured the timeout passed by the caller is used. Retries may exceed the
+ * ceiling only up to that timeout.
+ *
+ * See also:
+ *    <gestic_get_rtt_stats>, <gestic_send_message>
+ */
+GESTIC_API void CDECL gestic_set_timeout_limits(gestic_t *gestic,
+                                                int floor,
+                                                int ceiling);
+
+/* Function: gestic_get_rtt_stats
+ *
+ * Retrieves the response times measured for a message type.
+ *
+ * msg_id - The type of the sent message (e.g. <gestic_msg_Set_Runtime_Parameter>)
+ * stats  - Pointer where to store the statistics
+ *
+ * Returns 0 on success or <GESTIC_BAD_PARAM_ERROR> if no message of that type
+ * was sent yet.
+ *
+ * Parameter reads are sent as <gestic_msg_Request_Message>.
+ *
+ * See also:
+ *    <gestic_set_timeout_limits>
+ */
+GESTIC_API int CDECL gestic_get_rtt_stats(gestic_t *gestic,
+                                          int msg_id,
+                                          gestic_rtt_stats_t *stats);
+
+#endif
+
 /* Function: gestic_set_param
  *
  * Sends the instruction for updating a runtime-parameter to the device.
@@ -475,6 +1140,10 @@ GESTIC_API int CDECL gestic_set_param(gestic_t *gestic,
  * After a failure or no response within the timeout the request gets resend
  * up to three times.
  *
+ * Parameters that were read before, or set without a mask, are returned
+ * from the parameter cache without communication (see
+ * <gestic_param_cache_bypass>).
+ *
  * See also:
  *    <gestic_set_param>
  */
@@ -484,6 +1153,48 @@ GESTIC_API int CDECL gestic_get_param(gestic_t *gestic,
                                       unsigned int *arg1,
                                       int timeout);
 
+#ifndef GESTIC_NO_PARAM_CACHE
+
+/* Function: gestic_param_cache_bypass
+ *
+ * Controls the usage of the runtime parameter cache.
+ *
+ * bypass - Boolean value whether the cache is bypassed
+ *
+ * The cache keeps a copy of runtime parameters as set by <gestic_set_param>
+ * and as read back by <gestic_get_param>. Unless bypassed
+ * <gestic_set_param> skips instructions that would not change the
+ * parameter and <gestic_get_param> returns values that were read before
+ * from the cache. For parameters where arg1 selects the changed bits of
+ * arg0 only the selected bits are compared. Other parameters are fully
+ * known once set, so they are returned from the cache afterwards, too.
+ *
+ * The cache is still updated while bypassed. Triggered actions,
+ * <gestic_make_persistent> and <gestic_param_dataOutputRequestMask> are never
+ * cached.
+ *
+ * The cache is invalidated by <gestic_open>, <gestic_reset> and when the
+ * device reports <gestic_system_WakeupHappened>.
+ *
+ * See also:
+ *    <gestic_param_cache_invalidate>
+ */
+GESTIC_API void CDECL gestic_param_cache_bypass(gestic_t *gestic, int bypass);
+
+/* Function: gestic_param_cache_invalidate
+ *
+ * Drops all runtime parameters from the cache.
+ *
+ * This is required when the parameters of the device were changed without
+ * the knowledge of the SDK (e.g. by an external reset).
+ *
+ * See also:
+ *    <gestic_param_cache_bypass>
+ */
+GESTIC_API void CDECL gestic_param_cache_invalidate(gestic_t *gestic);
+
+#endif
+
 /* Function: gestic_trigger_action
  *
  * Sends the instruction for a specific action to the device.
@@ -505,6 +1216,46 @@ GESTIC_API int CDECL gestic_trigger_action(gestic_t *gestic,
                                            unsigned short action,
                                            int timeout);
 
+/* Function: gestic_send_pipelined
+ *
+ * Sends a batch of messages to the device without waiting for the response
+ * to each message before sending the next one.
+ *
+ * msgs    - Pointer to count messages of size bytes each.
+ *           All messages have to share the same message id.
+ * size    - The size of each message
+ * count   - The number of messages
+ * window  - The maximum number of messages that are sent but not yet
+ *           acknowledged by the device
+ * errors  - Optional array of count integers that receive the error code of
+ *           the System_Status response to each message
+ * timeout - Timeout in milliseconds to wait for the next response
+ *
+ * Returns 0 when all messages were acknowledged without error,
+ * <GESTIC_SYSTEM_ERROR> when some message was acknowledged with an error or
+ * another negative value when sending failed or the device stopped
+ * responding.
+ *
+ * The device processes the messages in order and acknowledges each one.
+ * Therefore the n-th System_Status response to the message id belongs to the
+ * n-th message. The entries of errors for messages without response are set
+ * to -1. Responses beyond the messages written so far, e.g. late responses to
+ * an earlier batch, are ignored.
+ *
+ * In contrast to <gestic_send_message> failed messages are *not* resent.
+ * The caller is expected to fall back to <gestic_send_message> for those.
+ *
+ * See also:
+ *    <gestic_send_message>
+ */
+GESTIC_API int CDECL gestic_send_pipelined(gestic_t *gestic,
+                                           const void *msgs,
+                                           int size,
+                                           int count,
+                                           int window,
+                                           int *errors,
+                                           int timeout);
+
 
 /* ======== Section: Data Access ======== */
 
@@ -827,6 +1578,28 @@ typedef struct {
     int valid;
 } gestic_noise_power_t;
 
+/* Structure: gestic_input_data_t
+ *
+ * All data of the device as decoded from its Sensor_Data_Output messages.
+ *
+ * frame_counter - Count of samples between start-up and the data
+ *
+ * The static API keeps the data after the last call to
+ * <gestic_data_stream_update> in gestic->result.
+ */
+typedef struct {
+    gestic_signal_t cic;
+    gestic_signal_t sd;
+    gestic_position_t pos;
+    gestic_gesture_t gesture;
+    gestic_calib_t calib;
+    gestic_touch_t touch;
+    gestic_air_wheel_t air_wheel;
+    gestic_freq_t frequency;
+    gestic_noise_power_t noise_power;
+    int frame_counter;
+} gestic_input_data_t;
+
 #endif
 
 /* ======== Section: Data Retrieval ======== */
@@ -862,28 +1635,320 @@ typedef struct {
  */
 GESTIC_API int CDECL gestic_data_stream_update(gestic_t *gestic, int *skipped);
 
-#endif
-
-/* ======== Section: Real time control (RTC) ======== */
-
-#ifndef GESTIC_NO_FW_VERSION
-
-/* Function: gestic_query_fw_version
- *
- * Reads the library version information.
+/* Function: gestic_data_sample
  *
- * version  - Pointer to a buffer receiving the version string
- * v_length - Maximal length of version in bytes including the terminating 0.
- * timeout  - Timeout in milliseconds to wait for a response
+ * Requests a single data output from the device and updates the result
+ * buffer with it.
  *
- * Note:
- *    The complete firmware-version-string has a maximum size of 120
- *    characters.
+ * mask    - Which data to be included in the requested message as a
+ *           combination of <gestic_data_mask_t>-values
+ * timeout - Timeout in milliseconds to wait for the acknowledgement and
+ *           again for the requested message
  *
  * Returns 0 on success or a negative value when the request failed.
+ * <GESTIC_MSG_MISSING_ERROR> is returned if the request was acknowledged but
+ * no data output containing all of mask was received.
  *
- * After a failure or no response within the timeout the request gets resend
- * up to three times.
+ * The request is done via <gestic_param_dataOutputRequestMask> and
+ * therefore does not change the continuous output configured with
+ * <gestic_set_output_enable_mask>. This allows to read e.g. SD data once in
+ * a while without streaming it all the time.
+ *
+ * The fetched data could be accessed with the gestic_get_* functions like
+ * after <gestic_data_stream_update>. Data output that was received but not
+ * yet fetched with <gestic_data_stream_update> is included and counted as
+ * skipped.
+ *
+ * See also:
+ *    <gestic_data_stream_update>, <gestic_set_output_enable_mask>
+ */
+GESTIC_API int CDECL gestic_data_sample(gestic_t *gestic,
+                                        gestic_data_mask_t mask,
+                                        int timeout);
+
+/* Enumeration: gestic_event_type_t
+ *
+ * The classes of events that could be handled with
+ * <gestic_set_event_callback>.
+ *
+ * gestic_event_gesture     - A gesture was recognized.
+ *                            value is the <gestic_gestures_t>, flags are the
+ *                            <gestic_gesture_flags_t>.
+ * gestic_event_touch_start - An electrode started to be touched.
+ *                            value is a single <gestic_touch_flags_t> bit.
+ * gestic_event_touch_end   - An electrode is no longer touched.
+ *                            value is a single <gestic_touch_flags_t> bit.
+ * gestic_event_tap         - An electrode was tapped.
+ *                            value is a single <gestic_tap_flags_t> bit.
+ * gestic_event_double_tap  - An electrode was double tapped.
+ *                            value is a single <gestic_tap_flags_t> bit.
+ * gestic_event_air_wheel   - The AirWheel counter changed.
+ *                            value is the signed change of the counter.
+ * gestic_event_calibration - A calibration was done.
+ *                            value is the <gestic_calib_reason_t>.
+ * gestic_event_recovery    - The watchdog tried to restore a stalled stream.
+ *                            value is the duration of the attempt in
+ *                            milliseconds, flags is 0 on success or the error
+ *                            (see <gestic_set_watchdog>).
+ * gestic_event_count       - Number of event classes
+ */
+typedef enum {
+    gestic_event_gesture,
+    gestic_event_touch_start,
+    gestic_event_touch_end,
+    gestic_event_tap,
+    gestic_event_double_tap,
+    gestic_event_air_wheel,
+    gestic_event_calibration,
+    gestic_event_recovery,
+    gestic_event_count
+} gestic_event_type_t;
+
+/* Structure: gestic_event_t
+ *
+ * Describes a single event as passed to a <gestic_event_callback_t>.
+ *
+ * type          - The class of the event
+ * value         - Event specific value (See <gestic_event_type_t>)
+ * flags         - Event specific flags (See <gestic_event_type_t>)
+ * frame_counter - Count of samples between start-up and the event
+ */
+typedef struct {
+    gestic_event_type_t type;
+    int value;
+    int flags;
+    int frame_counter;
+} gestic_event_t;
+
+/* Typedef: gestic_event_callback_t
+ *
+ * Definition of the signature for event callbacks.
+ *
+ * opaque - The opaque pointer provided with <gestic_set_event_callback>
+ * event  - The event that occured
+ *
+ * See also:
+ *    <gestic_set_event_callback>
+ */
+typedef void (CDECL* gestic_event_callback_t)(void *opaque,
+                                              const gestic_event_t *event);
+
+/* Function: gestic_set_event_callback
+ *
+ * Sets the function that is called for each event of a class.
+ *
+ * type     - The class of events to be handled
+ * callback - The function to call or NULL to remove the callback
+ * opaque   - An opaque pointer that is provided on calls of callback as the
+ *            first argument
+ *
+ * Returns 0 on success or <GESTIC_BAD_PARAM_ERROR> for an unknown type.
+ *
+ * The callbacks are called while the Sensor_Data_Output message is decoded
+ * and only for actual changes, e.g. once when a touch starts instead of
+ * on every frame while it lasts. Therefore they are called from within
+ * <gestic_data_stream_update> or any other function receiving messages.
+ * With threaded message handling they are called from the thread receiving
+ * the messages.
+ *
+ * Callbacks are not allowed to call functions that communicate with the
+ * device.
+ *
+ * The events are only detected for data included in the data output (see
+ * <gestic_set_output_enable_mask>).
+ */
+GESTIC_API int CDECL gestic_set_event_callback(gestic_t *gestic,
+                                               gestic_event_type_t type,
+                                               gestic_event_callback_t callback,
+                                               void *opaque);
+
+#endif
+
+/* ======== Section: Sensor Logging ======== */
+
+#if !defined(GESTIC_NO_SENSORLOG) && !defined(GESTIC_NO_DATA_RETRIEVAL) && \
+    !defined(GESTIC_NO_CRC32) && (defined(_WIN32) || defined(__linux__))
+#   define GESTIC_HAS_SENSORLOG
+#endif
+
+#ifdef GESTIC_HAS_SENSORLOG
+
+/* Constant: GESTIC_SENSORLOG_BLOCK
+ *
+ * Default count of frames per block of a sensor log.
+ */
+#ifndef GESTIC_SENSORLOG_BLOCK
+#define GESTIC_SENSORLOG_BLOCK 1024
+#endif
+
+/* Struct: gestic_sensorlog_header_t
+ *
+ * Header at the start of a sensor log as written by <gestic_sensorlog_create>.
+ * All values are stored in host byte order.
+ *
+ * magic        - "GLOG"
+ * version      - Version of the format, currently 1
+ * header_size  - sizeof(gestic_sensorlog_header_t)
+ * block_frames - Maximum count of frames per block
+ * mask         - The <gestic_data_mask_t> of the logged data
+ *
+ * The header is followed by blocks that start with a
+ * <gestic_sensorlog_block_t>. Each block is decoded on its own, so a damaged
+ * block only loses its own frames.
+ *
+ * Within a block each integer field is predicted from its previous two values
+ * and only the difference to the prediction is stored as zig-zag varint.
+ * A bitmap in front of the frame marks the fields with a difference, so
+ * counters that advance by the frame and unchanged values take one bit.
+ * Floats are XOR-ed with their previous value. A 4-bit code per float tells
+ * how many leading and trailing zero bytes of the result are omitted.
+ */
+typedef struct {
+    char magic[4];
+    unsigned short version;
+    unsigned short header_size;
+    unsigned int block_frames;
+    unsigned int mask;
+} gestic_sensorlog_header_t;
+
+/* Struct: gestic_sensorlog_block_t
+ *
+ * Header of a block of frames in a sensor log.
+ *
+ * magic - "GBLK"
+ * size  - Size of the encoded frames following the header in bytes
+ * count - Number of frames
+ * crc   - <gestic_crc32> of the encoded frames
+ */
+typedef struct {
+    char magic[4];
+    unsigned int size;
+    unsigned int count;
+    unsigned int crc;
+} gestic_sensorlog_block_t;
+
+/* Struct: gestic_sensorlog_stats_t
+ *
+ * frames    - Frames written or read
+ * blocks    - Blocks written or read
+ * bytes     - Size of the file so far
+ * raw_bytes - Size of the logged fields as plain 32-bit values
+ */
+typedef struct {
+    unsigned int frames;
+    unsigned int blocks;
+    unsigned long long bytes;
+    unsigned long long raw_bytes;
+} gestic_sensorlog_stats_t;
+
+/* Typedef: gestic_sensorlog_t
+ *
+ * An open sensor log, either for writing or for reading.
+ */
+typedef struct gestic_sensorlog_struct gestic_sensorlog_t;
+
+/* Function: gestic_sensorlog_create
+ *
+ * Creates a sensor log that stores <gestic_input_data_t> compressed.
+ *
+ * path         - The file to write, an existing file is replaced
+ * mask         - The data to be logged as a combination of
+ *                <gestic_data_mask_t>-values
+ * block_frames - Frames per block or 0 for <GESTIC_SENSORLOG_BLOCK>
+ * log          - Receives the ptr to the log
+ *
+ * Returns 0 on success, <GESTIC_IO_OPEN_ERROR> if the file could not be
+ * created, <GESTIC_BAD_PARAM_ERROR> or <GESTIC_IO_ERROR>.
+ *
+ * The frame_counter is always logged. Fields not included in mask read back
+ * as 0.
+ *
+ * See also:
+ *    <gestic_sensorlog_header_t>, <gestic_sensorlog_write>,
+ *    <gestic_sensorlog_close>
+ */
+GESTIC_API int CDECL gestic_sensorlog_create(const char *path,
+                                             gestic_data_mask_t mask,
+                                             int block_frames,
+                                             gestic_sensorlog_t **log);
+
+/* Function: gestic_sensorlog_write
+ *
+ * Appends a frame to a log created with <gestic_sensorlog_create>.
+ *
+ * data - The frame, typically gestic->result after
+ *        <gestic_data_stream_update>
+ *
+ * Returns 0 on success or <GESTIC_IO_ERROR> if a block could not be written.
+ *
+ * Frames are collected in memory and written a block at a time. The last
+ * block is written by <gestic_sensorlog_close>.
+ */
+GESTIC_API int CDECL gestic_sensorlog_write(gestic_sensorlog_t *log,
+                                            const gestic_input_data_t *data);
+
+/* Function: gestic_sensorlog_open
+ *
+ * Opens a sensor log for reading.
+ *
+ * path - The file to read
+ * log  - Receives the ptr to the log
+ *
+ * Returns 0 on success, <GESTIC_IO_OPEN_ERROR> if the file could not be
+ * opened or <GESTIC_BAD_PARAM_ERROR> if it is no sensor log.
+ *
+ * See also:
+ *    <gestic_sensorlog_read>, <gestic_sensorlog_close>
+ */
+GESTIC_API int CDECL gestic_sensorlog_open(const char *path,
+                                           gestic_sensorlog_t **log);
+
+/* Function: gestic_sensorlog_read
+ *
+ * Reads the next frame of a log opened with <gestic_sensorlog_open>.
+ *
+ * data - Receives the frame
+ *
+ * Returns 0 on success, <GESTIC_NO_DATA> at the end of the log or
+ * <GESTIC_IO_ERROR> if a block is damaged. Reading continues with the next
+ * block after such an error.
+ */
+GESTIC_API int CDECL gestic_sensorlog_read(gestic_sensorlog_t *log,
+                                           gestic_input_data_t *data);
+
+/* Function: gestic_sensorlog_close
+ *
+ * Writes the outstanding frames of a log and closes it.
+ *
+ * stats - Optional ptr receiving statistics of the log
+ *
+ * Returns 0 on success or <GESTIC_IO_ERROR> if a write failed.
+ */
+GESTIC_API int CDECL gestic_sensorlog_close(gestic_sensorlog_t *log,
+                                            gestic_sensorlog_stats_t *stats);
+
+#endif
+
+/* ======== Section: Real time control (RTC) ======== */
+
+#ifndef GESTIC_NO_FW_VERSION
+
+/* Function: gestic_query_fw_version
+ *
+ * Reads the library version information.
+ *
+ * version  - Pointer to a buffer receiving the version string
+ * v_length - Maximal length of version in bytes including the terminating 0.
+ * timeout  - Timeout in milliseconds to wait for a response
+ *
+ * Note:
+ *    The complete firmware-version-string has a maximum size of 120
+ *    characters.
+ *
+ * Returns 0 on success or a negative value when the request failed.
+ *
+ * After a failure or no response within the timeout the request gets resend
+ * up to three times.
  */
 GESTIC_API int CDECL gestic_query_fw_version(gestic_t *gestic,
                                              char *version,
@@ -944,6 +2009,180 @@ GESTIC_API int CDECL gestic_get_output_enable_mask(gestic_t *gestic,
                                                    gestic_data_mask_t *locked,
                                                    int timeout);
 
+/* Function: gestic_set_auto_output_mask
+ *
+ * Derives the data output of the GestIC device from the data that is
+ * actually used by the application.
+ *
+ * enabled - Boolean value whether the automatic output mask is enabled
+ * locked  - Which of the used data have to be always included in the
+ *           message even when they have no valid data.
+ * timeout - Timeout in milliseconds to wait for a response when the
+ *           output mask gets changed
+ *
+ * Returns 0 on success or a negative value when the request failed.
+ *
+ * While enabled the output mask only contains the data that was marked as
+ * used. The gestic_get_* functions of the dynamic API mark the data they
+ * return as used. Otherwise <gestic_data_mask_use> has to be called.
+ * Enabling sends the output mask of the used data right away, later changes
+ * are sent by the next call to <gestic_data_stream_update>. As long as no
+ * data is marked as used the output mask of the device is left as it is.
+ *
+ * Disabling the automatic output mask leaves the last output mask
+ * configured in the device.
+ *
+ * See also:
+ *    <gestic_data_mask_use>, <gestic_data_mask_release>,
+ *    <gestic_set_output_enable_mask>
+ */
+GESTIC_API int CDECL gestic_set_auto_output_mask(gestic_t *gestic,
+                                                 int enabled,
+                                                 gestic_data_mask_t locked,
+                                                 int timeout);
+
+/* Function: gestic_data_mask_use
+ *
+ * Marks data as used by the application.
+ *
+ * mask - The used data as a combination of <gestic_data_mask_t>-values
+ *
+ * With <gestic_set_auto_output_mask> enabled the output mask gets widened
+ * on the next call to <gestic_data_stream_update>.
+ *
+ * See also:
+ *    <gestic_set_auto_output_mask>, <gestic_data_mask_release>
+ */
+GESTIC_API void CDECL gestic_data_mask_use(gestic_t *gestic,
+                                           gestic_data_mask_t mask);
+
+/* Function: gestic_data_mask_release
+ *
+ * Marks data as no longer used by the application.
+ *
+ * mask - The released data as a combination of <gestic_data_mask_t>-values
+ *
+ * With <gestic_set_auto_output_mask> enabled the output mask gets narrowed
+ * on the next call to <gestic_data_stream_update>. Calling the according
+ * gestic_get_* function afterwards marks the data as used again.
+ *
+ * See also:
+ *    <gestic_set_auto_output_mask>, <gestic_data_mask_use>
+ */
+GESTIC_API void CDECL gestic_data_mask_release(gestic_t *gestic,
+                                               gestic_data_mask_t mask);
+
+/* Function: gestic_set_presence_policy
+ *
+ * Reduces the data output while no hand is near the sensor.
+ *
+ * idle_frames  - Number of frames without presence after which the output
+ *                gets reduced. A value of 0 disables the policy.
+ * idle_mask    - The output mask while idle as a combination of
+ *                <gestic_data_mask_t>-values
+ * sd_threshold - Signal deviation of any channel above which a hand is
+ *                considered present. A value of 0 disables this check.
+ * timeout      - Timeout in milliseconds to wait for a response when the
+ *                output mask gets changed
+ *
+ * Returns 0 on success or a negative value when the request failed.
+ *
+ * A hand is considered present while the position is valid, while any
+ * electrode is touched or while the signal deviation exceeds sd_threshold.
+ * The latter two checks require touch or SD data in the idle_mask.
+ *
+ * Once the policy switched to the idle_mask the previous output mask is
+ * restored by the call to <gestic_data_stream_update> that receives the
+ * first frame with presence. Therefore the full output is available again
+ * with the following frame. While idle single frames with other content
+ * could still be fetched with <gestic_data_sample>.
+ *
+ * Disabling the policy restores the previous output mask when idle.
+ *
+ * See also:
+ *    <gestic_presence_idle>, <gestic_set_output_enable_mask>,
+ *    <gestic_set_auto_output_mask>
+ */
+GESTIC_API int CDECL gestic_set_presence_policy(gestic_t *gestic,
+                                                int idle_frames,
+                                                gestic_data_mask_t idle_mask,
+                                                float sd_threshold,
+                                                int timeout);
+
+/* Function: gestic_presence_idle
+ *
+ * Returns whether <gestic_set_presence_policy> currently reduced the
+ * output because no hand is present.
+ */
+GESTIC_API int CDECL gestic_presence_idle(gestic_t *gestic);
+
+#ifndef GESTIC_NO_WATCHDOG
+
+/* Struct: gestic_watchdog_stats_t
+ *
+ * Statistics of <gestic_set_watchdog>.
+ *
+ * stalls        - Count of detected stalls of the data output
+ * recoveries    - Count of successful recovery attempts
+ * failures      - Count of failed recovery attempts
+ * last_recovery - Duration of the last successful attempt in milliseconds,
+ *                 from the reset until the parameters were restored
+ * last_downtime - Milliseconds between the last frame before and the first
+ *                 frame after the last stall
+ * max_downtime  - Longest downtime so far in milliseconds
+ */
+typedef struct {
+    int stalls;
+    int recoveries;
+    int failures;
+    int last_recovery;
+    int last_downtime;
+    int max_downtime;
+} gestic_watchdog_stats_t;
+
+/* Function: gestic_set_watchdog
+ *
+ * Restores the device when its data output stalled.
+ *
+ * frames  - Number of frame periods (5 ms each) without Sensor_Data_Output
+ *           after which the device is considered stalled. A value of 0
+ *           disables the watchdog.
+ * timeout - Timeout in milliseconds for the reset and each restored parameter
+ *
+ * Returns 0 on success or <GESTIC_NO_IMPLEMENTATION_ERROR> if the platform
+ * provides no clock.
+ *
+ * The watchdog is checked by <gestic_data_stream_update>. On a stall it
+ * resets the device, waits until it is ready and sets every runtime
+ * parameter that was successfully set with <gestic_set_param> since
+ * <gestic_initialize> again, including the output masks. A failed attempt is
+ * repeated after another period of frames. Each attempt is reported as
+ * <gestic_event_recovery>.
+ *
+ * The watchdog requires a continuous data output, it must not be enabled
+ * while the output is disabled or only single frames are requested with
+ * <gestic_data_sample>.
+ *
+ * See also:
+ *    <gestic_get_watchdog_stats>, <gestic_reset_and_wait>
+ */
+GESTIC_API int CDECL gestic_set_watchdog(gestic_t *gestic, int frames,
+                                         int timeout);
+
+/* Function: gestic_get_watchdog_stats
+ *
+ * Retrieves the statistics of the watchdog.
+ *
+ * stats - Pointer where to store the statistics
+ *
+ * See also:
+ *    <gestic_set_watchdog>
+ */
+GESTIC_API void CDECL gestic_get_watchdog_stats(gestic_t *gestic,
+                                                gestic_watchdog_stats_t *stats);
+
+#endif
+
 #endif
 
 #ifndef GESTIC_NO_RTC
@@ -1239,6 +2478,143 @@ GESTIC_API int CDECL gestic_make_persistent(gestic_t *gestic,
 
 #endif
 
+/* ======== Section: Configuration Profiles ======== */
+
+#ifndef GESTIC_NO_PROFILE
+
+#ifndef GESTIC_PROFILE_CAPACITY
+#define GESTIC_PROFILE_CAPACITY 32
+#endif
+
+/* Struct: gestic_profile_param_t
+ *
+ * A runtime parameter as set by <gestic_set_param>.
+ */
+typedef struct {
+    unsigned short param;
+    unsigned int arg0;
+    unsigned int arg1;
+} gestic_profile_param_t;
+
+/* Struct: gestic_profile_t
+ *
+ * A set of runtime parameters that brings the device to a known
+ * configuration.
+ *
+ * count  - Number of valid entries in params
+ * params - The runtime parameters
+ *
+ * See also:
+ *    <gestic_profile_parse>, <gestic_profile_apply>
+ */
+typedef struct {
+    int count;
+    gestic_profile_param_t params[GESTIC_PROFILE_CAPACITY];
+} gestic_profile_t;
+
+/* Struct: gestic_profile_report_t
+ *
+ * Outcome of <gestic_profile_apply>.
+ *
+ * params  - Number of parameters in the profile
+ * read    - Number of parameters that had to be read back from the device
+ * changed - Number of parameters that differed and were sent
+ * failed  - Number of parameters that could not be set
+ * time    - Milliseconds until the device was configured or 0 when no
+ *           clock is available on the platform
+ */
+typedef struct {
+    int params;
+    int read;
+    int changed;
+    int failed;
+    int time;
+} gestic_profile_report_t;
+
+/* Function: gestic_profile_init
+ *
+ * Initializes an empty profile.
+ */
+GESTIC_API void CDECL gestic_profile_init(gestic_profile_t *profile);
+
+/* Function: gestic_profile_add
+ *
+ * Adds a runtime parameter to the profile.
+ *
+ * param - The code for the parameter
+ * arg0  - First parameter specific argument
+ * arg1  - Second parameter specific argument
+ *
+ * Returns 0 on success or <GESTIC_BAD_PARAM_ERROR> when the profile is full.
+ *
+ * When the parameter is already part of the profile the entries are merged.
+ * For parameters where arg1 selects the bits of arg0 to be changed the
+ * selected bits get combined, otherwise the new arguments replace the old
+ * ones.
+ */
+GESTIC_API int CDECL gestic_profile_add(gestic_profile_t *profile,
+                                        unsigned short param,
+                                        unsigned int arg0,
+                                        unsigned int arg1);
+
+/* Function: gestic_profile_parse
+ *
+ * Adds the runtime parameters described by a text to the profile.
+ *
+ * text - The content of a Library.settings file or of a parameter list
+ * size - The size of text in bytes
+ *
+ * Returns 0 on success, <GESTIC_BAD_PARAM_ERROR> when text is malformed or
+ * the profile is full.
+ *
+ * Texts starting with '{' are parsed as Library.settings as contained in
+ * .enz-files. The following settings have a runtime parameter and are
+ * added to the profile while the others are part of the library itself:
+ *
+ *    Afe.SignalMatching.<i>            - <gestic_param_afeRxAtt_S> + i
+ *    Afe.ChannelMapping.<i>            - <gestic_param_channelmapping_S> + i
+ *    ApproachDetection.EnableOnStartup - <gestic_param_dspApproachDetectionMode>
+ *    Gestures.Enabled.<id>             - <gestic_param_dspGestureMask>
+ *
+ * Other texts are parsed as parameter list with one parameter per line
+ * consisting of the parameter code, arg0 and arg1 separated by whitespace.
+ * Numbers could be given in decimal or with prefix 0x in hexadecimal.
+ * Everything following a '#' is ignored.
+ *
+ * See also:
+ *    <gestic_profile_apply>
+ */
+GESTIC_API int CDECL gestic_profile_parse(gestic_profile_t *profile,
+                                          const char *text,
+                                          int size);
+
+/* Function: gestic_profile_apply
+ *
+ * Brings the device to the configuration described by the profile.
+ *
+ * profile - The profile to apply
+ * report  - Optional pointer that receives statistics about the update
+ * timeout - Timeout in milliseconds to wait for each response
+ *
+ * Returns 0 when all parameters of the profile are set or the negative
+ * error code of the first parameter that could not be set.
+ *
+ * Parameters that are not known from the parameter cache are read back from
+ * the device first. Then only the parameters that differ from the values
+ * of the device are sent. Both steps are done with <gestic_send_pipelined>
+ * so that only a few round trips are needed. Parameters that were not
+ * acknowledged are resent with <gestic_set_param>.
+ *
+ * See also:
+ *    <gestic_profile_parse>, <gestic_param_cache_bypass>
+ */
+GESTIC_API int CDECL gestic_profile_apply(gestic_t *gestic,
+                                          const gestic_profile_t *profile,
+                                          gestic_profile_report_t *report,
+                                          int timeout);
+
+#endif
+
 /* ======== Section: Flashing Firmware Libraries ======== */
 
 #ifndef GESTIC_NO_FLASH
@@ -1451,6 +2827,241 @@ GESTIC_API int CDECL gestic_flash_image(gestic_t *gestic,
                                         gestic_UpdateFunction_t mode,
                                         int timeout);
 
+/* Function: gestic_flash_verify
+ *
+ * Checks whether the flash of the device already contains an image.
+ *
+ * session_id - A random session-id. Can be any value except 0.
+ * image      - Ptr to a <gestic_flash_image_t>-structure containing the image.
+ * matches    - Receives 1 when the device confirmed every record, otherwise 0
+ * timeout    - Timeout in milliseconds to wait for a response
+ *
+ * Returns 0 when the verification could be run or a negative value when
+ * the communication failed.
+ *
+ * Runs a whole <gestic_UpdateFunction_VerifyOnly> session over the records,
+ * pipelined like <gestic_flash_image>. The session is aborted at the first
+ * <gestic_system_ContentMismatch>.
+ *
+ * Either way the session ends with a <gestic_UpdateFunction_Restart> like
+ * <gestic_flash_end>, so the device runs its firmware again afterwards.
+ *
+ * See also:
+ *    <Firmware Version and Update>, <gestic_flash_update>
+ */
+GESTIC_API int CDECL gestic_flash_verify(gestic_t *gestic,
+                                         unsigned int session_id,
+                                         gestic_flash_image_t *image,
+                                         int *matches,
+                                         int timeout);
+
+/* Enumeration: gestic_flash_outcome_t
+ *
+ * What <gestic_flash_update> did.
+ *
+ * gestic_flash_up_to_date - The running firmware reported the version of the
+ *                           image, nothing was sent
+ * gestic_flash_verified   - The flash already contained the image
+ * gestic_flash_programmed - The image was written to the flash
+ */
+typedef enum {
+    gestic_flash_up_to_date = 0,
+    gestic_flash_verified = 1,
+    gestic_flash_programmed = 2
+} gestic_flash_outcome_t;
+
+/* Structure: gestic_flash_update_result_t
+ *
+ * Outcome and duration of the phases of <gestic_flash_update>.
+ *
+ * outcome      - The <gestic_flash_outcome_t>
+ * version_time - Milliseconds spent comparing the running version
+ * verify_time  - Milliseconds spent in the verification session
+ * program_time - Milliseconds spent programming the image
+ *
+ * The times are 0 for phases that did not run or on platforms without
+ * GESTIC_TIME_MS.
+ */
+typedef struct {
+    gestic_flash_outcome_t outcome;
+    int version_time;
+    int verify_time;
+    int program_time;
+} gestic_flash_update_result_t;
+
+/* Function: gestic_flash_update
+ *
+ * Flashes an image only if the device does not contain it already.
+ *
+ * session_id - A random session-id. Can be any value except 0.
+ * image      - Ptr to a <gestic_flash_image_t>-structure containing the image.
+ * result     - Optional ptr receiving the outcome and the time of each phase
+ * timeout    - Timeout in milliseconds to wait for a response
+ *
+ * Returns 0 on success or a negative value when the request failed.
+ *
+ * Skips everything when <gestic_query_fw_version> reports the version of the
+ * image. Otherwise the records are checked with <gestic_flash_verify> and
+ * only written with <gestic_flash_image> when they differ.
+ *
+ * Note:
+ *    Only use it for library images. The running version is the one of the
+ *    library and loader images are staged in the flash area of the library,
+ *    so they do not verify anymore once a library was written.
+ *
+ * See also:
+ *    <Firmware Version and Update>, <gestic_flash_verify>,
+ *    <gestic_flash_image>
+ */
+GESTIC_API int CDECL gestic_flash_update(gestic_t *gestic,
+                                         unsigned int session_id,
+                                         gestic_flash_image_t *image,
+                                         gestic_flash_update_result_t *result,
+                                         int timeout);
+
+/* Function: gestic_set_flash_window
+ *
+ * Sets how many records <gestic_flash_image> sends before waiting for
+ * their responses.
+ *
+ * window - The maximum count of Fw_Update_Block messages in flight.
+ *          1 (the default) waits for the response to each record.
+ *
+ * Most of the time for flashing is spent waiting for the responses.
+ * With a window bigger than 1 the records are sent with
+ * <gestic_send_pipelined> and the responses are matched by their order.
+ * When the device rejects a record or stops responding, the image is
+ * continued one record at a time from the first record that was not
+ * acknowledged, with the retries of <gestic_flash_write>.
+ *
+ * Note:
+ *    Records are prepared in batches of GESTIC_FLASH_BATCH (32), so bigger
+ *    windows have no effect.
+ *
+ * See also:
+ *    <Firmware Version and Update>, <gestic_flash_image>,
+ *    <gestic_send_pipelined>
+ */
+GESTIC_API void CDECL gestic_set_flash_window(gestic_t *gestic, int window);
+
+/* Typedef: gestic_flash_progress_t
+ *
+ * Callback for the progress of flashing an image.
+ *
+ * opaque - The opaque pointer provided to <gestic_set_flash_progress>
+ * done   - Count of records of the image acknowledged by the device
+ * total  - Count of records of the image
+ *
+ * It is called with done = 0 when a session was started and once for every
+ * acknowledged record.
+ *
+ * See also:
+ *    <gestic_set_flash_progress>
+ */
+typedef void (CDECL* gestic_flash_progress_t)(void *opaque,
+                                              int done,
+                                              int total);
+
+/* Function: gestic_set_flash_progress
+ *
+ * Sets the callback for the progress of <gestic_flash_image> and
+ * <gestic_flash_resume>.
+ *
+ * callback - The callback or 0 to disable it
+ * opaque   - An opaque pointer that is provided on calls of callback as
+ *            the first argument
+ *
+ * See also:
+ *    <gestic_flash_progress_t>, <gestic_flash_image>
+ */
+GESTIC_API void CDECL gestic_set_flash_progress(gestic_t *gestic,
+                                                gestic_flash_progress_t callback,
+                                                void *opaque);
+
+/* Structure: gestic_flash_journal_t
+ *
+ * State of a flash session for resuming it with <gestic_flash_resume>.
+ *
+ * image_hash - <gestic_flash_image_hash> of the image being flashed
+ * session_id - The id of the session
+ * acked      - Count of records acknowledged by the device
+ *
+ * A journal filled with zeros starts a new session.
+ *
+ * See also:
+ *    <gestic_flash_resume>
+ */
+typedef struct {
+    unsigned int image_hash;
+    unsigned int session_id;
+    int acked;
+} gestic_flash_journal_t;
+
+/* Function: gestic_flash_image_hash
+ *
+ * Returns a CRC-32 over the content of the image.
+ *
+ * See also:
+ *    <gestic_flash_journal_t>, <gestic_crc32>
+ */
+GESTIC_API unsigned int CDECL gestic_flash_image_hash(const gestic_flash_image_t *image);
+
+/* Function: gestic_flash_resume
+ *
+ * Flashes an image like <gestic_flash_image> but continues an interrupted
+ * session where possible.
+ *
+ * image    - Ptr to a <gestic_flash_image_t>-structure containing the image.
+ * mode     - The mode for the session
+ * journal  - State of the last session, updated with every record
+ * attempts - How often the session is started from scratch at most
+ * timeout  - Timeout in milliseconds to wait for a response
+ *
+ * Returns 0 on success or a negative value when all attempts failed.
+ *
+ * When the journal belongs to the same image and has records left, those
+ * are sent within the session of the journal without resetting the device.
+ * If the loader does not accept them, e.g. because the device was reset in
+ * between, or any later step fails, a new session is started after a
+ * backoff of 100 ms that doubles with every attempt up to 1.6 s.
+ *
+ * The journal is updated before the progress callback gets called, so that
+ * the callback may store it.
+ *
+ * See also:
+ *    <Firmware Version and Update>, <gestic_flash_image>,
+ *    <gestic_flash_resume_file>
+ */
+GESTIC_API int CDECL gestic_flash_resume(gestic_t *gestic,
+                                         gestic_flash_image_t *image,
+                                         gestic_UpdateFunction_t mode,
+                                         gestic_flash_journal_t *journal,
+                                         int attempts,
+                                         int timeout);
+
+#ifdef __linux__
+
+/* Function: gestic_flash_resume_file
+ *
+ * Runs <gestic_flash_resume> with the journal stored in a file.
+ *
+ * path - The journal file. A missing or foreign file starts a new session.
+ *
+ * The file is written after every acknowledged record and removed when
+ * flashing succeeded.
+ *
+ * See also:
+ *    <gestic_flash_resume>
+ */
+GESTIC_API int CDECL gestic_flash_resume_file(gestic_t *gestic,
+                                              gestic_flash_image_t *image,
+                                              gestic_UpdateFunction_t mode,
+                                              const char *path,
+                                              int attempts,
+                                              int timeout);
+
+#endif
+
 /* Function: gestic_flash_wait_loader_updated
  *
  * Waits until loader update is finished.
@@ -1505,6 +3116,43 @@ GESTIC_API int CDECL gestic_flash_wait_loader_updated(gestic_t *gestic,
  */
 GESTIC_API int CDECL gestic_wait_for_version_info(gestic_t *gestic,
                                                   int timeout);
+
+#if defined(_WIN32) || defined(__linux__)
+/* Function: gestic_load_enz
+ *
+ * Loads a firmware image straight from an .enz archive as released by
+ * Microchip.
+ *
+ * path  - Path of the .enz archive
+ * name  - Name of the image within the archive, either "Loader.enc" or
+ *         "Library.enc"
+ * image - Receives the ptr to the loaded image
+ *
+ * Returns 0 on success or a negative error-code.
+ * Fails with GESTIC_BAD_IMAGE_ERROR if the archive does not contain the
+ * image, if a record fails its checksum or if the record addresses and
+ * lengths do not describe the flash of the device.
+ * Fails with GESTIC_NO_IMPLEMENTATION_ERROR if the image is compressed but
+ * the library was built without GESTIC_HAS_ZLIB.
+ * Fails with GESTIC_BAD_PARAM_ERROR if name is longer than 256 characters.
+ *
+ * The image is read and inflated in chunks without extracting the archive.
+ * On success the image has to be released with <gestic_free_flash_image>.
+ *
+ * See also:
+ *    <Firmware Version and Update>, <gestic_flash_image>
+ */
+GESTIC_API int CDECL gestic_load_enz(const char *path, const char *name,
+                                     gestic_flash_image_t **image);
+
+/* Function: gestic_free_flash_image
+ *
+ * Releases an image that was loaded with <gestic_load_enz>.
+ *
+ * image - Ptr to the image
+ */
+GESTIC_API void CDECL gestic_free_flash_image(gestic_flash_image_t *image);
+#endif
 #endif
 
 /* Include the dynamic API that has to be used when accessing
@@ -62,22 +62,176 @@ typedef struct {
     int received;
 } gestic_version_request_t;
 
+/* ======== Pipelined Messages ======== */
+
+typedef struct {
+    int msg_id;
+    /* Number of messages in the batch and written so far */
+    int count;
+    volatile int sent;
+    /* Number of responses received so far */
+    int acked;
+    int failed;
+    int *errors;
+} gestic_pipeline_t;
+
+/* ======== Response Times ======== */
+
+#ifndef GESTIC_NO_ADAPTIVE_TIMEOUT
+
+/* Count of message types whose response times are tracked */
+#ifndef GESTIC_RTT_TYPES
+#define GESTIC_RTT_TYPES 8
+#endif
+
+#define GESTIC_TIMEOUT_FLOOR 10
+#define GESTIC_TIMEOUT_CEILING 1000
+
+typedef struct {
+    /* Limits set with <gestic_set_timeout_limits> */
+    int floor;
+    int ceiling;
+    gestic_rtt_stats_t stats[GESTIC_RTT_TYPES];
+} gestic_rtt_t;
+
+#endif
+
+/* ======== Runtime Parameter Cache ======== */
+
+#ifndef GESTIC_NO_PARAM_CACHE
+
+#ifndef GESTIC_PARAM_CACHE_SIZE
+#define GESTIC_PARAM_CACHE_SIZE 16
+#endif
+
+typedef struct {
+    /* Zero for unused entries */
+    unsigned short param;
+    /* Bits of arg0 whose state in the device is known */
+    unsigned int known;
+    unsigned int arg0;
+    unsigned int arg1;
+    /* Whether arg0 and arg1 were read back from the device */
+    int complete;
+} gestic_param_entry_t;
+
+typedef struct {
+    int bypass;
+    /* Entry to be replaced next when the cache is full */
+    int next;
+    gestic_param_entry_t entries[GESTIC_PARAM_CACHE_SIZE];
+} gestic_param_cache_t;
+
+#endif
+
 /* ======== Structure containing retrieved GestIC data ======== */
 
 #ifndef GESTIC_NO_DATA_RETRIEVAL
 
+/* gestic_input_data_t is declared in gestic_api.h for <gestic_sensorlog_read> */
+
+typedef struct {
+    gestic_data_mask_t mask;
+    int received;
+} gestic_data_request_t;
+
+/* ======== Data Output Configuration ======== */
+
+typedef struct {
+    /* Output mask as last configured in the device */
+    gestic_data_mask_t enabled;
+    gestic_data_mask_t locked;
+    /* State of <gestic_set_auto_output_mask> */
+    int auto_mask;
+    int timeout;
+    gestic_data_mask_t auto_locked;
+    gestic_data_mask_t used;
+    gestic_data_mask_t requested;
+} gestic_output_t;
+
+/* ======== Event Callbacks ======== */
+
+typedef struct {
+    gestic_event_callback_t callback;
+    void *opaque;
+} gestic_event_handler_t;
+
+/* Upper bound of events per Sensor_Data_Output message */
+#define GESTIC_MAX_FRAME_EVENTS 24
+
+/* ======== Presence Policy ======== */
+
+typedef struct {
+    /* Configuration of <gestic_set_presence_policy> */
+    int idle_frames;
+    gestic_data_mask_t idle_mask;
+    float sd_threshold;
+    int timeout;
+    /* Frame counter of the last frame with presence */
+    int last_seen;
+    int idle;
+    /* Output mask to be restored on presence */
+    gestic_data_mask_t enabled;
+    gestic_data_mask_t locked;
+} gestic_presence_t;
+
+/* ======== Watchdog ======== */
+
+#ifndef GESTIC_NO_WATCHDOG
+
+/* Duration of one frame of the device in milliseconds */
+#define GESTIC_FRAME_PERIOD 5
+
+/* Count of runtime parameters restored by the watchdog */
+#ifndef GESTIC_WATCHDOG_PARAMS
+#define GESTIC_WATCHDOG_PARAMS 16
+#endif
+
 typedef struct {
-    gestic_signal_t cic;
-    gestic_signal_t sd;
-    gestic_position_t pos;
-    gestic_gesture_t gesture;
-    gestic_calib_t calib;
-    gestic_touch_t touch;
-    gestic_air_wheel_t air_wheel;
-    gestic_freq_t frequency;
-    gestic_noise_power_t noise_power;
-    int frame_counter;
-} gestic_input_data_t;
+    /* Zero for unused entries */
+    unsigned short param;
+    unsigned int arg0;
+    /* Bits of arg0 that were set for masked parameters */
+    unsigned int arg1;
+} gestic_watchdog_param_t;
+
+typedef struct {
+    /* Configuration of <gestic_set_watchdog> */
+    int frames;
+    int timeout;
+    /* Frame counter and time of its last change */
+    int counter;
+    int last_frame;
+    /* Time of the last frame before the current stall */
+    int stalled;
+    int stall_start;
+    gestic_watchdog_stats_t stats;
+    /* Parameters to be restored in the order they were set first */
+    gestic_watchdog_param_t params[GESTIC_WATCHDOG_PARAMS];
+} gestic_watchdog_t;
+
+#endif
+
+#endif
+
+/* ======== Trace Ring ======== */
+
+#ifdef GESTIC_HAS_TRACE
+
+/* Number of entries of the trace ring, has to be a power of 2 */
+#ifndef GESTIC_TRACE_SIZE
+#   ifdef __linux__
+#       define GESTIC_TRACE_SIZE 1024
+#   else
+#       define GESTIC_TRACE_SIZE 64
+#   endif
+#endif
+
+typedef struct {
+    /* Count of entries written so far */
+    unsigned int head;
+    gestic_trace_entry_t entries[GESTIC_TRACE_SIZE];
+} gestic_trace_t;
 
 #endif
 
@@ -94,11 +248,75 @@ typedef struct {
     int state;
     int buffer_cursor;
     int buffer_size;
+    /* Whether the last message ended where the current one starts */
+    int synced;
     unsigned char buffer[GESTIC_INPUT_CAPACITY];
     unsigned char msg[GESTIC_MAX_MESSAGE_SIZE];
 } gestic_msg_extract_t;
 #endif
 
+/* ======== Runtime Selected Backends ======== */
+
+#ifdef GESTIC_HAS_BACKENDS
+
+/* Room for the System_Status messages that acknowledge written messages */
+#define GESTIC_REPLAY_STATUS_CAPACITY (4 * 18)
+
+typedef struct {
+    /* Playback speed in percent, zero for as fast as possible */
+    int speed;
+    /* Time stamp of the last Sensor_Data_Output, negative before the first */
+    int time_stamp;
+    /* Point of time in microseconds when the held message is due */
+    long long due;
+    /* Message that is held back until it is due, including FE FF */
+    int held;
+    unsigned char msg[2 + GESTIC_MAX_MESSAGE_SIZE];
+    /* Data read from the capture but not yet extracted */
+    int input_cursor;
+    int input_size;
+    unsigned char input[256];
+    /* Acknowledgements that are returned before any further data */
+    int status_size;
+    unsigned char status[GESTIC_REPLAY_STATUS_CAPACITY];
+#ifdef GESTIC_HAS_CAPTURE
+    /* Capture files of gestic_start_capture are paced by record times */
+    int capture;
+    unsigned int chunk_left;
+    unsigned long long chunk_time;
+    unsigned long long record_time;
+    unsigned long long start_time;
+    long long start_due;
+#endif
+} gestic_replay_t;
+
+typedef struct {
+    /* Line requests of the GPIO character device */
+    int ts;
+    int mclr;
+    int address;
+    /* Milliseconds a read waits for the device to assert TS */
+    int wait;
+    /* Message read from the device but not yet returned, including FE FF */
+    int cursor;
+    int size;
+    unsigned char msg[2 + GESTIC_MAX_MESSAGE_SIZE];
+} gestic_i2c_t;
+
+typedef struct {
+    int enabled;
+    /* When the last wait found data to be readable, zero otherwise */
+    long long wait_time;
+    /* When the data in the input buffer became readable */
+    long long ready_time;
+    int messages;
+    int min;
+    int max;
+    long long total;
+} gestic_latency_t;
+
+#endif
+
 /* ======== Flashing Libraries ======== */
 
 #ifndef GESTIC_NO_FLASH
@@ -106,8 +324,14 @@ typedef struct {
 typedef struct {
     unsigned int session_id;
     gestic_UpdateFunction_t session_mode;
-    int crc_intialized;
-    unsigned int crc_table[256];
+    int window;
+    /* Records of the current image acknowledged so far */
+    int acked;
+    /* System_Status of the record that failed */
+    int status;
+    gestic_flash_journal_t *journal;
+    gestic_flash_progress_t progress;
+    void *progress_opaque;
 } gestic_flash_t;
 
 #endif
@@ -122,6 +346,13 @@ typedef struct {
 #ifdef GESTIC_USE_MSG_EXTRACT
     gestic_msg_extract_t msg_extract;
 #endif
+#ifdef GESTIC_HAS_BACKENDS
+    /* Backend selected by <gestic_open_uri> */
+    const struct gestic_backend_struct *backend;
+    gestic_replay_t replay;
+    gestic_i2c_t i2c;
+    gestic_latency_t latency;
+#endif
 } gestic_io_t;
 #endif
 
@@ -147,15 +378,33 @@ typedef struct {
 struct gestic_struct {
     volatile int resp_msg_id;
     volatile int resp_error_code;
+    /* Set when the chip announced itself after a reset */
+    volatile int ready;
     gestic_param_request_t * volatile param_request;
     gestic_version_request_t * volatile version_request;
+    gestic_pipeline_t * volatile pipeline;
+#ifndef GESTIC_NO_ADAPTIVE_TIMEOUT
+    gestic_rtt_t rtt;
+#endif
+#ifndef GESTIC_NO_PARAM_CACHE
+    gestic_param_cache_t param_cache;
+#endif
 
 #ifndef GESTIC_NO_DATA_RETRIEVAL
+    gestic_data_request_t * volatile data_request;
     /* Buffer for the result as fetched via <gestic_data_stream_update> */
     gestic_input_data_t result;
     /* Buffer that contains the state after the last received data-frame */
     gestic_input_data_t internal;
     unsigned char last_time_stamp;
+    /* Configuration of the data output */
+    gestic_output_t output;
+    gestic_presence_t presence;
+#ifndef GESTIC_NO_WATCHDOG
+    gestic_watchdog_t watchdog;
+#endif
+    /* Callbacks set with <gestic_set_event_callback> */
+    gestic_event_handler_t events[gestic_event_count];
 #if defined(GESTIC_SYNC_INTERRUPT) || defined(GESTIC_SYNC_THREADING)
     /* Pointer to data required for synchronization (e.g. a mutex) */
     void *io_sync;
@@ -164,8 +413,18 @@ struct gestic_struct {
 
 #ifndef GESTIC_NO_LOGGING
     gestic_logging_t logging;
+#endif
+#ifndef GESTIC_NO_METRICS
+    gestic_metrics_t metrics;
+#endif
+#ifdef GESTIC_HAS_TRACE
+    gestic_trace_t trace;
 #endif
     gestic_io_t io;
+#ifdef GESTIC_HAS_CAPTURE
+    /* State of <gestic_start_capture> while a capture is running */
+    struct gestic_capture_struct *capture;
+#endif
 #ifndef GESTIC_NO_FLASH
     gestic_flash_t flash;
     unsigned char fw_valid;
@@ -114,6 +114,13 @@
 #   endif
 #endif
 
+/* GESTIC_TIME_MS() is optional. Without it durations are reported as 0. */
+
+/* GESTIC_TIME_US(), the GESTIC_ATOMIC_*() macros and the GESTIC_PROBE*()
+ * macros are optional, see impl.h for their fallbacks. GESTIC_SYNC_THREADING
+ * requires the GESTIC_ATOMIC_*() macros.
+ */
+
 /* ======== Logging (not implemented by default). ======== */
 
 #ifndef GESTIC_BAD_DATA
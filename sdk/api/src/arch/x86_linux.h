@@ -111,6 +111,46 @@
 #   define GESTIC_SLEEP(MS) usleep(1000*MS)
 #endif
 
+/* Milliseconds of a monotonic clock, used for measuring durations. The
+ * value wraps around, the math is unsigned as time_t may have 32 bits.
+ */
+#ifndef GESTIC_TIME_MS
+#   include <time.h>
+static __inline int gestic_time_ms(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (int)((unsigned int)now.tv_sec * 1000u +
+                 (unsigned int)(now.tv_nsec / 1000000));
+}
+#   define GESTIC_TIME_MS() gestic_time_ms()
+#endif
+
+/* Counters of the metrics are updated from the thread receiving messages */
+#ifndef GESTIC_ATOMIC_ADD
+#   define GESTIC_ATOMIC_ADD(P, X) __atomic_fetch_add((P), (X), __ATOMIC_RELAXED)
+#   define GESTIC_ATOMIC_LOAD(P) __atomic_load_n((P), __ATOMIC_RELAXED)
+#endif
+
+/* Ordered accesses publishing entries of the trace ring */
+#ifndef GESTIC_ATOMIC_STORE
+#   define GESTIC_ATOMIC_STORE(P, X) __atomic_store_n((P), (X), __ATOMIC_RELEASE)
+#   define GESTIC_ATOMIC_ACQUIRE(P) __atomic_load_n((P), __ATOMIC_ACQUIRE)
+#   define GESTIC_ATOMIC_FENCE_RELEASE() __atomic_thread_fence(__ATOMIC_RELEASE)
+#   define GESTIC_ATOMIC_FENCE_ACQUIRE() __atomic_thread_fence(__ATOMIC_ACQUIRE)
+#endif
+
+/* Microseconds of a monotonic clock, used for measuring response times */
+#ifndef GESTIC_TIME_US
+#   include <time.h>
+static __inline unsigned int gestic_time_us(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (unsigned int)now.tv_sec * 1000000u +
+           (unsigned int)(now.tv_nsec / 1000);
+}
+#   define GESTIC_TIME_US() gestic_time_us()
+#endif
+
 #if defined(GESTIC_SYNC_INTERRUPT)
 #   error "Interrupt-based message handling synchronization not supported for Linux."
 #elif defined(GESTIC_SYNC_THREADING)
@@ -119,6 +159,22 @@
 #   endif
 #endif
 
+/* ======== Tracing ======== */
+
+/* USDT probes for perf and bpftrace if <sys/sdt.h> (systemtap-sdt-dev) is
+ * installed. Each probe is a single nop until a tracer attaches to it, e.g.
+ *
+ *   bpftrace -e 'usdt:./libgestic.so:gestic:command_ack { @[arg0] = hist(arg2); }'
+ */
+#if !defined(GESTIC_PROBE2) && !defined(GESTIC_NO_PROBES) && defined(__has_include)
+#   if __has_include(<sys/sdt.h>)
+#       include <sys/sdt.h>
+#       define GESTIC_HAS_PROBES
+#       define GESTIC_PROBE2(NAME, A, B) DTRACE_PROBE2(gestic, NAME, A, B)
+#       define GESTIC_PROBE4(NAME, A, B, C, D) DTRACE_PROBE4(gestic, NAME, A, B, C, D)
+#   endif
+#endif
+
 /* ======== Logging (not implemented by default). ======== */
 #ifndef GESTIC_BAD_DATA
 #   define GESTIC_BAD_DATA(FUNC, MSG, VALUE) ((void)0)
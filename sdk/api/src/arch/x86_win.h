@@ -111,6 +111,31 @@
 #   define GESTIC_SLEEP(MS) Sleep(MS)
 #endif
 
+/* Milliseconds of a monotonic clock, used for measuring durations */
+#ifndef GESTIC_TIME_MS
+#   define GESTIC_TIME_MS() ((int)GetTickCount())
+#endif
+
+/* Counters of the metrics are updated from the thread receiving messages.
+ * They have 32 or 64 bits.
+ */
+#ifndef GESTIC_ATOMIC_ADD
+#   define GESTIC_ATOMIC_ADD(P, X) (sizeof(*(P)) == 8 ? \
+        (unsigned long long)InterlockedExchangeAdd64((volatile LONGLONG *)(P), (LONGLONG)(X)) : \
+        (unsigned long long)(unsigned int)InterlockedExchangeAdd((volatile LONG *)(P), (LONG)(X)))
+#   define GESTIC_ATOMIC_LOAD(P) (sizeof(*(P)) == 8 ? \
+        (unsigned long long)InterlockedCompareExchange64((volatile LONGLONG *)(P), 0, 0) : \
+        (unsigned long long)*(volatile unsigned int *)(P))
+#endif
+
+/* Ordered accesses publishing entries of the trace ring */
+#ifndef GESTIC_ATOMIC_STORE
+#   define GESTIC_ATOMIC_STORE(P, X) ((void)InterlockedExchange((volatile LONG *)(P), (LONG)(X)))
+#   define GESTIC_ATOMIC_ACQUIRE(P) ((unsigned int)InterlockedCompareExchange((volatile LONG *)(P), 0, 0))
+#   define GESTIC_ATOMIC_FENCE_RELEASE() MemoryBarrier()
+#   define GESTIC_ATOMIC_FENCE_ACQUIRE() MemoryBarrier()
+#endif
+
 #if defined(GESTIC_SYNC_INTERRUPT)
 #   error "Interrupt-based message handling synchronization not supported on Windows."
 #elif defined(GESTIC_SYNC_THREADING)
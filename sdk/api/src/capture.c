@@ -0,0 +1,345 @@
+/******************************************************************************
+ *
+ * Copyright (C) 2014 Microchip Technology Inc. and its
+ *                    subsidiaries ("Microchip").
+ *
+ * All rights reserved.
+ *
+ * You are permitted to use the Aurea software, GestIC API, and other
+ * accompanying software with Microchip products.  Refer to the license
+ * agreement accompanying this software, if any, for additional info regarding
+ * your rights and obligations.
+ *
+ * SOFTWARE AND DOCUMENTATION ARE PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION, ANY WARRANTY OF
+ * MERCHANTABILITY, TITLE, NON-INFRINGEMENT AND FITNESS FOR A PARTICULAR
+ * PURPOSE. IN NO EVENT SHALL MICROCHIP, SMSC, OR ITS LICENSORS BE LIABLE OR
+ * OBLIGATED UNDER CONTRACT, NEGLIGENCE, STRICT LIABILITY, CONTRIBUTION, BREACH
+ * OF WARRANTY, OR OTHER LEGAL EQUITABLE THEORY FOR ANY DIRECT OR INDIRECT
+ * DAMAGES OR EXPENSES INCLUDING BUT NOT LIMITED TO ANY INCIDENTAL, SPECIAL,
+ * INDIRECT OR CONSEQUENTIAL DAMAGES, OR OTHER SIMILAR COSTS.
+ *
+ ******************************************************************************/
+#include "impl.h"
+
+#ifdef GESTIC_HAS_CAPTURE
+
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+/* Chunks in memory, the one being filled and those waiting for the writer */
+#ifndef GESTIC_CAPTURE_BUFFERS
+#define GESTIC_CAPTURE_BUFFERS 4
+#endif
+
+/* Longest time a record waits in memory before it is written */
+#define GESTIC_CAPTURE_FLUSH_MS 1000
+
+/* Size of a record without the message */
+#define GESTIC_CAPTURE_RECORD 6
+
+typedef struct {
+    gestic_capture_chunk_t header;
+    unsigned char data[GESTIC_CAPTURE_CHUNK];
+} gestic_capture_buffer_t;
+
+/* The buffers are used in turn: the writer takes them from tail while
+ * queued of them are complete, the one after those is filled.
+ */
+struct gestic_capture_struct {
+    int fd;
+    int error;
+    int stop;
+    pthread_t thread;
+    pthread_mutex_t lock;
+    pthread_cond_t wake;
+    struct timespec start;
+    int tail;
+    int queued;
+    gestic_capture_index_t *index;
+    int index_capacity;
+    gestic_capture_stats_t stats;
+    gestic_capture_buffer_t buffers[GESTIC_CAPTURE_BUFFERS];
+};
+
+typedef struct gestic_capture_struct gestic_capture_state_t;
+
+static unsigned long long capture_elapsed_us(gestic_capture_state_t *capture)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (unsigned long long)(now.tv_sec - capture->start.tv_sec) * 1000000 +
+           (now.tv_nsec - capture->start.tv_nsec) / 1000;
+}
+
+/* Returns the buffer that is filled or NULL if all are waiting */
+static gestic_capture_buffer_t *capture_current(gestic_capture_state_t *capture)
+{
+    if(capture->queued == GESTIC_CAPTURE_BUFFERS)
+        return 0;
+    return &capture->buffers[(capture->tail + capture->queued) %
+                             GESTIC_CAPTURE_BUFFERS];
+}
+
+/* Hands the buffer that is filled to the writer */
+static void capture_queue(gestic_capture_state_t *capture) {
+    ++capture->queued;
+    pthread_cond_signal(&capture->wake);
+}
+
+static void capture_add(gestic_t *gestic, gestic_capture_state_t *capture,
+                        gestic_capture_direction_t direction,
+                        const void *msg, int size)
+{
+    gestic_capture_buffer_t *buffer;
+    unsigned long long now;
+    unsigned int delta;
+    unsigned char *record;
+
+    pthread_mutex_lock(&capture->lock);
+
+    buffer = capture_current(capture);
+    if(buffer && buffer->header.size + GESTIC_CAPTURE_RECORD + size >
+                 GESTIC_CAPTURE_CHUNK)
+    {
+        capture_queue(capture);
+        buffer = capture_current(capture);
+    }
+    if(!buffer) {
+        ++capture->stats.dropped;
+        pthread_mutex_unlock(&capture->lock);
+        return;
+    }
+
+    now = capture_elapsed_us(capture);
+    if(!buffer->header.count) {
+        buffer->header.time = now;
+#ifndef GESTIC_NO_DATA_RETRIEVAL
+        buffer->header.frame = (unsigned int)gestic->internal.frame_counter;
+#endif
+    }
+    delta = (unsigned int)(now - buffer->header.time);
+
+    record = buffer->data + buffer->header.size;
+    GESTIC_MEMCPY(record, &delta, 4);
+    record[4] = (unsigned char)direction;
+    record[5] = (unsigned char)size;
+    GESTIC_MEMCPY(record + GESTIC_CAPTURE_RECORD, msg, size);
+    buffer->header.size += GESTIC_CAPTURE_RECORD + size;
+    ++buffer->header.count;
+    ++capture->stats.records;
+
+    pthread_mutex_unlock(&capture->lock);
+}
+
+void gestic_capture_add(gestic_t *gestic, gestic_capture_direction_t direction,
+                        const void *msg, int size)
+{
+#ifdef GESTIC_SYNC_THREADING
+    /* gestic_stop_capture clears gestic->capture under the same lock, so
+     * the capture is not freed while the message is added
+     */
+    GESTIC_SYNC_LOCK(gestic->io_sync);
+    if(gestic->capture)
+        capture_add(gestic, gestic->capture, direction, msg, size);
+    GESTIC_SYNC_UNLOCK(gestic->io_sync);
+#else
+    capture_add(gestic, gestic->capture, direction, msg, size);
+#endif
+}
+
+static int capture_write(gestic_capture_state_t *capture, const void *data,
+                         size_t size)
+{
+    const unsigned char *p = (const unsigned char *)data;
+    ssize_t written;
+
+    while(size) {
+        written = write(capture->fd, p, size);
+        if(written < 0)
+            return GESTIC_IO_ERROR;
+        p += written;
+        size -= written;
+        capture->stats.bytes += written;
+    }
+
+    return GESTIC_NO_ERROR;
+}
+
+/* Appends a chunk and remembers it for the index */
+static void capture_write_chunk(gestic_capture_state_t *capture,
+                                gestic_capture_buffer_t *buffer)
+{
+    gestic_capture_index_t *entry;
+    int capacity;
+
+    if(capture->stats.chunks == (unsigned int)capture->index_capacity) {
+        capacity = capture->index_capacity ? capture->index_capacity * 2 : 64;
+        entry = (gestic_capture_index_t *)realloc(capture->index,
+                    capacity * sizeof(gestic_capture_index_t));
+        if(!entry) {
+            capture->error = GESTIC_IO_ERROR;
+            return;
+        }
+        capture->index = entry;
+        capture->index_capacity = capacity;
+    }
+
+    entry = &capture->index[capture->stats.chunks];
+    entry->offset = capture->stats.bytes;
+    entry->time = buffer->header.time;
+    entry->frame = buffer->header.frame;
+    entry->count = buffer->header.count;
+
+    GESTIC_MEMCPY(buffer->header.magic, "GCHK", 4);
+    buffer->header.crc = gestic_crc32(0, buffer->data, buffer->header.size);
+
+    /* Header and records are adjacent, so a chunk takes a single write */
+    if(capture_write(capture, buffer,
+                     sizeof(gestic_capture_chunk_t) + buffer->header.size))
+        capture->error = GESTIC_IO_ERROR;
+    else
+        ++capture->stats.chunks;
+}
+
+static void *capture_writer(void *opaque) {
+    gestic_capture_state_t *capture = (gestic_capture_state_t *)opaque;
+    gestic_capture_buffer_t *buffer;
+    gestic_capture_trailer_t trailer;
+    struct timespec due;
+    int stop = 0;
+
+    pthread_mutex_lock(&capture->lock);
+    while(!stop) {
+        if(!capture->queued) {
+            clock_gettime(CLOCK_REALTIME, &due);
+            due.tv_sec += GESTIC_CAPTURE_FLUSH_MS / 1000;
+            if(!capture->stop)
+                pthread_cond_timedwait(&capture->wake, &capture->lock, &due);
+
+            /* Write what was captured so far, on stop or after a while */
+            buffer = capture_current(capture);
+            if(!capture->queued && buffer && buffer->header.count)
+                capture_queue(capture);
+            stop = capture->stop && !capture->queued;
+            continue;
+        }
+
+        buffer = &capture->buffers[capture->tail];
+        pthread_mutex_unlock(&capture->lock);
+
+        capture_write_chunk(capture, buffer);
+        buffer->header.size = 0;
+        buffer->header.count = 0;
+
+        pthread_mutex_lock(&capture->lock);
+        capture->tail = (capture->tail + 1) % GESTIC_CAPTURE_BUFFERS;
+        --capture->queued;
+    }
+    pthread_mutex_unlock(&capture->lock);
+
+    GESTIC_MEMCPY(trailer.magic, "GIDX", 4);
+    trailer.count = capture->stats.chunks;
+    trailer.offset = capture->stats.bytes;
+    if(capture_write(capture, capture->index,
+                     capture->stats.chunks * sizeof(gestic_capture_index_t)) ||
+       capture_write(capture, &trailer, sizeof(trailer)))
+        capture->error = GESTIC_IO_ERROR;
+
+    return 0;
+}
+
+int gestic_start_capture(gestic_t *gestic, const char *path) {
+    gestic_capture_state_t *capture;
+    gestic_capture_header_t header;
+    struct timespec now;
+
+    GESTIC_ASSERT(gestic && path && !gestic->capture);
+
+    capture = (gestic_capture_state_t *)calloc(1, sizeof(*capture));
+    if(!capture)
+        return GESTIC_IO_ERROR;
+
+    /* Every chunk is appended with a single write */
+    capture->fd = open(path, O_WRONLY | O_CREAT | O_TRUNC | O_APPEND, 0644);
+    if(capture->fd < 0) {
+        free(capture);
+        return GESTIC_IO_OPEN_ERROR;
+    }
+
+    clock_gettime(CLOCK_REALTIME, &now);
+    clock_gettime(CLOCK_MONOTONIC, &capture->start);
+
+    GESTIC_MEMSET(&header, 0, sizeof(header));
+    GESTIC_MEMCPY(header.magic, "GCAP", 4);
+    header.version = 1;
+    header.header_size = sizeof(header);
+    header.chunk_size = GESTIC_CAPTURE_CHUNK;
+    header.start_time = (unsigned long long)now.tv_sec * 1000000 +
+                        now.tv_nsec / 1000;
+
+    pthread_mutex_init(&capture->lock, NULL);
+    pthread_cond_init(&capture->wake, NULL);
+    if(capture_write(capture, &header, sizeof(header)) ||
+       pthread_create(&capture->thread, NULL, capture_writer, capture))
+    {
+        pthread_cond_destroy(&capture->wake);
+        pthread_mutex_destroy(&capture->lock);
+        close(capture->fd);
+        free(capture);
+        return GESTIC_IO_ERROR;
+    }
+
+#ifdef GESTIC_SYNC_THREADING
+    GESTIC_SYNC_LOCK(gestic->io_sync);
+    gestic->capture = capture;
+    GESTIC_SYNC_UNLOCK(gestic->io_sync);
+#else
+    gestic->capture = capture;
+#endif
+    return GESTIC_NO_ERROR;
+}
+
+int gestic_stop_capture(gestic_t *gestic, gestic_capture_stats_t *stats) {
+    gestic_capture_state_t *capture;
+    int error;
+
+    GESTIC_ASSERT(gestic);
+
+#ifdef GESTIC_SYNC_THREADING
+    GESTIC_SYNC_LOCK(gestic->io_sync);
+    capture = gestic->capture;
+    gestic->capture = 0;
+    GESTIC_SYNC_UNLOCK(gestic->io_sync);
+#else
+    capture = gestic->capture;
+    gestic->capture = 0;
+#endif
+    if(!capture)
+        return GESTIC_NO_ERROR;
+
+    pthread_mutex_lock(&capture->lock);
+    capture->stop = 1;
+    pthread_cond_signal(&capture->wake);
+    pthread_mutex_unlock(&capture->lock);
+    pthread_join(capture->thread, NULL);
+
+    error = capture->error;
+    if(close(capture->fd))
+        error = GESTIC_IO_ERROR;
+    if(stats)
+        *stats = capture->stats;
+
+    pthread_cond_destroy(&capture->wake);
+    pthread_mutex_destroy(&capture->lock);
+    free(capture->index);
+    free(capture);
+
+    return error;
+}
+
+#endif
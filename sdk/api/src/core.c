@@ -40,11 +40,20 @@ void gestic_initialize(gestic_t *gestic) {
 #if defined(GESTIC_SYNC_INTERRUPT) || defined(GESTIC_SYNC_THREADING)
     GESTIC_SYNC_INIT(gestic->io_sync);
 #endif
+
+#ifndef GESTIC_NO_ADAPTIVE_TIMEOUT
+    gestic->rtt.floor = GESTIC_TIMEOUT_FLOOR;
+    gestic->rtt.ceiling = GESTIC_TIMEOUT_CEILING;
+#endif
 }
 
 void gestic_cleanup(gestic_t *gestic) {
     GESTIC_ASSERT(gestic);
 
+#ifdef GESTIC_HAS_CAPTURE
+    gestic_stop_capture(gestic, 0);
+#endif
+
 #if defined(GESTIC_SYNC_INTERRUPT) || defined(GESTIC_SYNC_THREADING)
     GESTIC_SYNC_RELEASE(gestic->io_sync);
 #endif
@@ -91,7 +100,31 @@ void gestic_handle_system_status(gestic_t *gestic,
             gestic->resp_msg_id = 0;
             gestic->resp_error_code = error_code;
         }
+        if(error_code == gestic_system_WakeupHappened)
+            gestic->ready = 1;
+        /* Acknowledgements beyond the messages written so far are late or
+         * duplicate responses to earlier messages and are dropped
+         */
+        if(gestic->pipeline && msg_id == gestic->pipeline->msg_id &&
+           gestic->pipeline->acked < gestic->pipeline->sent &&
+           gestic->pipeline->acked < gestic->pipeline->count)
+        {
+            gestic_pipeline_t *pipeline = gestic->pipeline;
+            if(pipeline->errors)
+                pipeline->errors[pipeline->acked] = error_code;
+            if(error_code)
+                ++pipeline->failed;
+            ++pipeline->acked;
+        }
+#ifndef GESTIC_NO_PARAM_CACHE
+        /* Parameters might have been lost while the device was sleeping */
+        if(error_code == gestic_system_WakeupHappened)
+            gestic_param_cache_invalidate(gestic);
+#endif
     } else {
+        GESTIC_METRIC_ADD(gestic, bad_sizes, 1);
+        GESTIC_TRACE_ERROR(gestic, gestic_trace_bad_size,
+                           gestic_msg_System_Status, size, 0);
         GESTIC_BAD_DATA("gestic_handle_system_status",
                         "Expected message size of 16 bytes",
                         size);
@@ -124,24 +157,315 @@ static int wait_response(gestic_t *gestic, int msg_id, int timeout) {
     return error;
 }
 
+#ifndef GESTIC_NO_ADAPTIVE_TIMEOUT
+
+static gestic_rtt_stats_t *gestic_rtt_find(gestic_t *gestic, int msg_id, int add) {
+    gestic_rtt_stats_t *stats = gestic->rtt.stats;
+    int i;
+
+    for(i = 0; i < GESTIC_RTT_TYPES; ++i) {
+        if(stats[i].msg_id == msg_id)
+            return &stats[i];
+        if(!stats[i].msg_id) {
+            if(!add)
+                break;
+            stats[i].msg_id = msg_id;
+            return &stats[i];
+        }
+    }
+
+    /* Further message types are sent with the timeout of the caller */
+    return 0;
+}
+
+/* Messages that write the flash take far longer than the other messages of
+ * their type. They are always sent with the timeout of the caller.
+ */
+static int gestic_rtt_exempt(const unsigned char *msg) {
+    switch(msg[3]) {
+    case gestic_msg_Fw_Update_Start:
+    case gestic_msg_Fw_Update_Block:
+    case gestic_msg_Fw_Update_Completed:
+        return 1;
+    case gestic_msg_Set_Runtime_Parameter:
+        return GET_U16(msg + 4) == gestic_param_makePersistent;
+    default:
+        return 0;
+    }
+}
+
+/* Timeout of the given attempt, doubled for every retry */
+static int gestic_rtt_timeout(gestic_t *gestic, gestic_rtt_stats_t *stats,
+                              int timeout, int attempt)
+{
+    int ceiling = gestic->rtt.ceiling;
+
+    if(!ceiling || !stats)
+        return timeout;
+
+    if(ceiling < timeout)
+        ceiling = timeout;
+    if(stats->samples)
+        timeout = stats->timeout;
+    while(attempt-- > 0 && timeout > 0 && timeout < ceiling)
+        timeout *= 2;
+
+    return timeout < ceiling ? timeout : ceiling;
+}
+
+/* Updates the estimates as in RFC 6298 with microsecond resolution */
+static void gestic_rtt_sample(gestic_t *gestic, gestic_rtt_stats_t *stats, int rtt) {
+    int delta;
+    int timeout;
+
+    if(!stats->samples) {
+        stats->srtt = rtt;
+        stats->rttvar = rtt / 2;
+        stats->min = rtt;
+        stats->max = rtt;
+    } else {
+        delta = stats->srtt > rtt ? stats->srtt - rtt : rtt - stats->srtt;
+        stats->rttvar = (3 * stats->rttvar + delta) / 4;
+        stats->srtt = (7 * stats->srtt + rtt) / 8;
+        if(rtt < stats->min)
+            stats->min = rtt;
+        if(rtt > stats->max)
+            stats->max = rtt;
+    }
+    stats->last = rtt;
+    ++stats->samples;
+
+    timeout = (stats->srtt + 4 * stats->rttvar + 999) / 1000;
+    if(timeout < gestic->rtt.floor)
+        timeout = gestic->rtt.floor;
+    if(gestic->rtt.ceiling && timeout > gestic->rtt.ceiling)
+        timeout = gestic->rtt.ceiling;
+    stats->timeout = timeout;
+}
+
+void gestic_set_timeout_limits(gestic_t *gestic, int floor, int ceiling) {
+    int i;
+
+    GESTIC_ASSERT(gestic);
+
+    gestic->rtt.floor = floor > 0 ? floor : 0;
+    gestic->rtt.ceiling = ceiling > gestic->rtt.floor ? ceiling : 0;
+
+    /* Apply the limits to the current estimates */
+    for(i = 0; i < GESTIC_RTT_TYPES; ++i) {
+        gestic_rtt_stats_t *stats = &gestic->rtt.stats[i];
+        if(stats->timeout < gestic->rtt.floor)
+            stats->timeout = gestic->rtt.floor;
+        if(gestic->rtt.ceiling && stats->timeout > gestic->rtt.ceiling)
+            stats->timeout = gestic->rtt.ceiling;
+    }
+}
+
+int gestic_get_rtt_stats(gestic_t *gestic, int msg_id, gestic_rtt_stats_t *stats) {
+    gestic_rtt_stats_t *found;
+
+    GESTIC_ASSERT(gestic && stats);
+
+    found = msg_id ? gestic_rtt_find(gestic, msg_id, 0) : 0;
+    if(!found)
+        return GESTIC_BAD_PARAM_ERROR;
+
+    *stats = *found;
+    return GESTIC_NO_ERROR;
+}
+
+#endif
+
+/* Response times are measured for adaptive timeouts, the metrics, the trace
+ * and the command_ack probe
+ */
+#if defined(GESTIC_TIME_US) && (!defined(GESTIC_NO_ADAPTIVE_TIMEOUT) || \
+    !defined(GESTIC_NO_METRICS) || GESTIC_TRACE_LEVEL > 1 || \
+    defined(GESTIC_HAS_PROBES))
+#   define GESTIC_MEASURE_RTT
+#endif
+
 int gestic_send_message(gestic_t *gestic, void *msg, int size, int timeout) {
     int retries;
     int last_error = GESTIC_NO_ERROR;
     int msg_id = ((unsigned char *)msg)[3];
+    int attempt_timeout = timeout;
+#ifndef GESTIC_NO_ADAPTIVE_TIMEOUT
+    gestic_rtt_stats_t *stats = gestic_rtt_exempt((unsigned char *)msg) ? 0 :
+                                gestic_rtt_find(gestic, msg_id, 1);
+#endif
+#ifdef GESTIC_MEASURE_RTT
+    unsigned int start;
+    int rtt;
+#endif
 
     /* Retry 2 times before accepting a failure */
     for(retries = 3; retries > 0; --retries) {
+        if(retries < 3)
+            GESTIC_METRIC_ADD(gestic, retries, 1);
+
+#ifndef GESTIC_NO_ADAPTIVE_TIMEOUT
+        attempt_timeout = gestic_rtt_timeout(gestic, stats, timeout,
+                                             3 - retries);
+#endif
+
         last_error = gestic_message_write(gestic, msg, size);
         if(last_error)
             continue;
+        GESTIC_PROBE2(command_sent, msg_id, 3 - retries);
+        GESTIC_TRACE_INFO(gestic, gestic_trace_cmd_sent, msg_id, 3 - retries,
+                          attempt_timeout);
+
+#ifdef GESTIC_MEASURE_RTT
+        start = GESTIC_TIME_US();
+#endif
+        last_error = wait_response(gestic, msg_id, attempt_timeout);
+        if(last_error == GESTIC_NO_RESPONSE_ERROR) {
+            GESTIC_METRIC_ADD(gestic, timeouts, 1);
+            GESTIC_TRACE_ERROR(gestic, gestic_trace_cmd_timeout, msg_id,
+                               3 - retries, attempt_timeout);
+            continue;
+        }
+
+#ifdef GESTIC_MEASURE_RTT
+        rtt = (int)(GESTIC_TIME_US() - start);
+        /* Responses to a repeated message are ambiguous */
+        if(retries == 3) {
+#ifndef GESTIC_NO_ADAPTIVE_TIMEOUT
+            if(stats)
+                gestic_rtt_sample(gestic, stats, rtt);
+#endif
+#ifndef GESTIC_NO_METRICS
+            gestic_metrics_observe(&gestic->metrics.command_rtt, rtt);
+#endif
+        }
+        GESTIC_PROBE4(command_ack, msg_id, 3 - retries, rtt, last_error);
+        GESTIC_TRACE_INFO(gestic, gestic_trace_cmd_ack, msg_id, last_error, rtt);
+#else
+        GESTIC_TRACE_INFO(gestic, gestic_trace_cmd_ack, msg_id, last_error, 0);
+#endif
 
-        last_error = wait_response(gestic, msg_id, timeout);
         if(!last_error)
             break;
     }
+
+#ifndef GESTIC_NO_ADAPTIVE_TIMEOUT
+    if(stats) {
+        if(retries < 3)
+            ++stats->retries;
+        if(last_error)
+            ++stats->failures;
+    }
+#endif
+
     return last_error;
 }
 
+int gestic_reset_and_wait(gestic_t *gestic, int timeout) {
+    int error;
+
+    GESTIC_ASSERT(gestic && GESTIC_CONNECTED(gestic));
+
+    gestic->ready = 0;
+    error = gestic_reset(gestic);
+
+    while(!error && !gestic->ready) {
+        error = gestic_message_receive(gestic, &timeout);
+        if(error == GESTIC_NO_DATA)
+            error = GESTIC_NO_RESPONSE_ERROR;
+    }
+
+    GESTIC_TRACE_INFO(gestic, gestic_trace_reset, error, 0, 0);
+    return error;
+}
+
+int gestic_pipeline_send(gestic_t *gestic, const void *msgs, int size,
+                         int count, int window, int *errors, int *pending,
+                         int timeout)
+{
+    const unsigned char *data = (const unsigned char *)msgs;
+    gestic_pipeline_t pipeline;
+    int error = GESTIC_NO_ERROR;
+    int remaining = timeout;
+    int acked;
+    int i;
+
+    GESTIC_ASSERT(gestic && GESTIC_CONNECTED(gestic));
+
+    if(pending)
+        *pending = 0;
+    if(count <= 0)
+        return GESTIC_NO_ERROR;
+    if(window < 1)
+        window = 1;
+
+    if(errors) {
+        for(i = 0; i < count; ++i)
+            errors[i] = -1;
+    }
+
+    pipeline.msg_id = GET_U8(data + 3);
+    pipeline.count = count;
+    pipeline.sent = 0;
+    pipeline.acked = 0;
+    pipeline.failed = 0;
+    pipeline.errors = errors;
+    gestic->pipeline = &pipeline;
+
+    while(pipeline.acked < count) {
+        /* Keep the window filled */
+        while(pipeline.sent < count && pipeline.sent - pipeline.acked < window) {
+            /* Counted before the write as the response might be handled
+             * by another thread before the write returns
+             */
+            ++pipeline.sent;
+            error = gestic_message_write(gestic,
+                        (void *)(data + (pipeline.sent - 1) * size), size);
+            if(error) {
+                --pipeline.sent;
+                break;
+            }
+        }
+        if(error)
+            break;
+
+        /* Receive and handle message */
+        acked = pipeline.acked;
+        error = gestic_message_receive(gestic, &remaining);
+        if(error != GESTIC_NO_ERROR) {
+            if(error == GESTIC_NO_DATA)
+                error = GESTIC_NO_RESPONSE_ERROR;
+            break;
+        }
+
+        /* The timeout applies to each response */
+        if(pipeline.acked != acked)
+            remaining = timeout;
+    }
+
+#ifdef GESTIC_SYNC_THREADING
+    GESTIC_SYNC_LOCK(gestic->io_sync);
+    gestic->pipeline = 0;
+    GESTIC_SYNC_UNLOCK(gestic->io_sync);
+#else
+    gestic->pipeline = 0;
+#endif
+
+    if(pending)
+        *pending = pipeline.sent - pipeline.acked;
+    if(!error && pipeline.failed)
+        error = GESTIC_SYSTEM_ERROR;
+
+    return error;
+}
+
+int gestic_send_pipelined(gestic_t *gestic, const void *msgs, int size,
+                          int count, int window, int *errors, int timeout)
+{
+    return gestic_pipeline_send(gestic, msgs, size, count, window, errors, 0,
+                                timeout);
+}
+
 int gestic_request_message(gestic_t *gestic, unsigned char msgId, unsigned int param, int timeout) {
     unsigned char msg[12];
     GESTIC_MEMSET(msg, 0, sizeof(msg));
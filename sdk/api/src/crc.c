@@ -0,0 +1,78 @@
+/******************************************************************************
+ *
+ * Copyright (C) 2014 Microchip Technology Inc. and its
+ *                    subsidiaries ("Microchip").
+ *
+ * All rights reserved.
+ *
+ * You are permitted to use the Aurea software, GestIC API, and other
+ * accompanying software with Microchip products.  Refer to the license
+ * agreement accompanying this software, if any, for additional info regarding
+ * your rights and obligations.
+ *
+ * SOFTWARE AND DOCUMENTATION ARE PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION, ANY WARRANTY OF
+ * MERCHANTABILITY, TITLE, NON-INFRINGEMENT AND FITNESS FOR A PARTICULAR
+ * PURPOSE. IN NO EVENT SHALL MICROCHIP, SMSC, OR ITS LICENSORS BE LIABLE OR
+ * OBLIGATED UNDER CONTRACT, NEGLIGENCE, STRICT LIABILITY, CONTRIBUTION, BREACH
+ * OF WARRANTY, OR OTHER LEGAL EQUITABLE THEORY FOR ANY DIRECT OR INDIRECT
+ * DAMAGES OR EXPENSES INCLUDING BUT NOT LIMITED TO ANY INCIDENTAL, SPECIAL,
+ * INDIRECT OR CONSEQUENTIAL DAMAGES, OR OTHER SIMILAR COSTS.
+ *
+ ******************************************************************************/
+#include "impl.h"
+
+#ifndef GESTIC_NO_CRC32
+
+/* ARMv8 cores with the CRC extension compute the same CRC-32 in hardware.
+ * Otherwise eight bytes are processed per step with the slice-by-8 tables
+ * unless GESTIC_NO_CRC_SLICING restricts them to the 1 KB byte-wise table.
+ */
+#if defined(__ARM_FEATURE_CRC32) && !defined(__ARM_BIG_ENDIAN)
+#   include <arm_acle.h>
+#   define GESTIC_CRC_HARDWARE
+#else
+#   ifdef GESTIC_NO_CRC_SLICING
+#       define GESTIC_CRC_SLICES 1
+#   else
+#       define GESTIC_CRC_SLICES 8
+#   endif
+#   include "crc_table.h"
+#endif
+
+unsigned int gestic_crc32(unsigned int crc, const void *data, int size) {
+    const unsigned char *p = (const unsigned char *)data;
+
+    crc = ~crc;
+
+#ifdef GESTIC_CRC_HARDWARE
+    for(; size >= 8; size -= 8, p += 8) {
+        unsigned long long v;
+        GESTIC_MEMCPY(&v, p, 8);
+        crc = __crc32d(crc, v);
+    }
+    for(; size > 0; --size, ++p)
+        crc = __crc32b(crc, *p);
+#else
+#   if GESTIC_CRC_SLICES == 8
+    for(; size >= 8; size -= 8, p += 8) {
+        unsigned int lo = crc ^ GET_U32(p);
+        unsigned int hi = GET_U32(p + 4);
+        crc = gestic_crc_table[7][lo & 0xFF] ^
+              gestic_crc_table[6][(lo >> 8) & 0xFF] ^
+              gestic_crc_table[5][(lo >> 16) & 0xFF] ^
+              gestic_crc_table[4][lo >> 24] ^
+              gestic_crc_table[3][hi & 0xFF] ^
+              gestic_crc_table[2][(hi >> 8) & 0xFF] ^
+              gestic_crc_table[1][(hi >> 16) & 0xFF] ^
+              gestic_crc_table[0][hi >> 24];
+    }
+#   endif
+    for(; size > 0; --size, ++p)
+        crc = (crc >> 8) ^ gestic_crc_table[0][(crc ^ *p) & 0xFF];
+#endif
+
+    return ~crc;
+}
+
+#endif
@@ -52,6 +52,7 @@ gestic_signal_t *gestic_get_cic(gestic_t *gestic, int reserved) {
     GESTIC_ASSERT(reserved == 0);
     GESTIC_UNUSED(reserved);
 
+    gestic_data_mask_use(gestic, gestic_data_mask_cic);
     return &gestic->result.cic;
 }
 
@@ -60,6 +61,7 @@ gestic_signal_t *gestic_get_sd(gestic_t *gestic, int reserved) {
     GESTIC_ASSERT(reserved == 0);
     GESTIC_UNUSED(reserved);
 
+    gestic_data_mask_use(gestic, gestic_data_mask_sd);
     return &gestic->result.sd;
 }
 
@@ -68,6 +70,7 @@ gestic_position_t *gestic_get_position(gestic_t *gestic, int reserved) {
     GESTIC_ASSERT(reserved == 0);
     GESTIC_UNUSED(reserved);
 
+    gestic_data_mask_use(gestic, gestic_data_mask_position);
     return &gestic->result.pos;
 }
 
@@ -76,6 +79,7 @@ gestic_gesture_t *gestic_get_gesture(gestic_t *gestic, int reserved) {
     GESTIC_ASSERT(reserved == 0);
     GESTIC_UNUSED(reserved);
 
+    gestic_data_mask_use(gestic, gestic_data_mask_gesture);
     return &gestic->result.gesture;
 }
 
@@ -84,6 +88,7 @@ gestic_touch_t *gestic_get_touch(gestic_t *gestic, int reserved) {
     GESTIC_ASSERT(reserved == 0);
     GESTIC_UNUSED(reserved);
 
+    gestic_data_mask_use(gestic, gestic_data_mask_touch);
     return &gestic->result.touch;
 }
 
@@ -92,6 +97,7 @@ gestic_air_wheel_t *gestic_get_air_wheel(gestic_t *gestic, int reserved) {
     GESTIC_ASSERT(reserved == 0);
     GESTIC_UNUSED(reserved);
 
+    gestic_data_mask_use(gestic, gestic_data_mask_airwheel);
     return &gestic->result.air_wheel;
 }
 
@@ -100,16 +106,19 @@ gestic_calib_t *gestic_get_calibration(gestic_t *gestic, int reserved) {
     GESTIC_ASSERT(reserved == 0);
     GESTIC_UNUSED(reserved);
 
+    gestic_data_mask_use(gestic, gestic_data_mask_dsp_status);
     return &gestic->result.calib;
 }
 
 gestic_freq_t *gestic_get_frequency(gestic_t *gestic) {
     GESTIC_ASSERT(gestic);
+    gestic_data_mask_use(gestic, gestic_data_mask_dsp_status);
     return &gestic->result.frequency;
 }
 
 gestic_noise_power_t *gestic_get_noise_power(gestic_t *gestic) {
     GESTIC_ASSERT(gestic);
+    gestic_data_mask_use(gestic, gestic_data_mask_noise_power);
     return &gestic->result.noise_power;
 }
 
@@ -0,0 +1,396 @@
+/******************************************************************************
+ *
+ * Copyright (C) 2014 Microchip Technology Inc. and its
+ *                    subsidiaries ("Microchip").
+ *
+ * All rights reserved.
+ *
+ * You are permitted to use the Aurea software, GestIC API, and other
+ * accompanying software with Microchip products.  Refer to the license
+ * agreement accompanying this software, if any, for additional info regarding
+ * your rights and obligations.
+ *
+ * SOFTWARE AND DOCUMENTATION ARE PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION, ANY WARRANTY OF
+ * MERCHANTABILITY, TITLE, NON-INFRINGEMENT AND FITNESS FOR A PARTICULAR
+ * PURPOSE. IN NO EVENT SHALL MICROCHIP, SMSC, OR ITS LICENSORS BE LIABLE OR
+ * OBLIGATED UNDER CONTRACT, NEGLIGENCE, STRICT LIABILITY, CONTRIBUTION, BREACH
+ * OF WARRANTY, OR OTHER LEGAL EQUITABLE THEORY FOR ANY DIRECT OR INDIRECT
+ * DAMAGES OR EXPENSES INCLUDING BUT NOT LIMITED TO ANY INCIDENTAL, SPECIAL,
+ * INDIRECT OR CONSEQUENTIAL DAMAGES, OR OTHER SIMILAR COSTS.
+ *
+ ******************************************************************************/
+#include "impl.h"
+
+#if !defined(GESTIC_NO_FLASH) && (defined(_WIN32) || defined(__linux__))
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef GESTIC_HAS_ZLIB
+#   include <zlib.h>
+#endif
+
+/* Size of the chunks read from the archive and inflated at once */
+#define GESTIC_ENZ_CHUNK 4096
+
+/* Longest line of an image: ':' and 5 + 129 bytes of a record in hex */
+#define GESTIC_ENZ_LINE 280
+
+/* Addresses of the version and the initialization vector in the image */
+#define GESTIC_ENZ_VERSION 0xFF78
+#define GESTIC_ENZ_IV 0xFFF0
+
+/* The images in the archive are Intel HEX files after a header of
+ * "-Key: value" lines that ends with "--". Each record of the flash is
+ * stored as its length followed by up to 128 bytes of data.
+ */
+typedef struct {
+    gestic_flash_image_t *image;
+    int capacity;
+    char line[GESTIC_ENZ_LINE];
+    int line_size;
+    int header;
+    int has_iv;
+    int has_version;
+    int finished;
+    int error;
+} gestic_enz_parser_t;
+
+static int gestic_enz_hex(const char *p) {
+    int value = 0;
+    int i;
+
+    for(i = 0; i < 2; ++i) {
+        value <<= 4;
+        if(p[i] >= '0' && p[i] <= '9')
+            value |= p[i] - '0';
+        else if(p[i] >= 'A' && p[i] <= 'F')
+            value |= p[i] - 'A' + 10;
+        else if(p[i] >= 'a' && p[i] <= 'f')
+            value |= p[i] - 'a' + 10;
+        else
+            return -1;
+    }
+
+    return value;
+}
+
+/* Appends a flash record after checking that it fits behind the last one */
+static int gestic_enz_record(gestic_enz_parser_t *parser, unsigned int address,
+                             const unsigned char *bytes, int size)
+{
+    gestic_flash_image_t *image = parser->image;
+    gestic_flash_record_t *record;
+
+    if(address % 128 || address + 128 > GESTIC_ENZ_VERSION ||
+       size < 2 || size > 129 || bytes[0] < 1 || bytes[0] > size - 1)
+        return GESTIC_BAD_IMAGE_ERROR;
+    if(image->record_count &&
+       address <= image->data[image->record_count - 1].address)
+        return GESTIC_BAD_IMAGE_ERROR;
+
+    if(image->record_count == parser->capacity) {
+        parser->capacity *= 2;
+        image = (gestic_flash_image_t *)realloc(image,
+                    sizeof(gestic_flash_image_t) +
+                    (parser->capacity - 1) * sizeof(gestic_flash_record_t));
+        if(!image)
+            return GESTIC_IO_ERROR;
+        parser->image = image;
+    }
+
+    record = &image->data[image->record_count++];
+    record->address = (unsigned short)address;
+    record->length = bytes[0];
+    GESTIC_MEMCPY(record->data, bytes + 1, size - 1);
+    GESTIC_MEMSET(record->data + size - 1, 0, 129 - size);
+
+    return GESTIC_NO_ERROR;
+}
+
+static int gestic_enz_line(gestic_enz_parser_t *parser, const char *line,
+                           int size)
+{
+    unsigned char bytes[(GESTIC_ENZ_LINE - 1) / 2];
+    unsigned int address;
+    int count, value, i;
+    int sum = 0;
+
+    if(parser->header) {
+        if(size == 2 && line[0] == '-' && line[1] == '-')
+            parser->header = 0;
+        else if(!size || line[0] != '-')
+            return GESTIC_BAD_IMAGE_ERROR;
+        return GESTIC_NO_ERROR;
+    }
+    if(!size)
+        return GESTIC_NO_ERROR;
+    if(parser->finished || line[0] != ':' || size < 11 || !(size & 1))
+        return GESTIC_BAD_IMAGE_ERROR;
+
+    /* Count, address, type, data and checksum */
+    count = (size - 1) / 2;
+    for(i = 0; i < count; ++i) {
+        value = gestic_enz_hex(line + 1 + 2 * i);
+        if(value < 0)
+            return GESTIC_BAD_IMAGE_ERROR;
+        bytes[i] = (unsigned char)value;
+        sum += value;
+    }
+    if((sum & 0xFF) || bytes[0] != count - 5)
+        return GESTIC_BAD_IMAGE_ERROR;
+
+    address = (bytes[1] << 8) | bytes[2];
+    switch(bytes[3]) {
+    case 0x00:
+        if(address == GESTIC_ENZ_VERSION && bytes[0] == 120) {
+            GESTIC_MEMCPY(parser->image->fw_version, bytes + 4, 120);
+            parser->has_version = 1;
+        } else if(address == GESTIC_ENZ_IV && bytes[0] == 14) {
+            GESTIC_MEMCPY(parser->image->iv, bytes + 4, 14);
+            parser->has_iv = 1;
+        } else {
+            return gestic_enz_record(parser, address, bytes + 4, bytes[0]);
+        }
+        break;
+    case 0x01:
+        parser->finished = 1;
+        break;
+    case 0x04:
+        /* The flash is addressed with 16 bits only */
+        if(bytes[0] != 2 || bytes[4] || bytes[5])
+            return GESTIC_BAD_IMAGE_ERROR;
+        break;
+    default:
+        return GESTIC_BAD_IMAGE_ERROR;
+    }
+
+    return GESTIC_NO_ERROR;
+}
+
+/* Splits the uncompressed data into lines */
+static void gestic_enz_feed(gestic_enz_parser_t *parser,
+                            const unsigned char *data, int size)
+{
+    int i;
+
+    for(i = 0; i < size && !parser->error; ++i) {
+        if(data[i] == '\n') {
+            parser->error = gestic_enz_line(parser, parser->line,
+                                            parser->line_size);
+            parser->line_size = 0;
+        } else if(data[i] != '\r') {
+            if(parser->line_size == GESTIC_ENZ_LINE)
+                parser->error = GESTIC_BAD_IMAGE_ERROR;
+            else
+                parser->line[parser->line_size++] = (char)data[i];
+        }
+    }
+}
+
+typedef struct {
+    long offset;
+    unsigned long compressed;
+    unsigned long size;
+    unsigned int crc;
+    int method;
+} gestic_enz_entry_t;
+
+/* Looks the entry up in the central directory of the zip archive */
+static int gestic_enz_find(FILE *file, const char *name,
+                           gestic_enz_entry_t *entry)
+{
+    unsigned char header[46];
+    unsigned char *tail;
+    long size, tail_size, position;
+    int name_length = (int)strlen(name);
+    int entries, length, i;
+    int error = GESTIC_BAD_IMAGE_ERROR;
+    char found[256];
+
+    /* Longer names could not be compared in found */
+    if(name_length > (int)sizeof(found))
+        return GESTIC_BAD_PARAM_ERROR;
+
+    if(fseek(file, 0, SEEK_END) || (size = ftell(file)) < 22)
+        return GESTIC_BAD_IMAGE_ERROR;
+
+    /* The end of central directory record is followed by up to 64 KB of
+     * comment
+     */
+    tail_size = size < 22 + 65535 ? size : 22 + 65535;
+    tail = (unsigned char *)malloc(tail_size);
+    if(!tail)
+        return GESTIC_IO_ERROR;
+    if(fseek(file, size - tail_size, SEEK_SET) ||
+       fread(tail, 1, tail_size, file) != (size_t)tail_size)
+    {
+        free(tail);
+        return GESTIC_IO_ERROR;
+    }
+    for(i = (int)tail_size - 22; i >= 0; --i) {
+        if(GET_U32(tail + i) == 0x06054B50)
+            break;
+    }
+    if(i < 0) {
+        free(tail);
+        return GESTIC_BAD_IMAGE_ERROR;
+    }
+    entries = GET_U16(tail + i + 10);
+    position = (long)GET_U32(tail + i + 16);
+    free(tail);
+
+    for(; entries > 0; --entries) {
+        if(fseek(file, position, SEEK_SET) ||
+           fread(header, 1, sizeof(header), file) != sizeof(header) ||
+           GET_U32(header) != 0x02014B50)
+            break;
+        length = GET_U16(header + 28);
+        position += 46 + length + GET_U16(header + 30) + GET_U16(header + 32);
+        if(length != name_length ||
+           fread(found, 1, length, file) != (size_t)length ||
+           memcmp(found, name, length))
+            continue;
+
+        entry->method = GET_U16(header + 10);
+        entry->crc = GET_U32(header + 16);
+        entry->compressed = GET_U32(header + 20);
+        entry->size = GET_U32(header + 24);
+        entry->offset = (long)GET_U32(header + 42);
+
+        /* The data follows the local header with its own extra field */
+        if(fseek(file, entry->offset, SEEK_SET) ||
+           fread(header, 1, 30, file) != 30 ||
+           GET_U32(header) != 0x04034B50)
+            break;
+        entry->offset += 30 + GET_U16(header + 26) + GET_U16(header + 28);
+        error = fseek(file, entry->offset, SEEK_SET) ? GESTIC_IO_ERROR
+                                                     : GESTIC_NO_ERROR;
+        break;
+    }
+
+    return error;
+}
+
+/* Streams the entry through the parser, inflating it if required */
+static int gestic_enz_read(FILE *file, const gestic_enz_entry_t *entry,
+                           gestic_enz_parser_t *parser)
+{
+    unsigned char in[GESTIC_ENZ_CHUNK];
+    unsigned long remaining = entry->compressed;
+    unsigned long produced = 0;
+    unsigned int crc = 0;
+    size_t count;
+#ifdef GESTIC_HAS_ZLIB
+    unsigned char out[GESTIC_ENZ_CHUNK];
+    z_stream stream;
+    int result = Z_OK;
+#endif
+
+    if(entry->method == 0) {
+        while(remaining && !parser->error) {
+            count = remaining < sizeof(in) ? remaining : sizeof(in);
+            if(fread(in, 1, count, file) != count)
+                return GESTIC_IO_ERROR;
+            remaining -= count;
+            produced += count;
+            crc = gestic_crc32(crc, in, (int)count);
+            gestic_enz_feed(parser, in, (int)count);
+        }
+#ifdef GESTIC_HAS_ZLIB
+    } else if(entry->method == 8) {
+        GESTIC_MEMSET(&stream, 0, sizeof(stream));
+        if(inflateInit2(&stream, -MAX_WBITS) != Z_OK)
+            return GESTIC_IO_ERROR;
+        while(result != Z_STREAM_END && !parser->error) {
+            if(!stream.avail_in) {
+                count = remaining < sizeof(in) ? remaining : sizeof(in);
+                if(!count || fread(in, 1, count, file) != count) {
+                    result = Z_DATA_ERROR;
+                    break;
+                }
+                remaining -= count;
+                stream.next_in = in;
+                stream.avail_in = (uInt)count;
+            }
+            stream.next_out = out;
+            stream.avail_out = sizeof(out);
+            result = inflate(&stream, Z_NO_FLUSH);
+            if(result != Z_OK && result != Z_STREAM_END)
+                break;
+            count = sizeof(out) - stream.avail_out;
+            produced += count;
+            crc = gestic_crc32(crc, out, (int)count);
+            gestic_enz_feed(parser, out, (int)count);
+        }
+        inflateEnd(&stream);
+        if(!parser->error && result != Z_STREAM_END)
+            return GESTIC_BAD_IMAGE_ERROR;
+#endif
+    } else {
+        return GESTIC_NO_IMPLEMENTATION_ERROR;
+    }
+
+    if(parser->error)
+        return parser->error;
+    if(produced != entry->size || crc != entry->crc)
+        return GESTIC_BAD_IMAGE_ERROR;
+
+    /* The last line might miss its line break */
+    if(parser->line_size) {
+        parser->error = gestic_enz_line(parser, parser->line,
+                                        parser->line_size);
+        parser->line_size = 0;
+    }
+
+    return parser->error;
+}
+
+int gestic_load_enz(const char *path, const char *name,
+                    gestic_flash_image_t **image)
+{
+    gestic_enz_parser_t parser;
+    gestic_enz_entry_t entry;
+    FILE *file;
+    int error;
+
+    GESTIC_ASSERT(path && name && image);
+
+    *image = 0;
+
+    file = fopen(path, "rb");
+    if(!file)
+        return GESTIC_IO_OPEN_ERROR;
+
+    GESTIC_MEMSET(&parser, 0, sizeof(parser));
+    parser.header = 1;
+    parser.capacity = 256;
+    parser.image = (gestic_flash_image_t *)calloc(1,
+                        sizeof(gestic_flash_image_t) +
+                        (parser.capacity - 1) * sizeof(gestic_flash_record_t));
+
+    error = parser.image ? gestic_enz_find(file, name, &entry)
+                         : GESTIC_IO_ERROR;
+    if(!error)
+        error = gestic_enz_read(file, &entry, &parser);
+    if(!error && (!parser.finished || !parser.has_iv || !parser.has_version ||
+                  !parser.image->record_count))
+        error = GESTIC_BAD_IMAGE_ERROR;
+
+    fclose(file);
+
+    if(error)
+        free(parser.image);
+    else
+        *image = parser.image;
+
+    return error;
+}
+
+void gestic_free_flash_image(gestic_flash_image_t *image) {
+    free(image);
+}
+
+#endif
@@ -24,37 +24,15 @@
 
 #ifndef GESTIC_NO_FLASH
 
-#define CRC_P_32 0xEDB88320L
-
-static unsigned int crc(gestic_t *gestic, const unsigned char *msg, int size)
-{
-    unsigned int crc = 0xFFFFFFFF;
-    int i;
-    for(i = 0; i < size; ++i)
-        crc = (crc >> 8) ^ gestic->flash.crc_table[(crc ^ msg[i]) & 0xFF];
-    return crc ^ 0xFFFFFFFF;
-}
-
-static void init_crc(gestic_t *gestic)
-{
-    int i, j;
-    unsigned long crc;
-
-    for (i = 0; i < 256; ++i) {
-        crc = i;
-
-        for (j = 0; j < 8; ++j) {
-            if ( crc & 0x00000001L )
-                crc = (crc >> 1) ^ CRC_P_32;
-            else
-                crc = crc >> 1;
-        }
-
-        gestic->flash.crc_table[i] = crc;
-    }
+#ifdef __linux__
+#   include <fcntl.h>
+#   include <unistd.h>
+#endif
 
-    gestic->flash.crc_intialized = 1;
-}
+/* Count of Fw_Update_Block messages prepared at once for pipelined flashing */
+#ifndef GESTIC_FLASH_BATCH
+#define GESTIC_FLASH_BATCH 32
+#endif
 
 int gestic_wait_for_version_info(gestic_t *gestic, int timeout)
 {
@@ -86,10 +64,6 @@ int gestic_flash_begin(gestic_t *gestic, unsigned int session_id, void *iv,
     unsigned char msg[28];
     gestic_version_request_t v_request;
 
-    /* Init table for CRC32-checksum */
-    if(!gestic->flash.crc_intialized)
-        init_crc(gestic);
-
     /* Prepare flash start message */
     GESTIC_MEMSET(msg, 0, sizeof(msg));
     SET_U8(msg, sizeof(msg));
@@ -100,15 +74,16 @@ int gestic_flash_begin(gestic_t *gestic, unsigned int session_id, void *iv,
 
     GESTIC_MEMSET(&v_request, 0, sizeof(v_request));
 
-    SET_U32(msg+4, crc(gestic, msg+8, 20));
+    SET_U32(msg+4, gestic_crc32(0, msg+8, 20));
 
     gestic->flash.session_id = session_id;
+    gestic->flash.session_mode = mode;
 
     /* Reset device and wait for the firmware-version */
     gestic->version_request = &v_request;
-    error = gestic_reset(gestic);
+    error = gestic_reset_and_wait(gestic, timeout);
 
-    if(!error)
+    if(!error && !v_request.received)
         error = gestic_wait_for_version_info(gestic, timeout);
     gestic->version_request = 0;
 
@@ -119,6 +94,22 @@ int gestic_flash_begin(gestic_t *gestic, unsigned int session_id, void *iv,
     return error;
 }
 
+/* Prepares the 140 bytes of a Fw_Update_Block message */
+static void gestic_flash_block(unsigned char *msg, unsigned short address,
+                               unsigned char length, const unsigned char *record,
+                               gestic_UpdateFunction_t mode)
+{
+    GESTIC_MEMSET(msg, 0, 140);
+    SET_U8(msg, 140);
+    SET_U8(msg + 3, gestic_msg_Fw_Update_Block);
+    SET_U16(msg + 8, address);
+    SET_U8(msg + 10, length);
+    SET_U8(msg + 11, mode);
+    GESTIC_MEMCPY(msg + 12, record, 128);
+
+    SET_U32(msg + 4, gestic_crc32(0, msg + 8, 132));
+}
+
 int gestic_flash_write(gestic_t *gestic, unsigned short address,
                        unsigned char length, unsigned char *record,
                        gestic_UpdateFunction_t mode, int timeout)
@@ -129,19 +120,168 @@ int gestic_flash_write(gestic_t *gestic, unsigned short address,
     GESTIC_ASSERT(gestic->flash.session_mode != gestic_UpdateFunction_VerifyOnly ||
             mode == gestic_UpdateFunction_VerifyOnly);
 
-    GESTIC_MEMSET(msg, 0, sizeof(msg));
-    SET_U8(msg, sizeof(msg));
-    SET_U8(msg + 3, gestic_msg_Fw_Update_Block);
-    SET_U16(msg + 8, address);
-    SET_U8(msg + 10, length);
-    SET_U8(msg + 11, mode);
-    GESTIC_MEMCPY(msg + 12, record, 128);
-
-    SET_U32(msg + 4, crc(gestic, msg + 8, 132));
+    gestic_flash_block(msg, address, length, record, mode);
 
     return gestic_send_message(gestic, msg, sizeof(msg), timeout);
 }
 
+void gestic_set_flash_window(gestic_t *gestic, int window) {
+    GESTIC_ASSERT(gestic);
+
+    gestic->flash.window = window > 1 ? window : 1;
+}
+
+void gestic_set_flash_progress(gestic_t *gestic,
+                               gestic_flash_progress_t callback,
+                               void *opaque)
+{
+    GESTIC_ASSERT(gestic);
+
+    gestic->flash.progress = callback;
+    gestic->flash.progress_opaque = opaque;
+}
+
+/* Records the progress in the journal and reports it */
+static void gestic_flash_progress(gestic_t *gestic, int done, int total) {
+    gestic->flash.acked = done;
+    if(gestic->flash.journal)
+        gestic->flash.journal->acked = done;
+    if(gestic->flash.progress)
+        gestic->flash.progress(gestic->flash.progress_opaque, done, total);
+}
+
+/* Writes the records of image from first on with up to window blocks in
+ * flight. The device acknowledges the blocks in order, so the n-th
+ * System_Status belongs to the n-th block of a batch.
+ *
+ * Returns the index of the first record that was not acknowledged without
+ * error or record_count when all succeeded. The status of the device for
+ * that record is kept in gestic->flash.status, the count of blocks still in
+ * flight in pending.
+ */
+static int gestic_flash_pipelined(gestic_t *gestic,
+                                  gestic_flash_image_t *image, int first,
+                                  gestic_UpdateFunction_t mode,
+                                  int window, int *pending, int timeout)
+{
+    unsigned char msgs[GESTIC_FLASH_BATCH][140];
+    int errors[GESTIC_FLASH_BATCH];
+    gestic_flash_record_t *record;
+    int count, i;
+    int error;
+
+    for(; first < image->record_count; first += count) {
+        count = image->record_count - first;
+        if(count > GESTIC_FLASH_BATCH)
+            count = GESTIC_FLASH_BATCH;
+
+        for(i = 0; i < count; ++i) {
+            record = image->data + first + i;
+            gestic_flash_block(msgs[i], record->address, record->length,
+                               record->data, mode);
+        }
+
+        error = gestic_pipeline_send(gestic, msgs, 140, count, window,
+                                     errors, pending, timeout);
+
+        for(i = 0; i < count && errors[i] == GESTIC_NO_ERROR; ++i)
+            gestic_flash_progress(gestic, first + i + 1, image->record_count);
+        if(error) {
+            gestic->flash.status = i < count ? errors[i] : -1;
+            return first + i;
+        }
+    }
+
+    return image->record_count;
+}
+
+/* Consumes the acknowledgements of the pending blocks that were still in
+ * flight when the pipeline stopped waiting for them. Otherwise a late one
+ * would be taken for the acknowledgement of the next record sent. Returns
+ * once all arrived or none arrived within timeout.
+ */
+static void gestic_flash_drain(gestic_t *gestic, int pending, int timeout) {
+    gestic_pipeline_t drain;
+    int remaining = timeout;
+    int acked;
+
+    drain.msg_id = gestic_msg_Fw_Update_Block;
+    drain.count = pending;
+    drain.sent = pending;
+    drain.acked = 0;
+    drain.failed = 0;
+    drain.errors = 0;
+    gestic->pipeline = &drain;
+
+    while(drain.acked < pending) {
+        acked = drain.acked;
+        if(gestic_message_receive(gestic, &remaining) != GESTIC_NO_ERROR)
+            break;
+        if(drain.acked != acked)
+            remaining = timeout;
+    }
+
+#ifdef GESTIC_SYNC_THREADING
+    GESTIC_SYNC_LOCK(gestic->io_sync);
+    gestic->pipeline = 0;
+    GESTIC_SYNC_UNLOCK(gestic->io_sync);
+#else
+    gestic->pipeline = 0;
+#endif
+}
+
+/* Writes the records of image from first on, pipelined if a window is set.
+ * After a failure in the pipeline the records are sent one at a time with
+ * retries from the first record that failed on.
+ */
+static int gestic_flash_records(gestic_t *gestic,
+                                gestic_flash_image_t *image, int first,
+                                gestic_UpdateFunction_t mode, int timeout)
+{
+    int error = GESTIC_NO_ERROR;
+    gestic_flash_record_t *record;
+    int i = first;
+    int pending = 0;
+
+    gestic->flash.status = 0;
+
+    if(gestic->flash.window > 1) {
+        i = gestic_flash_pipelined(gestic, image, first, mode,
+                                   gestic->flash.window, &pending, timeout);
+        /* Sending a mismatching record again does not change the outcome */
+        if(i < image->record_count &&
+           gestic->flash.status == gestic_system_ContentMismatch)
+            return GESTIC_SYSTEM_ERROR;
+        /* Without response the rest of the window might still be in flight */
+        if(i < image->record_count && pending > 0)
+            gestic_flash_drain(gestic, pending, timeout);
+    }
+
+    for(; !error && i < image->record_count; ++i) {
+        record = image->data + i;
+        error = gestic_flash_write(gestic, record->address, record->length,
+                                   record->data, mode, timeout);
+        if(!error)
+            gestic_flash_progress(gestic, i + 1, image->record_count);
+        else if(error == GESTIC_SYSTEM_ERROR)
+            gestic->flash.status = gestic->resp_error_code;
+    }
+
+    return error;
+}
+
+/* Ends the session by restarting the device */
+static int gestic_flash_restart(gestic_t *gestic, unsigned char *msg,
+                                int timeout)
+{
+    SET_U8(msg + 12, gestic_UpdateFunction_Restart);
+    GESTIC_MEMSET(msg + 13, 0, 120);
+
+    SET_U32(msg + 4, gestic_crc32(0, msg + 8, 128));
+
+    return gestic_send_message(gestic, msg, 136, timeout);
+}
+
 int gestic_flash_end(gestic_t *gestic, unsigned char *version, int timeout)
 {
     int error = GESTIC_NO_ERROR;
@@ -156,20 +296,14 @@ int gestic_flash_end(gestic_t *gestic, unsigned char *version, int timeout)
     SET_U8(msg + 12, gestic->flash.session_mode);
     GESTIC_MEMCPY(msg + 13, version, 120);
 
-    SET_U32(msg + 4, crc(gestic, msg + 8, 128));
+    SET_U32(msg + 4, gestic_crc32(0, msg + 8, 128));
 
     error = gestic_send_message(gestic, msg, sizeof(msg), timeout);
 
     /* Finally restart device */
 
-    if(!error) {
-        SET_U8(msg + 12, gestic_UpdateFunction_Restart);
-        GESTIC_MEMSET(msg + 13, 0, 120);
-
-        SET_U32(msg + 4, crc(gestic, msg + 8, 128));
-
-        error = gestic_send_message(gestic, msg, sizeof(msg), timeout);
-    }
+    if(!error)
+        error = gestic_flash_restart(gestic, msg, timeout);
 
     return error;
 }
@@ -181,15 +315,12 @@ int gestic_flash_image(gestic_t *gestic,
                        int timeout)
 {
     int error = GESTIC_NO_ERROR;
-    int i;
-    gestic_flash_record_t *record;
 
     error = gestic_flash_begin(gestic, session_id, image->iv, mode, timeout);
 
-    for(i = 0; !error && i < image->record_count; ++i) {
-        record = image->data + i;
-        error = gestic_flash_write(gestic, record->address, record->length,
-                                   record->data, mode, timeout);
+    if(!error) {
+        gestic_flash_progress(gestic, 0, image->record_count);
+        error = gestic_flash_records(gestic, image, 0, mode, timeout);
     }
 
     if(!error)
@@ -198,6 +329,268 @@ int gestic_flash_image(gestic_t *gestic,
     return error;
 }
 
+int gestic_flash_verify(gestic_t *gestic,
+                        unsigned int session_id,
+                        gestic_flash_image_t *image,
+                        int *matches,
+                        int timeout)
+{
+    unsigned char msg[136];
+    int error;
+
+    GESTIC_ASSERT(gestic && image && matches);
+
+    *matches = 0;
+
+    error = gestic_flash_begin(gestic, session_id, image->iv,
+                               gestic_UpdateFunction_VerifyOnly, timeout);
+    if(!error) {
+        gestic_flash_progress(gestic, 0, image->record_count);
+        error = gestic_flash_records(gestic, image, 0,
+                                     gestic_UpdateFunction_VerifyOnly, timeout);
+    }
+    if(!error) {
+        error = gestic_flash_end(gestic, image->fw_version, timeout);
+        if(error == GESTIC_SYSTEM_ERROR)
+            gestic->flash.status = gestic->resp_error_code;
+    }
+
+    if(!error) {
+        *matches = 1;
+    } else if(error == GESTIC_SYSTEM_ERROR &&
+              gestic->flash.status == gestic_system_ContentMismatch) {
+        /* Leave the loader like gestic_flash_end does */
+        GESTIC_MEMSET(msg, 0, sizeof(msg));
+        SET_U8(msg, sizeof(msg));
+        SET_U8(msg + 3, gestic_msg_Fw_Update_Completed);
+        SET_U32(msg + 8, gestic->flash.session_id);
+        error = gestic_flash_restart(gestic, msg, timeout);
+    }
+
+    return error;
+}
+
+#ifdef GESTIC_TIME_MS
+#   define GESTIC_FLASH_NOW() GESTIC_TIME_MS()
+#else
+#   define GESTIC_FLASH_NOW() 0
+#endif
+
+#ifndef GESTIC_NO_FW_VERSION
+
+/* Compares the running version with the one of the image */
+static int gestic_flash_running(gestic_t *gestic, gestic_flash_image_t *image,
+                                int timeout)
+{
+    char version[120];
+    int i;
+
+    if(gestic_query_fw_version(gestic, version, sizeof(version), timeout))
+        return 0;
+
+    for(i = 0; i < (int)sizeof(version); ++i) {
+        if(version[i] != (char)image->fw_version[i])
+            return 0;
+        if(!version[i])
+            break;
+    }
+
+    return 1;
+}
+
+#endif
+
+int gestic_flash_update(gestic_t *gestic,
+                        unsigned int session_id,
+                        gestic_flash_image_t *image,
+                        gestic_flash_update_result_t *result,
+                        int timeout)
+{
+    gestic_flash_update_result_t local;
+    int matches = 0;
+    int error;
+    int start;
+
+    GESTIC_ASSERT(gestic && image);
+
+    if(!result)
+        result = &local;
+    GESTIC_MEMSET(result, 0, sizeof(*result));
+
+#ifndef GESTIC_NO_FW_VERSION
+    start = GESTIC_FLASH_NOW();
+    matches = gestic_flash_running(gestic, image, timeout);
+    result->version_time = GESTIC_TIME_SINCE(GESTIC_FLASH_NOW(), start);
+    if(matches) {
+        result->outcome = gestic_flash_up_to_date;
+        return GESTIC_NO_ERROR;
+    }
+#endif
+
+    start = GESTIC_FLASH_NOW();
+    error = gestic_flash_verify(gestic, session_id, image, &matches, timeout);
+    result->verify_time = GESTIC_TIME_SINCE(GESTIC_FLASH_NOW(), start);
+    if(error)
+        return error;
+    if(matches) {
+        result->outcome = gestic_flash_verified;
+        return GESTIC_NO_ERROR;
+    }
+
+    start = GESTIC_FLASH_NOW();
+    error = gestic_flash_image(gestic, session_id, image,
+                               gestic_UpdateFunction_ProgramFlash, timeout);
+    result->program_time = GESTIC_TIME_SINCE(GESTIC_FLASH_NOW(), start);
+    if(!error)
+        result->outcome = gestic_flash_programmed;
+
+    return error;
+}
+
+unsigned int gestic_flash_image_hash(const gestic_flash_image_t *image) {
+    unsigned char header[4];
+    unsigned int hash;
+    int i;
+
+    SET_U32(header, image->record_count);
+    hash = gestic_crc32(0, header, 4);
+    hash = gestic_crc32(hash, image->iv, sizeof(image->iv));
+    hash = gestic_crc32(hash, image->fw_version, sizeof(image->fw_version));
+
+    /* Field by field as the records contain padding */
+    for(i = 0; i < image->record_count; ++i) {
+        const gestic_flash_record_t *record = image->data + i;
+        SET_U16(header, record->address);
+        SET_U8(header + 2, record->length);
+        hash = gestic_crc32(hash, header, 3);
+        hash = gestic_crc32(hash, record->data, sizeof(record->data));
+    }
+
+    return hash;
+}
+
+/* Backoff before starting a new session, doubled with every attempt */
+#define GESTIC_FLASH_BACKOFF 100
+#define GESTIC_FLASH_MAX_BACKOFF 1600
+
+int gestic_flash_resume(gestic_t *gestic,
+                        gestic_flash_image_t *image,
+                        gestic_UpdateFunction_t mode,
+                        gestic_flash_journal_t *journal,
+                        int attempts,
+                        int timeout)
+{
+    unsigned int hash = gestic_flash_image_hash(image);
+    int backoff = GESTIC_FLASH_BACKOFF;
+    int error = GESTIC_NO_ERROR;
+    int attempt;
+
+    GESTIC_ASSERT(gestic && image && journal);
+
+    gestic->flash.journal = journal;
+
+    /* Continue the session of the journal as long as the loader accepts it */
+    if(journal->image_hash == hash && journal->session_id &&
+       journal->acked > 0 && journal->acked < image->record_count)
+    {
+        gestic->flash.session_id = journal->session_id;
+        gestic->flash.session_mode = mode;
+        gestic_flash_progress(gestic, journal->acked, image->record_count);
+        error = gestic_flash_records(gestic, image, journal->acked, mode,
+                                     timeout);
+        if(!error)
+            error = gestic_flash_end(gestic, image->fw_version, timeout);
+        if(!error) {
+            gestic->flash.journal = 0;
+            return GESTIC_NO_ERROR;
+        }
+    }
+
+    for(attempt = 0; attempt < attempts; ++attempt) {
+        if(attempt) {
+            GESTIC_SLEEP(backoff);
+            if(backoff < GESTIC_FLASH_MAX_BACKOFF)
+                backoff *= 2;
+        }
+
+        /* A fresh session id keeps acks of the old session apart */
+        journal->image_hash = hash;
+        journal->session_id = journal->session_id + 1 ? journal->session_id + 1 : 1;
+        journal->acked = 0;
+
+        error = gestic_flash_begin(gestic, journal->session_id, image->iv,
+                                   mode, timeout);
+        if(!error) {
+            gestic_flash_progress(gestic, 0, image->record_count);
+            error = gestic_flash_records(gestic, image, 0, mode, timeout);
+        }
+        if(!error)
+            error = gestic_flash_end(gestic, image->fw_version, timeout);
+        if(!error)
+            break;
+    }
+
+    gestic->flash.journal = 0;
+    return error;
+}
+
+#ifdef __linux__
+
+typedef struct {
+    gestic_flash_journal_t journal;
+    int fd;
+    gestic_flash_progress_t progress;
+    void *opaque;
+} gestic_journal_file_t;
+
+/* Stores the journal before passing the progress on */
+static void CDECL gestic_journal_progress(void *opaque, int done, int total) {
+    gestic_journal_file_t *file = (gestic_journal_file_t *)opaque;
+    ssize_t written;
+
+    /* A journal lagging behind only leads to records being sent again */
+    written = pwrite(file->fd, &file->journal, sizeof(file->journal), 0);
+    (void)written;
+    if(file->progress)
+        file->progress(file->opaque, done, total);
+}
+
+int gestic_flash_resume_file(gestic_t *gestic,
+                             gestic_flash_image_t *image,
+                             gestic_UpdateFunction_t mode,
+                             const char *path,
+                             int attempts,
+                             int timeout)
+{
+    gestic_journal_file_t file;
+    int error;
+
+    GESTIC_ASSERT(gestic && path);
+
+    GESTIC_MEMSET(&file, 0, sizeof(file));
+    file.fd = open(path, O_RDWR | O_CREAT, 0644);
+    if(file.fd < 0)
+        return GESTIC_IO_ERROR;
+    if(read(file.fd, &file.journal, sizeof(file.journal)) != sizeof(file.journal))
+        GESTIC_MEMSET(&file.journal, 0, sizeof(file.journal));
+
+    file.progress = gestic->flash.progress;
+    file.opaque = gestic->flash.progress_opaque;
+    gestic_set_flash_progress(gestic, gestic_journal_progress, &file);
+
+    error = gestic_flash_resume(gestic, image, mode, &file.journal, attempts,
+                                timeout);
+
+    gestic_set_flash_progress(gestic, file.progress, file.opaque);
+    close(file.fd);
+    if(!error)
+        unlink(path);
+
+    return error;
+}
+
+#endif
+
 int gestic_flash_wait_loader_updated(gestic_t *gestic,
                                      int timeout)
 {
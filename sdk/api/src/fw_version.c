@@ -30,6 +30,9 @@ void gestic_handle_version_info(gestic_t *gestic,
     gestic_version_request_t *request;
     int v_size;
     if(size != 132) {
+        GESTIC_METRIC_ADD(gestic, bad_sizes, 1);
+        GESTIC_TRACE_ERROR(gestic, gestic_trace_bad_size,
+                           gestic_msg_Fw_Version_Info, size, 0);
         GESTIC_BAD_DATA("gestic_handle_version_info",
                         "Expected message size of 132 bytes",
                         size);
@@ -43,7 +46,10 @@ void gestic_handle_version_info(gestic_t *gestic,
     GESTIC_SYNC_LOCK(gestic->io_sync);
 #endif
 
+#ifndef GESTIC_NO_FLASH
     gestic->fw_valid = GET_U8(data + 4);
+#endif
+    gestic->ready = 1;
     request = gestic->version_request;
     if(request) {
         v_size = request->size > 120 ? 120 : request->size;
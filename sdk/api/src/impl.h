@@ -30,6 +30,116 @@
 
 #define GESTIC_UNUSED(x) (void)x;
 
+/* ======== Section: Optional Platform Features ======== */
+
+/* GESTIC_TIME_US() falls back to GESTIC_TIME_MS(). Without both no response
+ * times are measured.
+ */
+#if !defined(GESTIC_TIME_US) && defined(GESTIC_TIME_MS)
+#   define GESTIC_TIME_US() ((unsigned int)GESTIC_TIME_MS() * 1000u)
+#endif
+
+/* Milliseconds from START to NOW of GESTIC_TIME_MS(), also across its
+ * wrap-around
+ */
+#define GESTIC_TIME_SINCE(NOW, START) \
+    ((int)((unsigned int)(NOW) - (unsigned int)(START)))
+
+/* Counters of the metrics. Plain operations suffice without threads.
+ * GESTIC_ATOMIC_ADD() returns the previous value.
+ */
+#if defined(GESTIC_SYNC_THREADING) && \
+    (!defined(GESTIC_ATOMIC_ADD) || !defined(GESTIC_ATOMIC_STORE))
+#   error "GESTIC_SYNC_THREADING requires the GESTIC_ATOMIC_*() macros"
+#endif
+#ifndef GESTIC_ATOMIC_ADD
+#   define GESTIC_ATOMIC_ADD(P, X) ((*(P) += (X)) - (X))
+#   define GESTIC_ATOMIC_LOAD(P) (*(P))
+#endif
+#ifndef GESTIC_ATOMIC_STORE
+#   define GESTIC_ATOMIC_STORE(P, X) (*(P) = (X))
+#   define GESTIC_ATOMIC_ACQUIRE(P) (*(P))
+#   define GESTIC_ATOMIC_FENCE_RELEASE() ((void)0)
+#   define GESTIC_ATOMIC_FENCE_ACQUIRE() ((void)0)
+#endif
+
+/* Without GESTIC_SLEEP() retries follow each other immediately */
+#ifndef GESTIC_SLEEP
+#   define GESTIC_SLEEP(MS) ((void)0)
+#endif
+
+/* Static tracing probes, e.g. USDT on Linux */
+#ifndef GESTIC_PROBE2
+#   define GESTIC_PROBE2(NAME, A, B) ((void)0)
+#   define GESTIC_PROBE4(NAME, A, B, C, D) ((void)0)
+#endif
+
+/* ======== Section: Metrics ======== */
+
+/* Define: GESTIC_METRIC_ADD
+ *
+ * Adds X to the counter FIELD of the <gestic_metrics_t> of G.
+ */
+#ifndef GESTIC_NO_METRICS
+#   define GESTIC_METRIC_ADD(G, FIELD, X) GESTIC_ATOMIC_ADD(&(G)->metrics.FIELD, X)
+#else
+#   define GESTIC_METRIC_ADD(G, FIELD, X) ((void)0)
+#endif
+
+#ifndef GESTIC_NO_METRICS
+
+/* Function: gestic_metrics_observe
+ *
+ * Adds a duration in microseconds to a histogram.
+ */
+void gestic_metrics_observe(gestic_histogram_t *histogram, unsigned int value);
+
+#endif
+
+/* ======== Section: Trace ======== */
+
+#ifdef GESTIC_HAS_TRACE
+
+/* Function: gestic_trace
+ *
+ * Records an event in the trace ring of gestic. Use the GESTIC_TRACE_*
+ * macros instead, they drop events above <GESTIC_TRACE_LEVEL>.
+ */
+void gestic_trace(gestic_t *gestic, int level, gestic_trace_event_t event,
+                  int arg0, int arg1, int arg2);
+
+#   define GESTIC_TRACE_ERROR(G, E, A, B, C) gestic_trace(G, 1, E, A, B, C)
+#else
+#   define GESTIC_TRACE_ERROR(G, E, A, B, C) ((void)0)
+#endif
+#if GESTIC_TRACE_LEVEL > 1
+#   define GESTIC_TRACE_INFO(G, E, A, B, C) gestic_trace(G, 2, E, A, B, C)
+#else
+#   define GESTIC_TRACE_INFO(G, E, A, B, C) ((void)0)
+#endif
+#if GESTIC_TRACE_LEVEL > 2
+#   define GESTIC_TRACE_DEBUG(G, E, A, B, C) gestic_trace(G, 3, E, A, B, C)
+#else
+#   define GESTIC_TRACE_DEBUG(G, E, A, B, C) ((void)0)
+#endif
+
+/* ======== Section: Capture ======== */
+
+#ifdef GESTIC_HAS_CAPTURE
+
+/* Function: gestic_capture_add
+ *
+ * Adds a message to the running capture of gestic.
+ */
+void gestic_capture_add(gestic_t *gestic, gestic_capture_direction_t direction,
+                        const void *msg, int size);
+
+#   define GESTIC_CAPTURE(G, D, M, S) \
+        do { if((G)->capture) gestic_capture_add(G, D, M, S); } while(0)
+#else
+#   define GESTIC_CAPTURE(G, D, M, S) ((void)0)
+#endif
+
 /* ======== Section: Message Processing ======== */
 
 /* Function: gestic_handle_system_status
@@ -110,4 +220,118 @@ int gestic_request_message(gestic_t *gestic,
                            unsigned int param,
                            int timeout);
 
+/* Function: gestic_pipeline_send
+ *
+ * Works like <gestic_send_pipelined> and additionally stores the count of
+ * messages that were written but not acknowledged when it returned in
+ * pending, if given.
+ */
+int gestic_pipeline_send(gestic_t *gestic, const void *msgs, int size,
+                         int count, int window, int *errors, int *pending,
+                         int timeout);
+
+/* ======== Section: Runtime Parameter Cache ======== */
+
+/* Function: gestic_param_masked
+ *
+ * Returns whether arg1 of the parameter selects the bits of arg0 that are
+ * changed by <gestic_set_param>.
+ */
+int gestic_param_masked(unsigned short param);
+
+/* Function: gestic_param_cacheable
+ *
+ * Returns whether the parameter is a state of the device rather than an
+ * action, i.e. whether setting it again has no further effect.
+ */
+int gestic_param_cacheable(unsigned short param);
+
+#ifndef GESTIC_NO_PARAM_CACHE
+
+/* Function: gestic_param_cache_unchanged
+ *
+ * Returns whether setting the parameter would not change the device
+ * according to the cache.
+ *
+ * Always returns 0 while the cache is bypassed.
+ */
+int gestic_param_cache_unchanged(gestic_t *gestic, unsigned short param,
+                                 unsigned int arg0, unsigned int arg1);
+
+/* Function: gestic_param_cache_set
+ *
+ * Records the outcome of setting a parameter in the cache.
+ *
+ * error - The result of the instruction. The parameter is dropped from the
+ *         cache on failure.
+ */
+void gestic_param_cache_set(gestic_t *gestic, unsigned short param,
+                            unsigned int arg0, unsigned int arg1, int error);
+
+/* Function: gestic_param_cache_get
+ *
+ * Returns whether the arguments of the parameter as read back from the
+ * device are known and stores them in arg0 and arg1 if those are valid.
+ *
+ * Always returns 0 while the cache is bypassed.
+ */
+int gestic_param_cache_get(gestic_t *gestic, unsigned short param,
+                           unsigned int *arg0, unsigned int *arg1);
+
+#endif
+
+/* ======== Section: Data Output Configuration ======== */
+
+#ifndef GESTIC_NO_DATA_RETRIEVAL
+
+/* Function: gestic_output_update
+ *
+ * Sends the output mask derived by <gestic_set_auto_output_mask> to the
+ * device if it differs from the one configured last.
+ *
+ * Returns 0 on success or a negative value when the request failed.
+ *
+ * This function is called by <gestic_data_stream_update> before new data is
+ * retrieved. A failed request is not repeated until the used data changes.
+ */
+int gestic_output_update(gestic_t *gestic);
+
+/* Function: gestic_presence_update
+ *
+ * Switches between the idle and the full output mask according to
+ * <gestic_set_presence_policy>.
+ *
+ * Returns 0 on success or a negative value when the request failed.
+ *
+ * This function is called by <gestic_data_stream_update> after new data was
+ * retrieved. A failed switch is retried with the next update.
+ */
+int gestic_presence_update(gestic_t *gestic);
+
+#ifndef GESTIC_NO_WATCHDOG
+
+/* Function: gestic_watchdog_record
+ *
+ * Records a runtime parameter that was set successfully to be restored by
+ * the watchdog.
+ *
+ * Parameters beyond GESTIC_WATCHDOG_PARAMS are not restored.
+ */
+void gestic_watchdog_record(gestic_t *gestic, unsigned short param,
+                            unsigned int arg0, unsigned int arg1);
+
+/* Function: gestic_watchdog_update
+ *
+ * Checks whether the data output stalled and restores the device according
+ * to <gestic_set_watchdog>.
+ *
+ * This function is called by <gestic_data_stream_update>. Failures are only
+ * reported as <gestic_event_recovery>.
+ */
+void gestic_watchdog_update(gestic_t *gestic);
+
+#endif
+
+#endif
+
 #endif /* GESTIC_IMPL_H */
@@ -139,6 +139,9 @@ int gestic_open(gestic_t *gestic) {
             CloseHandle(handle);
     } else {
         gestic->io.cdc_serial = handle;
+#ifndef GESTIC_NO_PARAM_CACHE
+        gestic_param_cache_invalidate(gestic);
+#endif
     }
 
     return error;
@@ -165,6 +168,11 @@ int gestic_reset(gestic_t *gestic) {
     if(!WriteFile(handle, reset_msg, sizeof(reset_msg), &bytesWritten, NULL))
         error = GESTIC_IO_ERROR;
 
+#ifndef GESTIC_NO_PARAM_CACHE
+    /* The device starts over with the parameters of the library */
+    gestic_param_cache_invalidate(gestic);
+#endif
+
     return error;
 }
 
@@ -24,111 +24,662 @@
 
 #if defined(GESTIC_USE_IO_CDC_SERIAL) && defined(__linux__)
 
+#include <errno.h>
 #include <fcntl.h>
+#include <linux/serial.h>
+#include <poll.h>
+#include <stdlib.h>
+#include <string.h>
 #include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <time.h>
 #include <unistd.h>
 #include <termios.h>
 
 #define DEVICE "/dev/gestic"
 
-int gestic_open(gestic_t *gestic) {
-    int error = GESTIC_NO_ERROR;
+/* The descriptor is stored in place of a pointer */
+#define DEVICE_FD(GESTIC) ((int)(long)(GESTIC)->io.cdc_serial)
+
+/* Sensor_Data_Output time stamps advance every 5 ms */
+#define REPLAY_TICK_US 5000
+
+/* Replays wait inside read for messages due within that time */
+#define REPLAY_MAX_WAIT_US 10000
+
+/* ======== File Descriptor Operations ======== */
+
+/* Microseconds of a monotonic clock */
+static long long time_us(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1000000LL + now.tv_nsec / 1000;
+}
+
+static void fd_close(gestic_t *gestic) {
+    close(DEVICE_FD(gestic));
+}
+
+static int fd_read(gestic_t *gestic, void *buffer, int maxsize) {
+    int result = read(DEVICE_FD(gestic), buffer, maxsize);
+    if(result <= 0)
+        result = GESTIC_IO_ERROR;
+    return result;
+}
+
+static int fd_wait(gestic_t *gestic, int timeout) {
+    struct pollfd pfd;
+
+    pfd.fd = DEVICE_FD(gestic);
+    pfd.events = POLLIN;
+    pfd.revents = 0;
+    return poll(&pfd, 1, timeout) < 0 ? GESTIC_IO_ERROR : (pfd.revents != 0);
+}
+
+static int fd_write(gestic_t *gestic, const void *buffer, int size) {
+    int result = write(DEVICE_FD(gestic), buffer, size);
+    if(result <= 0)
+        result = GESTIC_IO_ERROR;
+    return result;
+}
+
+/* Control message of the kernel module that resets the device */
+static int fd_reset(gestic_t *gestic) {
+    const unsigned char reset_msg[] = {
+        0xFE, 0xFF, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00
+    };
+
+    if(write(DEVICE_FD(gestic), reset_msg, sizeof(reset_msg)) != sizeof(reset_msg))
+        return GESTIC_IO_ERROR;
+    return GESTIC_NO_ERROR;
+}
+
+const char *gestic_uri_option(const char *options, const char *name) {
+    int length = strlen(name);
+
+    while(options && *options) {
+        if(!strncmp(options, name, length) && options[length] == '=')
+            return options + length + 1;
+        options = strchr(options, '&');
+        if(options)
+            ++options;
+    }
+    return NULL;
+}
+
+int gestic_uri_path(char *buffer, int size, const char *path,
+                     const char *options)
+{
+    int length = options ? (int)(options - path - 1) : (int)strlen(path);
+
+    if(length <= 0 || length >= size)
+        return GESTIC_BAD_PARAM_ERROR;
+    memcpy(buffer, path, length);
+    buffer[length] = 0;
+    return GESTIC_NO_ERROR;
+}
+
+/* ======== Backend: Kernel Module Device ======== */
+
+static int dev_open(gestic_t *gestic, const char *path, const char *options) {
+    char name[256];
     int device;
 
-    device = open(DEVICE, O_RDWR | O_NOCTTY | O_NDELAY);
+    if(gestic_uri_path(name, sizeof(name), path, options))
+        return GESTIC_BAD_PARAM_ERROR;
+
+    device = open(name, O_RDWR | O_NOCTTY | O_NDELAY);
     if(device == -1)
-        error = GESTIC_IO_OPEN_ERROR;
+        return GESTIC_IO_OPEN_ERROR;
 
-#if disabled_for_ninja_sphere
-    /* Set terminal parameters */
-    if(!error) {
-        struct termios io;
-        int iFlags;
+    gestic->io.cdc_serial = (void*)(long)device;
+    return GESTIC_NO_ERROR;
+}
 
-        memset(&io, 0, sizeof(io));
+static const gestic_backend_t dev_backend = {
+    "dev", dev_open, fd_close, fd_read, fd_wait, fd_write, fd_reset
+};
 
-        if(tcgetattr(device, &io))
-            error = GESTIC_IO_CTL_ERROR;
+/* ======== Backend: Serial Port ======== */
+
+static speed_t tty_speed(int baud) {
+    switch(baud) {
+    case 9600: return B9600;
+    case 19200: return B19200;
+    case 38400: return B38400;
+    case 57600: return B57600;
+    case 115200: return B115200;
+    case 230400: return B230400;
+    case 460800: return B460800;
+    case 921600: return B921600;
+    default: return B0;
+    }
+}
+
+/* Returns whether a boolean option is enabled, defaulting to fallback */
+static int tty_flag(const char *options, const char *name, int fallback) {
+    const char *value = gestic_uri_option(options, name);
+    return value ? atoi(value) != 0 : fallback;
+}
+
+static int tty_open(gestic_t *gestic, const char *path, const char *options) {
+    const char *baud = gestic_uri_option(options, "baud");
+    struct termios io;
+    struct serial_struct serial;
+    int error;
+    int device;
+    int flags;
+
+    if(baud && tty_speed(atoi(baud)) == B0)
+        return GESTIC_BAD_PARAM_ERROR;
+
+    error = dev_open(gestic, path, options);
+    if(error)
+        return error;
+    device = DEVICE_FD(gestic);
 
-        if(!error) {
-            io.c_iflag = 0;
-            io.c_oflag = 0;
-            io.c_lflag = 0;
-            io.c_cflag = CS8;
-            io.c_cc[VMIN] = 1;
+    /* Set terminal parameters unless the line is set up elsewhere */
+    if(tty_flag(options, "raw", 1)) {
+        memset(&io, 0, sizeof(io));
+        if(tcgetattr(device, &io)) {
+            error = GESTIC_IO_CTL_ERROR;
+        } else {
+            cfmakeraw(&io);
+            io.c_cflag |= CLOCAL | CREAD;
+            /* Reads never block and return whatever arrived so far, waiting
+             * is done with poll() which wakes up with the first byte of a
+             * message.
+             */
+            io.c_cc[VMIN] = 0;
             io.c_cc[VTIME] = 0;
+            if(baud) {
+                cfsetispeed(&io, tty_speed(atoi(baud)));
+                cfsetospeed(&io, tty_speed(atoi(baud)));
+            }
             if(tcsetattr(device, TCSANOW, &io))
                 error = GESTIC_IO_CTL_ERROR;
         }
+    }
 
-        /* Turn on DTR */
-        if(!error) {
-            iFlags = TIOCM_DTR;
-            if(ioctl(device, TIOCMBIS, &iFlags))
-                error = GESTIC_IO_CTL_ERROR;
-        }
+    /* Serial drivers might deliver data in larger batches otherwise.
+     * Not supported by every driver (e.g. ptys) so failing is fine.
+     */
+    if(!error && tty_flag(options, "lowlatency", 1) &&
+       !ioctl(device, TIOCGSERIAL, &serial))
+    {
+        serial.flags |= ASYNC_LOW_LATENCY;
+        ioctl(device, TIOCSSERIAL, &serial);
+    }
+
+    /* Turn on DTR, USB CDC bridges only send while it is set */
+    if(!error && tty_flag(options, "dtr", 1)) {
+        flags = TIOCM_DTR;
+        ioctl(device, TIOCMBIS, &flags);
+    }
+
+    /* Discard what was received while nobody was listening */
+    if(!error)
+        tcflush(device, TCIOFLUSH);
+
+    if(error)
+        close(device);
+    return error;
+}
+
+static const gestic_backend_t tty_backend = {
+    "tty", tty_open, fd_close, fd_read, fd_wait, fd_write, fd_reset
+};
+
+/* ======== Backend: Unix Domain Socket ======== */
+
+static int unix_open(gestic_t *gestic, const char *path, const char *options) {
+    struct sockaddr_un address;
+    int device;
+
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    if(gestic_uri_path(address.sun_path, sizeof(address.sun_path), path, options))
+        return GESTIC_BAD_PARAM_ERROR;
+
+    device = socket(AF_UNIX, SOCK_STREAM, 0);
+    if(device == -1)
+        return GESTIC_IO_OPEN_ERROR;
+
+    if(connect(device, (struct sockaddr*)&address, sizeof(address)) ||
+       fcntl(device, F_SETFL, fcntl(device, F_GETFL) | O_NONBLOCK))
+    {
+        close(device);
+        return GESTIC_IO_OPEN_ERROR;
     }
+
+    gestic->io.cdc_serial = (void*)(long)device;
+    return GESTIC_NO_ERROR;
+}
+
+static const gestic_backend_t unix_backend = {
+    "unix", unix_open, fd_close, fd_read, fd_wait, fd_write, fd_reset
+};
+
+/* ======== Backend: Replay of Captures ======== */
+
+static int replay_open(gestic_t *gestic, const char *path, const char *options) {
+    gestic_replay_t *replay = &gestic->io.replay;
+    const char *speed = gestic_uri_option(options, "speed");
+#ifdef GESTIC_HAS_CAPTURE
+    gestic_capture_header_t header;
 #endif
+    char name[256];
+    int device;
+
+    if(gestic_uri_path(name, sizeof(name), path, options))
+        return GESTIC_BAD_PARAM_ERROR;
 
-    if(error) {
-        if(device != -1)
-            close(device);
+    GESTIC_MEMSET(replay, 0, sizeof(*replay));
+    replay->time_stamp = -1;
+    replay->speed = 100;
+    if(speed && !strncmp(speed, "max", 3))
+        replay->speed = 0;
+    else if(speed)
+        replay->speed = (int)(atof(speed) * 100);
+    if(replay->speed < 0 || (speed && replay->speed == 0 && strncmp(speed, "max", 3)))
+        return GESTIC_BAD_PARAM_ERROR;
+
+    device = open(name, O_RDONLY);
+    if(device == -1)
+        return GESTIC_IO_OPEN_ERROR;
+
+#ifdef GESTIC_HAS_CAPTURE
+    /* Capture files start with their header, raw dumps with FE FF */
+    if(read(device, &header, sizeof(header)) == sizeof(header) &&
+       !memcmp(header.magic, "GCAP", 4) && header.version == 1)
+    {
+        replay->capture = 1;
+        replay->start_due = -1;
+        lseek(device, header.header_size, SEEK_SET);
     } else {
-        gestic->io.cdc_serial = (void*)device;
+        lseek(device, 0, SEEK_SET);
+    }
+#endif
+
+    gestic->io.cdc_serial = (void*)(long)device;
+    return GESTIC_NO_ERROR;
+}
+
+/* Returns the next byte of the capture or -1 at its end */
+static int replay_byte(gestic_t *gestic) {
+    gestic_replay_t *replay = &gestic->io.replay;
+
+    if(replay->input_cursor >= replay->input_size) {
+        int result = read(DEVICE_FD(gestic), replay->input, sizeof(replay->input));
+        if(result <= 0)
+            return -1;
+        replay->input_cursor = 0;
+        replay->input_size = result;
+    }
+    return replay->input[replay->input_cursor++];
+}
+
+#ifdef GESTIC_HAS_CAPTURE
+
+/* Reads size bytes of the capture, returns zero at its end */
+static int replay_bytes(gestic_t *gestic, void *buffer, int size) {
+    unsigned char *p = (unsigned char *)buffer;
+    int c;
+
+    for(; size > 0; --size) {
+        if((c = replay_byte(gestic)) < 0)
+            return 0;
+        *p++ = (unsigned char)c;
+    }
+    return 1;
+}
+
+/* Extracts the next received message of a capture file into replay->msg
+ * and its time into replay->record_time. Sent messages are skipped.
+ */
+static int replay_next_record(gestic_t *gestic) {
+    gestic_replay_t *replay = &gestic->io.replay;
+    gestic_capture_chunk_t chunk;
+    unsigned char record[6];
+    unsigned int delta;
+    int size;
+
+    for(;;) {
+        /* The index following the last chunk ends the capture */
+        if(!replay->chunk_left) {
+            if(!replay_bytes(gestic, &chunk, sizeof(chunk)) ||
+               memcmp(chunk.magic, "GCHK", 4))
+                return 0;
+            replay->chunk_left = chunk.size;
+            replay->chunk_time = chunk.time;
+            continue;
+        }
+
+        if(replay->chunk_left < sizeof(record) ||
+           !replay_bytes(gestic, record, sizeof(record)))
+            return 0;
+        size = record[5];
+        if(replay->chunk_left < sizeof(record) + size ||
+           !replay_bytes(gestic, replay->msg + 2, size))
+            return 0;
+        replay->chunk_left -= sizeof(record) + size;
+
+        if(record[4] != gestic_capture_received || size < 4)
+            continue;
+        GESTIC_MEMCPY(&delta, record, 4);
+        replay->record_time = replay->chunk_time + delta;
+        replay->msg[0] = 0xFE;
+        replay->msg[1] = 0xFF;
+        return 2 + size;
+    }
+}
+
+#endif
+
+/* Extracts the next message of the capture into replay->msg */
+static int replay_next(gestic_t *gestic) {
+    gestic_replay_t *replay = &gestic->io.replay;
+    int size, i, c;
+
+    for(;;) {
+        if((c = replay_byte(gestic)) < 0)
+            return 0;
+        if(c != 0xFE)
+            continue;
+        if((c = replay_byte(gestic)) < 0)
+            return 0;
+        if(c != 0xFF)
+            continue;
+        if((size = replay_byte(gestic)) < 0)
+            return 0;
+        if(size >= 4)
+            break;
+    }
+
+    replay->msg[0] = 0xFE;
+    replay->msg[1] = 0xFF;
+    replay->msg[2] = size;
+    for(i = 1; i < size; ++i) {
+        if((c = replay_byte(gestic)) < 0)
+            return 0;
+        replay->msg[2 + i] = c;
+    }
+    return 2 + size;
+}
+
+/* Holds back the next message of the capture and determines when it is due.
+ *
+ * Returns zero at the end of the capture.
+ */
+static int replay_fetch(gestic_t *gestic, long long now) {
+    gestic_replay_t *replay = &gestic->io.replay;
+
+#ifdef GESTIC_HAS_CAPTURE
+    /* Messages of capture files are due at the time they were received */
+    if(!replay->held && replay->capture) {
+        replay->held = replay_next_record(gestic);
+        if(replay->held && replay->speed) {
+            if(replay->start_due < 0) {
+                replay->start_due = now;
+                replay->start_time = replay->record_time;
+            }
+            replay->due = replay->start_due +
+                          (long long)(replay->record_time - replay->start_time) *
+                          100 / replay->speed;
+        }
+        return replay->held;
+    }
+#endif
+
+    if(!replay->held) {
+        replay->held = replay_next(gestic);
+        if(!replay->held)
+            return 0;
+
+        if(replay->msg[5] == gestic_msg_Sensor_Data_Output && replay->speed) {
+            int time_stamp = replay->msg[2 + 6];
+            if(replay->time_stamp < 0)
+                replay->due = now;
+            else
+                replay->due += ((time_stamp - replay->time_stamp) & 0xFF) *
+                               (REPLAY_TICK_US * 100LL / replay->speed);
+            replay->time_stamp = time_stamp;
+        }
+    }
+    return replay->held;
+}
+
+static int replay_read(gestic_t *gestic, void *buffer, int maxsize) {
+    gestic_replay_t *replay = &gestic->io.replay;
+    long long now;
+
+    /* Acknowledgements come first */
+    if(replay->status_size) {
+        int size = replay->status_size < maxsize ? replay->status_size : maxsize;
+        GESTIC_MEMCPY(buffer, replay->status, size);
+        replay->status_size -= size;
+        memmove(replay->status, replay->status + size, replay->status_size);
+        return size;
+    }
+
+    now = time_us();
+    if(!replay_fetch(gestic, now))
+        return GESTIC_IO_ERROR;
+
+    if(replay->speed && replay->due > now) {
+        if(replay->due - now > REPLAY_MAX_WAIT_US)
+            return GESTIC_IO_ERROR;
+        usleep((useconds_t)(replay->due - now));
+    }
+
+    if(replay->held > maxsize)
+        return GESTIC_IO_ERROR;
+    GESTIC_MEMCPY(buffer, replay->msg, replay->held);
+    maxsize = replay->held;
+    replay->held = 0;
+    return maxsize;
+}
+
+static int replay_wait(gestic_t *gestic, int timeout) {
+    gestic_replay_t *replay = &gestic->io.replay;
+    long long now = time_us();
+    long long delay = timeout * 1000LL;
+
+    if(replay->status_size)
+        return 1;
+
+    /* Nothing follows at the end of the capture */
+    if(!replay_fetch(gestic, now)) {
+        usleep((useconds_t)delay);
+        return 0;
+    }
+
+    if(!replay->speed || replay->due <= now)
+        return 1;
+    if(replay->due - now < delay)
+        delay = replay->due - now;
+
+    usleep((useconds_t)delay);
+    return time_us() >= replay->due;
+}
+
+/* Acknowledges messages as the capture contains no responses */
+static int replay_write(gestic_t *gestic, const void *buffer, int size) {
+    gestic_replay_t *replay = &gestic->io.replay;
+    const unsigned char *msg = (const unsigned char *)buffer;
+
+    /* Messages follow their FE FF in a separate write */
+    if(size >= 4 && msg[0] == size &&
+       replay->status_size + 18 <= GESTIC_REPLAY_STATUS_CAPACITY)
+    {
+        unsigned char *status = replay->status + replay->status_size;
+        GESTIC_MEMSET(status, 0, 18);
+        status[0] = 0xFE;
+        status[1] = 0xFF;
+        status[2] = 16;
+        status[5] = gestic_msg_System_Status;
+        status[6] = msg[3];
+        replay->status_size += 18;
+    }
+    return size;
+}
+
+static int replay_reset(gestic_t *gestic) {
+    GESTIC_UNUSED(gestic)
+    return GESTIC_NO_ERROR;
+}
+
+static const gestic_backend_t replay_backend = {
+    "replay", replay_open, fd_close, replay_read, replay_wait, replay_write,
+    replay_reset
+};
+
+/* ======== Connection Handling ======== */
+
+static const gestic_backend_t * const backends[] = {
+    &dev_backend, &tty_backend, &unix_backend, &replay_backend,
+    &gestic_i2c_backend
+};
+
+int gestic_open_uri(gestic_t *gestic, const char *uri) {
+    const gestic_backend_t *backend = &dev_backend;
+    const char *path = uri;
+    const char *options;
+    int error;
+    int i;
+
+    GESTIC_ASSERT(gestic && uri);
+
+    for(i = 0; i < (int)(sizeof(backends) / sizeof(backends[0])); ++i) {
+        int length = strlen(backends[i]->scheme);
+        if(!strncmp(uri, backends[i]->scheme, length) && uri[length] == ':') {
+            backend = backends[i];
+            path = uri + length + 1;
+            break;
+        }
+    }
+
+    options = strchr(path, '?');
+    if(options)
+        ++options;
+
+    error = backend->open(gestic, path, options);
+    if(!error) {
+        gestic->io.backend = backend;
+#ifndef GESTIC_NO_PARAM_CACHE
+        gestic_param_cache_invalidate(gestic);
+#endif
     }
 
     return error;
 }
 
+int gestic_open(gestic_t *gestic) {
+    const char *uri = getenv("GESTIC_DEVICE");
+
+    if(!uri || !*uri)
+        uri = DEVICE;
+
+    return gestic_open_uri(gestic, uri);
+}
+
 void gestic_close(gestic_t *gestic) {
     GESTIC_ASSERT(gestic && GESTIC_CONNECTED(gestic));
 
-    close((int)gestic->io.cdc_serial);
+    gestic->io.backend->close(gestic);
     gestic->io.cdc_serial = 0;
 }
 
 int gestic_reset(gestic_t *gestic) {
-    const unsigned char reset_msg[] = {
-        0xFE, 0xFF, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00
-    };
-    int device = -1;
-    int error = GESTIC_NO_ERROR;
+    int error;
 
     GESTIC_ASSERT(gestic && GESTIC_CONNECTED(gestic));
 
-    device = (int)gestic->io.cdc_serial;
-    if(write(device, reset_msg, sizeof(reset_msg)) != sizeof(reset_msg))
-        error = GESTIC_IO_ERROR;
+    error = gestic->io.backend->reset(gestic);
+
+#ifndef GESTIC_NO_PARAM_CACHE
+    /* The device starts over with the parameters of the library */
+    gestic_param_cache_invalidate(gestic);
+#endif
 
     return error;
 }
 
 int gestic_serial_read(gestic_t *gestic, void *buffer, int maxsize) {
+    gestic_latency_t *latency = &gestic->io.latency;
+    long long start = 0;
     int result;
-    int device = -1;
 
     GESTIC_ASSERT(gestic && GESTIC_CONNECTED(gestic));
 
-    device = (int)gestic->io.cdc_serial;
-    result = read(device, buffer, maxsize);
-    if(result <= 0)
-        result = GESTIC_IO_ERROR;
+    if(latency->enabled)
+        start = time_us();
+
+    result = gestic->io.backend->read(gestic, buffer, maxsize);
+
+    /* Data counts as readable since the wait that found it */
+    if(latency->enabled && result > 0) {
+        latency->ready_time = latency->wait_time ? latency->wait_time : start;
+        latency->wait_time = 0;
+    }
 
     return result;
 }
 
-int gestic_serial_write(gestic_t *gestic, void *buffer, int size) {
+int gestic_serial_wait(gestic_t *gestic, int timeout) {
     int result;
-    int device = -1;
 
     GESTIC_ASSERT(gestic && GESTIC_CONNECTED(gestic));
 
-    device = (int)gestic->io.cdc_serial;
-    result = write(device, buffer, size);
-    if(result <= 0)
-        result = GESTIC_IO_ERROR;
+    result = gestic->io.backend->wait(gestic, timeout);
+    if(gestic->io.latency.enabled && result > 0)
+        gestic->io.latency.wait_time = time_us();
 
     return result;
 }
 
+/* ======== Read Latency ======== */
+
+void gestic_measure_read_latency(gestic_t *gestic, int enable) {
+    GESTIC_ASSERT(gestic);
+
+    GESTIC_MEMSET(&gestic->io.latency, 0, sizeof(gestic->io.latency));
+    gestic->io.latency.enabled = enable ? 1 : 0;
+}
+
+void gestic_get_read_latency(gestic_t *gestic, gestic_read_latency_t *latency) {
+    const gestic_latency_t *measured = &gestic->io.latency;
+
+    GESTIC_ASSERT(gestic && latency);
+
+    latency->messages = measured->messages;
+    latency->min = measured->min;
+    latency->max = measured->max;
+    latency->average = measured->messages ?
+                       (int)(measured->total / measured->messages) : 0;
+}
+
+void gestic_read_latency_add(gestic_t *gestic) {
+    gestic_latency_t *latency = &gestic->io.latency;
+    int value;
+
+    if(!latency->enabled || !latency->ready_time)
+        return;
+
+    value = (int)(time_us() - latency->ready_time);
+    if(!latency->messages || value < latency->min)
+        latency->min = value;
+    if(value > latency->max)
+        latency->max = value;
+    latency->total += value;
+    ++latency->messages;
+}
+
+int gestic_serial_write(gestic_t *gestic, void *buffer, int size) {
+    GESTIC_ASSERT(gestic && GESTIC_CONNECTED(gestic));
+
+    return gestic->io.backend->write(gestic, buffer, size);
+}
+
 #endif
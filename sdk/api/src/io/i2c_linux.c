@@ -0,0 +1,346 @@
+/******************************************************************************
+ *
+ * Copyright (C) 2014 Microchip Technology Inc. and its
+ *                    subsidiaries ("Microchip").
+ *
+ * All rights reserved.
+ *
+ * You are permitted to use the Aurea software, GestIC API, and other
+ * accompanying software with Microchip products.  Refer to the license
+ * agreement accompanying this software, if any, for additional info regarding
+ * your rights and obligations.
+ *
+ * SOFTWARE AND DOCUMENTATION ARE PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION, ANY WARRANTY OF
+ * MERCHANTABILITY, TITLE, NON-INFRINGEMENT AND FITNESS FOR A PARTICULAR
+ * PURPOSE. IN NO EVENT SHALL MICROCHIP, SMSC, OR ITS LICENSORS BE LIABLE OR
+ * OBLIGATED UNDER CONTRACT, NEGLIGENCE, STRICT LIABILITY, CONTRIBUTION, BREACH
+ * OF WARRANTY, OR OTHER LEGAL EQUITABLE THEORY FOR ANY DIRECT OR INDIRECT
+ * DAMAGES OR EXPENSES INCLUDING BUT NOT LIMITED TO ANY INCIDENTAL, SPECIAL,
+ * INDIRECT OR CONSEQUENTIAL DAMAGES, OR OTHER SIMILAR COSTS.
+ *
+ ******************************************************************************/
+#include "io.h"
+
+#if defined(GESTIC_USE_IO_CDC_SERIAL) && defined(__linux__)
+
+#include <fcntl.h>
+#include <linux/gpio.h>
+#include <linux/i2c.h>
+#include <linux/i2c-dev.h>
+#include <poll.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <time.h>
+#include <unistd.h>
+
+/* This backend does in userspace what the kernel module does:
+ *
+ * The device pulls the open-drain TS line low when a message is available.
+ * The host then holds TS low itself while reading the message via I2C and
+ * releases it afterwards. Messages to the device are plain I2C writes and
+ * a reset is done by pulling MCLR low.
+ */
+
+/* Defaults match the wiring of the Ninja Sphere */
+#define I2C_DEFAULT_ADDRESS 0x42
+#define I2C_DEFAULT_CHIP "/dev/gpiochip3"
+#define I2C_DEFAULT_TS 10
+#define I2C_DEFAULT_MCLR 4
+#define I2C_DEFAULT_WAIT 0
+
+/* Same read size as the kernel module, long enough for any message */
+#define I2C_READ_SIZE 138
+
+/* Time the device gets to release TS after a transfer */
+#define I2C_TS_RELEASE_MS 10
+
+/* Upper bound for the device to assert TS after a reset */
+#define I2C_RESET_TIMEOUT_MS 20
+
+#define I2C_FD(GESTIC) ((int)(long)(GESTIC)->io.cdc_serial)
+
+static int i2c_time_ms(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (int)(now.tv_sec * 1000 + now.tv_nsec / 1000000);
+}
+
+/* Reads an integer option or returns fallback if it is missing */
+static int i2c_option(const char *options, const char *name, int fallback) {
+    const char *value = gestic_uri_option(options, name);
+    return value ? (int)strtol(value, NULL, 0) : fallback;
+}
+
+/* Requests a single line of the GPIO chip and returns its descriptor */
+static int i2c_request_line(int chip, int line, unsigned long long flags,
+                            int value)
+{
+    struct gpio_v2_line_request request;
+
+    GESTIC_MEMSET(&request, 0, sizeof(request));
+    request.offsets[0] = line;
+    request.num_lines = 1;
+    strcpy(request.consumer, "gestic");
+    request.config.flags = flags;
+    if(flags & GPIO_V2_LINE_FLAG_OUTPUT) {
+        request.config.num_attrs = 1;
+        request.config.attrs[0].attr.id = GPIO_V2_LINE_ATTR_ID_OUTPUT_VALUES;
+        request.config.attrs[0].attr.values = value;
+        request.config.attrs[0].mask = 1;
+    }
+
+    if(ioctl(chip, GPIO_V2_GET_LINE_IOCTL, &request) < 0)
+        return -1;
+    return request.fd;
+}
+
+/* Switches TS between being held low by the host and being an input that
+ * reports both edges.
+ */
+static int i2c_ts_hold(gestic_t *gestic, int hold) {
+    struct gpio_v2_line_config config;
+
+    GESTIC_MEMSET(&config, 0, sizeof(config));
+    if(hold) {
+        config.flags = GPIO_V2_LINE_FLAG_OUTPUT | GPIO_V2_LINE_FLAG_OPEN_DRAIN;
+        config.num_attrs = 1;
+        config.attrs[0].attr.id = GPIO_V2_LINE_ATTR_ID_OUTPUT_VALUES;
+        config.attrs[0].attr.values = 0;
+        config.attrs[0].mask = 1;
+    } else {
+        config.flags = GPIO_V2_LINE_FLAG_INPUT | GPIO_V2_LINE_FLAG_BIAS_PULL_UP |
+                       GPIO_V2_LINE_FLAG_EDGE_RISING | GPIO_V2_LINE_FLAG_EDGE_FALLING;
+    }
+
+    if(ioctl(gestic->io.i2c.ts, GPIO_V2_LINE_SET_CONFIG_IOCTL, &config) < 0)
+        return GESTIC_IO_CTL_ERROR;
+    return GESTIC_NO_ERROR;
+}
+
+static int i2c_line_value(int line) {
+    struct gpio_v2_line_values values;
+
+    values.bits = 0;
+    values.mask = 1;
+    if(ioctl(line, GPIO_V2_LINE_GET_VALUES_IOCTL, &values) < 0)
+        return -1;
+    return (int)(values.bits & 1);
+}
+
+static int i2c_set_line(int line, int value) {
+    struct gpio_v2_line_values values;
+
+    values.bits = value ? 1 : 0;
+    values.mask = 1;
+    if(ioctl(line, GPIO_V2_LINE_SET_VALUES_IOCTL, &values) < 0)
+        return GESTIC_IO_ERROR;
+    return GESTIC_NO_ERROR;
+}
+
+/* Blocks on edge events of TS until it is in the requested state.
+ *
+ * Returns <GESTIC_NO_DATA> if that did not happen within timeout.
+ */
+static int i2c_wait_ts(gestic_t *gestic, int asserted, int timeout) {
+    struct gpio_v2_line_event event;
+    struct pollfd pfd;
+    int deadline = i2c_time_ms() + timeout;
+    int remaining;
+    int value;
+
+    pfd.fd = gestic->io.i2c.ts;
+    pfd.events = POLLIN;
+
+    for(;;) {
+        /* Drop the events that were already seen */
+        while(read(pfd.fd, &event, sizeof(event)) == sizeof(event))
+            ;
+
+        value = i2c_line_value(pfd.fd);
+        if(value < 0)
+            return GESTIC_IO_ERROR;
+        if(value == !asserted)
+            return GESTIC_NO_ERROR;
+
+        remaining = deadline - i2c_time_ms();
+        if(remaining <= 0 || poll(&pfd, 1, remaining) <= 0)
+            return GESTIC_NO_DATA;
+    }
+}
+
+static int i2c_open(gestic_t *gestic, const char *path, const char *options) {
+    gestic_i2c_t *i2c = &gestic->io.i2c;
+    const char *chip_option = gestic_uri_option(options, "chip");
+    char name[256];
+    char chip_name[256];
+    int chip;
+    int device;
+    int length;
+
+    if(gestic_uri_path(name, sizeof(name), path, options))
+        return GESTIC_BAD_PARAM_ERROR;
+
+    strcpy(chip_name, I2C_DEFAULT_CHIP);
+    if(chip_option) {
+        length = strcspn(chip_option, "&");
+        if(!length || length >= (int)sizeof(chip_name))
+            return GESTIC_BAD_PARAM_ERROR;
+        memcpy(chip_name, chip_option, length);
+        chip_name[length] = 0;
+    }
+
+    GESTIC_MEMSET(i2c, 0, sizeof(*i2c));
+    i2c->address = i2c_option(options, "addr", I2C_DEFAULT_ADDRESS);
+    i2c->wait = i2c_option(options, "wait", I2C_DEFAULT_WAIT);
+
+    device = open(name, O_RDWR);
+    if(device == -1)
+        return GESTIC_IO_OPEN_ERROR;
+
+    chip = open(chip_name, O_RDWR);
+    if(chip == -1) {
+        close(device);
+        return GESTIC_IO_OPEN_ERROR;
+    }
+
+    /* Just make sure the device is not held in reset */
+    i2c->ts = i2c_request_line(chip, i2c_option(options, "ts", I2C_DEFAULT_TS),
+                               GPIO_V2_LINE_FLAG_INPUT |
+                               GPIO_V2_LINE_FLAG_BIAS_PULL_UP |
+                               GPIO_V2_LINE_FLAG_EDGE_RISING |
+                               GPIO_V2_LINE_FLAG_EDGE_FALLING, 0);
+    i2c->mclr = i2c_request_line(chip, i2c_option(options, "mclr", I2C_DEFAULT_MCLR),
+                                 GPIO_V2_LINE_FLAG_OUTPUT, 1);
+    close(chip);
+
+    if(i2c->ts < 0 || i2c->mclr < 0) {
+        if(i2c->ts >= 0)
+            close(i2c->ts);
+        if(i2c->mclr >= 0)
+            close(i2c->mclr);
+        close(device);
+        return GESTIC_IO_CTL_ERROR;
+    }
+
+    fcntl(i2c->ts, F_SETFL, fcntl(i2c->ts, F_GETFL) | O_NONBLOCK);
+
+    /* Give a device that was held in reset the chance to come up */
+    if(i2c_wait_ts(gestic, 1, I2C_RESET_TIMEOUT_MS) == GESTIC_IO_ERROR) {
+        close(i2c->ts);
+        close(i2c->mclr);
+        close(device);
+        return GESTIC_IO_CTL_ERROR;
+    }
+
+    gestic->io.cdc_serial = (void*)(long)device;
+    return GESTIC_NO_ERROR;
+}
+
+static void i2c_close(gestic_t *gestic) {
+    close(gestic->io.i2c.ts);
+    close(gestic->io.i2c.mclr);
+    close(I2C_FD(gestic));
+}
+
+static int i2c_transfer(gestic_t *gestic, int flags, void *data, int size) {
+    struct i2c_msg msg;
+    struct i2c_rdwr_ioctl_data rdwr;
+
+    msg.addr = gestic->io.i2c.address;
+    msg.flags = flags;
+    msg.len = size;
+    msg.buf = (unsigned char *)data;
+    rdwr.msgs = &msg;
+    rdwr.nmsgs = 1;
+
+    if(ioctl(I2C_FD(gestic), I2C_RDWR, &rdwr) < 0)
+        return GESTIC_IO_ERROR;
+    return GESTIC_NO_ERROR;
+}
+
+static int i2c_read(gestic_t *gestic, void *buffer, int maxsize) {
+    gestic_i2c_t *i2c = &gestic->io.i2c;
+    unsigned char data[I2C_READ_SIZE];
+    int error;
+    int size;
+
+    if(i2c->cursor >= i2c->size) {
+        /* Nothing to read unless the device asserts TS */
+        if(i2c_wait_ts(gestic, 1, i2c->wait))
+            return GESTIC_IO_ERROR;
+
+        /* Hold TS so that the message is not updated during the transfer */
+        error = i2c_ts_hold(gestic, 1);
+        if(!error)
+            error = i2c_transfer(gestic, I2C_M_RD, data, sizeof(data));
+        if(i2c_ts_hold(gestic, 0) && !error)
+            error = GESTIC_IO_CTL_ERROR;
+        if(!error)
+            i2c_wait_ts(gestic, 0, I2C_TS_RELEASE_MS);
+
+        if(error || data[0] < 4)
+            return GESTIC_IO_ERROR;
+
+        size = data[0] < sizeof(data) ? data[0] : sizeof(data);
+        i2c->msg[0] = 0xFE;
+        i2c->msg[1] = 0xFF;
+        GESTIC_MEMCPY(i2c->msg + 2, data, size);
+        i2c->size = 2 + size;
+        i2c->cursor = 0;
+    }
+
+    size = i2c->size - i2c->cursor;
+    if(size > maxsize)
+        size = maxsize;
+    GESTIC_MEMCPY(buffer, i2c->msg + i2c->cursor, size);
+    i2c->cursor += size;
+    return size;
+}
+
+static int i2c_wait(gestic_t *gestic, int timeout) {
+    int error;
+
+    if(gestic->io.i2c.cursor < gestic->io.i2c.size)
+        return 1;
+
+    error = i2c_wait_ts(gestic, 1, timeout);
+    if(error == GESTIC_NO_DATA)
+        return 0;
+    return error ? error : 1;
+}
+
+static int i2c_write(gestic_t *gestic, const void *buffer, int size) {
+    const unsigned char *msg = (const unsigned char *)buffer;
+
+    /* The device does not expect the FE FF written ahead of each message */
+    if(size == 2 && msg[0] == 0xFE && msg[1] == 0xFF)
+        return size;
+
+    if(i2c_transfer(gestic, 0, (void *)buffer, size))
+        return GESTIC_IO_ERROR;
+    return size;
+}
+
+static int i2c_reset(gestic_t *gestic) {
+    int mclr = gestic->io.i2c.mclr;
+
+    gestic->io.i2c.size = 0;
+    if(i2c_set_line(mclr, 0))
+        return GESTIC_IO_ERROR;
+    GESTIC_SLEEP(5);
+    if(i2c_set_line(mclr, 1))
+        return GESTIC_IO_ERROR;
+
+    /* The device is ready as soon as it offers its first message */
+    if(i2c_wait_ts(gestic, 1, I2C_RESET_TIMEOUT_MS) == GESTIC_IO_ERROR)
+        return GESTIC_IO_ERROR;
+    return GESTIC_NO_ERROR;
+}
+
+const gestic_backend_t gestic_i2c_backend = {
+    "i2c", i2c_open, i2c_close, i2c_read, i2c_wait, i2c_write, i2c_reset
+};
+
+#endif
@@ -45,6 +45,78 @@ int gestic_serial_write(gestic_t *gestic, void *buffer, int size);
 
 #endif /* GESTIC_HAS_SERIAL_IO */
 
+/* ======== Section: Backends ======== */
+
+#ifdef GESTIC_HAS_BACKENDS
+
+/* Struct: gestic_backend_t
+ *
+ * Operations of a kind of connection that is selected with <gestic_open_uri>.
+ *
+ * scheme - Prefix of the URIs handled by this backend
+ * open   - Opens path with the options following '?' (NULL if there were
+ *          none) and stores the descriptor in io.cdc_serial
+ * close  - Releases the connection
+ * read   - Same as <gestic_serial_read>
+ * wait   - Same as <gestic_serial_wait>
+ * write  - Same as <gestic_serial_write>
+ * reset  - Same as <gestic_reset>
+ */
+typedef struct gestic_backend_struct {
+    const char *scheme;
+    int (*open)(gestic_t *gestic, const char *path, const char *options);
+    void (*close)(gestic_t *gestic);
+    int (*read)(gestic_t *gestic, void *buffer, int maxsize);
+    int (*wait)(gestic_t *gestic, int timeout);
+    int (*write)(gestic_t *gestic, const void *buffer, int size);
+    int (*reset)(gestic_t *gestic);
+} gestic_backend_t;
+
+/* Function: gestic_serial_wait
+ *
+ * Blocks until data could be read from the device or timeout milliseconds
+ * passed.
+ *
+ * Returns a positive value if data is available, zero on timeout or a
+ * negative error code.
+ */
+int gestic_serial_wait(gestic_t *gestic, int timeout);
+
+/* Function: gestic_read_latency_add
+ *
+ * Records the read latency of a message that was just extracted from data
+ * of <gestic_serial_read> if enabled with <gestic_measure_read_latency>.
+ */
+void gestic_read_latency_add(gestic_t *gestic);
+
+/* Variable: gestic_i2c_backend
+ *
+ * Talks to the device through i2c-dev and the GPIO character device instead
+ * of the kernel module.
+ */
+extern const gestic_backend_t gestic_i2c_backend;
+
+/* Function: gestic_uri_option
+ *
+ * Returns the value of the option name within options (as passed to
+ * open of <gestic_backend_t>) or NULL if it is missing.
+ *
+ * The value is terminated by '&' or the end of the string.
+ */
+const char *gestic_uri_option(const char *options, const char *name);
+
+/* Function: gestic_uri_path
+ *
+ * Copies path up to the options into buffer as terminated string.
+ *
+ * Returns 0 on success or <GESTIC_BAD_PARAM_ERROR> if the path is empty or
+ * does not fit into buffer.
+ */
+int gestic_uri_path(char *buffer, int size, const char *path,
+                    const char *options);
+
+#endif /* GESTIC_HAS_BACKENDS */
+
 /* ======== Section: Message-IO ========*/
 
 /* ======== Section: Message Extraction ======== */
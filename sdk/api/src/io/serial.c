@@ -28,7 +28,20 @@ void gestic_init_msg_extract(gestic_t *gestic) {
     gestic->io.msg_extract.state = -2;
 }
 
-static void *message_extract(gestic_msg_extract_t *extract, int *size) {
+/* Counts the loss of the framing once until the next complete message */
+static void message_resync(gestic_t *gestic, gestic_msg_extract_t *extract) {
+    if(extract->synced) {
+        extract->synced = 0;
+        GESTIC_METRIC_ADD(gestic, resyncs, 1);
+        GESTIC_TRACE_ERROR(gestic, gestic_trace_resync,
+                           extract->buffer_size - extract->buffer_cursor, 0, 0);
+    }
+    GESTIC_UNUSED(gestic);
+}
+
+static void *message_extract(gestic_t *gestic, int *size) {
+    gestic_msg_extract_t *extract = &gestic->io.msg_extract;
+
     /* This while loop is only left through one of the return statements */
     while(1) {
         switch(extract->state) {
@@ -36,14 +49,17 @@ static void *message_extract(gestic_msg_extract_t *extract, int *size) {
             /* Expect FE */
             if(extract->buffer_cursor >= extract->buffer_size)
                 return 0;
-            if(extract->buffer[extract->buffer_cursor++] != 0xFE)
+            if(extract->buffer[extract->buffer_cursor++] != 0xFE) {
+                message_resync(gestic, extract);
                 continue;
+            }
             extract->state = -1;
         case -1:
             /* Expect FF */
             if(extract->buffer_cursor >= extract->buffer_size)
                 return 0;
             if(extract->buffer[extract->buffer_cursor++] != 0xFF) {
+                message_resync(gestic, extract);
                 extract->state = -2;
                 continue;
             }
@@ -57,6 +73,10 @@ static void *message_extract(gestic_msg_extract_t *extract, int *size) {
             }
             /* Check header */
             if(extract->msg[0] < 4) {
+                GESTIC_METRIC_ADD(gestic, bad_sizes, 1);
+                GESTIC_TRACE_ERROR(gestic, gestic_trace_bad_size,
+                                   extract->msg[3], extract->msg[0], 0);
+                message_resync(gestic, extract);
                 extract->state = -2;
                 continue;
             }
@@ -70,6 +90,7 @@ static void *message_extract(gestic_msg_extract_t *extract, int *size) {
             if(size)
                 *size = extract->state;
             extract->state = -2;
+            extract->synced = 1;
             return extract->msg;
         }
     }
@@ -80,11 +101,34 @@ int gestic_message_receive(gestic_t *gestic, int *timeout)
     int error = GESTIC_NO_DATA;
     int msg_size;
     void *msg = 0;
+#ifdef GESTIC_HAS_BACKENDS
+    int ready = 0;
+#endif
+#if !defined(GESTIC_NO_METRICS) && defined(GESTIC_TIME_US)
+    unsigned int start;
+#endif
 
     for(;;) {
-        msg = message_extract(&gestic->io.msg_extract, &msg_size);
+        msg = message_extract(gestic, &msg_size);
         if(msg) {
+            GESTIC_PROBE2(message_extracted, GET_U8((unsigned char *)msg + 3),
+                          msg_size);
+            GESTIC_TRACE_DEBUG(gestic, gestic_trace_message,
+                               GET_U8((unsigned char *)msg + 3), msg_size, 0);
+#ifdef GESTIC_HAS_BACKENDS
+            gestic_read_latency_add(gestic);
+#endif
+            GESTIC_METRIC_ADD(gestic, messages[GET_U8((unsigned char *)msg + 3)], 1);
+#if !defined(GESTIC_NO_METRICS) && defined(GESTIC_TIME_US)
+            start = GESTIC_TIME_US();
+            gestic_message_handle(gestic, msg, msg_size);
+            gestic_metrics_observe(&gestic->metrics.decode_time,
+                                   GESTIC_TIME_US() - start);
+#else
             gestic_message_handle(gestic, msg, msg_size);
+#endif
+            /* After handling it so that chunks know the frame counter */
+            GESTIC_CAPTURE(gestic, gestic_capture_received, msg, msg_size);
             error = GESTIC_NO_ERROR;
             break;
         }
@@ -92,13 +136,31 @@ int gestic_message_receive(gestic_t *gestic, int *timeout)
         /* Try to read more data to retry message-extraction */
         gestic->io.msg_extract.buffer_cursor = 0;
         gestic->io.msg_extract.buffer_size = gestic_serial_read(gestic, gestic->io.msg_extract.buffer, GESTIC_INPUT_CAPACITY);
-        if(gestic->io.msg_extract.buffer_size > 0)
+        if(gestic->io.msg_extract.buffer_size > 0) {
+            GESTIC_METRIC_ADD(gestic, bytes_read,
+                              gestic->io.msg_extract.buffer_size);
             continue;
+        }
 
         /* Wait a short time before retrying */
         if(!timeout || (*timeout <= 0))
             break;
 
+#ifdef GESTIC_HAS_BACKENDS
+        /* Block until data arrives instead of polling, unless the last
+         * wait found data that could not be read after all.
+         */
+        if(ready <= 0) {
+            int start = GESTIC_TIME_MS();
+            ready = gestic_serial_wait(gestic, *timeout);
+            if(ready >= 0) {
+                *timeout -= GESTIC_TIME_MS() - start;
+                continue;
+            }
+        }
+        ready = 0;
+#endif
+
         GESTIC_SLEEP(10);
         *timeout -= 10;
     }
@@ -115,6 +177,8 @@ int gestic_message_write(gestic_t *gestic, void *msg, int size) {
         error = status;
     if(!error && (status = gestic_serial_write(gestic, msg, size)) < 0)
         error = status;
+    if(!error)
+        GESTIC_CAPTURE(gestic, gestic_capture_sent, msg, size);
     return error;
 }
 
@@ -0,0 +1,313 @@
+/******************************************************************************
+ *
+ * Copyright (C) 2014 Microchip Technology Inc. and its
+ *                    subsidiaries ("Microchip").
+ *
+ * All rights reserved.
+ *
+ * You are permitted to use the Aurea software, GestIC API, and other
+ * accompanying software with Microchip products.  Refer to the license
+ * agreement accompanying this software, if any, for additional info regarding
+ * your rights and obligations.
+ *
+ * SOFTWARE AND DOCUMENTATION ARE PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION, ANY WARRANTY OF
+ * MERCHANTABILITY, TITLE, NON-INFRINGEMENT AND FITNESS FOR A PARTICULAR
+ * PURPOSE. IN NO EVENT SHALL MICROCHIP, SMSC, OR ITS LICENSORS BE LIABLE OR
+ * OBLIGATED UNDER CONTRACT, NEGLIGENCE, STRICT LIABILITY, CONTRIBUTION, BREACH
+ * OF WARRANTY, OR OTHER LEGAL EQUITABLE THEORY FOR ANY DIRECT OR INDIRECT
+ * DAMAGES OR EXPENSES INCLUDING BUT NOT LIMITED TO ANY INCIDENTAL, SPECIAL,
+ * INDIRECT OR CONSEQUENTIAL DAMAGES, OR OTHER SIMILAR COSTS.
+ *
+ ******************************************************************************/
+#include "impl.h"
+
+#ifndef GESTIC_NO_METRICS
+
+#ifdef __linux__
+#   include <fcntl.h>
+#   include <stdio.h>
+#   include <stdlib.h>
+#   include <unistd.h>
+#endif
+
+/* Upper bounds of the buckets in microseconds, the last one is unbounded */
+static const unsigned int gestic_metrics_bounds[GESTIC_METRICS_BUCKETS] = {
+    1, 2, 5, 10, 20, 50, 100, 200, 500, 1000, 2000, 5000, 10000, 20000, 50000,
+    100000, 200000, 500000, 1000000, 0
+};
+
+void gestic_metrics_observe(gestic_histogram_t *histogram, unsigned int value) {
+    int i;
+
+    for(i = 0; i < GESTIC_METRICS_BUCKETS - 1; ++i) {
+        if(value <= gestic_metrics_bounds[i])
+            break;
+    }
+
+    GESTIC_ATOMIC_ADD(&histogram->buckets[i], 1);
+    GESTIC_ATOMIC_ADD(&histogram->count, 1);
+    GESTIC_ATOMIC_ADD(&histogram->sum, value);
+}
+
+static void gestic_histogram_copy(gestic_histogram_t *dest,
+                                  gestic_histogram_t *src)
+{
+    int i;
+
+    for(i = 0; i < GESTIC_METRICS_BUCKETS; ++i)
+        dest->buckets[i] = GESTIC_ATOMIC_LOAD(&src->buckets[i]);
+    dest->count = GESTIC_ATOMIC_LOAD(&src->count);
+    dest->sum = GESTIC_ATOMIC_LOAD(&src->sum);
+}
+
+void gestic_get_metrics(gestic_t *gestic, gestic_metrics_t *metrics) {
+    gestic_metrics_t *src = &gestic->metrics;
+    int i;
+
+    GESTIC_ASSERT(gestic && metrics);
+
+    metrics->bytes_read = GESTIC_ATOMIC_LOAD(&src->bytes_read);
+    for(i = 0; i < 256; ++i)
+        metrics->messages[i] = GESTIC_ATOMIC_LOAD(&src->messages[i]);
+    metrics->resyncs = GESTIC_ATOMIC_LOAD(&src->resyncs);
+    metrics->bad_sizes = GESTIC_ATOMIC_LOAD(&src->bad_sizes);
+    metrics->skipped_frames = GESTIC_ATOMIC_LOAD(&src->skipped_frames);
+    metrics->retries = GESTIC_ATOMIC_LOAD(&src->retries);
+    metrics->timeouts = GESTIC_ATOMIC_LOAD(&src->timeouts);
+    gestic_histogram_copy(&metrics->decode_time, &src->decode_time);
+    gestic_histogram_copy(&metrics->command_rtt, &src->command_rtt);
+}
+
+unsigned int gestic_metrics_bound(int bucket) {
+    if(bucket < 0 || bucket >= GESTIC_METRICS_BUCKETS)
+        return 0;
+    return gestic_metrics_bounds[bucket];
+}
+
+/* ======== Text Output ======== */
+
+/* Text written so far, only the part fitting into the buffer is stored */
+typedef struct {
+    char *buffer;
+    int size;
+    int length;
+    const char *labels;
+} gestic_text_t;
+
+static void gestic_text_char(gestic_text_t *text, char c) {
+    if(text->length < text->size - 1)
+        text->buffer[text->length] = c;
+    ++text->length;
+}
+
+static void gestic_text_str(gestic_text_t *text, const char *str) {
+    while(*str)
+        gestic_text_char(text, *str++);
+}
+
+static void gestic_text_uint(gestic_text_t *text, unsigned long long value,
+                             int min_digits)
+{
+    char digits[20];
+    int count = 0;
+
+    do {
+        digits[count++] = (char)('0' + value % 10);
+        value /= 10;
+    } while(value || count < min_digits);
+
+    while(count > 0)
+        gestic_text_char(text, digits[--count]);
+}
+
+/* Microseconds as seconds with six decimals */
+static void gestic_text_seconds(gestic_text_t *text, unsigned long long us) {
+    gestic_text_uint(text, us / 1000000, 1);
+    gestic_text_char(text, '.');
+    gestic_text_uint(text, us % 1000000, 6);
+}
+
+static void gestic_text_header(gestic_text_t *text, const char *name,
+                               const char *type, const char *help)
+{
+    gestic_text_str(text, "# HELP gestic_");
+    gestic_text_str(text, name);
+    gestic_text_char(text, ' ');
+    gestic_text_str(text, help);
+    gestic_text_str(text, "\n# TYPE gestic_");
+    gestic_text_str(text, name);
+    gestic_text_char(text, ' ');
+    gestic_text_str(text, type);
+    gestic_text_char(text, '\n');
+}
+
+/* Writes the name of a sample with the common labels and an optional
+ * label of its own, e.g. gestic_messages_total{device="a",id="0x91"}
+ */
+static void gestic_text_name(gestic_text_t *text, const char *name,
+                             const char *suffix, const char *label)
+{
+    int has_labels = text->labels && *text->labels;
+
+    gestic_text_str(text, "gestic_");
+    gestic_text_str(text, name);
+    gestic_text_str(text, suffix);
+    if(has_labels || label) {
+        gestic_text_char(text, '{');
+        if(has_labels)
+            gestic_text_str(text, text->labels);
+        if(has_labels && label)
+            gestic_text_char(text, ',');
+        if(label)
+            gestic_text_str(text, label);
+        gestic_text_char(text, '}');
+    }
+    gestic_text_char(text, ' ');
+}
+
+static void gestic_text_counter(gestic_text_t *text, const char *name,
+                                const char *help, unsigned long long value)
+{
+    gestic_text_header(text, name, "counter", help);
+    gestic_text_name(text, name, "", 0);
+    gestic_text_uint(text, value, 1);
+    gestic_text_char(text, '\n');
+}
+
+static void gestic_text_histogram(gestic_text_t *text, const char *name,
+                                  const char *help,
+                                  const gestic_histogram_t *histogram)
+{
+    char label[24];
+    gestic_text_t bound;
+    unsigned long long cumulative = 0;
+    int i;
+
+    gestic_text_header(text, name, "histogram", help);
+
+    for(i = 0; i < GESTIC_METRICS_BUCKETS; ++i) {
+        /* Format le="<bound>" into label */
+        bound.buffer = label;
+        bound.size = sizeof(label);
+        bound.length = 0;
+        gestic_text_str(&bound, "le=\"");
+        if(gestic_metrics_bounds[i])
+            gestic_text_seconds(&bound, gestic_metrics_bounds[i]);
+        else
+            gestic_text_str(&bound, "+Inf");
+        gestic_text_char(&bound, '"');
+        label[bound.length] = 0;
+
+        cumulative += histogram->buckets[i];
+        gestic_text_name(text, name, "_bucket", label);
+        gestic_text_uint(text, cumulative, 1);
+        gestic_text_char(text, '\n');
+    }
+
+    gestic_text_name(text, name, "_sum", 0);
+    gestic_text_seconds(text, histogram->sum);
+    gestic_text_char(text, '\n');
+    gestic_text_name(text, name, "_count", 0);
+    gestic_text_uint(text, histogram->count, 1);
+    gestic_text_char(text, '\n');
+}
+
+int gestic_format_metrics(const gestic_metrics_t *metrics, const char *labels,
+                          char *buffer, int size)
+{
+    static const char hex[] = "0123456789ABCDEF";
+    char label[] = "id=\"0x00\"";
+    gestic_text_t text;
+    int id;
+
+    GESTIC_ASSERT(metrics && (buffer || size <= 0));
+
+    text.buffer = buffer;
+    text.size = size;
+    text.length = 0;
+    text.labels = labels;
+
+    gestic_text_counter(&text, "bytes_read_total",
+                        "Bytes read from the device.", metrics->bytes_read);
+
+    gestic_text_header(&text, "messages_total", "counter",
+                       "Messages received from the device by id.");
+    for(id = 0; id < 256; ++id) {
+        if(!metrics->messages[id])
+            continue;
+        label[6] = hex[id >> 4];
+        label[7] = hex[id & 0xF];
+        gestic_text_name(&text, "messages_total", "", label);
+        gestic_text_uint(&text, metrics->messages[id], 1);
+        gestic_text_char(&text, '\n');
+    }
+
+    gestic_text_counter(&text, "framing_resyncs_total",
+                        "Times the message framing was lost.",
+                        metrics->resyncs);
+    gestic_text_counter(&text, "bad_sizes_total",
+                        "Messages with an invalid size.", metrics->bad_sizes);
+    gestic_text_counter(&text, "skipped_frames_total",
+                        "Frames received but not fetched by the application.",
+                        metrics->skipped_frames);
+    gestic_text_counter(&text, "command_retries_total",
+                        "Messages sent again after a failure.",
+                        metrics->retries);
+    gestic_text_counter(&text, "command_timeouts_total",
+                        "Attempts without a response within the timeout.",
+                        metrics->timeouts);
+    gestic_text_histogram(&text, "decode_seconds",
+                          "Time to handle a received message.",
+                          &metrics->decode_time);
+    gestic_text_histogram(&text, "command_rtt_seconds",
+                          "Time from sending a message until its response.",
+                          &metrics->command_rtt);
+
+    if(size > 0)
+        buffer[text.length < size ? text.length : size - 1] = 0;
+
+    return text.length;
+}
+
+#ifdef __linux__
+
+int gestic_write_metrics(gestic_t *gestic, const char *path,
+                         const char *labels)
+{
+    gestic_metrics_t metrics;
+    char tmp_path[256];
+    char *text;
+    int length;
+    int fd;
+    int error = GESTIC_IO_ERROR;
+
+    GESTIC_ASSERT(gestic && path);
+
+    if(snprintf(tmp_path, sizeof(tmp_path), "%s.tmp", path) >= (int)sizeof(tmp_path))
+        return GESTIC_BAD_PARAM_ERROR;
+
+    gestic_get_metrics(gestic, &metrics);
+    length = gestic_format_metrics(&metrics, labels, 0, 0);
+    text = malloc(length + 1);
+    if(!text)
+        return GESTIC_IO_ERROR;
+    gestic_format_metrics(&metrics, labels, text, length + 1);
+
+    fd = open(tmp_path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if(fd >= 0) {
+        if(write(fd, text, length) == length)
+            error = GESTIC_NO_ERROR;
+        if(close(fd) || (!error && rename(tmp_path, path)))
+            error = GESTIC_IO_ERROR;
+        if(error)
+            unlink(tmp_path);
+    }
+
+    free(text);
+    return error;
+}
+
+#endif
+
+#endif
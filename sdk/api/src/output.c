@@ -0,0 +1,206 @@
+/******************************************************************************
+ *
+ * Copyright (C) 2014 Microchip Technology Inc. and its
+ *                    subsidiaries ("Microchip").
+ *
+ * All rights reserved.
+ *
+ * You are permitted to use the Aurea software, GestIC API, and other
+ * accompanying software with Microchip products.  Refer to the license
+ * agreement accompanying this software, if any, for additional info regarding
+ * your rights and obligations.
+ *
+ * SOFTWARE AND DOCUMENTATION ARE PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION, ANY WARRANTY OF
+ * MERCHANTABILITY, TITLE, NON-INFRINGEMENT AND FITNESS FOR A PARTICULAR
+ * PURPOSE. IN NO EVENT SHALL MICROCHIP, SMSC, OR ITS LICENSORS BE LIABLE OR
+ * OBLIGATED UNDER CONTRACT, NEGLIGENCE, STRICT LIABILITY, CONTRIBUTION, BREACH
+ * OF WARRANTY, OR OTHER LEGAL EQUITABLE THEORY FOR ANY DIRECT OR INDIRECT
+ * DAMAGES OR EXPENSES INCLUDING BUT NOT LIMITED TO ANY INCIDENTAL, SPECIAL,
+ * INDIRECT OR CONSEQUENTIAL DAMAGES, OR OTHER SIMILAR COSTS.
+ *
+ ******************************************************************************/
+#include "impl.h"
+
+#ifndef GESTIC_NO_DATA_RETRIEVAL
+
+int gestic_set_auto_output_mask(gestic_t *gestic, int enabled,
+                                gestic_data_mask_t locked, int timeout)
+{
+    int error = GESTIC_NO_ERROR;
+
+    GESTIC_ASSERT(gestic && GESTIC_CONNECTED(gestic));
+
+    gestic->output.auto_mask = enabled ? 1 : 0;
+    gestic->output.auto_locked = locked & gestic_data_mask_all;
+    gestic->output.timeout = timeout;
+
+    if(enabled) {
+        /* The masks of the device are unknown before the first update */
+        gestic->output.enabled = ~gestic_data_mask_all;
+        gestic->output.locked = ~gestic_data_mask_all;
+        gestic->output.requested = ~gestic->output.used;
+        error = gestic_output_update(gestic);
+    }
+
+    return error;
+}
+
+void gestic_data_mask_use(gestic_t *gestic, gestic_data_mask_t mask) {
+    GESTIC_ASSERT(gestic);
+
+    gestic->output.used |= mask & gestic_data_mask_all;
+}
+
+void gestic_data_mask_release(gestic_t *gestic, gestic_data_mask_t mask) {
+    GESTIC_ASSERT(gestic);
+
+    gestic->output.used &= ~mask;
+}
+
+int gestic_output_update(gestic_t *gestic) {
+    gestic_output_t *output = &gestic->output;
+    gestic_data_mask_t used = output->used;
+    gestic_data_mask_t locked = used & output->auto_locked;
+    int error = GESTIC_NO_ERROR;
+
+    if(!output->auto_mask || used == output->requested)
+        return GESTIC_NO_ERROR;
+
+    /* Without frames the gestic_get_* functions could never mark data as
+     * used again, so the current mask is kept until something is used.
+     */
+    if(!used)
+        return GESTIC_NO_ERROR;
+
+    /* The mask is adapted once <gestic_presence_update> restored it */
+    if(gestic->presence.idle)
+        return GESTIC_NO_ERROR;
+
+    /* Remember the attempt so that a failing device is not flooded with
+     * requests on every update.
+     */
+    output->requested = used;
+
+    /* Same order as <gestic_set_output_enable_mask> but with every bit of
+     * both masks selected so that unused data gets disabled, too.
+     */
+    if(locked != output->locked) {
+        error = gestic_set_param(gestic, gestic_param_dataOutputLockMask,
+                                 locked, gestic_data_mask_all,
+                                 output->timeout);
+        if(!error)
+            output->locked = locked;
+    }
+    if(!error && used != output->enabled) {
+        error = gestic_set_param(gestic, gestic_param_dataOutputEnableMask,
+                                 used, gestic_data_mask_all,
+                                 output->timeout);
+        if(!error)
+            output->enabled = used;
+    }
+
+    return error;
+}
+
+/* Sends an output mask to the device and records it like
+ * <gestic_set_output_enable_mask> does.
+ */
+static int gestic_presence_set_mask(gestic_t *gestic,
+                                    gestic_data_mask_t enabled,
+                                    gestic_data_mask_t locked)
+{
+    gestic_output_t *output = &gestic->output;
+    int timeout = gestic->presence.timeout;
+    int error;
+
+    error = gestic_set_param(gestic, gestic_param_dataOutputLockMask,
+                             locked, gestic_data_mask_all, timeout);
+    if(!error) {
+        output->locked = locked;
+        error = gestic_set_param(gestic, gestic_param_dataOutputEnableMask,
+                                 enabled, gestic_data_mask_all, timeout);
+    }
+    if(!error)
+        output->enabled = enabled;
+
+    return error;
+}
+
+int gestic_set_presence_policy(gestic_t *gestic, int idle_frames,
+                               gestic_data_mask_t idle_mask,
+                               float sd_threshold, int timeout)
+{
+    gestic_presence_t *presence = &gestic->presence;
+    gestic_output_t *output = &gestic->output;
+    int error = GESTIC_NO_ERROR;
+
+    GESTIC_ASSERT(gestic && GESTIC_CONNECTED(gestic));
+
+    presence->timeout = timeout;
+
+    if(idle_frames <= 0) {
+        if(presence->idle) {
+            error = gestic_presence_set_mask(gestic, presence->enabled,
+                                             presence->locked);
+            if(error)
+                return error;
+            presence->idle = 0;
+        }
+        presence->idle_frames = 0;
+        return GESTIC_NO_ERROR;
+    }
+
+    /* The mask to be restored has to be known before going idle */
+    if(!presence->idle_frames && !output->auto_mask) {
+        error = gestic_get_output_enable_mask(gestic, &output->enabled,
+                                              &output->locked, timeout);
+        if(error)
+            return error;
+    }
+
+    presence->idle_frames = idle_frames;
+    presence->idle_mask = idle_mask & gestic_data_mask_all;
+    presence->sd_threshold = sd_threshold;
+    presence->last_seen = gestic->internal.frame_counter;
+
+    return error;
+}
+
+int gestic_presence_idle(gestic_t *gestic) {
+    GESTIC_ASSERT(gestic);
+
+    return gestic->presence.idle;
+}
+
+int gestic_presence_update(gestic_t *gestic) {
+    gestic_presence_t *presence = &gestic->presence;
+    gestic_output_t *output = &gestic->output;
+    int idle;
+    int error;
+
+    if(!presence->idle_frames)
+        return GESTIC_NO_ERROR;
+
+    idle = gestic->internal.frame_counter - presence->last_seen >=
+           presence->idle_frames;
+    if(idle == presence->idle)
+        return GESTIC_NO_ERROR;
+
+    if(idle) {
+        presence->enabled = output->enabled;
+        presence->locked = output->locked;
+        error = gestic_presence_set_mask(gestic, presence->idle_mask,
+                                         presence->locked & presence->idle_mask);
+    } else {
+        error = gestic_presence_set_mask(gestic, presence->enabled,
+                                         presence->locked);
+    }
+
+    if(!error)
+        presence->idle = idle;
+
+    return error;
+}
+
+#endif
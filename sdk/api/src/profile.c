@@ -0,0 +1,470 @@
+/******************************************************************************
+ *
+ * Copyright (C) 2014 Microchip Technology Inc. and its
+ *                    subsidiaries ("Microchip").
+ *
+ * All rights reserved.
+ *
+ * You are permitted to use the Aurea software, GestIC API, and other
+ * accompanying software with Microchip products.  Refer to the license
+ * agreement accompanying this software, if any, for additional info regarding
+ * your rights and obligations.
+ *
+ * SOFTWARE AND DOCUMENTATION ARE PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION, ANY WARRANTY OF
+ * MERCHANTABILITY, TITLE, NON-INFRINGEMENT AND FITNESS FOR A PARTICULAR
+ * PURPOSE. IN NO EVENT SHALL MICROCHIP, SMSC, OR ITS LICENSORS BE LIABLE OR
+ * OBLIGATED UNDER CONTRACT, NEGLIGENCE, STRICT LIABILITY, CONTRIBUTION, BREACH
+ * OF WARRANTY, OR OTHER LEGAL EQUITABLE THEORY FOR ANY DIRECT OR INDIRECT
+ * DAMAGES OR EXPENSES INCLUDING BUT NOT LIMITED TO ANY INCIDENTAL, SPECIAL,
+ * INDIRECT OR CONSEQUENTIAL DAMAGES, OR OTHER SIMILAR COSTS.
+ *
+ ******************************************************************************/
+#include "impl.h"
+
+#ifndef GESTIC_NO_PROFILE
+
+/* Maximum number of messages that are sent ahead of their responses */
+#ifndef GESTIC_PROFILE_WINDOW
+#define GESTIC_PROFILE_WINDOW 4
+#endif
+
+/* Limits for the parsing of Library.settings */
+#define GESTIC_PROFILE_PATH_SIZE 96
+#define GESTIC_PROFILE_MAX_DEPTH 16
+
+void gestic_profile_init(gestic_profile_t *profile) {
+    GESTIC_ASSERT(profile);
+
+    GESTIC_MEMSET(profile, 0, sizeof(gestic_profile_t));
+}
+
+int gestic_profile_add(gestic_profile_t *profile, unsigned short param,
+                       unsigned int arg0, unsigned int arg1)
+{
+    gestic_profile_param_t *entry;
+    int i;
+
+    GESTIC_ASSERT(profile);
+
+    for(i = 0; i < profile->count; ++i) {
+        entry = &profile->params[i];
+        if(entry->param != param)
+            continue;
+        if(gestic_param_masked(param)) {
+            entry->arg0 = (entry->arg0 & ~arg1) | (arg0 & arg1);
+            entry->arg1 |= arg1;
+        } else {
+            entry->arg0 = arg0;
+            entry->arg1 = arg1;
+        }
+        return GESTIC_NO_ERROR;
+    }
+
+    if(profile->count >= GESTIC_PROFILE_CAPACITY)
+        return GESTIC_BAD_PARAM_ERROR;
+
+    entry = &profile->params[profile->count++];
+    entry->param = param;
+    entry->arg0 = arg0;
+    entry->arg1 = arg1;
+    return GESTIC_NO_ERROR;
+}
+
+/* ======== Parsing ======== */
+
+typedef struct {
+    const char *cursor;
+    const char *end;
+    gestic_profile_t *profile;
+    int error;
+    char path[GESTIC_PROFILE_PATH_SIZE];
+} gestic_profile_parser_t;
+
+static void gestic_profile_skip_space(gestic_profile_parser_t *parser) {
+    while(parser->cursor < parser->end &&
+          (*parser->cursor == ' ' || *parser->cursor == '\t' ||
+           *parser->cursor == '\r' || *parser->cursor == '\n'))
+    {
+        ++parser->cursor;
+    }
+}
+
+/* Parses an unsigned decimal or hexadecimal number.
+ * Returns 0 if there is no number at the cursor.
+ */
+static int gestic_profile_number(gestic_profile_parser_t *parser,
+                                 unsigned int *value)
+{
+    const char *cursor = parser->cursor;
+    unsigned int result = 0;
+    int base = 10;
+    int digits = 0;
+
+    if(parser->end - cursor > 2 && cursor[0] == '0' &&
+       (cursor[1] == 'x' || cursor[1] == 'X'))
+    {
+        base = 16;
+        cursor += 2;
+    }
+
+    for(; cursor < parser->end; ++cursor, ++digits) {
+        char c = *cursor;
+        if(c >= '0' && c <= '9')
+            result = result * base + (c - '0');
+        else if(base == 16 && c >= 'a' && c <= 'f')
+            result = result * base + (c - 'a' + 10);
+        else if(base == 16 && c >= 'A' && c <= 'F')
+            result = result * base + (c - 'A' + 10);
+        else
+            break;
+    }
+
+    if(!digits)
+        return 0;
+
+    parser->cursor = cursor;
+    *value = result;
+    return 1;
+}
+
+/* Returns whether the next character is c and skips it in that case */
+static int gestic_profile_accept(gestic_profile_parser_t *parser, char c) {
+    gestic_profile_skip_space(parser);
+    if(parser->cursor < parser->end && *parser->cursor == c) {
+        ++parser->cursor;
+        return 1;
+    }
+    return 0;
+}
+
+/* Returns the index following prefix in path or -1 if path does not match */
+static int gestic_profile_index(const char *path, const char *prefix) {
+    int index = 0;
+
+    for(; *prefix; ++prefix, ++path) {
+        if(*path != *prefix)
+            return -1;
+    }
+
+    if(!*path)
+        return -1;
+    for(; *path; ++path) {
+        if(*path < '0' || *path > '9')
+            return -1;
+        index = index * 10 + (*path - '0');
+    }
+    return index;
+}
+
+static int gestic_profile_equal(const char *a, const char *b) {
+    for(; *a && *a == *b; ++a, ++b)
+        ;
+    return *a == *b;
+}
+
+/* Adds the runtime parameter for a single setting of Library.settings */
+static void gestic_profile_setting(gestic_profile_parser_t *parser,
+                                   unsigned int value)
+{
+    const char *path = parser->path;
+    int index;
+    int error = GESTIC_NO_ERROR;
+
+    if((index = gestic_profile_index(path, ".Afe.SignalMatching.")) >= 0) {
+        if(index < 5)
+            error = gestic_profile_add(parser->profile,
+                                       gestic_param_afeRxAtt_S + index,
+                                       value, 0);
+    } else if((index = gestic_profile_index(path, ".Afe.ChannelMapping.")) >= 0) {
+        if(index < 5)
+            error = gestic_profile_add(parser->profile,
+                                       gestic_param_channelmapping_S + index,
+                                       value, 0);
+    } else if(gestic_profile_equal(path, ".ApproachDetection.EnableOnStartup")) {
+        error = gestic_profile_add(parser->profile,
+                                   gestic_param_dspApproachDetectionMode,
+                                   value ? 0x01 : 0x00, 0x01);
+    } else if((index = gestic_profile_index(path, ".Gestures.Enabled.")) >= 0) {
+        /* The low byte is the id as reported in the gesture info where the
+         * garbage model 1 is bit 0 of the mask
+         */
+        int bit = (index & 0xFF) - 1;
+        if(bit >= 0 && bit < 7)
+            error = gestic_profile_add(parser->profile,
+                                       gestic_param_dspGestureMask,
+                                       value ? 1 << bit : 0, 1 << bit);
+    }
+
+    if(error && !parser->error)
+        parser->error = error;
+}
+
+/* Parses a string and appends its content to the path if append is set */
+static int gestic_profile_string(gestic_profile_parser_t *parser, int append) {
+    int length = 0;
+
+    while(parser->path[length])
+        ++length;
+
+    if(!gestic_profile_accept(parser, '"'))
+        return 0;
+
+    if(append && length < GESTIC_PROFILE_PATH_SIZE - 1)
+        parser->path[length++] = '.';
+
+    for(; parser->cursor < parser->end; ++parser->cursor) {
+        char c = *parser->cursor;
+        if(c == '"') {
+            ++parser->cursor;
+            if(append)
+                parser->path[length] = 0;
+            return 1;
+        }
+        if(c == '\\' && parser->cursor + 1 < parser->end)
+            c = *++parser->cursor;
+        if(append && length < GESTIC_PROFILE_PATH_SIZE - 1)
+            parser->path[length++] = c;
+    }
+    return 0;
+}
+
+static int gestic_profile_value(gestic_profile_parser_t *parser, int depth) {
+    int length = 0;
+    unsigned int value;
+    char c;
+
+    gestic_profile_skip_space(parser);
+    if(parser->cursor >= parser->end || depth > GESTIC_PROFILE_MAX_DEPTH)
+        return 0;
+
+    while(parser->path[length])
+        ++length;
+
+    c = *parser->cursor;
+    if(c == '{') {
+        ++parser->cursor;
+        if(gestic_profile_accept(parser, '}'))
+            return 1;
+        do {
+            if(!gestic_profile_string(parser, 1) ||
+               !gestic_profile_accept(parser, ':') ||
+               !gestic_profile_value(parser, depth + 1))
+                return 0;
+            parser->path[length] = 0;
+        } while(gestic_profile_accept(parser, ','));
+        return gestic_profile_accept(parser, '}');
+    } else if(c == '[') {
+        ++parser->cursor;
+        if(gestic_profile_accept(parser, ']'))
+            return 1;
+        do {
+            if(!gestic_profile_value(parser, depth + 1))
+                return 0;
+        } while(gestic_profile_accept(parser, ','));
+        return gestic_profile_accept(parser, ']');
+    } else if(c == '"') {
+        return gestic_profile_string(parser, 0);
+    } else if(c == 't' || c == 'f' || c == 'n') {
+        const char *literal = c == 't' ? "true" : c == 'f' ? "false" : "null";
+        for(; *literal; ++literal, ++parser->cursor) {
+            if(parser->cursor >= parser->end || *parser->cursor != *literal)
+                return 0;
+        }
+        if(c != 'n')
+            gestic_profile_setting(parser, c == 't');
+        return 1;
+    } else if(c == '-' || (c >= '0' && c <= '9')) {
+        /* Only non-negative integers have a runtime parameter */
+        int integer = c != '-';
+        if(c == '-')
+            ++parser->cursor;
+        if(!gestic_profile_number(parser, &value))
+            return 0;
+        while(parser->cursor < parser->end &&
+              (*parser->cursor == '.' || *parser->cursor == 'e' ||
+               *parser->cursor == 'E' || *parser->cursor == '+' ||
+               *parser->cursor == '-' ||
+               (*parser->cursor >= '0' && *parser->cursor <= '9')))
+        {
+            integer = 0;
+            ++parser->cursor;
+        }
+        if(integer)
+            gestic_profile_setting(parser, value);
+        return 1;
+    }
+    return 0;
+}
+
+static int gestic_profile_list(gestic_profile_parser_t *parser) {
+    unsigned int param, arg0, arg1;
+    int error;
+
+    while(parser->cursor < parser->end) {
+        /* Skip whitespace of the current line */
+        while(parser->cursor < parser->end &&
+              (*parser->cursor == ' ' || *parser->cursor == '\t' ||
+               *parser->cursor == '\r'))
+        {
+            ++parser->cursor;
+        }
+
+        if(gestic_profile_number(parser, &param)) {
+            gestic_profile_skip_space(parser);
+            if(!gestic_profile_number(parser, &arg0))
+                return GESTIC_BAD_PARAM_ERROR;
+            gestic_profile_skip_space(parser);
+            if(!gestic_profile_number(parser, &arg1))
+                return GESTIC_BAD_PARAM_ERROR;
+            error = gestic_profile_add(parser->profile,
+                                       (unsigned short)param, arg0, arg1);
+            if(error)
+                return error;
+        }
+
+        /* Only comments may follow on the same line */
+        while(parser->cursor < parser->end && *parser->cursor != '\n') {
+            char c = *parser->cursor;
+            if(c == '#') {
+                while(parser->cursor < parser->end && *parser->cursor != '\n')
+                    ++parser->cursor;
+                break;
+            }
+            if(c != ' ' && c != '\t' && c != '\r')
+                return GESTIC_BAD_PARAM_ERROR;
+            ++parser->cursor;
+        }
+        if(parser->cursor < parser->end)
+            ++parser->cursor;
+    }
+    return GESTIC_NO_ERROR;
+}
+
+int gestic_profile_parse(gestic_profile_t *profile, const char *text,
+                         int size)
+{
+    gestic_profile_parser_t parser;
+
+    GESTIC_ASSERT(profile && text);
+
+    GESTIC_MEMSET(&parser, 0, sizeof(parser));
+    parser.cursor = text;
+    parser.end = text + size;
+    parser.profile = profile;
+
+    gestic_profile_skip_space(&parser);
+    if(!gestic_profile_accept(&parser, '{')) {
+        parser.cursor = text;
+        return gestic_profile_list(&parser);
+    }
+
+    parser.cursor--;
+    if(!gestic_profile_value(&parser, 0))
+        return GESTIC_BAD_PARAM_ERROR;
+
+    return parser.error;
+}
+
+/* ======== Applying ======== */
+
+int gestic_profile_apply(gestic_t *gestic, const gestic_profile_t *profile,
+                         gestic_profile_report_t *report, int timeout)
+{
+#ifndef GESTIC_NO_PARAM_CACHE
+    unsigned char requests[GESTIC_PROFILE_CAPACITY][12];
+#endif
+    unsigned char sets[GESTIC_PROFILE_CAPACITY][16];
+    const gestic_profile_param_t *changed[GESTIC_PROFILE_CAPACITY];
+    int errors[GESTIC_PROFILE_CAPACITY];
+    gestic_profile_report_t result;
+    int error = GESTIC_NO_ERROR;
+    int count = 0;
+    int i;
+#ifdef GESTIC_TIME_MS
+    int start = GESTIC_TIME_MS();
+#endif
+
+    GESTIC_ASSERT(gestic && GESTIC_CONNECTED(gestic) && profile);
+
+    GESTIC_MEMSET(&result, 0, sizeof(result));
+    result.params = profile->count;
+
+#ifndef GESTIC_NO_PARAM_CACHE
+    /* Read back the parameters that are unknown to the cache. The replies
+     * are recorded by the cache as they arrive.
+     */
+    for(i = 0; i < profile->count; ++i) {
+        const gestic_profile_param_t *p = &profile->params[i];
+        unsigned char *msg = requests[count];
+        if(gestic_param_cache_unchanged(gestic, p->param, p->arg0, p->arg1) ||
+           gestic_param_cache_get(gestic, p->param, 0, 0))
+            continue;
+        GESTIC_MEMSET(msg, 0, 12);
+        SET_U8(msg, 12);
+        SET_U8(msg + 3, gestic_msg_Request_Message);
+        SET_U8(msg + 4, gestic_msg_Set_Runtime_Parameter);
+        SET_U32(msg + 8, p->param);
+        ++count;
+    }
+    result.read = count;
+    /* Failures just leave the parameter unknown so that it is sent */
+    gestic_send_pipelined(gestic, requests, 12, count,
+                          GESTIC_PROFILE_WINDOW, 0, timeout);
+#endif
+
+    /* Collect the parameters that differ */
+    count = 0;
+    for(i = 0; i < profile->count; ++i) {
+        const gestic_profile_param_t *p = &profile->params[i];
+        unsigned char *msg = sets[count];
+#ifndef GESTIC_NO_PARAM_CACHE
+        if(gestic_param_cache_unchanged(gestic, p->param, p->arg0, p->arg1))
+            continue;
+#endif
+        GESTIC_MEMSET(msg, 0, 16);
+        SET_U8(msg, 16);
+        SET_U8(msg + 3, gestic_msg_Set_Runtime_Parameter);
+        SET_U16(msg + 4, p->param);
+        SET_U32(msg + 8, p->arg0);
+        SET_U32(msg + 12, p->arg1);
+        changed[count++] = p;
+    }
+    result.changed = count;
+
+    gestic_send_pipelined(gestic, sets, 16, count, GESTIC_PROFILE_WINDOW,
+                          errors, timeout);
+
+    for(i = 0; i < count; ++i) {
+        const gestic_profile_param_t *p = changed[i];
+        int param_error = GESTIC_NO_ERROR;
+
+        if(errors[i] == 0) {
+#ifndef GESTIC_NO_PARAM_CACHE
+            gestic_param_cache_set(gestic, p->param, p->arg0, p->arg1,
+                                   GESTIC_NO_ERROR);
+#endif
+            continue;
+        }
+
+        /* Resend parameters that were rejected or not acknowledged */
+        param_error = gestic_set_param(gestic, p->param, p->arg0, p->arg1,
+                                       timeout);
+        if(param_error) {
+            ++result.failed;
+            if(!error)
+                error = param_error;
+        }
+    }
+
+#ifdef GESTIC_TIME_MS
+    result.time = GESTIC_TIME_SINCE(GESTIC_TIME_MS(), start);
+#endif
+
+    if(report)
+        *report = result;
+
+    return error;
+}
+
+#endif
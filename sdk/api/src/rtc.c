@@ -22,6 +22,173 @@
  ******************************************************************************/
 #include "impl.h"
 
+int gestic_param_masked(unsigned short param) {
+    /* AFE parameters don't use arg1 */
+    if(param >= gestic_param_afeRxAtt_S && param <= gestic_param_afeRxAtt_C)
+        return 0;
+    if(param >= gestic_param_channelmapping_S && param <= gestic_param_channelmapping_C)
+        return 0;
+    return param != gestic_param_transFreqSelect;
+}
+
+int gestic_param_cacheable(unsigned short param) {
+    return param != gestic_param_trigger &&
+           param != gestic_param_makePersistent &&
+           param != gestic_param_dataOutputRequestMask;
+}
+
+#ifndef GESTIC_NO_PARAM_CACHE
+
+static gestic_param_entry_t *gestic_param_cache_find(gestic_t *gestic,
+                                                     unsigned short param,
+                                                     int create)
+{
+    gestic_param_cache_t *cache = &gestic->param_cache;
+    gestic_param_entry_t *entry = 0;
+    int i;
+
+    for(i = 0; i < GESTIC_PARAM_CACHE_SIZE; ++i) {
+        if(cache->entries[i].param == param)
+            return &cache->entries[i];
+        if(!entry && !cache->entries[i].param)
+            entry = &cache->entries[i];
+    }
+
+    if(!create)
+        return 0;
+
+    /* Replace the oldest entry when the cache is full */
+    if(!entry) {
+        entry = &cache->entries[cache->next];
+        cache->next = (cache->next + 1) % GESTIC_PARAM_CACHE_SIZE;
+    }
+
+    GESTIC_MEMSET(entry, 0, sizeof(gestic_param_entry_t));
+    entry->param = param;
+    return entry;
+}
+
+int gestic_param_cache_unchanged(gestic_t *gestic, unsigned short param,
+                                        unsigned int arg0, unsigned int arg1)
+{
+    gestic_param_entry_t *entry;
+    int unchanged = 0;
+
+    if(gestic->param_cache.bypass || !gestic_param_cacheable(param))
+        return 0;
+
+#ifdef GESTIC_SYNC_THREADING
+    GESTIC_SYNC_LOCK(gestic->io_sync);
+#endif
+
+    entry = gestic_param_cache_find(gestic, param, 0);
+    if(entry) {
+        if(gestic_param_masked(param))
+            unchanged = arg1 && (entry->known & arg1) == arg1 &&
+                        !((entry->arg0 ^ arg0) & arg1);
+        else
+            unchanged = entry->known == ~0u && entry->arg0 == arg0 &&
+                        entry->arg1 == arg1;
+    }
+
+#ifdef GESTIC_SYNC_THREADING
+    GESTIC_SYNC_UNLOCK(gestic->io_sync);
+#endif
+
+    return unchanged;
+}
+
+void gestic_param_cache_set(gestic_t *gestic, unsigned short param,
+                                   unsigned int arg0, unsigned int arg1,
+                                   int error)
+{
+    gestic_param_entry_t *entry;
+
+    if(!gestic_param_cacheable(param))
+        return;
+
+#ifdef GESTIC_SYNC_THREADING
+    GESTIC_SYNC_LOCK(gestic->io_sync);
+#endif
+
+    if(error || (gestic_param_masked(param) && !arg1)) {
+        /* The state of the device is unknown after a failure or when the
+         * parameter is used without a mask
+         */
+        entry = gestic_param_cache_find(gestic, param, 0);
+        if(entry)
+            entry->param = 0;
+    } else if(gestic_param_masked(param)) {
+        entry = gestic_param_cache_find(gestic, param, 1);
+        entry->arg0 = (entry->arg0 & ~arg1) | (arg0 & arg1);
+        entry->known |= arg1;
+    } else {
+        entry = gestic_param_cache_find(gestic, param, 1);
+        entry->arg0 = arg0;
+        entry->arg1 = arg1;
+        /* Without a mask the set fully determines the parameter */
+        entry->known = ~0u;
+        entry->complete = 1;
+    }
+
+#ifdef GESTIC_SYNC_THREADING
+    GESTIC_SYNC_UNLOCK(gestic->io_sync);
+#endif
+}
+
+int gestic_param_cache_get(gestic_t *gestic, unsigned short param,
+                                  unsigned int *arg0, unsigned int *arg1)
+{
+    gestic_param_entry_t *entry;
+    int found = 0;
+
+    if(gestic->param_cache.bypass)
+        return 0;
+
+#ifdef GESTIC_SYNC_THREADING
+    GESTIC_SYNC_LOCK(gestic->io_sync);
+#endif
+
+    entry = gestic_param_cache_find(gestic, param, 0);
+    if(entry && entry->complete) {
+        if(arg0)
+            *arg0 = entry->arg0;
+        if(arg1)
+            *arg1 = entry->arg1;
+        found = 1;
+    }
+
+#ifdef GESTIC_SYNC_THREADING
+    GESTIC_SYNC_UNLOCK(gestic->io_sync);
+#endif
+
+    return found;
+}
+
+void gestic_param_cache_bypass(gestic_t *gestic, int bypass) {
+    GESTIC_ASSERT(gestic);
+
+    gestic->param_cache.bypass = bypass ? 1 : 0;
+}
+
+void gestic_param_cache_invalidate(gestic_t *gestic) {
+    GESTIC_ASSERT(gestic);
+
+#ifdef GESTIC_SYNC_THREADING
+    GESTIC_SYNC_LOCK(gestic->io_sync);
+#endif
+
+    GESTIC_MEMSET(gestic->param_cache.entries, 0,
+                  sizeof(gestic->param_cache.entries));
+    gestic->param_cache.next = 0;
+
+#ifdef GESTIC_SYNC_THREADING
+    GESTIC_SYNC_UNLOCK(gestic->io_sync);
+#endif
+}
+
+#endif
+
 void gestic_handle_runtime_parameter(gestic_t *gestic,
                                      const unsigned char *data)
 {
@@ -37,6 +204,17 @@ void gestic_handle_runtime_parameter(gestic_t *gestic,
 
     request = gestic->param_request;
     param = GET_U16(data + 4);
+
+#ifndef GESTIC_NO_PARAM_CACHE
+    /* Every reply contains the complete state of the parameter */
+    if(gestic_param_cacheable(param)) {
+        gestic_param_entry_t *entry = gestic_param_cache_find(gestic, param, 1);
+        entry->arg0 = GET_U32(data + 8);
+        entry->arg1 = GET_U32(data + 12);
+        entry->known = ~0u;
+        entry->complete = 1;
+    }
+#endif
     if(request && request->param == param) {
         if(request->arg0)
             *request->arg0 = GET_U32(data + 8);
@@ -53,13 +231,37 @@ void gestic_handle_runtime_parameter(gestic_t *gestic,
 
 int gestic_set_param(gestic_t *gestic, unsigned short param, unsigned int arg0, unsigned int arg1, int timeout) {
     unsigned char msg[16];
+    int error;
+
+#ifndef GESTIC_NO_PARAM_CACHE
+    if(gestic_param_cache_unchanged(gestic, param, arg0, arg1)) {
+#if !defined(GESTIC_NO_DATA_RETRIEVAL) && !defined(GESTIC_NO_WATCHDOG)
+        /* The value might only be known from reading it back */
+        gestic_watchdog_record(gestic, param, arg0, arg1);
+#endif
+        return GESTIC_NO_ERROR;
+    }
+#endif
+
     GESTIC_MEMSET(msg, 0, sizeof(msg));
     SET_U8(msg, sizeof(msg));
     SET_U8(msg + 3, gestic_msg_Set_Runtime_Parameter);
     SET_U16(msg + 4, param);
     SET_U32(msg + 8, arg0);
     SET_U32(msg + 12, arg1);
-    return gestic_send_message(gestic, msg, sizeof(msg), timeout);
+    error = gestic_send_message(gestic, msg, sizeof(msg), timeout);
+
+#ifndef GESTIC_NO_PARAM_CACHE
+    gestic_param_cache_set(gestic, param, arg0, arg1, error);
+#endif
+#if !defined(GESTIC_NO_DATA_RETRIEVAL) && !defined(GESTIC_NO_WATCHDOG)
+    if(!error)
+        gestic_watchdog_record(gestic, param, arg0, arg1);
+#endif
+    if(!error)
+        GESTIC_TRACE_INFO(gestic, gestic_trace_param, param, arg0, arg1);
+
+    return error;
 }
 
 int gestic_get_param(gestic_t *gestic, unsigned short param, unsigned int *arg0, unsigned int *arg1, int timeout)
@@ -67,6 +269,11 @@ int gestic_get_param(gestic_t *gestic, unsigned short param, unsigned int *arg0,
     gestic_param_request_t request;
     int error;
 
+#ifndef GESTIC_NO_PARAM_CACHE
+    if(gestic_param_cache_get(gestic, param, arg0, arg1))
+        return GESTIC_NO_ERROR;
+#endif
+
     /* Enable receiving of parameters */
     request.param = param;
     request.arg0 = arg0;
@@ -108,9 +315,14 @@ int gestic_set_output_enable_mask(gestic_t *gestic, gestic_data_mask_t flags,
     error = gestic_set_param(gestic, gestic_param_dataOutputLockMask,
                               flags, lock, timeout);
 
-    if(!error)
+    if(!error) {
+        gestic->output.locked = (gestic->output.locked & ~lock) | (flags & lock);
         error = gestic_set_param(gestic, gestic_param_dataOutputEnableMask,
                                 flags, mask, timeout);
+    }
+
+    if(!error)
+        gestic->output.enabled = (gestic->output.enabled & ~mask) | (flags & mask);
 
     return error;
 }
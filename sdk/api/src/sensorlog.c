@@ -0,0 +1,492 @@
+/******************************************************************************
+ *
+ * Copyright (C) 2014 Microchip Technology Inc. and its
+ *                    subsidiaries ("Microchip").
+ *
+ * All rights reserved.
+ *
+ * You are permitted to use the Aurea software, GestIC API, and other
+ * accompanying software with Microchip products.  Refer to the license
+ * agreement accompanying this software, if any, for additional info regarding
+ * your rights and obligations.
+ *
+ * SOFTWARE AND DOCUMENTATION ARE PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION, ANY WARRANTY OF
+ * MERCHANTABILITY, TITLE, NON-INFRINGEMENT AND FITNESS FOR A PARTICULAR
+ * PURPOSE. IN NO EVENT SHALL MICROCHIP, SMSC, OR ITS LICENSORS BE LIABLE OR
+ * OBLIGATED UNDER CONTRACT, NEGLIGENCE, STRICT LIABILITY, CONTRIBUTION, BREACH
+ * OF WARRANTY, OR OTHER LEGAL EQUITABLE THEORY FOR ANY DIRECT OR INDIRECT
+ * DAMAGES OR EXPENSES INCLUDING BUT NOT LIMITED TO ANY INCIDENTAL, SPECIAL,
+ * INDIRECT OR CONSEQUENTIAL DAMAGES, OR OTHER SIMILAR COSTS.
+ *
+ ******************************************************************************/
+#include "impl.h"
+
+#ifdef GESTIC_HAS_SENSORLOG
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Largest block accepted from a file, also limits the buffer of a block */
+#define GESTIC_SENSORLOG_MAX_BLOCK 65536
+
+/* Zig-zag maps small negative and positive differences to small codes */
+#define GESTIC_ZIGZAG(X) (((X) << 1) ^ (0u - ((X) >> 31)))
+#define GESTIC_UNZIGZAG(X) (((X) >> 1) ^ (0u - ((X) & 1)))
+
+/* A field of gestic_input_data_t and the data output it is part of */
+typedef struct {
+    unsigned int mask;
+    unsigned short offset;
+} gestic_sensorlog_field_t;
+
+#define GESTIC_FIELD(MASK, MEMBER) \
+    { MASK, (unsigned short)offsetof(gestic_input_data_t, MEMBER) }
+
+static const gestic_sensorlog_field_t gestic_sensorlog_ints[] = {
+    GESTIC_FIELD(0, frame_counter),
+    GESTIC_FIELD(gestic_data_mask_dsp_status, calib.reason),
+    GESTIC_FIELD(gestic_data_mask_dsp_status, calib.last_event),
+    GESTIC_FIELD(gestic_data_mask_dsp_status, frequency.frequency),
+    GESTIC_FIELD(gestic_data_mask_dsp_status, frequency.freq_changed),
+    GESTIC_FIELD(gestic_data_mask_dsp_status, frequency.last_event),
+    GESTIC_FIELD(gestic_data_mask_gesture, gesture.gesture),
+    GESTIC_FIELD(gestic_data_mask_gesture, gesture.flags),
+    GESTIC_FIELD(gestic_data_mask_gesture, gesture.last_event),
+    GESTIC_FIELD(gestic_data_mask_touch, touch.flags),
+    GESTIC_FIELD(gestic_data_mask_touch, touch.last_event),
+    GESTIC_FIELD(gestic_data_mask_touch, touch.tap_flags),
+    GESTIC_FIELD(gestic_data_mask_touch, touch.last_tap_event),
+    GESTIC_FIELD(gestic_data_mask_touch, touch.last_touch_event_start),
+    GESTIC_FIELD(gestic_data_mask_airwheel, air_wheel.counter),
+    GESTIC_FIELD(gestic_data_mask_airwheel, air_wheel.active),
+    GESTIC_FIELD(gestic_data_mask_airwheel, air_wheel.last_event),
+    GESTIC_FIELD(gestic_data_mask_position, pos.x),
+    GESTIC_FIELD(gestic_data_mask_position, pos.y),
+    GESTIC_FIELD(gestic_data_mask_position, pos.z),
+    GESTIC_FIELD(gestic_data_mask_noise_power, noise_power.valid)
+};
+
+static const gestic_sensorlog_field_t gestic_sensorlog_floats[] = {
+    GESTIC_FIELD(gestic_data_mask_noise_power, noise_power.value),
+    GESTIC_FIELD(gestic_data_mask_cic, cic.channel[0]),
+    GESTIC_FIELD(gestic_data_mask_cic, cic.channel[1]),
+    GESTIC_FIELD(gestic_data_mask_cic, cic.channel[2]),
+    GESTIC_FIELD(gestic_data_mask_cic, cic.channel[3]),
+    GESTIC_FIELD(gestic_data_mask_cic, cic.channel[4]),
+    GESTIC_FIELD(gestic_data_mask_sd, sd.channel[0]),
+    GESTIC_FIELD(gestic_data_mask_sd, sd.channel[1]),
+    GESTIC_FIELD(gestic_data_mask_sd, sd.channel[2]),
+    GESTIC_FIELD(gestic_data_mask_sd, sd.channel[3]),
+    GESTIC_FIELD(gestic_data_mask_sd, sd.channel[4])
+};
+
+#define GESTIC_SENSORLOG_INTS \
+    (int)(sizeof(gestic_sensorlog_ints) / sizeof(gestic_sensorlog_ints[0]))
+#define GESTIC_SENSORLOG_FLOATS \
+    (int)(sizeof(gestic_sensorlog_floats) / sizeof(gestic_sensorlog_floats[0]))
+
+/* Largest encoded frame: bitmap, varints of up to 5 bytes, one control byte
+ * per two floats and the floats
+ */
+#define GESTIC_SENSORLOG_FRAME ((GESTIC_SENSORLOG_INTS + 7) / 8 + \
+                                GESTIC_SENSORLOG_INTS * 5 + \
+                                (GESTIC_SENSORLOG_FLOATS + 1) / 2 + \
+                                GESTIC_SENSORLOG_FLOATS * 4)
+
+/* The 4-bit codes of the floats enumerate the pairs of leading and trailing
+ * zero bytes with lead + trail <= 4, lead by lead
+ */
+static const unsigned char gestic_sensorlog_first_code[5] = { 0, 5, 9, 12, 14 };
+static const unsigned char gestic_sensorlog_lead[15] = {
+    0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 3, 3, 4
+};
+
+struct gestic_sensorlog_struct {
+    FILE *file;
+    int writing;
+    int error;
+    gestic_sensorlog_header_t header;
+    /* Offsets of the fields selected by the mask */
+    unsigned short ints[GESTIC_SENSORLOG_INTS];
+    unsigned short floats[GESTIC_SENSORLOG_FLOATS];
+    int int_count;
+    int float_count;
+    /* Predictor state, reset at the start of each block */
+    unsigned int last[GESTIC_SENSORLOG_INTS];
+    unsigned int delta[GESTIC_SENSORLOG_INTS];
+    unsigned int last_float[GESTIC_SENSORLOG_FLOATS];
+    /* The current block, frame counts the frames encoded or decoded */
+    gestic_sensorlog_block_t block;
+    unsigned char *data;
+    unsigned int cursor;
+    unsigned int frame;
+    gestic_sensorlog_stats_t stats;
+};
+
+static gestic_sensorlog_t *gestic_sensorlog_alloc(unsigned int mask,
+                                                  unsigned int block_frames)
+{
+    gestic_sensorlog_t *log;
+    int i;
+
+    log = (gestic_sensorlog_t *)calloc(1, sizeof(gestic_sensorlog_t));
+    if(!log)
+        return 0;
+    log->data = (unsigned char *)malloc(block_frames * GESTIC_SENSORLOG_FRAME);
+    if(!log->data) {
+        free(log);
+        return 0;
+    }
+
+    GESTIC_MEMCPY(log->header.magic, "GLOG", 4);
+    log->header.version = 1;
+    log->header.header_size = sizeof(gestic_sensorlog_header_t);
+    log->header.block_frames = block_frames;
+    log->header.mask = mask;
+
+    for(i = 0; i < GESTIC_SENSORLOG_INTS; ++i) {
+        if(!gestic_sensorlog_ints[i].mask || (gestic_sensorlog_ints[i].mask & mask))
+            log->ints[log->int_count++] = gestic_sensorlog_ints[i].offset;
+    }
+    for(i = 0; i < GESTIC_SENSORLOG_FLOATS; ++i) {
+        if(gestic_sensorlog_floats[i].mask & mask)
+            log->floats[log->float_count++] = gestic_sensorlog_floats[i].offset;
+    }
+
+    return log;
+}
+
+/* Starts a new block, so that it could be decoded on its own */
+static void gestic_sensorlog_reset(gestic_sensorlog_t *log) {
+    GESTIC_MEMSET(log->last, 0, sizeof(log->last));
+    GESTIC_MEMSET(log->delta, 0, sizeof(log->delta));
+    GESTIC_MEMSET(log->last_float, 0, sizeof(log->last_float));
+    log->block.size = 0;
+    log->block.count = 0;
+    log->cursor = 0;
+    log->frame = 0;
+}
+
+/* Updates the prediction of an integer field with its actual value */
+static void gestic_sensorlog_predict(gestic_sensorlog_t *log, int i,
+                                     unsigned int value)
+{
+    log->delta[i] = log->frame ? value - log->last[i] : 0;
+    log->last[i] = value;
+}
+
+static void gestic_sensorlog_encode(gestic_sensorlog_t *log,
+                                    const gestic_input_data_t *data)
+{
+    const unsigned char *base = (const unsigned char *)data;
+    unsigned char *bitmap = log->data + log->block.size;
+    unsigned char *p = bitmap + (log->int_count + 7) / 8;
+    unsigned char *control = 0;
+    unsigned int value, residual;
+    int lead, trail, code, i, j;
+
+    GESTIC_MEMSET(bitmap, 0, (log->int_count + 7) / 8);
+    for(i = 0; i < log->int_count; ++i) {
+        GESTIC_MEMCPY(&value, base + log->ints[i], sizeof(value));
+        residual = value - (log->last[i] + log->delta[i]);
+        gestic_sensorlog_predict(log, i, value);
+        if(!residual)
+            continue;
+
+        bitmap[i >> 3] |= (unsigned char)(1 << (i & 7));
+        residual = GESTIC_ZIGZAG(residual);
+        while(residual >= 0x80) {
+            *p++ = (unsigned char)(residual | 0x80);
+            residual >>= 7;
+        }
+        *p++ = (unsigned char)residual;
+    }
+
+    for(i = 0; i < log->float_count; ++i) {
+        GESTIC_MEMCPY(&value, base + log->floats[i], sizeof(value));
+        residual = value ^ log->last_float[i];
+        log->last_float[i] = value;
+
+        lead = 4;
+        trail = 0;
+        if(residual) {
+            for(lead = 0; !(residual & (0xFF000000u >> (lead * 8))); ++lead)
+                ;
+            for(trail = 0; !(residual & (0xFFu << (trail * 8))); ++trail)
+                ;
+        }
+        code = gestic_sensorlog_first_code[lead] + trail;
+
+        if(i & 1) {
+            *control |= (unsigned char)(code << 4);
+        } else {
+            control = p++;
+            *control = (unsigned char)code;
+        }
+        /* The bytes in between, least significant first */
+        for(j = trail; j < 4 - lead; ++j)
+            *p++ = (unsigned char)(residual >> (j * 8));
+    }
+
+    log->block.size = (unsigned int)(p - log->data);
+}
+
+static int gestic_sensorlog_decode(gestic_sensorlog_t *log,
+                                   gestic_input_data_t *data)
+{
+    unsigned char *base = (unsigned char *)data;
+    const unsigned char *bitmap = log->data + log->cursor;
+    const unsigned char *p = bitmap + (log->int_count + 7) / 8;
+    const unsigned char *end = log->data + log->block.size;
+    unsigned int value, residual;
+    int control = 0;
+    int lead, trail, shift, i, j;
+
+    if(p > end)
+        return GESTIC_IO_ERROR;
+
+    GESTIC_MEMSET(data, 0, sizeof(gestic_input_data_t));
+
+    for(i = 0; i < log->int_count; ++i) {
+        residual = 0;
+        if(bitmap[i >> 3] & (1 << (i & 7))) {
+            for(shift = 0;; shift += 7) {
+                if(p == end || shift > 28)
+                    return GESTIC_IO_ERROR;
+                residual |= (unsigned int)(*p & 0x7F) << shift;
+                if(!(*p++ & 0x80))
+                    break;
+            }
+            residual = GESTIC_UNZIGZAG(residual);
+        }
+        value = log->last[i] + log->delta[i] + residual;
+        gestic_sensorlog_predict(log, i, value);
+        GESTIC_MEMCPY(base + log->ints[i], &value, sizeof(value));
+    }
+
+    for(i = 0; i < log->float_count; ++i) {
+        if(i & 1) {
+            control >>= 4;
+        } else {
+            if(p == end)
+                return GESTIC_IO_ERROR;
+            control = *p++;
+        }
+        if((control & 0x0F) == 15)
+            return GESTIC_IO_ERROR;
+        lead = gestic_sensorlog_lead[control & 0x0F];
+        trail = (control & 0x0F) - gestic_sensorlog_first_code[lead];
+        if(p + (4 - lead - trail) > end)
+            return GESTIC_IO_ERROR;
+
+        residual = 0;
+        for(j = trail; j < 4 - lead; ++j)
+            residual |= (unsigned int)*p++ << (j * 8);
+        value = residual ^ log->last_float[i];
+        log->last_float[i] = value;
+        GESTIC_MEMCPY(base + log->floats[i], &value, sizeof(value));
+    }
+
+    log->cursor = (unsigned int)(p - log->data);
+    return GESTIC_NO_ERROR;
+}
+
+/* Writes the current block and starts the next one */
+static int gestic_sensorlog_flush(gestic_sensorlog_t *log) {
+    gestic_sensorlog_block_t *block = &log->block;
+
+    if(!log->frame)
+        return GESTIC_NO_ERROR;
+
+    GESTIC_MEMCPY(block->magic, "GBLK", 4);
+    block->count = log->frame;
+    block->crc = gestic_crc32(0, log->data, block->size);
+    if(fwrite(block, sizeof(*block), 1, log->file) != 1 ||
+       fwrite(log->data, 1, block->size, log->file) != block->size ||
+       fflush(log->file))
+    {
+        return GESTIC_IO_ERROR;
+    }
+
+    ++log->stats.blocks;
+    log->stats.bytes += sizeof(*block) + block->size;
+    gestic_sensorlog_reset(log);
+
+    return GESTIC_NO_ERROR;
+}
+
+/* Reads the next block, returns GESTIC_NO_DATA at the end of the log */
+static int gestic_sensorlog_next(gestic_sensorlog_t *log) {
+    gestic_sensorlog_block_t *block = &log->block;
+
+    gestic_sensorlog_reset(log);
+
+    /* Without a valid header the following blocks could not be found */
+    if(log->error || fread(block, sizeof(*block), 1, log->file) != 1)
+        return GESTIC_NO_DATA;
+    if(memcmp(block->magic, "GBLK", 4) ||
+       block->count > log->header.block_frames ||
+       block->size > log->header.block_frames * GESTIC_SENSORLOG_FRAME ||
+       fread(log->data, 1, block->size, log->file) != block->size)
+    {
+        block->size = block->count = 0;
+        log->error = GESTIC_IO_ERROR;
+        return GESTIC_IO_ERROR;
+    }
+
+    ++log->stats.blocks;
+    log->stats.bytes += sizeof(*block) + block->size;
+
+    if(gestic_crc32(0, log->data, block->size) != block->crc) {
+        block->size = block->count = 0;
+        return GESTIC_IO_ERROR;
+    }
+
+    return GESTIC_NO_ERROR;
+}
+
+int gestic_sensorlog_create(const char *path, gestic_data_mask_t mask,
+                            int block_frames, gestic_sensorlog_t **log)
+{
+    gestic_sensorlog_t *result;
+
+    GESTIC_ASSERT(path && log);
+
+    *log = 0;
+
+    if(!block_frames)
+        block_frames = GESTIC_SENSORLOG_BLOCK;
+    if(block_frames < 0 || block_frames > GESTIC_SENSORLOG_MAX_BLOCK ||
+       (mask & ~gestic_data_mask_all))
+    {
+        return GESTIC_BAD_PARAM_ERROR;
+    }
+
+    result = gestic_sensorlog_alloc(mask, block_frames);
+    if(!result)
+        return GESTIC_IO_ERROR;
+    result->writing = 1;
+
+    result->file = fopen(path, "wb");
+    if(!result->file) {
+        free(result->data);
+        free(result);
+        return GESTIC_IO_OPEN_ERROR;
+    }
+
+    if(fwrite(&result->header, sizeof(result->header), 1, result->file) != 1) {
+        gestic_sensorlog_close(result, 0);
+        return GESTIC_IO_ERROR;
+    }
+    result->stats.bytes = sizeof(result->header);
+
+    *log = result;
+    return GESTIC_NO_ERROR;
+}
+
+int gestic_sensorlog_write(gestic_sensorlog_t *log,
+                           const gestic_input_data_t *data)
+{
+    GESTIC_ASSERT(log && log->writing && data);
+
+    if(log->error)
+        return log->error;
+
+    gestic_sensorlog_encode(log, data);
+    ++log->frame;
+    ++log->stats.frames;
+    log->stats.raw_bytes += 4 * (log->int_count + log->float_count);
+
+    if(log->frame == log->header.block_frames)
+        log->error = gestic_sensorlog_flush(log);
+
+    return log->error;
+}
+
+int gestic_sensorlog_open(const char *path, gestic_sensorlog_t **log) {
+    gestic_sensorlog_header_t header;
+    gestic_sensorlog_t *result;
+    FILE *file;
+
+    GESTIC_ASSERT(path && log);
+
+    *log = 0;
+
+    file = fopen(path, "rb");
+    if(!file)
+        return GESTIC_IO_OPEN_ERROR;
+
+    if(fread(&header, sizeof(header), 1, file) != 1 ||
+       memcmp(header.magic, "GLOG", 4) || header.version != 1 ||
+       header.header_size < sizeof(header) || !header.block_frames ||
+       header.block_frames > GESTIC_SENSORLOG_MAX_BLOCK ||
+       (header.mask & ~gestic_data_mask_all) ||
+       fseek(file, header.header_size, SEEK_SET))
+    {
+        fclose(file);
+        return GESTIC_BAD_PARAM_ERROR;
+    }
+
+    result = gestic_sensorlog_alloc(header.mask, header.block_frames);
+    if(!result) {
+        fclose(file);
+        return GESTIC_IO_ERROR;
+    }
+    result->file = file;
+    result->stats.bytes = header.header_size;
+
+    *log = result;
+    return GESTIC_NO_ERROR;
+}
+
+int gestic_sensorlog_read(gestic_sensorlog_t *log, gestic_input_data_t *data) {
+    int error;
+
+    GESTIC_ASSERT(log && !log->writing && data);
+
+    while(log->frame == log->block.count) {
+        error = gestic_sensorlog_next(log);
+        if(error)
+            return error;
+    }
+
+    if(gestic_sensorlog_decode(log, data)) {
+        /* Skip the rest of the damaged block */
+        log->frame = log->block.count;
+        return GESTIC_IO_ERROR;
+    }
+    ++log->frame;
+    ++log->stats.frames;
+    log->stats.raw_bytes += 4 * (log->int_count + log->float_count);
+
+    return GESTIC_NO_ERROR;
+}
+
+int gestic_sensorlog_close(gestic_sensorlog_t *log,
+                           gestic_sensorlog_stats_t *stats)
+{
+    int error = GESTIC_NO_ERROR;
+
+    GESTIC_ASSERT(log);
+
+    if(log->writing) {
+        error = log->error;
+        if(!error)
+            error = gestic_sensorlog_flush(log);
+    }
+    if(fclose(log->file) && log->writing && !error)
+        error = GESTIC_IO_ERROR;
+
+    if(stats)
+        *stats = log->stats;
+
+    free(log->data);
+    free(log);
+
+    return error;
+}
+
+#endif
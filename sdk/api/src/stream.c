@@ -26,6 +26,55 @@
 
 unsigned char systemModeElectrodes[] = { 4, 5 };
 
+/* Records an event for dispatching if there is a callback for its type */
+static void gestic_event_add(gestic_t *gestic, gestic_event_t *events,
+                             int *count, gestic_event_type_t type,
+                             int value, int flags, int frame_counter)
+{
+    if(gestic->events[type].callback && *count < GESTIC_MAX_FRAME_EVENTS) {
+        gestic_event_t *event = &events[(*count)++];
+        event->type = type;
+        event->value = value;
+        event->flags = flags;
+        event->frame_counter = frame_counter;
+    }
+}
+
+/* Records an event for each bit of mask that is set in bits */
+static void gestic_event_add_bits(gestic_t *gestic, gestic_event_t *events,
+                                  int *count, gestic_event_type_t type,
+                                  int bits, int mask, int frame_counter)
+{
+    int bit;
+
+    for(bit = 1; bit <= mask; bit <<= 1) {
+        if(bits & mask & bit)
+            gestic_event_add(gestic, events, count, type, bit, 0, frame_counter);
+    }
+}
+
+int gestic_set_event_callback(gestic_t *gestic, gestic_event_type_t type,
+                              gestic_event_callback_t callback, void *opaque)
+{
+    GESTIC_ASSERT(gestic);
+
+    if(type < 0 || type >= gestic_event_count)
+        return GESTIC_BAD_PARAM_ERROR;
+
+#ifdef GESTIC_SYNC_THREADING
+    GESTIC_SYNC_LOCK(gestic->io_sync);
+#endif
+
+    gestic->events[type].callback = callback;
+    gestic->events[type].opaque = opaque;
+
+#ifdef GESTIC_SYNC_THREADING
+    GESTIC_SYNC_UNLOCK(gestic->io_sync);
+#endif
+
+    return GESTIC_NO_ERROR;
+}
+
 void gestic_handle_data_output(gestic_t *gestic,
                                const unsigned char *data)
 {
@@ -36,10 +85,14 @@ void gestic_handle_data_output(gestic_t *gestic,
     int systemMode = (dataOutputConfig & gestic_DataOutConfigMask_ElectrodeConfiguration) >> 8;
     int electrodeCount = systemModeElectrodes[systemMode];
     int increment;
+    gestic_event_t events[GESTIC_MAX_FRAME_EVENTS];
+    int event_count = 0;
+    int i;
 
     gestic_input_data_t *dest = &gestic->internal;
 
     int airWheelActive = (systemInfo & gestic_SystemInfo_PositionValid) ? 1 : 0;
+    int present = airWheelActive;
 
 #ifdef GESTIC_SYNC_THREADING
     /* Synchronize against interaction with the internal buffer
@@ -65,6 +118,9 @@ void gestic_handle_data_output(gestic_t *gestic,
         if(calibration != 0) {
             dest->calib.reason = calibration;
             dest->calib.last_event = dest->frame_counter;
+            gestic_event_add(gestic, events, &event_count,
+                             gestic_event_calibration, calibration, 0,
+                             dest->frame_counter);
         }
         if(frequency != dest->frequency.frequency) {
             dest->frequency.frequency = frequency;
@@ -81,6 +137,9 @@ void gestic_handle_data_output(gestic_t *gestic,
             dest->gesture.gesture = gesture;
             dest->gesture.flags = gestureInfo & gestic_gesture_flags_mask;
             dest->gesture.last_event = dest->frame_counter;
+            gestic_event_add(gestic, events, &event_count,
+                             gestic_event_gesture, gesture,
+                             dest->gesture.flags, dest->frame_counter);
         }
         cursor += 4;
     }
@@ -89,21 +148,43 @@ void gestic_handle_data_output(gestic_t *gestic,
         int touch = info & gestic_touch_mask;
         int tap = info & gestic_tap_mask;
         if((gestic_touch_flags_t)touch != dest->touch.flags) {
+            gestic_event_add_bits(gestic, events, &event_count,
+                                  gestic_event_touch_start,
+                                  touch & ~dest->touch.flags,
+                                  gestic_touch_mask, dest->frame_counter);
+            gestic_event_add_bits(gestic, events, &event_count,
+                                  gestic_event_touch_end,
+                                  dest->touch.flags & ~touch,
+                                  gestic_touch_mask, dest->frame_counter);
             dest->touch.flags = touch;
             dest->touch.last_event = dest->frame_counter;
             dest->touch.last_touch_event_start = dest->frame_counter - ((info & 0xFF0000) >> 16);
         }
+        if(touch)
+            present = 1;
         if(tap) {
             dest->touch.tap_flags = tap;
             dest->touch.last_tap_event = dest->frame_counter;
+            gestic_event_add_bits(gestic, events, &event_count,
+                                  gestic_event_tap, tap,
+                                  gestic_single_tap_mask, dest->frame_counter);
+            gestic_event_add_bits(gestic, events, &event_count,
+                                  gestic_event_double_tap, tap,
+                                  gestic_double_tap_mask, dest->frame_counter);
         }
         cursor += 4;
     }
     if(dataOutputConfig & gestic_DataOutConfigMask_AirWheelInfo) {
         if(airWheelActive) {
             int counter = GET_U8(cursor);
-            if(counter != dest->air_wheel.counter)
+            if(counter != dest->air_wheel.counter) {
+                /* The counter wraps around after 256 increments */
+                gestic_event_add(gestic, events, &event_count,
+                                 gestic_event_air_wheel,
+                                 (signed char)(counter - dest->air_wheel.counter),
+                                 0, dest->frame_counter);
                 dest->air_wheel.counter = counter;
+            }
         }
         cursor += 2;
     }
@@ -144,14 +225,75 @@ void gestic_handle_data_output(gestic_t *gestic,
                 dest->sd.channel[i] = GET_F32(cursor + 4*i);
             for(i = electrodeCount; i < 5; ++i)
                 dest->sd.channel[i] = GESTIC_UNDEFINED_VALUE;
+            if(gestic->presence.sd_threshold > 0) {
+                for(i = 0; i < electrodeCount; ++i) {
+                    if(dest->sd.channel[i] > gestic->presence.sd_threshold ||
+                       dest->sd.channel[i] < -gestic->presence.sd_threshold)
+                        present = 1;
+                }
+            }
         }
         cursor += electrodeCount * 4;
     }
 
+    if(present)
+        gestic->presence.last_seen = dest->frame_counter;
+
+    /* Check whether the message answers a pending <gestic_data_sample> */
+    if(gestic->data_request &&
+       (dataOutputConfig & gestic->data_request->mask) == gestic->data_request->mask)
+    {
+        gestic->data_request->received = 1;
+    }
+
+    GESTIC_PROBE2(frame_decoded, dest->frame_counter, dataOutputConfig);
+    GESTIC_TRACE_DEBUG(gestic, gestic_trace_frame, dest->frame_counter,
+                       dataOutputConfig, 0);
+
 #ifdef GESTIC_SYNC_THREADING
     /* Release synchronization against Application-Layer */
     GESTIC_SYNC_UNLOCK(gestic->io_sync);
 #endif
+
+    /* Dispatch the events outside of the synchronization */
+    for(i = 0; i < event_count; ++i) {
+        gestic_event_handler_t *handler = &gestic->events[events[i].type];
+        if(handler->callback)
+            handler->callback(handler->opaque, &events[i]);
+    }
+}
+
+/* Copies the internal buffer to the result buffer and converts the
+ * frame counters of the events into ages relative to the newest frame.
+ */
+static void gestic_data_result_update(gestic_t *gestic, int last_counter,
+                                      int current_counter)
+{
+    gestic->result = gestic->internal;
+
+    if(gestic->result.gesture.last_event <= last_counter) {
+        gestic->result.gesture.gesture = 0;
+        /* Reset flags except for the in-progress flag */
+        gestic->result.gesture.flags &= gestic_gesture_in_progress;
+    }
+    gestic->result.gesture.last_event = current_counter - gestic->result.gesture.last_event;
+
+    gestic->result.touch.last_event = current_counter - gestic->result.touch.last_event;
+    if(gestic->result.touch.last_tap_event <= last_counter)
+        gestic->result.touch.tap_flags = 0;
+    gestic->result.touch.last_tap_event = current_counter - gestic->result.touch.last_tap_event;
+    gestic->result.touch.last_touch_event_start = current_counter - gestic->result.touch.last_touch_event_start;
+
+    gestic->result.air_wheel.last_event = current_counter -
+            gestic->result.air_wheel.last_event;
+
+    if(gestic->result.calib.last_event <= last_counter)
+        gestic->result.calib.reason = 0;
+    gestic->result.calib.last_event = current_counter - gestic->result.calib.last_event;
+
+    if(gestic->result.frequency.last_event <= last_counter)
+        gestic->result.frequency.freq_changed = 0;
+    gestic->result.frequency.last_event = current_counter - gestic->result.frequency.last_event;
 }
 
 int gestic_data_stream_update(gestic_t *gestic, int *skipped) {
@@ -161,6 +303,9 @@ int gestic_data_stream_update(gestic_t *gestic, int *skipped) {
 
     GESTIC_ASSERT(gestic && GESTIC_CONNECTED(gestic));
 
+    /* Adapt the output mask to the data used by the application */
+    gestic_output_update(gestic);
+
     last_counter = gestic->result.frame_counter;
 
 #if defined(GESTIC_SYNC_INTERRUPT) || defined(GESTIC_SYNC_THREADING)
@@ -192,41 +337,79 @@ int gestic_data_stream_update(gestic_t *gestic, int *skipped) {
             break;
     }
 
+    GESTIC_PROBE2(stream_update, count, count > 0 ? count - 1 : 0);
+
     if(count > 0) {
-        gestic->result = gestic->internal;
+        gestic_data_result_update(gestic, last_counter, current_counter);
 
-        if(gestic->result.gesture.last_event <= last_counter) {
-            gestic->result.gesture.gesture = 0;
-            /* Reset flags except for the in-progress flag */
-            gestic->result.gesture.flags &= gestic_gesture_in_progress;
-        }
-        gestic->result.gesture.last_event = current_counter - gestic->result.gesture.last_event;
+        if(skipped)
+            *skipped = count - 1;
+        if(count > 1)
+            GESTIC_METRIC_ADD(gestic, skipped_frames, count - 1);
 
-        gestic->result.touch.last_event = current_counter - gestic->result.touch.last_event;
-        if(gestic->result.touch.last_tap_event <= last_counter)
-            gestic->result.touch.tap_flags = 0;
-        gestic->result.touch.last_tap_event = current_counter - gestic->result.touch.last_tap_event;
-        gestic->result.touch.last_touch_event_start = current_counter - gestic->result.touch.last_touch_event_start;
+        error = GESTIC_NO_ERROR;
+    }
 
-        gestic->result.air_wheel.last_event = current_counter -
-                gestic->result.air_wheel.last_event;
+#if defined(GESTIC_SYNC_INTERRUPT) || defined(GESTIC_SYNC_THREADING)
+    /* Release synchronization against Hardware-Layer */
+    GESTIC_SYNC_UNLOCK(gestic->io_sync);
+#endif
 
-        if(gestic->result.calib.last_event <= last_counter)
-            gestic->result.calib.reason = 0;
-        gestic->result.calib.last_event = current_counter - gestic->result.calib.last_event;
+    /* Switch the output mask on approach or when idle */
+    if(count > 0)
+        gestic_presence_update(gestic);
 
-        if(gestic->result.frequency.last_event <= last_counter)
-            gestic->result.frequency.freq_changed = 0;
-        gestic->result.frequency.last_event = current_counter - gestic->result.frequency.last_event;
+#ifndef GESTIC_NO_WATCHDOG
+    gestic_watchdog_update(gestic);
+#endif
 
-        if(skipped)
-            *skipped = count - 1;
+    return error;
+}
 
-        error = GESTIC_NO_ERROR;
+int gestic_data_sample(gestic_t *gestic, gestic_data_mask_t mask, int timeout) {
+    gestic_data_request_t request;
+    int error;
+    int remaining = timeout;
+    int last_counter, current_counter;
+
+    GESTIC_ASSERT(gestic && GESTIC_CONNECTED(gestic));
+
+    mask &= gestic_data_mask_all;
+
+    /* Enable detection of the requested message */
+    request.mask = mask;
+    request.received = 0;
+    gestic->data_request = &request;
+
+    /* The message might already arrive before the acknowledgement */
+    error = gestic_set_param(gestic, gestic_param_dataOutputRequestMask,
+                             mask, gestic_data_mask_all, timeout);
+
+    while(!error && !request.received) {
+        error = gestic_message_receive(gestic, &remaining);
+        if(error == GESTIC_NO_DATA)
+            error = GESTIC_MSG_MISSING_ERROR;
+    }
+
+#if defined(GESTIC_SYNC_INTERRUPT) || defined(GESTIC_SYNC_THREADING)
+    GESTIC_SYNC_LOCK(gestic->io_sync);
+#endif
+
+    /* Disable detection of the requested message */
+    gestic->data_request = 0;
+
+    if(!error) {
+        last_counter = gestic->result.frame_counter;
+        current_counter = gestic->internal.frame_counter;
+        gestic_data_result_update(gestic, last_counter, current_counter);
+
+        /* Only the newest of the frames received meanwhile is fetched */
+        if(current_counter - last_counter > 1)
+            GESTIC_METRIC_ADD(gestic, skipped_frames,
+                              current_counter - last_counter - 1);
     }
 
 #if defined(GESTIC_SYNC_INTERRUPT) || defined(GESTIC_SYNC_THREADING)
-    /* Release synchronization against Hardware-Layer */
     GESTIC_SYNC_UNLOCK(gestic->io_sync);
 #endif
 
@@ -0,0 +1,128 @@
+/******************************************************************************
+ *
+ * Copyright (C) 2014 Microchip Technology Inc. and its
+ *                    subsidiaries ("Microchip").
+ *
+ * All rights reserved.
+ *
+ * You are permitted to use the Aurea software, GestIC API, and other
+ * accompanying software with Microchip products.  Refer to the license
+ * agreement accompanying this software, if any, for additional info regarding
+ * your rights and obligations.
+ *
+ * SOFTWARE AND DOCUMENTATION ARE PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION, ANY WARRANTY OF
+ * MERCHANTABILITY, TITLE, NON-INFRINGEMENT AND FITNESS FOR A PARTICULAR
+ * PURPOSE. IN NO EVENT SHALL MICROCHIP, SMSC, OR ITS LICENSORS BE LIABLE OR
+ * OBLIGATED UNDER CONTRACT, NEGLIGENCE, STRICT LIABILITY, CONTRIBUTION, BREACH
+ * OF WARRANTY, OR OTHER LEGAL EQUITABLE THEORY FOR ANY DIRECT OR INDIRECT
+ * DAMAGES OR EXPENSES INCLUDING BUT NOT LIMITED TO ANY INCIDENTAL, SPECIAL,
+ * INDIRECT OR CONSEQUENTIAL DAMAGES, OR OTHER SIMILAR COSTS.
+ *
+ ******************************************************************************/
+#include "impl.h"
+
+#ifdef GESTIC_HAS_TRACE
+
+#ifdef __linux__
+#   include <fcntl.h>
+#   include <stdlib.h>
+#   include <unistd.h>
+#endif
+
+void gestic_trace(gestic_t *gestic, int level, gestic_trace_event_t event,
+                  int arg0, int arg1, int arg2)
+{
+    /* Reserve a slot, concurrent writers get different ones */
+    unsigned int seq = GESTIC_ATOMIC_ADD(&gestic->trace.head, 1) + 1;
+    gestic_trace_entry_t *entry =
+        &gestic->trace.entries[(seq - 1) & (GESTIC_TRACE_SIZE - 1)];
+
+    /* Readers skip the entry until it is complete. The fence keeps the
+     * following stores of the fields from becoming visible before seq = 0.
+     */
+    GESTIC_ATOMIC_STORE(&entry->seq, 0);
+    GESTIC_ATOMIC_FENCE_RELEASE();
+#ifdef GESTIC_TIME_US
+    entry->time = GESTIC_TIME_US();
+#else
+    entry->time = 0;
+#endif
+    entry->event = (unsigned short)event;
+    entry->level = (unsigned short)level;
+    entry->args[0] = arg0;
+    entry->args[1] = arg1;
+    entry->args[2] = arg2;
+    GESTIC_ATOMIC_STORE(&entry->seq, seq);
+}
+
+int gestic_read_trace(gestic_t *gestic, gestic_trace_entry_t *entries,
+                      int count)
+{
+    gestic_trace_entry_t *entry;
+    unsigned int head;
+    unsigned int seq;
+    int copied = 0;
+
+    GESTIC_ASSERT(gestic && (entries || count <= 0));
+
+    head = GESTIC_ATOMIC_LOAD(&gestic->trace.head);
+    if(count > GESTIC_TRACE_SIZE)
+        count = GESTIC_TRACE_SIZE;
+    if((unsigned int)count > head)
+        count = (int)head;
+
+    for(seq = head - count + 1; seq != head + 1; ++seq) {
+        entry = &gestic->trace.entries[(seq - 1) & (GESTIC_TRACE_SIZE - 1)];
+        if(GESTIC_ATOMIC_ACQUIRE(&entry->seq) != seq)
+            continue;
+        entries[copied] = *entry;
+        /* Drop the copy if a writer started to replace the entry meanwhile.
+         * The fence keeps the copy from being reordered after the check.
+         */
+        GESTIC_ATOMIC_FENCE_ACQUIRE();
+        if(GESTIC_ATOMIC_LOAD(&entry->seq) == seq && entries[copied].seq == seq)
+            ++copied;
+    }
+
+    return copied;
+}
+
+#ifdef __linux__
+
+int gestic_write_trace(gestic_t *gestic, const char *path) {
+    gestic_trace_header_t header;
+    gestic_trace_entry_t *entries;
+    int size;
+    int fd;
+    int error = GESTIC_IO_ERROR;
+
+    GESTIC_ASSERT(gestic && path);
+
+    entries = malloc(GESTIC_TRACE_SIZE * sizeof(gestic_trace_entry_t));
+    if(!entries)
+        return GESTIC_IO_ERROR;
+
+    GESTIC_MEMSET(&header, 0, sizeof(header));
+    GESTIC_MEMCPY(header.magic, "GTRC", 4);
+    header.version = 1;
+    header.entry_size = sizeof(gestic_trace_entry_t);
+    header.count = gestic_read_trace(gestic, entries, GESTIC_TRACE_SIZE);
+    size = header.count * sizeof(gestic_trace_entry_t);
+
+    fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if(fd >= 0) {
+        if(write(fd, &header, sizeof(header)) == sizeof(header) &&
+           write(fd, entries, size) == size)
+            error = GESTIC_NO_ERROR;
+        if(close(fd))
+            error = GESTIC_IO_ERROR;
+    }
+
+    free(entries);
+    return error;
+}
+
+#endif
+
+#endif
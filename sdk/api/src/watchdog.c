@@ -0,0 +1,186 @@
+/******************************************************************************
+ *
+ * Copyright (C) 2014 Microchip Technology Inc. and its
+ *                    subsidiaries ("Microchip").
+ *
+ * All rights reserved.
+ *
+ * You are permitted to use the Aurea software, GestIC API, and other
+ * accompanying software with Microchip products.  Refer to the license
+ * agreement accompanying this software, if any, for additional info regarding
+ * your rights and obligations.
+ *
+ * SOFTWARE AND DOCUMENTATION ARE PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION, ANY WARRANTY OF
+ * MERCHANTABILITY, TITLE, NON-INFRINGEMENT AND FITNESS FOR A PARTICULAR
+ * PURPOSE. IN NO EVENT SHALL MICROCHIP, SMSC, OR ITS LICENSORS BE LIABLE OR
+ * OBLIGATED UNDER CONTRACT, NEGLIGENCE, STRICT LIABILITY, CONTRIBUTION, BREACH
+ * OF WARRANTY, OR OTHER LEGAL EQUITABLE THEORY FOR ANY DIRECT OR INDIRECT
+ * DAMAGES OR EXPENSES INCLUDING BUT NOT LIMITED TO ANY INCIDENTAL, SPECIAL,
+ * INDIRECT OR CONSEQUENTIAL DAMAGES, OR OTHER SIMILAR COSTS.
+ *
+ ******************************************************************************/
+#include "impl.h"
+
+#if !defined(GESTIC_NO_DATA_RETRIEVAL) && !defined(GESTIC_NO_WATCHDOG)
+
+void gestic_watchdog_record(gestic_t *gestic, unsigned short param,
+                            unsigned int arg0, unsigned int arg1)
+{
+    gestic_watchdog_param_t *entry = 0;
+    int masked = gestic_param_masked(param);
+    int i;
+
+    if(!gestic_param_cacheable(param) || (masked && !arg1))
+        return;
+
+    for(i = 0; i < GESTIC_WATCHDOG_PARAMS; ++i) {
+        entry = &gestic->watchdog.params[i];
+        if(entry->param == param || !entry->param)
+            break;
+    }
+    if(i == GESTIC_WATCHDOG_PARAMS)
+        return;
+
+    if(!entry->param) {
+        entry->param = param;
+        entry->arg0 = 0;
+        entry->arg1 = 0;
+    }
+    if(masked) {
+        entry->arg0 = (entry->arg0 & ~arg1) | (arg0 & arg1);
+        entry->arg1 |= arg1;
+    } else {
+        entry->arg0 = arg0;
+        entry->arg1 = arg1;
+    }
+}
+
+int gestic_set_watchdog(gestic_t *gestic, int frames, int timeout) {
+    gestic_watchdog_t *watchdog = &gestic->watchdog;
+
+    GESTIC_ASSERT(gestic);
+
+#ifdef GESTIC_TIME_MS
+    watchdog->frames = frames > 0 ? frames : 0;
+    watchdog->timeout = timeout;
+    watchdog->counter = gestic->internal.frame_counter;
+    watchdog->last_frame = GESTIC_TIME_MS();
+    watchdog->stalled = 0;
+    return GESTIC_NO_ERROR;
+#else
+    GESTIC_UNUSED(watchdog);
+    GESTIC_UNUSED(frames);
+    GESTIC_UNUSED(timeout);
+    return GESTIC_NO_IMPLEMENTATION_ERROR;
+#endif
+}
+
+void gestic_get_watchdog_stats(gestic_t *gestic,
+                               gestic_watchdog_stats_t *stats)
+{
+    GESTIC_ASSERT(gestic && stats);
+
+    *stats = gestic->watchdog.stats;
+}
+
+#ifdef GESTIC_TIME_MS
+
+/* Resets the device and sets the recorded parameters again */
+static int gestic_watchdog_restore(gestic_t *gestic) {
+    gestic_watchdog_t *watchdog = &gestic->watchdog;
+    gestic_watchdog_param_t *entry;
+    int error;
+    int i;
+
+    error = gestic_reset_and_wait(gestic, watchdog->timeout);
+
+#ifndef GESTIC_NO_PARAM_CACHE
+    /* Not every device reports the wakeup that clears the cache */
+    gestic_param_cache_invalidate(gestic);
+#endif
+
+    for(i = 0; !error && i < GESTIC_WATCHDOG_PARAMS; ++i) {
+        entry = &watchdog->params[i];
+        if(!entry->param)
+            break;
+        error = gestic_set_param(gestic, entry->param, entry->arg0,
+                                 entry->arg1, watchdog->timeout);
+    }
+
+    return error;
+}
+
+void gestic_watchdog_update(gestic_t *gestic) {
+    gestic_watchdog_t *watchdog = &gestic->watchdog;
+    gestic_event_handler_t *handler = &gestic->events[gestic_event_recovery];
+    gestic_event_t event;
+    int counter = gestic->internal.frame_counter;
+    int now;
+    int start;
+    int error;
+
+    if(!watchdog->frames)
+        return;
+
+    now = GESTIC_TIME_MS();
+
+    if(counter != watchdog->counter) {
+        if(watchdog->stalled) {
+            watchdog->stats.last_downtime = GESTIC_TIME_SINCE(now,
+                                                watchdog->stall_start);
+            if(watchdog->stats.last_downtime > watchdog->stats.max_downtime)
+                watchdog->stats.max_downtime = watchdog->stats.last_downtime;
+            watchdog->stalled = 0;
+        }
+        watchdog->counter = counter;
+        watchdog->last_frame = now;
+        return;
+    }
+
+    if(GESTIC_TIME_SINCE(now, watchdog->last_frame) <
+       watchdog->frames * GESTIC_FRAME_PERIOD)
+        return;
+
+    if(!watchdog->stalled) {
+        watchdog->stalled = 1;
+        watchdog->stall_start = watchdog->last_frame;
+        ++watchdog->stats.stalls;
+    }
+
+    start = now;
+    error = gestic_watchdog_restore(gestic);
+    now = GESTIC_TIME_MS();
+
+    if(error) {
+        ++watchdog->stats.failures;
+    } else {
+        ++watchdog->stats.recoveries;
+        watchdog->stats.last_recovery = GESTIC_TIME_SINCE(now, start);
+    }
+    GESTIC_TRACE_ERROR(gestic, gestic_trace_recovery,
+                       GESTIC_TIME_SINCE(now, start), error, 0);
+
+    /* Give the device another period before the next attempt. Frames
+     * received meanwhile end the stall with the next update.
+     */
+    watchdog->last_frame = now;
+
+    if(handler->callback) {
+        event.type = gestic_event_recovery;
+        event.value = now - start;
+        event.flags = error;
+        event.frame_counter = gestic->internal.frame_counter;
+        handler->callback(handler->opaque, &event);
+    }
+}
+
+#else
+
+void gestic_watchdog_update(gestic_t *gestic) {
+    GESTIC_UNUSED(gestic);
+}
+
+#endif
+
+#endif
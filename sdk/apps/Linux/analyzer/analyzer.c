@@ -0,0 +1,548 @@
+/******************************************************************************
+ *
+ * Copyright (C) 2014 Microchip Technology Inc. and its
+ *                    subsidiaries ("Microchip").
+ *
+ * All rights reserved.
+ *
+ * You are permitted to use the Aurea software, GestIC API, and other
+ * accompanying software with Microchip products.  Refer to the license
+ * agreement accompanying this software, if any, for additional info regarding
+ * your rights and obligations.
+ *
+ * SOFTWARE AND DOCUMENTATION ARE PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION, ANY WARRANTY OF
+ * MERCHANTABILITY, TITLE, NON-INFRINGEMENT AND FITNESS FOR A PARTICULAR
+ * PURPOSE. IN NO EVENT SHALL MICROCHIP, SMSC, OR ITS LICENSORS BE LIABLE OR
+ * OBLIGATED UNDER CONTRACT, NEGLIGENCE, STRICT LIABILITY, CONTRIBUTION, BREACH
+ * OF WARRANTY, OR OTHER LEGAL EQUITABLE THEORY FOR ANY DIRECT OR INDIRECT
+ * DAMAGES OR EXPENSES INCLUDING BUT NOT LIMITED TO ANY INCIDENTAL, SPECIAL,
+ * INDIRECT OR CONSEQUENTIAL DAMAGES, OR OTHER SIMILAR COSTS.
+ *
+ ******************************************************************************/
+#include <gestic_api.h>
+#include <fcntl.h>
+#include <math.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+/* This tool analyzes capture files as written by gestic_start_capture. The
+ * file is mapped into memory and its chunks are decoded by worker threads,
+ * each with its own gestic_t that is fed through gestic_message_handle. The
+ * results of the chunks are merged in file order afterwards.
+ */
+
+#define MAX_THREADS 64
+
+/* Gestures up to gestic_circle_ccw, higher values are counted as others */
+#define GESTURES 8
+
+static const char *gesture_names[GESTURES] = {
+    "None", "Flick West > East", "Flick East > West", "Flick South > North",
+    "Flick North > South", "Circle clockwise", "Circle counter-clockwise",
+    "Other"
+};
+
+/* Upper limits of the buckets of frame gaps, i.e. the difference of the time
+ * stamps of subsequent Sensor_Data_Output messages
+ */
+#define GAP_BUCKETS 7
+static const int gap_limits[GAP_BUCKETS] = { 1, 2, 3, 4, 8, 16, 64 };
+
+typedef enum {
+    timeline_calibration,
+    timeline_frequency
+} timeline_type_t;
+
+typedef struct {
+    unsigned long long time;
+    int frame;
+    timeline_type_t type;
+    int value;
+} timeline_entry_t;
+
+typedef struct {
+    unsigned int count;
+    double sum;
+    double squares;
+    float min;
+    float max;
+} sd_stats_t;
+
+/* Results that simply add up, kept per worker */
+typedef struct {
+    unsigned int records;
+    unsigned int frames;
+    unsigned int corrupt;
+    unsigned int gestures[GESTURES];
+    unsigned int gaps[GAP_BUCKETS + 1];
+    sd_stats_t sd[5];
+} totals_t;
+
+/* Results that depend on the neighbouring chunks, kept per chunk */
+typedef struct {
+    gestic_capture_chunk_t header;
+    const unsigned char *records;
+    int valid;
+    unsigned long long last_time;
+    /* Time stamp of the first and last frame or -1 */
+    int first_stamp;
+    int last_stamp;
+    /* Working frequency of the first and last frame reporting it or -1 */
+    int first_frequency;
+    int last_frequency;
+    int frequency_frame;
+    unsigned long long frequency_time;
+    timeline_entry_t *timeline;
+    int timeline_size;
+    int timeline_capacity;
+} chunk_t;
+
+typedef struct {
+    gestic_t gestic;
+    pthread_t thread;
+    chunk_t *chunks;
+    int chunk_count;
+    int *next;
+    chunk_t *chunk;
+    totals_t totals;
+} worker_t;
+
+static double now_ms(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1000.0 + now.tv_nsec / 1e6;
+}
+
+static void timeline_add(chunk_t *chunk, unsigned long long time, int frame,
+                         timeline_type_t type, int value)
+{
+    timeline_entry_t *entry;
+    int capacity;
+
+    if(chunk->timeline_size == chunk->timeline_capacity) {
+        capacity = chunk->timeline_capacity ? chunk->timeline_capacity * 2 : 16;
+        entry = realloc(chunk->timeline, capacity * sizeof(*entry));
+        if(!entry)
+            return;
+        chunk->timeline = entry;
+        chunk->timeline_capacity = capacity;
+    }
+    entry = &chunk->timeline[chunk->timeline_size++];
+    entry->time = time;
+    entry->frame = frame;
+    entry->type = type;
+    entry->value = value;
+}
+
+static void CDECL on_gesture(void *opaque, const gestic_event_t *event) {
+    worker_t *worker = (worker_t *)opaque;
+
+    ++worker->totals.gestures[event->value < GESTURES ? event->value
+                                                      : GESTURES - 1];
+}
+
+static void CDECL on_calibration(void *opaque, const gestic_event_t *event) {
+    worker_t *worker = (worker_t *)opaque;
+
+    /* The time is filled in once the message was handled */
+    timeline_add(worker->chunk, 0, event->frame_counter, timeline_calibration,
+                 event->value);
+}
+
+static void add_gap(totals_t *totals, int gap) {
+    int i;
+
+    for(i = 0; i < GAP_BUCKETS && gap > gap_limits[i]; ++i)
+        ;
+    ++totals->gaps[i];
+}
+
+/* Adds the SD data of the frame gestic_message_handle just decoded */
+static void add_sd(totals_t *totals, const unsigned char *msg,
+                   const gestic_signal_t *sd)
+{
+    int config = msg[4] | (msg[5] << 8);
+    int electrodes = ((config & gestic_DataOutConfigMask_ElectrodeConfiguration)
+                      >> 8) == 1 ? 5 : 4;
+    sd_stats_t *stats;
+    float value;
+    int i;
+
+    if(!(config & gestic_DataOutConfigMask_SDData) ||
+       !(msg[7] & gestic_SystemInfo_RawDataValid))
+        return;
+
+    for(i = 0; i < electrodes; ++i) {
+        stats = &totals->sd[i];
+        value = sd->channel[i];
+        if(!stats->count || value < stats->min)
+            stats->min = value;
+        if(!stats->count || value > stats->max)
+            stats->max = value;
+        ++stats->count;
+        stats->sum += value;
+        stats->squares += (double)value * value;
+    }
+}
+
+/* Decodes the records of one chunk */
+static void analyze_chunk(worker_t *worker, chunk_t *chunk) {
+    const gestic_capture_chunk_t *header = &chunk->header;
+    const unsigned char *record = chunk->records;
+    const unsigned char *end = record + header->size;
+    gestic_input_data_t *data = &worker->gestic.internal;
+    const unsigned char *msg;
+    unsigned long long time;
+    unsigned int delta;
+    unsigned int count = 0;
+    int timeline;
+    int size;
+    int i;
+
+    chunk->first_stamp = chunk->last_stamp = -1;
+    chunk->first_frequency = chunk->last_frequency = -1;
+    if(gestic_crc32(0, record, header->size) != header->crc) {
+        ++worker->totals.corrupt;
+        return;
+    }
+    chunk->valid = 1;
+
+    /* Every chunk starts on a fresh instance */
+    gestic_initialize(&worker->gestic);
+    gestic_set_event_callback(&worker->gestic, gestic_event_gesture,
+                              on_gesture, worker);
+    gestic_set_event_callback(&worker->gestic, gestic_event_calibration,
+                              on_calibration, worker);
+    worker->chunk = chunk;
+
+    for(; record + 6 <= end; record = msg + size, ++count) {
+        memcpy(&delta, record, 4);
+        size = record[5];
+        msg = record + 6;
+        if(msg + size > end || size < 4)
+            break;
+        time = header->time + delta;
+        chunk->last_time = time;
+        if(record[4] != gestic_capture_received ||
+           msg[3] != gestic_msg_Sensor_Data_Output || size < 8)
+            continue;
+
+        /* The chunk knows the frame counter after its first record. Later
+         * frames continue it as if no frame was lost in between.
+         */
+        if(chunk->first_stamp < 0) {
+            data->frame_counter = (int)header->frame - (count ? 0 : 1);
+            worker->gestic.last_time_stamp = (unsigned char)(msg[6] - 1);
+        }
+
+        timeline = chunk->timeline_size;
+        gestic_message_handle(&worker->gestic, msg, size);
+        for(i = timeline; i < chunk->timeline_size; ++i)
+            chunk->timeline[i].time = time;
+
+        ++worker->totals.frames;
+        if(chunk->first_stamp < 0)
+            chunk->first_stamp = msg[6];
+        else
+            add_gap(&worker->totals, (unsigned char)(msg[6] - chunk->last_stamp));
+        chunk->last_stamp = msg[6];
+
+        if(msg[4] & gestic_DataOutConfigMask_DSPStatus) {
+            if(chunk->first_frequency < 0) {
+                chunk->first_frequency = data->frequency.frequency;
+                chunk->frequency_frame = data->frame_counter;
+                chunk->frequency_time = time;
+            } else if(data->frequency.frequency != chunk->last_frequency) {
+                timeline_add(chunk, time, data->frame_counter,
+                             timeline_frequency, data->frequency.frequency);
+            }
+            chunk->last_frequency = data->frequency.frequency;
+        }
+
+        add_sd(&worker->totals, msg, &data->sd);
+    }
+    worker->totals.records += count;
+
+    gestic_cleanup(&worker->gestic);
+}
+
+static void *worker_run(void *opaque) {
+    worker_t *worker = (worker_t *)opaque;
+    int i;
+
+    while((i = __atomic_fetch_add(worker->next, 1, __ATOMIC_RELAXED)) <
+          worker->chunk_count)
+        analyze_chunk(worker, &worker->chunks[i]);
+
+    return NULL;
+}
+
+/* Reads the chunk at offset, returns 0 if there is none */
+static int read_chunk(const unsigned char *data, size_t size,
+                      unsigned long long offset, size_t end, chunk_t *chunk)
+{
+    if(offset + sizeof(gestic_capture_chunk_t) > end || offset > size)
+        return 0;
+    memcpy(&chunk->header, data + offset, sizeof(chunk->header));
+    if(memcmp(chunk->header.magic, "GCHK", 4) ||
+       offset + sizeof(gestic_capture_chunk_t) + chunk->header.size > end)
+        return 0;
+    chunk->records = data + offset + sizeof(gestic_capture_chunk_t);
+    return 1;
+}
+
+/* Finds the chunks via the index or, if the capture was not stopped, by
+ * walking from one chunk to the next. Returns the count or -1.
+ */
+static int find_chunks(const unsigned char *data, size_t size,
+                       chunk_t **chunks, int *indexed)
+{
+    gestic_capture_header_t header;
+    gestic_capture_trailer_t trailer;
+    gestic_capture_index_t entry;
+    unsigned long long offset;
+    int capacity = 0;
+    int count = 0;
+    chunk_t *grown;
+    unsigned int i;
+
+    *chunks = NULL;
+    *indexed = 0;
+    if(size < sizeof(header))
+        return -1;
+    memcpy(&header, data, sizeof(header));
+    if(memcmp(header.magic, "GCAP", 4) || header.version != 1 ||
+       header.header_size < sizeof(header) || header.header_size > size)
+        return -1;
+
+    if(size >= header.header_size + sizeof(trailer)) {
+        memcpy(&trailer, data + size - sizeof(trailer), sizeof(trailer));
+        *indexed = !memcmp(trailer.magic, "GIDX", 4) &&
+                   trailer.offset + (unsigned long long)trailer.count *
+                   sizeof(entry) + sizeof(trailer) == size;
+    }
+    if(*indexed) {
+        *chunks = calloc(trailer.count ? trailer.count : 1, sizeof(chunk_t));
+        if(!*chunks)
+            return -1;
+        for(i = 0; i < trailer.count; ++i) {
+            memcpy(&entry, data + trailer.offset + i * sizeof(entry),
+                   sizeof(entry));
+            if(!read_chunk(data, size, entry.offset, trailer.offset,
+                           &(*chunks)[i]))
+                break;
+        }
+        if(i == trailer.count)
+            return (int)trailer.count;
+        free(*chunks);
+        *indexed = 0;
+    }
+
+    offset = header.header_size;
+    *chunks = NULL;
+    for(;;) {
+        if(count == capacity) {
+            capacity = capacity ? capacity * 2 : 256;
+            grown = realloc(*chunks, capacity * sizeof(chunk_t));
+            if(!grown)
+                return -1;
+            *chunks = grown;
+        }
+        memset(&(*chunks)[count], 0, sizeof(chunk_t));
+        if(!read_chunk(data, size, offset, size, &(*chunks)[count]))
+            break;
+        offset += sizeof(gestic_capture_chunk_t) + (*chunks)[count++].header.size;
+    }
+
+    return count;
+}
+
+static void print_entry(const timeline_entry_t *entry) {
+    if(entry->type == timeline_calibration)
+        printf("  %10.3f s  frame %10d  calibration 0x%02x\n",
+               entry->time / 1e6, entry->frame, entry->value);
+    else
+        printf("  %10.3f s  frame %10d  frequency %d kHz\n",
+               entry->time / 1e6, entry->frame, entry->value);
+}
+
+int main(int argc, char *argv[]) {
+    static worker_t workers[MAX_THREADS];
+    gestic_capture_header_t header;
+    timeline_entry_t stitched;
+    totals_t totals;
+    chunk_t *chunks;
+    chunk_t *last = NULL;
+    const unsigned char *data;
+    struct stat st;
+    double start, elapsed, duration;
+    double mean;
+    int threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    int frequency = -1;
+    int count, indexed, next = 0;
+    int first = 1;
+    int fd, i, j;
+
+    if(first + 1 < argc && !strcmp(argv[first], "-j")) {
+        threads = atoi(argv[first + 1]);
+        first += 2;
+    }
+    if(argc != first + 1) {
+        fprintf(stderr, "Usage: %s [-j threads] <capture.gcap>\n", argv[0]);
+        return -1;
+    }
+    if(threads < 1)
+        threads = 1;
+    if(threads > MAX_THREADS)
+        threads = MAX_THREADS;
+
+    fd = open(argv[first], O_RDONLY);
+    if(fd < 0 || fstat(fd, &st) || st.st_size == 0) {
+        fprintf(stderr, "Could not open %s.\n", argv[first]);
+        return -1;
+    }
+    data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if(data == MAP_FAILED) {
+        fprintf(stderr, "Could not map %s.\n", argv[first]);
+        return -1;
+    }
+    madvise((void *)data, st.st_size, MADV_WILLNEED);
+
+    count = find_chunks(data, st.st_size, &chunks, &indexed);
+    if(count < 0) {
+        fprintf(stderr, "%s is no capture file.\n", argv[first]);
+        return -1;
+    }
+    memcpy(&header, data, sizeof(header));
+
+    /* Decode the chunks in parallel */
+    start = now_ms();
+    for(i = 0; i < threads; ++i) {
+        workers[i].chunks = chunks;
+        workers[i].chunk_count = count;
+        workers[i].next = &next;
+        if(pthread_create(&workers[i].thread, NULL, worker_run, &workers[i])) {
+            fprintf(stderr, "Could not start thread %d.\n", i);
+            threads = i;
+            break;
+        }
+    }
+    for(i = 0; i < threads; ++i)
+        pthread_join(workers[i].thread, NULL);
+    elapsed = now_ms() - start;
+    if(!threads)
+        return -1;
+
+    /* Merge the results */
+    memset(&totals, 0, sizeof(totals));
+    for(i = 0; i < threads; ++i) {
+        totals.records += workers[i].totals.records;
+        totals.frames += workers[i].totals.frames;
+        totals.corrupt += workers[i].totals.corrupt;
+        for(j = 0; j < GESTURES; ++j)
+            totals.gestures[j] += workers[i].totals.gestures[j];
+        for(j = 0; j <= GAP_BUCKETS; ++j)
+            totals.gaps[j] += workers[i].totals.gaps[j];
+        for(j = 0; j < 5; ++j) {
+            sd_stats_t *to = &totals.sd[j], *from = &workers[i].totals.sd[j];
+            if(!from->count)
+                continue;
+            if(!to->count || from->min < to->min)
+                to->min = from->min;
+            if(!to->count || from->max > to->max)
+                to->max = from->max;
+            to->count += from->count;
+            to->sum += from->sum;
+            to->squares += from->squares;
+        }
+    }
+
+    /* Gaps between chunks, unless a corrupt chunk is in between */
+    for(i = 0; i < count; ++i) {
+        if(!chunks[i].valid) {
+            last = NULL;
+            continue;
+        }
+        if(chunks[i].first_stamp < 0)
+            continue;
+        if(last)
+            add_gap(&totals, (unsigned char)(chunks[i].first_stamp -
+                                             last->last_stamp));
+        last = &chunks[i];
+    }
+
+    duration = count ? (chunks[count - 1].last_time - chunks[0].header.time) / 1e6
+                     : 0;
+    printf("%s: %lld bytes, %d chunks%s, %u corrupt\n", argv[first],
+           (long long)st.st_size, count, indexed ? " (indexed)" : "",
+           totals.corrupt);
+    printf("Started %.3f s after 1970, %.1f s of traffic, %u records, "
+           "%u frames\n", header.start_time / 1e6, duration, totals.records,
+           totals.frames);
+    printf("Decoded with %d threads in %.1f ms, %.1f MB/s\n", threads, elapsed,
+           elapsed > 0 ? st.st_size / 1e3 / elapsed : 0);
+
+    printf("\nGestures:\n");
+    for(i = 1; i < GESTURES; ++i) {
+        if(totals.gestures[i])
+            printf("  %-26s %8u  %8.2f/min\n", gesture_names[i],
+                   totals.gestures[i],
+                   duration > 0 ? totals.gestures[i] * 60 / duration : 0);
+    }
+
+    printf("\nFrame gaps:\n");
+    for(i = 0; i <= GAP_BUCKETS; ++i) {
+        if(i == GAP_BUCKETS)
+            printf("  > %-4d %10u\n", gap_limits[i - 1], totals.gaps[i]);
+        else if(i && gap_limits[i] > gap_limits[i - 1] + 1)
+            printf("  <= %-3d %10u\n", gap_limits[i], totals.gaps[i]);
+        else
+            printf("  %-6d %10u\n", gap_limits[i], totals.gaps[i]);
+    }
+
+    /* Each chunk reports the frequency it started with, that is a change
+     * only if it differs from the end of the preceding chunks
+     */
+    printf("\nTimeline:\n");
+    for(i = 0; i < count; ++i) {
+        if(chunks[i].first_frequency >= 0 &&
+           chunks[i].first_frequency != frequency)
+        {
+            stitched.time = chunks[i].frequency_time;
+            stitched.frame = chunks[i].frequency_frame;
+            stitched.type = timeline_frequency;
+            stitched.value = chunks[i].first_frequency;
+            print_entry(&stitched);
+        }
+        for(j = 0; j < chunks[i].timeline_size; ++j)
+            print_entry(&chunks[i].timeline[j]);
+        if(chunks[i].last_frequency >= 0)
+            frequency = chunks[i].last_frequency;
+        free(chunks[i].timeline);
+    }
+
+    printf("\nSD:\n  %-7s %10s %12s %12s %12s %12s\n", "Channel", "Frames",
+           "Mean", "Std.dev.", "Min", "Max");
+    for(i = 0; i < 5; ++i) {
+        sd_stats_t *stats = &totals.sd[i];
+        if(!stats->count)
+            continue;
+        mean = stats->sum / stats->count;
+        printf("  %-7d %10u %12.2f %12.2f %12.2f %12.2f\n", i, stats->count,
+               mean, sqrt(fmax(stats->squares / stats->count - mean * mean, 0)),
+               stats->min, stats->max);
+    }
+
+    free(chunks);
+    munmap((void *)data, st.st_size);
+
+    return totals.corrupt ? 1 : 0;
+}
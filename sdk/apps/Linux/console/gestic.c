@@ -35,6 +35,15 @@ static const char *gestures[] = {
     "Circle counter-clockwise"
 };
 
+/* Remembers recognized gestures for display */
+static void CDECL on_gesture(void *opaque, const gestic_event_t *event)
+{
+    data_t *data = (data_t *)opaque;
+
+    if(event->value > 0 && event->value <= 6)
+        data->last_gesture = event->value;
+}
+
 void init_device(data_t *data)
 {
     /* Bitmask later used for starting a stream with
@@ -67,6 +76,10 @@ void init_device(data_t *data)
     data->gestic_touch = gestic_get_touch(data->gestic, 0);
     data->gestic_air_wheel = gestic_get_air_wheel(data->gestic, 0);
 
+    /* Get notified about recognized gestures */
+    gestic_set_event_callback(data->gestic, gestic_event_gesture,
+                              on_gesture, data);
+
     /* Reset the device to the default state:
      * - Automatic calibration enabled
      * - All frequencies allowed
@@ -128,10 +141,8 @@ void update_device(data_t *data)
 
         /* Print update of gestures */
         if(data->gestic_gesture != NULL) {
-            /* Remember last gesture and reset it after 1s = 200 updates */
-            if(data->gestic_gesture->gesture > 0 && data->gestic_gesture->gesture <= 6)
-                data->last_gesture = data->gestic_gesture->gesture;
-            else if(data->gestic_gesture->last_event > 200)
+            /* Reset the last gesture after 1s = 200 samples */
+            if(data->gestic_gesture->last_event > FLICK_TIMEOUT)
                 data->last_gesture = 0;
 
             mvprintw(5, 0,
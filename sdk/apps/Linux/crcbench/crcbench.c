@@ -0,0 +1,211 @@
+/******************************************************************************
+ *
+ * Copyright (C) 2014 Microchip Technology Inc. and its
+ *                    subsidiaries ("Microchip").
+ *
+ * All rights reserved.
+ *
+ * You are permitted to use the Aurea software, GestIC API, and other
+ * accompanying software with Microchip products.  Refer to the license
+ * agreement accompanying this software, if any, for additional info regarding
+ * your rights and obligations.
+ *
+ * SOFTWARE AND DOCUMENTATION ARE PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION, ANY WARRANTY OF
+ * MERCHANTABILITY, TITLE, NON-INFRINGEMENT AND FITNESS FOR A PARTICULAR
+ * PURPOSE. IN NO EVENT SHALL MICROCHIP, SMSC, OR ITS LICENSORS BE LIABLE OR
+ * OBLIGATED UNDER CONTRACT, NEGLIGENCE, STRICT LIABILITY, CONTRIBUTION, BREACH
+ * OF WARRANTY, OR OTHER LEGAL EQUITABLE THEORY FOR ANY DIRECT OR INDIRECT
+ * DAMAGES OR EXPENSES INCLUDING BUT NOT LIMITED TO ANY INCIDENTAL, SPECIAL,
+ * INDIRECT OR CONSEQUENTIAL DAMAGES, OR OTHER SIMILAR COSTS.
+ *
+ ******************************************************************************/
+#include <gestic_api.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* This tool cross-checks and benchmarks gestic_crc32 against the byte-wise
+ * table lookup the SDK used before:
+ *
+ *   crcbench [-n megabytes]
+ *
+ * With -g it prints the lookup tables that are included by the SDK as
+ * crc_table.h instead:
+ *
+ *   crcbench -g > ../../api/src/crc_table.h
+ */
+
+#define CRC_P_32 0xEDB88320U
+#define SLICES 8
+
+static unsigned int tables[SLICES][256];
+
+static void init_tables(void) {
+    unsigned int crc;
+    int i, j;
+
+    for(i = 0; i < 256; ++i) {
+        crc = i;
+        for(j = 0; j < 8; ++j)
+            crc = (crc & 1) ? (crc >> 1) ^ CRC_P_32 : crc >> 1;
+        tables[0][i] = crc;
+    }
+
+    /* Table k advances the CRC of a byte over k additional zero bytes */
+    for(j = 1; j < SLICES; ++j) {
+        for(i = 0; i < 256; ++i) {
+            crc = tables[j - 1][i];
+            tables[j][i] = (crc >> 8) ^ tables[0][crc & 0xFF];
+        }
+    }
+}
+
+/* The implementation replaced by gestic_crc32: one lookup per byte */
+static unsigned int reference_crc(const unsigned char *msg, int size) {
+    unsigned int crc = 0xFFFFFFFF;
+    int i;
+
+    for(i = 0; i < size; ++i)
+        crc = (crc >> 8) ^ tables[0][(crc ^ msg[i]) & 0xFF];
+    return crc ^ 0xFFFFFFFF;
+}
+
+static void generate(void) {
+    int i, j;
+
+    printf("/* Generated with sdk/apps/Linux/crcbench -g, do not edit.\r\n");
+    printf(" *\r\n");
+    printf(" * Lookup tables for the CRC-32 of the firmware update messages\r\n");
+    printf(" * (reflected polynomial 0x%08X). Table k advances the CRC of a byte\r\n", CRC_P_32);
+    printf(" * over k further zero bytes, as required for slice-by-8.\r\n");
+    printf(" */\r\n");
+    printf("static const unsigned int gestic_crc_table[GESTIC_CRC_SLICES][256] = {\r\n");
+    for(j = 0; j < SLICES; ++j) {
+        if(j == 1)
+            printf("#if GESTIC_CRC_SLICES > 1\r\n");
+        printf("    {\r\n");
+        for(i = 0; i < 256; ++i) {
+            printf("%s0x%08X%s", i % 6 ? " " : "        ", tables[j][i],
+                   i == 255 ? "\r\n" : (i % 6 == 5 ? ",\r\n" : ","));
+        }
+        printf("    }%s\r\n", j == SLICES - 1 ? "" : ",");
+    }
+    printf("#endif\r\n");
+    printf("};\r\n");
+}
+
+static int cross_check(void) {
+    static const char check[] = "123456789";
+    unsigned char buffer[4096 + 8];
+    unsigned int expected, crc;
+    int failures = 0;
+    int i, offset, size, split;
+
+    if(gestic_crc32(0, check, 9) != 0xCBF43926) {
+        fprintf(stderr, "check value: 0x%08X instead of 0xCBF43926\n",
+                gestic_crc32(0, check, 9));
+        ++failures;
+    }
+
+    srand(42);
+    for(i = 0; i < (int)sizeof(buffer); ++i)
+        buffer[i] = rand() & 0xFF;
+
+    /* Every alignment, every size up to 300 bytes plus some larger ones */
+    for(i = 0; i < 20000; ++i) {
+        offset = i & 7;
+        size = i < 2400 ? i / 8 : rand() % 4097;
+        split = size ? rand() % (size + 1) : 0;
+
+        expected = reference_crc(buffer + offset, size);
+        crc = gestic_crc32(0, buffer + offset, size);
+        if(crc != expected) {
+            fprintf(stderr, "offset %d size %d: 0x%08X instead of 0x%08X\n",
+                    offset, size, crc, expected);
+            ++failures;
+        }
+
+        /* Chained calls have to give the same result */
+        crc = gestic_crc32(0, buffer + offset, split);
+        crc = gestic_crc32(crc, buffer + offset + split, size - split);
+        if(crc != expected) {
+            fprintf(stderr, "offset %d size %d split %d: 0x%08X instead of 0x%08X\n",
+                    offset, size, split, crc, expected);
+            ++failures;
+        }
+    }
+
+    return failures;
+}
+
+static double now(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void benchmark(const char *name, const unsigned char *data, int size,
+                      long long total)
+{
+    long long rounds = total / size;
+    volatile unsigned int sink = 0;
+    double start, reference, sliced;
+    long long i;
+
+    start = now();
+    for(i = 0; i < rounds; ++i)
+        sink ^= reference_crc(data, size);
+    reference = now() - start;
+
+    start = now();
+    for(i = 0; i < rounds; ++i)
+        sink ^= gestic_crc32(0, data, size);
+    sliced = now() - start;
+
+    printf("%-26s %10.1f MB/s %10.1f MB/s %8.2fx\n", name,
+           rounds * size / reference / 1e6, rounds * size / sliced / 1e6,
+           reference / sliced);
+}
+
+int main(int argc, char *argv[]) {
+    static unsigned char buffer[1 << 20];
+    long long total = 256LL << 20;
+    int failures;
+    int i;
+
+    init_tables();
+
+    for(i = 1; i < argc; ++i) {
+        if(!strcmp(argv[i], "-g")) {
+            generate();
+            return 0;
+        } else if(!strcmp(argv[i], "-n") && i + 1 < argc) {
+            total = atoll(argv[++i]) << 20;
+        } else {
+            fprintf(stderr, "Usage: %s [-g] [-n megabytes]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    failures = cross_check();
+    if(failures) {
+        fprintf(stderr, "%d mismatches\n", failures);
+        return 1;
+    }
+    printf("cross-check passed\n\n");
+
+    for(i = 0; i < (int)sizeof(buffer); ++i)
+        buffer[i] = i * 131 + (i >> 8);
+
+    printf("%-26s %15s %15s %9s\n", "", "byte-wise", "gestic_crc32", "speedup");
+    /* The payloads of Fw_Update_Start, Fw_Update_Completed and _Block */
+    benchmark("Fw_Update_Start (20)", buffer, 20, total);
+    benchmark("Fw_Update_Completed (128)", buffer, 128, total);
+    benchmark("Fw_Update_Block (132)", buffer, 132, total);
+    benchmark("1 MB", buffer, sizeof(buffer), total);
+
+    return 0;
+}
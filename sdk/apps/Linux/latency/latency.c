@@ -0,0 +1,175 @@
+/******************************************************************************
+ *
+ * Copyright (C) 2014 Microchip Technology Inc. and its
+ *                    subsidiaries ("Microchip").
+ *
+ * All rights reserved.
+ *
+ * You are permitted to use the Aurea software, GestIC API, and other
+ * accompanying software with Microchip products.  Refer to the license
+ * agreement accompanying this software, if any, for additional info regarding
+ * your rights and obligations.
+ *
+ * SOFTWARE AND DOCUMENTATION ARE PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION, ANY WARRANTY OF
+ * MERCHANTABILITY, TITLE, NON-INFRINGEMENT AND FITNESS FOR A PARTICULAR
+ * PURPOSE. IN NO EVENT SHALL MICROCHIP, SMSC, OR ITS LICENSORS BE LIABLE OR
+ * OBLIGATED UNDER CONTRACT, NEGLIGENCE, STRICT LIABILITY, CONTRIBUTION, BREACH
+ * OF WARRANTY, OR OTHER LEGAL EQUITABLE THEORY FOR ANY DIRECT OR INDIRECT
+ * DAMAGES OR EXPENSES INCLUDING BUT NOT LIMITED TO ANY INCIDENTAL, SPECIAL,
+ * INDIRECT OR CONSEQUENTIAL DAMAGES, OR OTHER SIMILAR COSTS.
+ *
+ ******************************************************************************/
+#include <gestic_api.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* This tool compares the latency of connections opened with gestic_open_uri,
+ * e.g. the kernel module against the direct I2C backend:
+ *
+ *   latency dev:/dev/gestic i2c:/dev/i2c-1
+ *
+ * It measures the round trip of reading a runtime parameter from the device
+ * and prints the estimate the SDK derives its timeouts from.
+ * With -r it instead requests single data outputs and reports the read
+ * latency of the received messages as measured by the SDK.
+ */
+
+#define DEFAULT_COUNT 200
+
+static long long now_us(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1000000LL + now.tv_nsec / 1000;
+}
+
+static int compare(const void *a, const void *b) {
+    long long x = *(const long long *)a;
+    long long y = *(const long long *)b;
+    return x < y ? -1 : x > y;
+}
+
+static void print_read_latency(const char *uri, gestic_t *gestic, int errors) {
+    gestic_read_latency_t latency;
+
+    gestic_get_read_latency(gestic, &latency);
+    printf("%-32s %5d %7d %7d %7d %6d\n", uri, latency.messages, latency.min,
+           latency.average, latency.max, errors);
+}
+
+static void print_rtt_stats(gestic_t *gestic) {
+    gestic_rtt_stats_t stats;
+
+    if(gestic_get_rtt_stats(gestic, gestic_msg_Request_Message, &stats))
+        return;
+    printf("%-32s srtt %d us, rttvar %d us, timeout %d ms, retries %d\n", "",
+           stats.srtt, stats.rttvar, stats.timeout, stats.retries);
+}
+
+static int measure(const char *uri, int count, int read_latency) {
+    gestic_t *gestic = gestic_create();
+    long long *samples = malloc(count * sizeof(long long));
+    long long start, sum = 0;
+    unsigned int arg0, arg1;
+    int errors = 0;
+    int n = 0;
+    int i;
+
+    gestic_initialize(gestic);
+
+    if(!samples || gestic_open_uri(gestic, uri) < 0) {
+        fprintf(stderr, "Could not open %s.\n", uri);
+        free(samples);
+        gestic_cleanup(gestic);
+        gestic_free(gestic);
+        return -1;
+    }
+
+    /* Every request has to reach the device */
+    gestic_param_cache_bypass(gestic, 1);
+
+    if(read_latency) {
+        /* Only the requested messages should arrive */
+        gestic_set_output_enable_mask(gestic, 0, 0, gestic_data_mask_all, 100);
+        gestic_measure_read_latency(gestic, 1);
+        for(i = 0; i < count; ++i) {
+            if(gestic_data_sample(gestic, gestic_data_mask_position, 100))
+                ++errors;
+        }
+        print_read_latency(uri, gestic, errors);
+        count = 0;
+    }
+
+    for(i = 0; i < count; ++i) {
+        start = now_us();
+        if(gestic_get_param(gestic, gestic_param_dataOutputEnableMask,
+                            &arg0, &arg1, 100))
+        {
+            ++errors;
+            continue;
+        }
+        samples[n] = now_us() - start;
+        sum += samples[n++];
+    }
+
+    if(read_latency) {
+        /* Already reported */
+    } else if(n) {
+        qsort(samples, n, sizeof(long long), compare);
+        printf("%-32s %5d %7lld %7lld %7lld %7lld %7lld %6d\n", uri, n,
+               samples[0], sum / n, samples[n / 2], samples[n * 99 / 100],
+               samples[n - 1], errors);
+        print_rtt_stats(gestic);
+    } else {
+        printf("%-32s %5d %7s %7s %7s %7s %7s %6d\n", uri, 0, "-", "-", "-",
+               "-", "-", errors);
+    }
+
+    gestic_close(gestic);
+    gestic_cleanup(gestic);
+    gestic_free(gestic);
+    free(samples);
+    return 0;
+}
+
+int main(int argc, char *argv[]) {
+    int count = DEFAULT_COUNT;
+    int read_latency = 0;
+    int first = 1;
+    int error = 0;
+    int i;
+
+    for(; first < argc && argv[first][0] == '-'; ++first) {
+        if(!strcmp(argv[first], "-r"))
+            read_latency = 1;
+        else if(!strcmp(argv[first], "-n") && first + 1 < argc)
+            count = atoi(argv[++first]);
+        else
+            break;
+    }
+
+    if(first >= argc || count <= 0) {
+        fprintf(stderr, "Usage: %s [-r] [-n count] <uri>...\n"
+                        "  -r  Measure the read latency of requested data outputs\n"
+                        "  e.g. %s dev:/dev/gestic i2c:/dev/i2c-1\n",
+                argv[0], argv[0]);
+        return -1;
+    }
+
+    if(read_latency) {
+        printf("Read latency of messages in us\n");
+        printf("%-32s %5s %7s %7s %7s %6s\n", "uri", "n", "min", "avg", "max",
+               "errors");
+    } else {
+        printf("Round trip of parameter requests in us\n");
+        printf("%-32s %5s %7s %7s %7s %7s %7s %6s\n", "uri", "n", "min",
+               "avg", "p50", "p99", "max", "errors");
+    }
+
+    for(i = first; i < argc; ++i)
+        error |= measure(argv[i], count, read_latency);
+
+    return error;
+}
@@ -0,0 +1,121 @@
+/******************************************************************************
+ *
+ * Copyright (C) 2014 Microchip Technology Inc. and its
+ *                    subsidiaries ("Microchip").
+ *
+ * All rights reserved.
+ *
+ * You are permitted to use the Aurea software, GestIC API, and other
+ * accompanying software with Microchip products.  Refer to the license
+ * agreement accompanying this software, if any, for additional info regarding
+ * your rights and obligations.
+ *
+ * SOFTWARE AND DOCUMENTATION ARE PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION, ANY WARRANTY OF
+ * MERCHANTABILITY, TITLE, NON-INFRINGEMENT AND FITNESS FOR A PARTICULAR
+ * PURPOSE. IN NO EVENT SHALL MICROCHIP, SMSC, OR ITS LICENSORS BE LIABLE OR
+ * OBLIGATED UNDER CONTRACT, NEGLIGENCE, STRICT LIABILITY, CONTRIBUTION, BREACH
+ * OF WARRANTY, OR OTHER LEGAL EQUITABLE THEORY FOR ANY DIRECT OR INDIRECT
+ * DAMAGES OR EXPENSES INCLUDING BUT NOT LIMITED TO ANY INCIDENTAL, SPECIAL,
+ * INDIRECT OR CONSEQUENTIAL DAMAGES, OR OTHER SIMILAR COSTS.
+ *
+ ******************************************************************************/
+#include <gestic_api.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* This tool brings the device to the configuration of a Library.settings
+ * file or a parameter list and reports how long it took.
+ */
+
+static char *read_file(const char *filename, int *size) {
+    FILE *file = fopen(filename, "rb");
+    char *content = NULL;
+    long length;
+
+    if(!file)
+        return NULL;
+
+    if(!fseek(file, 0, SEEK_END) && (length = ftell(file)) >= 0 &&
+       !fseek(file, 0, SEEK_SET))
+    {
+        content = malloc(length + 1);
+        if(content && fread(content, 1, length, file) != (size_t)length) {
+            free(content);
+            content = NULL;
+        }
+        *size = (int)length;
+    }
+
+    fclose(file);
+    return content;
+}
+
+int main(int argc, char *argv[]) {
+    gestic_t *gestic;
+    gestic_profile_t profile;
+    gestic_profile_report_t report;
+    const char *filename = NULL;
+    int dry_run = 0;
+    char *text;
+    int size = 0;
+    int error;
+    int i;
+
+    for(i = 1; i < argc; ++i) {
+        if(!strcmp(argv[i], "-n"))
+            dry_run = 1;
+        else
+            filename = argv[i];
+    }
+
+    if(!filename) {
+        fprintf(stderr, "Usage: %s [-n] <Library.settings|parameter list>\n"
+                        "  -n  Only show the parameters of the profile\n",
+                argv[0]);
+        return -1;
+    }
+
+    text = read_file(filename, &size);
+    if(!text) {
+        fprintf(stderr, "Could not read %s.\n", filename);
+        return -1;
+    }
+
+    gestic_profile_init(&profile);
+    error = gestic_profile_parse(&profile, text, size);
+    free(text);
+    if(error) {
+        fprintf(stderr, "Could not parse %s.\n", filename);
+        return -1;
+    }
+
+    for(i = 0; i < profile.count; ++i) {
+        printf("0x%04X 0x%08X 0x%08X\n", profile.params[i].param,
+               profile.params[i].arg0, profile.params[i].arg1);
+    }
+
+    if(dry_run)
+        return 0;
+
+    gestic = gestic_create();
+    gestic_initialize(gestic);
+
+    if(gestic_open(gestic) < 0) {
+        fprintf(stderr, "Could not open connection to device.\n");
+        return -1;
+    }
+
+    error = gestic_profile_apply(gestic, &profile, &report, 100);
+
+    printf("%d parameters, %d read back, %d changed, %d failed in %d ms\n",
+           report.params, report.read, report.changed, report.failed,
+           report.time);
+
+    gestic_close(gestic);
+    gestic_cleanup(gestic);
+    gestic_free(gestic);
+
+    return error ? -1 : 0;
+}
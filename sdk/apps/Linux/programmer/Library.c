@@ -1,2481 +0,0 @@
-// This file was generated with mgcconv, which is part of the Microchip GestIC SDK 1.1.8
-
-struct {
-    int record_count;
-    unsigned char iv[14];
-    unsigned char fw_version[120];
-    struct {
-        unsigned short address;
-        unsigned char length;
-        unsigned char data[128];
-    } data[223];
-} Library = {
-    // Record-Count
-    223,
-
-    // IV
-    0x42,0xea,0xff,0x27,0x9,0x5e,0xc9,0x15,0x4a,0x92,0x2f,0x95,0xe1,0x29,
-
-    // FwVersion: 1.2.4;p:HillstarV01;x:NINJA1  ;DSP:ID9000r2151;i:B;f:22500;nMsg;s:Rel_1_2r1400:1401:NM;c:MKI;
-    0x31,0x2e,0x32,0x2e,0x34,0x3b,0x70,0x3a,0x48,0x69,0x6c,0x6c,0x73,0x74,0x61,0x72,
-    0x56,0x30,0x31,0x3b,0x78,0x3a,0x4e,0x49,0x4e,0x4a,0x41,0x31,0x20,0x20,0x3b,0x44,
-    0x53,0x50,0x3a,0x49,0x44,0x39,0x30,0x30,0x30,0x72,0x32,0x31,0x35,0x31,0x3b,0x69,
-    0x3a,0x42,0x3b,0x66,0x3a,0x32,0x32,0x35,0x30,0x30,0x3b,0x6e,0x4d,0x73,0x67,0x3b,
-    0x73,0x3a,0x52,0x65,0x6c,0x5f,0x31,0x5f,0x32,0x72,0x31,0x34,0x30,0x30,0x3a,0x31,
-    0x34,0x30,0x31,0x3a,0x4e,0x4d,0x3b,0x63,0x3a,0x4d,0x4b,0x49,0x3b,0x0,0x3b,0x0,
-    0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-    0x0,0x0,0x0,0x0,0xe1,0xea,0x0,0x0,
-
-    // Record 0: Address = 0x1000, Length = 128
-    0x1000,0x80,
-    0x7d,0xff,0x84,0xca,0x5e,0x14,0x94,0xda,0x25,0x10,0xc,0x3f,0x84,0xdd,0xf3,0xc5,
-    0xa9,0x31,0x83,0x8,0xbe,0x8b,0xc9,0x3d,0x97,0xc6,0x1b,0x90,0x33,0xe2,0x5b,0x5b,
-    0x60,0xb5,0xfb,0xf,0xfe,0xb8,0xc1,0xb0,0x4f,0x90,0x4c,0xc,0x62,0x1d,0x8,0x55,
-    0x34,0xdc,0x2f,0xbe,0x7b,0x83,0x1d,0x43,0xd,0x39,0x2c,0x7e,0xb1,0xb7,0x73,0xfa,
-    0x17,0x90,0xbb,0xe6,0xdc,0xd3,0x97,0x7b,0x86,0x17,0x3,0x52,0x81,0xd1,0x4f,0x8e,
-    0xe2,0xf7,0x67,0x4c,0x14,0xa4,0xa6,0xa1,0xd9,0xbd,0x3f,0xb9,0x13,0xb4,0xe1,0xd2,
-    0xdf,0x2a,0xfa,0x2e,0xff,0xb2,0x72,0x62,0x63,0x6e,0x50,0xa,0x4c,0x75,0x9c,0xda,
-    0xcf,0xc8,0x4b,0xb7,0x1,0xc3,0xdc,0x90,0x90,0x99,0x52,0x1b,0x10,0x81,0x1a,0x40,
-
-    // Record 1: Address = 0x1080, Length = 128
-    0x1080,0x80,
-    0x94,0x3b,0x19,0xd9,0x87,0xcc,0xaf,0xe6,0x8f,0xa7,0xa7,0x72,0x63,0xe0,0x3a,0x73,
-    0x96,0x2c,0x90,0x7b,0x75,0x24,0xfb,0x5c,0x65,0x16,0xc3,0x7c,0xf5,0x8b,0x17,0x94,
-    0xb3,0xb4,0x8e,0x6a,0x9e,0x9d,0x3d,0x41,0xc2,0xed,0xe3,0x62,0xa7,0xf1,0xd9,0x2c,
-    0xce,0xfb,0xd4,0xf0,0x25,0x78,0x14,0x61,0x98,0x15,0x61,0x41,0x55,0x19,0x3a,0xa9,
-    0x85,0x89,0xa9,0x34,0x94,0x72,0x36,0xe6,0x8b,0x3e,0x0,0x8a,0x44,0x1b,0xd8,0x43,
-    0x68,0xa9,0x1f,0xc7,0xfb,0x6b,0xf3,0xae,0x1e,0x87,0xa8,0x6,0x9e,0xf0,0x45,0xae,
-    0x3b,0x5b,0x93,0x54,0x6c,0xd8,0x8c,0xdf,0x78,0x1a,0xfc,0xd5,0xcb,0xc,0x58,0xf9,
-    0xef,0x0,0x4,0xca,0xfa,0x57,0x42,0xd9,0x7e,0x47,0x61,0xd6,0x90,0xc5,0xfc,0xc0,
-
-    // Record 2: Address = 0x1100, Length = 128
-    0x1100,0x80,
-    0x76,0x85,0x9f,0xea,0xa2,0x9b,0x18,0x43,0x4f,0x42,0xcf,0xe,0xe5,0x60,0x84,0xec,
-    0x11,0x90,0x8f,0x33,0x7e,0x0,0x9a,0x65,0x80,0x83,0xad,0x97,0x25,0x7b,0xf0,0x37,
-    0x5f,0xe3,0xb5,0xdc,0xf5,0x90,0xe7,0x2d,0x40,0x1a,0xcb,0xa3,0x9d,0x3d,0x21,0x4f,
-    0xcf,0x3,0x67,0xd8,0x5a,0xc1,0x12,0xeb,0x8c,0xad,0xbb,0x26,0x19,0x16,0x66,0x49,
-    0x76,0x24,0xb1,0xa5,0x68,0xf4,0xe1,0xf3,0xf6,0xc5,0xe2,0x4a,0x45,0x91,0x1d,0x5d,
-    0xaf,0x7b,0xc3,0x43,0x34,0xd2,0xdb,0xb8,0xf9,0xd7,0xe1,0x1f,0x58,0xd9,0x25,0x7,
-    0xde,0xca,0xf6,0xcd,0x40,0x33,0xa0,0x4c,0x54,0xcd,0x6d,0x60,0xe6,0x3d,0xfd,0x8d,
-    0xe8,0xe8,0xf1,0x97,0x2d,0x8d,0x54,0xd3,0x95,0x57,0xf0,0xe7,0xae,0x13,0x6f,0xcc,
-
-    // Record 3: Address = 0x1180, Length = 128
-    0x1180,0x80,
-    0x77,0x46,0x7,0x54,0x97,0xb6,0x43,0x57,0xed,0xff,0x60,0x42,0xe7,0x88,0x49,0xb0,
-    0xb1,0x48,0xb7,0x10,0xd8,0x8b,0x70,0x32,0x6b,0x8d,0x17,0x64,0xe,0x89,0x53,0xc4,
-    0xb7,0x69,0x22,0x3b,0x86,0xf,0x7d,0x29,0x5f,0x5b,0xe8,0x6f,0xd9,0x33,0x82,0xab,
-    0x91,0x85,0x9c,0x2d,0xf0,0xc3,0x4e,0xe9,0xae,0x6d,0x33,0x70,0x60,0x5,0xa2,0x44,
-    0x6,0x6c,0xa1,0x76,0x22,0xa4,0x21,0x39,0xda,0x3f,0x90,0x96,0x13,0x5d,0x4a,0x91,
-    0xf3,0x46,0xdc,0x6b,0x3e,0x18,0xf8,0x27,0xaa,0x70,0xc1,0x82,0x44,0xa,0x3f,0x94,
-    0xf4,0x6e,0xa7,0x8b,0x26,0xf0,0x67,0x18,0x2,0xa2,0x34,0xe4,0x27,0xe0,0xba,0xea,
-    0xe1,0x18,0x95,0xb7,0x51,0x59,0x62,0x48,0x41,0x37,0xf8,0x6b,0x60,0x7d,0xf3,0x34,
-
-    // Record 4: Address = 0x1200, Length = 128
-    0x1200,0x80,
-    0xe,0xef,0x63,0x11,0xc2,0xe1,0x71,0x82,0xd0,0xdb,0xe4,0xe9,0xf7,0x41,0x44,0x14,
-    0x23,0xc6,0xb9,0xee,0xbc,0x48,0xfb,0x63,0xb0,0x3a,0xdd,0x2b,0x6a,0xd0,0xf9,0x87,
-    0x30,0x87,0xcb,0x7c,0xe1,0xc2,0xd3,0x87,0x2a,0xf0,0xfb,0xfc,0x5c,0x42,0x15,0xca,
-    0x7,0x87,0x3b,0xc,0x4e,0xc7,0xad,0xde,0x52,0x47,0x9f,0x9b,0xab,0xf5,0x29,0x91,
-    0x8a,0x5a,0xe1,0x77,0x22,0xf8,0x93,0x7,0x38,0x2f,0x5e,0x8d,0x70,0x8,0xb7,0x45,
-    0x59,0x3c,0xf3,0xe5,0xce,0xd9,0xc7,0x20,0xf5,0x3e,0xb6,0x73,0xa1,0x64,0xed,0x61,
-    0x7a,0x44,0x5b,0x89,0xdf,0x7c,0x40,0xf7,0xe8,0x88,0x2d,0xa3,0xf7,0xd7,0x9f,0x3,
-    0xab,0x5c,0x31,0xfa,0x8b,0xe0,0x20,0x61,0x79,0x4f,0x9,0x25,0xf6,0xc1,0x76,0xf8,
-
-    // Record 5: Address = 0x1280, Length = 128
-    0x1280,0x80,
-    0x81,0x18,0x7e,0x22,0x1e,0x45,0xaa,0x37,0xdd,0x27,0xcf,0xd0,0xa2,0xc8,0x90,0x5c,
-    0xa9,0xb6,0xf5,0x66,0x8f,0xc1,0x29,0x13,0xd3,0xbf,0xed,0x23,0x52,0x32,0xcf,0xc5,
-    0xff,0x36,0x8,0x80,0x1e,0x9,0xc7,0x66,0xe5,0xc3,0x27,0x56,0x5e,0x1a,0x65,0xff,
-    0xdf,0x6d,0x41,0x60,0xb1,0x2,0x2c,0x26,0xa9,0x53,0x30,0xa4,0xd2,0x59,0x5c,0xb0,
-    0x52,0xf4,0x93,0x33,0xa,0x59,0xb2,0x1d,0x6b,0xff,0xd,0xbb,0x4c,0xf6,0xb0,0x6e,
-    0x86,0x26,0x65,0x77,0x7a,0xa5,0x1,0x3b,0x6a,0x6c,0x29,0x3,0xc9,0xf,0x1c,0xed,
-    0x18,0xe3,0x1,0xb5,0x70,0xa9,0xc5,0x7,0xd4,0x19,0x59,0xa3,0xda,0x67,0x94,0x54,
-    0x56,0x76,0x3,0x20,0x98,0x27,0x47,0xe6,0x24,0x17,0x3e,0x8d,0xdc,0xae,0x7b,0xa1,
-
-    // Record 6: Address = 0x1300, Length = 128
-    0x1300,0x80,
-    0x9e,0xbc,0x16,0x89,0x1d,0xcd,0xe,0xc1,0xcc,0x47,0x47,0x62,0xee,0x24,0x2c,0x17,
-    0x12,0x69,0xb3,0xd2,0xae,0xf7,0xee,0x10,0x51,0x9a,0x7e,0x2b,0x41,0x0,0x35,0xe5,
-    0x3e,0x54,0x85,0x1a,0x43,0xa4,0x2f,0xf0,0xa9,0x20,0xda,0xeb,0xe5,0x6c,0xdc,0x56,
-    0x38,0xbc,0x10,0xa2,0xb5,0xf4,0xa3,0xa,0x2f,0x13,0xa7,0x8b,0x5,0xde,0xcc,0xf8,
-    0xa4,0xea,0xc7,0x3a,0x44,0x68,0xde,0x5c,0x66,0x3a,0xfc,0xcf,0xfa,0xbf,0x8a,0x9a,
-    0x43,0x54,0x1d,0x52,0x36,0xb4,0xd,0xe5,0xab,0x4c,0x57,0xa,0x35,0xc3,0x4e,0x80,
-    0x93,0x84,0x15,0xb2,0x8c,0x16,0xda,0x36,0xf2,0xc4,0x9f,0x26,0xee,0x92,0x86,0xc1,
-    0xbd,0xd3,0x76,0x12,0x42,0x50,0xe5,0xb9,0x5f,0x87,0x12,0xa6,0x6f,0x11,0x92,0xe7,
-
-    // Record 7: Address = 0x1380, Length = 128
-    0x1380,0x80,
-    0x1f,0x33,0xce,0x69,0x32,0x4b,0xca,0xb7,0x51,0x63,0x86,0xd8,0x8b,0x31,0x44,0x2b,
-    0x7a,0x17,0x4d,0x5f,0x3c,0x1a,0x3b,0x54,0x15,0x86,0x6e,0x2b,0x28,0x1d,0x94,0xc8,
-    0x3,0xc5,0xe3,0x29,0xcc,0x2e,0x56,0xd,0x19,0x35,0xb,0x99,0x4e,0xe4,0x1c,0xe3,
-    0xbf,0x95,0xc8,0xce,0x3e,0x27,0x15,0x51,0x93,0xda,0x95,0x8e,0xb1,0x56,0x52,0x89,
-    0x94,0x8c,0xf0,0x58,0x67,0x6c,0x7a,0x99,0x9d,0x6c,0x2d,0x1a,0xbe,0xc6,0xf9,0xb3,
-    0xe6,0x62,0xcd,0x42,0xa2,0x80,0x81,0x29,0xbd,0xab,0x42,0xad,0xa1,0x77,0x6a,0xf0,
-    0xaa,0xe,0xcf,0xde,0x76,0xa4,0x75,0x89,0xfd,0x4e,0xfb,0x19,0x3c,0x41,0x84,0x95,
-    0x33,0x7,0xd4,0xc3,0x2b,0x71,0xe0,0x8d,0xd1,0x3b,0x1f,0x25,0x70,0xc7,0x64,0xeb,
-
-    // Record 8: Address = 0x1400, Length = 128
-    0x1400,0x80,
-    0x2a,0x58,0xa4,0x97,0x1b,0xe0,0x7b,0xfb,0x4,0x4d,0xe3,0xc8,0x4b,0x41,0x9f,0x97,
-    0x38,0xf7,0x7c,0x6f,0x29,0x92,0xfb,0x74,0xd2,0x96,0x52,0xe7,0x8,0xd6,0x93,0x68,
-    0x70,0xc7,0x72,0xc8,0xc0,0x6,0x77,0x3,0xd4,0xc4,0x51,0x9c,0x37,0xd6,0xfe,0x1c,
-    0x54,0xb3,0x7a,0xda,0xef,0xd1,0x34,0xd5,0xb9,0x9e,0x7c,0xf,0x9f,0xba,0x96,0xaf,
-    0x13,0xb6,0x2f,0x43,0xdc,0x1,0xd,0xfb,0x88,0x73,0xb7,0x19,0xd,0x89,0x1f,0x40,
-    0xf9,0x25,0x8b,0x9,0x1a,0x73,0x82,0xdc,0xac,0x71,0x9e,0x44,0x92,0x3d,0xe6,0x61,
-    0xd1,0x51,0xe4,0x5f,0x2e,0xf,0x5e,0x39,0x53,0x41,0x80,0xa,0xf5,0x1a,0xde,0x34,
-    0xb2,0x11,0x9f,0x69,0x68,0x4f,0xe5,0xab,0x96,0x3c,0xe7,0x41,0xa7,0xf5,0x4b,0xf0,
-
-    // Record 9: Address = 0x1480, Length = 128
-    0x1480,0x80,
-    0x61,0x8,0x38,0x9b,0xa0,0x4f,0xb6,0x73,0xc9,0xf3,0x5c,0xcb,0x45,0xc,0x88,0xc9,
-    0x71,0x28,0xf8,0x60,0x95,0x3f,0x9a,0x2a,0x73,0x25,0x9d,0x4f,0x8f,0x13,0xd2,0x23,
-    0x4d,0x1b,0x29,0xd1,0xcb,0x71,0xbb,0x0,0xa5,0x67,0x2f,0xce,0x3b,0xa5,0xa9,0x62,
-    0x5c,0xd5,0x81,0x7b,0x8,0x78,0x85,0xd7,0xc9,0x16,0xef,0x91,0x9d,0xc4,0xa2,0x5d,
-    0x2e,0x81,0x29,0x2e,0x14,0xda,0xbe,0x46,0x6a,0x18,0x65,0xa9,0xcc,0xe5,0x26,0x96,
-    0x67,0xa,0xe3,0x25,0x1,0xc9,0x44,0x5d,0x4f,0xd1,0x33,0x3d,0x68,0x79,0xf7,0xa3,
-    0xff,0xd5,0xb6,0x8b,0x75,0x18,0xa9,0x4f,0xf4,0xd4,0x45,0xac,0xac,0x29,0xd3,0x2c,
-    0x57,0x2,0x45,0x6,0x6,0x27,0xbd,0x3c,0x67,0xdb,0xc9,0x4e,0xe5,0xa9,0x15,0x76,
-
-    // Record 10: Address = 0x1500, Length = 128
-    0x1500,0x80,
-    0x54,0x84,0xa7,0xbb,0xc0,0x42,0x20,0x23,0xb7,0x8e,0x2c,0xc4,0x12,0xf5,0xb4,0x18,
-    0x5b,0xd1,0x6,0x9c,0x83,0x53,0x4c,0xea,0x1,0xd,0x9b,0x42,0xd9,0x3,0x28,0x3f,
-    0x32,0x3b,0xfa,0x3a,0x58,0xe7,0xa9,0x9c,0x84,0x51,0x60,0x7d,0xc4,0x2e,0x95,0x84,
-    0x50,0x29,0x95,0x67,0xe4,0xdc,0xc5,0xec,0x5a,0xc3,0xf0,0x75,0x73,0xb2,0x3f,0xf3,
-    0xb,0x66,0xec,0xd9,0x1e,0x49,0xc7,0xe,0x94,0x1d,0x8f,0x3e,0xbc,0x2,0xf8,0x5,
-    0x22,0x2,0x38,0xf9,0x5b,0x2b,0x15,0x94,0x27,0x21,0x7c,0x7,0x3b,0x85,0xa0,0xed,
-    0x38,0xad,0xa1,0xed,0x2b,0x51,0xe5,0x58,0xeb,0xfe,0x7c,0xc3,0x2f,0xd4,0xb4,0x8a,
-    0xca,0xb2,0xd,0x54,0xa6,0x9c,0xb0,0x4d,0x7f,0x49,0xe1,0x8,0x6c,0x34,0x56,0x50,
-
-    // Record 11: Address = 0x1580, Length = 128
-    0x1580,0x80,
-    0xb3,0xcc,0x8e,0xf5,0x44,0xf4,0xbb,0x99,0x66,0x45,0x13,0xad,0xf3,0x1c,0x21,0xe6,
-    0x4b,0xce,0x8c,0xe3,0xc0,0x6c,0x8b,0xcd,0x83,0xd4,0x23,0x9a,0x29,0x6d,0x26,0xc7,
-    0xf8,0x6d,0x94,0xbf,0xc6,0x4d,0x95,0x2e,0x22,0x35,0x34,0x63,0x7b,0x1b,0x18,0x18,
-    0x2b,0x2f,0x38,0x7e,0xe0,0x15,0x75,0xa5,0x8b,0x9b,0xf4,0x2b,0x43,0xbf,0xee,0xfb,
-    0x2c,0xca,0xc8,0x50,0xd9,0xd8,0xb0,0xde,0x69,0x4f,0x9c,0x92,0xe4,0x9c,0x87,0x74,
-    0x76,0xde,0x6f,0x69,0xdb,0xc5,0xbf,0xf0,0x48,0xcd,0x5,0x32,0x93,0xfb,0xa4,0x45,
-    0x52,0xc,0x40,0xb8,0xc5,0xab,0x33,0x3c,0x30,0x7e,0x71,0x29,0xf7,0x9d,0x31,0x60,
-    0x26,0x3a,0x65,0xd1,0x1d,0xc6,0x52,0x33,0xf2,0x76,0x28,0xca,0xa4,0x1d,0x69,0x6e,
-
-    // Record 12: Address = 0x1600, Length = 128
-    0x1600,0x80,
-    0xc6,0xa,0x8b,0x79,0x82,0x22,0x5,0x30,0x8,0x3d,0x31,0x9,0x6c,0xd3,0xd1,0xdb,
-    0x53,0x16,0x96,0x9e,0xe3,0xc2,0x3e,0xf8,0xae,0xa,0x12,0xfb,0xda,0x47,0x56,0x66,
-    0x78,0x11,0x98,0xf,0x36,0x16,0x2c,0x3,0x48,0x56,0x1a,0x81,0x3d,0x86,0x62,0xc1,
-    0x9d,0x36,0xf2,0x12,0xb0,0x7c,0xb4,0xbd,0xb6,0xf5,0xa9,0x14,0xc1,0xf6,0xec,0x6d,
-    0xf7,0x6f,0x57,0xeb,0x79,0xbd,0x25,0xa5,0x45,0xcc,0xcd,0xd3,0xb0,0x7c,0xbc,0x50,
-    0x21,0x39,0xc3,0x7c,0x3,0x2,0x3a,0x12,0x54,0xaa,0xea,0xad,0xf6,0x31,0x2,0xf9,
-    0xa0,0xbe,0xe4,0x54,0x47,0x9a,0x17,0x52,0xc,0x8f,0x6e,0x8a,0xdc,0x5d,0x6b,0x83,
-    0x4e,0xb6,0x1,0x69,0xb1,0xfa,0x75,0x9c,0xb1,0xa3,0x97,0xaa,0x16,0xcc,0x29,0x1f,
-
-    // Record 13: Address = 0x1680, Length = 128
-    0x1680,0x80,
-    0xb8,0xd4,0xd5,0xd6,0x8a,0xc1,0x18,0xcb,0xf1,0xd4,0xee,0xb0,0xbb,0xae,0x2,0x6c,
-    0xeb,0xd7,0xf7,0x9b,0xd4,0xab,0x73,0xcb,0x36,0x8d,0x6e,0xf2,0x2a,0x32,0xa2,0x60,
-    0xde,0xa2,0x66,0xaa,0xcd,0xa4,0x3b,0xb1,0x79,0x45,0x24,0x24,0x82,0xac,0x9c,0x76,
-    0x85,0xb3,0x7d,0x4b,0x73,0x53,0xe3,0x7d,0xe4,0xfb,0xef,0xf1,0x39,0xb9,0xa3,0x8,
-    0x33,0xaa,0x5c,0xad,0x3e,0xf9,0x7a,0x9b,0x29,0x1a,0x17,0x23,0xae,0xa6,0x3e,0x9c,
-    0x83,0xda,0x56,0x90,0x14,0xeb,0xf5,0x38,0xaa,0x9c,0xef,0x7e,0xaa,0x3,0x81,0x39,
-    0x7c,0x4f,0x1f,0xe7,0x3e,0x33,0x71,0xff,0xed,0x3c,0xe0,0xb9,0x4e,0x75,0xb7,0x9,
-    0x3,0x68,0xbb,0x1a,0x46,0x1d,0x66,0x24,0xcb,0xea,0x1a,0x46,0x6f,0xc6,0x44,0x6b,
-
-    // Record 14: Address = 0x1700, Length = 128
-    0x1700,0x80,
-    0xb0,0xc,0x5a,0x5b,0xd7,0x6b,0xa8,0x7c,0xb8,0x5,0xfa,0xc,0x2a,0x63,0x4e,0x4,
-    0x63,0x4c,0xf8,0x77,0xba,0x9e,0xb0,0x9e,0xb7,0xd3,0xb7,0x64,0xe,0x73,0x34,0x94,
-    0x5c,0xe5,0x1a,0xb5,0xe4,0xa,0xa5,0x1d,0xc9,0x62,0x87,0xc3,0xab,0x84,0xfa,0x58,
-    0x82,0x75,0x43,0x8d,0x4a,0x3d,0x19,0xd,0x11,0xda,0x44,0x8f,0x1a,0xf4,0x73,0x6e,
-    0xfc,0x49,0x4b,0xb1,0x84,0x31,0xdd,0xf7,0xcf,0x6d,0x8,0xa8,0x6b,0xc0,0x8f,0xd8,
-    0x64,0x64,0x5e,0x66,0xff,0x3a,0x7c,0xaa,0x88,0xae,0x2a,0x63,0x23,0xd3,0x26,0xc1,
-    0x15,0x7,0x7,0x92,0xd1,0x41,0x12,0xc9,0x65,0x8e,0x9c,0xb,0x76,0xd0,0xc9,0x92,
-    0xc6,0xcc,0x4c,0xa,0xc1,0x1d,0x24,0xff,0x25,0xa,0x7,0xbe,0x70,0xe4,0xc0,0x49,
-
-    // Record 15: Address = 0x1780, Length = 128
-    0x1780,0x80,
-    0x77,0xef,0x36,0x93,0x72,0xaf,0x5f,0x58,0x9d,0xe3,0xfa,0x76,0xdc,0xad,0x29,0xf8,
-    0x22,0x15,0x1a,0x24,0x5,0xca,0x79,0x14,0x81,0xbd,0xad,0x77,0x88,0x30,0x7d,0x24,
-    0xd0,0x41,0x84,0x79,0x2a,0xe3,0xf8,0x2a,0x8d,0x0,0xc,0x3,0x85,0xad,0x1f,0xe,
-    0x47,0x82,0x54,0xfa,0xc9,0xc7,0x8b,0x75,0x72,0xdd,0x5f,0xee,0xb9,0x53,0x4f,0x3d,
-    0x17,0x53,0xc6,0x77,0x99,0x53,0xc,0x25,0x35,0x85,0x20,0x10,0x43,0x3,0x72,0xd,
-    0xa4,0x43,0x6d,0xf6,0xca,0xa1,0x10,0x3c,0x6b,0xa7,0x80,0x16,0xf5,0x2e,0xe7,0xf8,
-    0xf3,0x2,0x45,0x41,0x55,0x3a,0x15,0x93,0xe8,0xc1,0x12,0xec,0x4,0xc9,0x96,0xfe,
-    0xb0,0xd8,0x27,0x72,0x36,0x95,0x67,0xf1,0x8d,0xc9,0x93,0xe6,0xc,0x8e,0x32,0x49,
-
-    // Record 16: Address = 0x1800, Length = 128
-    0x1800,0x80,
-    0xe1,0x78,0x31,0xf,0x99,0x42,0x8,0xfb,0x4c,0x9b,0xb2,0x97,0x91,0x6e,0xe0,0x3c,
-    0xe3,0x93,0xa,0xd7,0xc2,0xb,0x1,0x7e,0x6a,0x91,0xb1,0xa1,0x67,0xb6,0x42,0x56,
-    0x9d,0xdc,0xa9,0x6e,0xb1,0x9b,0x87,0xa,0xfc,0x70,0xf,0xa4,0xc2,0x47,0x69,0x1b,
-    0x8b,0x12,0xfe,0xe8,0xac,0x6,0xfc,0xc5,0xb8,0xc0,0xfe,0xae,0xd7,0xf5,0x46,0xb9,
-    0xf2,0xea,0xfd,0x13,0x6f,0xad,0xab,0xad,0x71,0x4d,0xe2,0xf0,0x34,0x6,0x7a,0x4f,
-    0x4f,0x62,0xd9,0xfa,0x63,0x0,0xcd,0x15,0x94,0x48,0x1d,0x97,0xd6,0xb7,0x9,0x56,
-    0xcd,0xa2,0x36,0xc5,0x3d,0x3e,0xf4,0x6f,0x7,0x2,0x2a,0x88,0x52,0xaa,0x52,0x16,
-    0xa5,0x15,0x6,0xec,0xa7,0xc9,0x33,0xfc,0xa7,0xcb,0xc0,0xb0,0x53,0x93,0x6a,0x36,
-
-    // Record 17: Address = 0x1880, Length = 128
-    0x1880,0x80,
-    0x23,0xb9,0xe1,0xba,0x49,0x3c,0x14,0x11,0x6d,0xfd,0x3a,0xa6,0xa4,0x61,0xf,0x31,
-    0x6,0x88,0xad,0xeb,0xfe,0xa8,0x90,0xb1,0x21,0x43,0xe6,0xe6,0x84,0x2e,0x9e,0x6c,
-    0x6,0xb0,0xe8,0x60,0xae,0xe5,0xa7,0x97,0xd2,0xfd,0xb8,0xbf,0xfc,0x5b,0x15,0xdb,
-    0xdc,0x65,0x35,0xcf,0x17,0xeb,0x7a,0x95,0xda,0x17,0xc4,0xe6,0x26,0x25,0x47,0x8d,
-    0x58,0xf6,0xad,0xbf,0x6a,0x36,0x7,0x5a,0x3c,0x17,0x29,0x73,0x32,0x67,0xe0,0x6c,
-    0xa1,0xaf,0xa9,0x96,0x47,0x5a,0x38,0x8a,0x1c,0x7e,0xc1,0xa3,0xce,0xcc,0x98,0xb6,
-    0xe9,0xad,0xe6,0x81,0xad,0xe1,0x7d,0x1c,0xa9,0x5b,0xa7,0xbd,0xd8,0x1a,0xa8,0x7d,
-    0xbe,0xb9,0x5a,0x12,0xa,0xe1,0xfe,0x5a,0xc1,0xa,0x83,0xb2,0x2d,0xf7,0xd,0x3c,
-
-    // Record 18: Address = 0x1900, Length = 128
-    0x1900,0x80,
-    0xb1,0x20,0x4f,0x48,0xd0,0xbd,0x6f,0xff,0xce,0xf4,0xb8,0x85,0xf6,0x2f,0x1e,0x6a,
-    0x17,0xf9,0xe9,0x20,0x9,0x30,0xfb,0x88,0xc3,0x36,0x34,0x51,0xcb,0x95,0x71,0x85,
-    0x99,0x17,0x7f,0x5a,0x3f,0x1,0xab,0x5b,0x27,0xe0,0x54,0xd0,0xb2,0x2,0xfa,0x4b,
-    0x38,0x53,0xa2,0x92,0x74,0x52,0x6b,0x21,0xf6,0x10,0x7b,0x60,0xac,0xd5,0xf8,0xb3,
-    0xae,0x13,0xfc,0x5a,0x6,0x63,0x31,0xbd,0x82,0x8,0x2e,0x1c,0xf4,0x3c,0x92,0xdb,
-    0xd1,0xd6,0x75,0xd4,0x9,0xfd,0xd3,0x85,0xcc,0x7b,0x93,0x4,0x50,0xeb,0xf3,0x25,
-    0x22,0xaf,0x26,0x54,0xab,0x65,0xd9,0x43,0x88,0x50,0xf8,0x40,0x84,0xd6,0xb9,0xf4,
-    0xe,0x24,0x9a,0x4b,0x33,0xb1,0x8e,0xf5,0x6e,0x66,0x47,0x18,0x10,0xf9,0x21,0x46,
-
-    // Record 19: Address = 0x1980, Length = 128
-    0x1980,0x80,
-    0x23,0x60,0x88,0x82,0x91,0x6b,0x2d,0x4c,0x96,0x7f,0x30,0x7a,0x7f,0x64,0x9f,0x95,
-    0xde,0xb6,0x1a,0x12,0x14,0xd,0xbf,0x32,0x35,0x49,0x58,0xb3,0xd2,0x7b,0x86,0xba,
-    0xed,0xee,0x65,0x27,0x5d,0xd5,0xeb,0x1b,0xd3,0x99,0xaf,0x86,0x9,0xd0,0x13,0xca,
-    0xc8,0x10,0x33,0xaf,0xd4,0xa0,0x50,0x38,0xf1,0xcc,0x49,0x92,0xe1,0x54,0x19,0x88,
-    0xee,0x79,0x3a,0xf9,0x8f,0xef,0xd6,0x25,0x6e,0xc0,0x37,0xc5,0xf5,0xd5,0x62,0x84,
-    0x4,0x1c,0x1f,0x5c,0x3b,0x8,0x2a,0xab,0x2b,0xad,0x34,0x33,0x8c,0x11,0x2,0xd4,
-    0x80,0x75,0xf9,0x89,0xcb,0xf6,0x2b,0xa2,0x4b,0x68,0xe7,0x30,0x66,0x77,0x4e,0x9c,
-    0xb5,0x5e,0xfc,0xb1,0xa5,0x75,0x9a,0x4d,0xc3,0xbc,0xc8,0x5d,0x9b,0x48,0x12,0x53,
-
-    // Record 20: Address = 0x1a00, Length = 128
-    0x1a00,0x80,
-    0xfc,0x59,0x45,0xaf,0xbb,0x9c,0xfe,0x85,0x8b,0x4a,0xd1,0x46,0x57,0x10,0x55,0x3f,
-    0x81,0xed,0x1c,0xdc,0x67,0x4d,0x4,0xc9,0xcb,0xfa,0x8b,0x94,0x40,0xb9,0x2a,0x5b,
-    0xde,0x3d,0xb0,0x2d,0x7e,0x43,0xc2,0xf1,0x65,0x15,0x18,0x21,0x6d,0x7b,0x33,0x75,
-    0xf7,0x3b,0xae,0x93,0x43,0xbd,0x3a,0x6d,0x20,0xc5,0x2b,0x25,0xad,0x62,0xd8,0xad,
-    0x86,0xef,0x88,0xc0,0xbf,0xbe,0xd7,0x57,0x77,0xea,0xec,0xe8,0xc5,0x3d,0xb3,0xa5,
-    0xb8,0x4a,0xda,0xd9,0x95,0x69,0x1f,0xa9,0xa5,0x10,0xea,0xad,0x5a,0x79,0xae,0x50,
-    0xce,0x99,0xd,0x5b,0xdc,0x16,0xda,0xa4,0x2a,0xdc,0x4,0xdf,0x96,0xc0,0xae,0x9d,
-    0x29,0x99,0xbf,0x22,0xe9,0x38,0x33,0x53,0x36,0xf0,0xf3,0x11,0x33,0x8c,0xfc,0xe6,
-
-    // Record 21: Address = 0x1a80, Length = 128
-    0x1a80,0x80,
-    0x1b,0x7c,0xc3,0xa9,0xc3,0x65,0xc4,0xd0,0x5f,0x61,0xff,0x9b,0x4c,0xf6,0xff,0xd6,
-    0xda,0xe5,0xb2,0x34,0x77,0xc6,0xf1,0xc2,0x9,0x11,0xcf,0x9,0x40,0xb1,0x8,0x32,
-    0x2a,0xed,0xf,0xe7,0x99,0x87,0x2b,0xdb,0xfa,0x9,0xb5,0x9e,0xae,0x8,0xe6,0xfd,
-    0x82,0xdf,0xcd,0x4f,0xa9,0xde,0x8b,0x1a,0x2d,0x6b,0xe4,0x7b,0x1d,0x4,0xf0,0xd5,
-    0x1c,0xcf,0x55,0x88,0x78,0x7b,0xe5,0x84,0x55,0x95,0x95,0xdf,0xbb,0x30,0x2d,0xe3,
-    0x2c,0xb0,0x93,0xd8,0x35,0xfa,0x31,0xad,0x18,0x92,0xdb,0x77,0xb7,0xdd,0xcd,0xfb,
-    0x9b,0xb6,0x64,0x9,0x39,0x23,0xd5,0xf4,0xeb,0x35,0x41,0xd8,0x78,0xfd,0x1c,0x5c,
-    0xbb,0x5b,0xe1,0xc5,0x85,0xd4,0xf8,0xc5,0xd,0x8d,0x7b,0xd1,0xe1,0xe8,0xda,0xe8,
-
-    // Record 22: Address = 0x1b00, Length = 128
-    0x1b00,0x80,
-    0xe6,0x34,0xa2,0xdd,0xd7,0x6b,0xe2,0x65,0xab,0xda,0xec,0x71,0xde,0x9d,0xac,0x28,
-    0x72,0xbe,0xf3,0x99,0x24,0xae,0x4,0x5c,0xf2,0xb0,0x46,0xeb,0xe5,0x49,0xa2,0xe7,
-    0x37,0x3e,0x70,0x15,0xc0,0xb9,0xca,0xb4,0x75,0xf4,0x73,0x80,0x59,0x4,0xdd,0x78,
-    0x9a,0x29,0xa6,0x6b,0x21,0xc1,0x9a,0x6a,0xfa,0x5d,0x47,0x69,0x45,0xa0,0x9e,0x12,
-    0xb5,0xbd,0x31,0x7,0x44,0x69,0xd1,0xbf,0x9f,0xae,0xed,0x79,0x98,0x86,0x52,0x60,
-    0xca,0xd6,0x4d,0xe2,0xac,0xa1,0x98,0x16,0xcd,0xd,0x92,0xf4,0x6d,0x30,0xd5,0x6a,
-    0x8,0x51,0x7d,0x7e,0x78,0xa1,0xdb,0x17,0xd7,0x27,0x2f,0x9f,0x6c,0x13,0xcc,0xd6,
-    0xf9,0xc4,0xe7,0x6d,0x4c,0xb,0x6,0xcf,0xec,0x1,0x93,0x2a,0x95,0x52,0x10,0xc2,
-
-    // Record 23: Address = 0x1b80, Length = 128
-    0x1b80,0x80,
-    0xbc,0xfb,0x6a,0x5,0x18,0x5e,0xef,0x45,0x78,0x91,0x34,0x18,0xd3,0x77,0xf1,0x94,
-    0xf0,0x84,0x4a,0x19,0x56,0x19,0x6b,0x54,0xc3,0xcb,0xa3,0x84,0xc5,0x74,0xc7,0xb9,
-    0x42,0xa9,0x3,0xdc,0xfe,0xe5,0x40,0xd4,0x33,0xf3,0x5,0xf2,0x24,0x3d,0x81,0xe7,
-    0xf1,0xb8,0xa3,0x67,0x9d,0xcb,0xc,0xa1,0x43,0xde,0x6c,0x28,0x4b,0xc4,0x35,0xce,
-    0x4d,0xa2,0xef,0xa5,0xc7,0x7,0x86,0x4b,0xa6,0x58,0x77,0x63,0x86,0x89,0x0,0xdb,
-    0xbd,0x15,0x3c,0x87,0xe7,0xe0,0x4d,0x35,0x79,0x1f,0x85,0xcb,0x91,0x8d,0xe3,0x56,
-    0x51,0xee,0xfd,0x91,0xb7,0xa2,0xf,0xe1,0xf6,0x55,0x4,0x7c,0xde,0x4,0x8f,0xbc,
-    0x8d,0x22,0x3b,0x15,0x6,0x76,0x10,0xc9,0xfc,0x23,0x89,0x6c,0x75,0xee,0x85,0xa,
-
-    // Record 24: Address = 0x1c00, Length = 128
-    0x1c00,0x80,
-    0x8,0xcc,0xfa,0x7b,0xfa,0x9a,0xf,0x97,0xee,0x15,0x1,0x58,0xa8,0xfa,0x30,0x41,
-    0x2b,0x32,0xb8,0x5b,0xa,0xd8,0xbd,0x25,0xc6,0x35,0xf3,0x77,0xeb,0x95,0xf5,0xc8,
-    0x4,0x5e,0xb8,0x97,0xe1,0x1d,0x42,0xfa,0x81,0x65,0x33,0x58,0xa4,0x13,0xeb,0xd7,
-    0xba,0x8c,0xb3,0x88,0xd9,0xc7,0x51,0x51,0xed,0xca,0xb7,0x2f,0xce,0xff,0x64,0xe6,
-    0x4,0xd8,0x1,0x4f,0x6,0x4e,0xa5,0x2d,0x34,0x7a,0x87,0xf8,0x3a,0x42,0x75,0xef,
-    0xbb,0xcd,0xf7,0x6d,0x6,0xec,0xd1,0x24,0x7b,0x99,0x9c,0x14,0xf1,0x48,0xe6,0x52,
-    0x53,0x70,0x68,0xc7,0xd9,0x98,0x4,0xa5,0xd8,0x7a,0xc6,0xd3,0x5c,0xae,0x99,0xe5,
-    0xde,0x2a,0x2e,0xc8,0x81,0x62,0xf5,0xa0,0x47,0x9f,0x42,0xb4,0xe8,0x15,0x6c,0x4f,
-
-    // Record 25: Address = 0x1c80, Length = 128
-    0x1c80,0x80,
-    0xc6,0xa3,0xcb,0x5c,0x20,0x4d,0xa8,0x4a,0x3f,0xaf,0x9f,0xad,0x99,0xb8,0xda,0x6f,
-    0xef,0x94,0x4e,0x19,0xa7,0xfd,0x66,0xcf,0x55,0xb2,0xeb,0x47,0x55,0xb1,0xc9,0xf2,
-    0x5e,0xce,0xa1,0x60,0xf7,0x48,0x79,0xad,0xf7,0x33,0xd2,0xec,0x1b,0xbc,0x7,0xd7,
-    0xbe,0x98,0xb9,0x9d,0x7b,0x6d,0x7b,0x3,0xa9,0x40,0x20,0x12,0x54,0x7f,0x4f,0x22,
-    0x91,0x58,0x5c,0x1d,0xee,0x54,0x7e,0xfc,0xd0,0x7a,0xcd,0x73,0x8a,0x8e,0x1b,0x2f,
-    0xce,0x7b,0x87,0xca,0xf9,0x63,0xf3,0xa4,0x3b,0x1d,0xdf,0x57,0x7f,0xf1,0x9a,0x68,
-    0x7,0x9b,0x24,0xd,0x5d,0xac,0xb2,0xa,0x3d,0x15,0x89,0x7c,0x7,0x2e,0xdf,0xea,
-    0x72,0x61,0x50,0xc5,0x47,0xa5,0x81,0xe1,0xf7,0xb6,0x1d,0x93,0xc9,0x6e,0x5f,0xa9,
-
-    // Record 26: Address = 0x1d00, Length = 128
-    0x1d00,0x80,
-    0x78,0x3e,0x2f,0x7,0xc,0xcf,0xf3,0x5d,0xe9,0xe2,0xed,0x5d,0xd7,0x70,0x1d,0x60,
-    0x16,0x5c,0x9b,0x2a,0xfa,0xeb,0xfd,0x76,0xa3,0x46,0xb5,0x5e,0x9b,0x3f,0x98,0x40,
-    0xf4,0xf1,0x5f,0x8c,0x61,0x83,0x2,0x37,0x95,0xdd,0xeb,0x57,0xe,0xf7,0x4b,0xae,
-    0x61,0x8c,0x42,0x5c,0xf7,0x5d,0xb2,0x87,0x72,0x96,0xbe,0x35,0x59,0x8a,0x43,0xe2,
-    0xf3,0x28,0x6f,0xeb,0x56,0xd0,0xa3,0x67,0xab,0x71,0xd,0x36,0xb8,0x58,0x53,0xbf,
-    0x62,0xfd,0x20,0xa7,0xb1,0x28,0xca,0x64,0x18,0x3e,0x50,0xf9,0x90,0xe9,0x88,0xc2,
-    0x47,0xfe,0xb7,0x9d,0x2e,0x98,0x35,0x3f,0x65,0x3f,0x27,0x5d,0x30,0x80,0x79,0x2e,
-    0xe4,0xe6,0x4f,0x11,0x60,0xa5,0x53,0x4a,0x59,0xb4,0x0,0xb7,0x68,0x6f,0xca,0x65,
-
-    // Record 27: Address = 0x1d80, Length = 128
-    0x1d80,0x80,
-    0x49,0x99,0x7e,0x9e,0x20,0x42,0xd2,0x37,0x23,0xd8,0x87,0x5a,0x36,0x1e,0x66,0xbe,
-    0xb3,0x32,0x90,0x49,0xed,0xce,0x70,0x7d,0x0,0x19,0xec,0x7,0x5b,0xeb,0xfe,0x64,
-    0xcf,0x9f,0xef,0x7e,0xe1,0x1c,0x7f,0xbf,0x7f,0xca,0x75,0x45,0x36,0x13,0xd0,0x0,
-    0x6,0xf1,0x9c,0x53,0x13,0xf,0x43,0x38,0xf2,0x1,0x32,0x12,0x52,0x9a,0x2d,0xed,
-    0xb5,0x67,0x1c,0x29,0x32,0xdc,0xd9,0x19,0x89,0x77,0x41,0xfb,0xe0,0x23,0x3e,0x4f,
-    0x44,0x78,0x1f,0xef,0x34,0xef,0xc2,0xd3,0xec,0xd2,0xd,0x6b,0x52,0x6d,0x5c,0x4,
-    0x15,0x77,0x3f,0x81,0x68,0x8e,0x59,0xd4,0x35,0x46,0x82,0xc9,0xef,0xa,0xbe,0xdd,
-    0xd7,0x22,0x6d,0xb9,0xdb,0x59,0x40,0x22,0x4b,0x9f,0x15,0x19,0xbd,0xbc,0x43,0xbb,
-
-    // Record 28: Address = 0x1e00, Length = 128
-    0x1e00,0x80,
-    0xce,0xe8,0x63,0x10,0xfc,0x80,0x5,0x15,0x3c,0x4a,0xab,0x35,0x61,0x9f,0x14,0x6f,
-    0xf5,0xb5,0x3,0xc7,0xd1,0xd4,0xa0,0xea,0xc8,0x26,0x60,0x13,0xff,0xc5,0xbe,0xa1,
-    0x9,0x89,0x79,0xa3,0x5c,0x18,0x87,0xe9,0xa0,0x6d,0x1a,0xa2,0xf7,0xc5,0xed,0x9b,
-    0x66,0x40,0xbb,0xca,0x90,0x9,0x81,0x9e,0x74,0x73,0x14,0x87,0x3e,0xeb,0x27,0xa,
-    0x86,0x10,0x20,0x76,0x65,0x3,0x7,0xa,0x9a,0xe6,0x42,0x66,0xb8,0xb4,0xe9,0x7e,
-    0xa6,0xdb,0x10,0x1d,0xe,0x40,0x92,0xb9,0xa2,0x62,0xdf,0xa8,0xd3,0xd7,0x51,0x97,
-    0x16,0x2a,0xe4,0x3,0xe2,0xd8,0xee,0x18,0xdf,0x8e,0xb5,0xb3,0xf5,0x7f,0xb,0x4b,
-    0xbb,0x55,0x19,0x96,0x62,0x1a,0xb2,0x4f,0x7f,0x9,0xfb,0xf1,0xe0,0xba,0x48,0x87,
-
-    // Record 29: Address = 0x1e80, Length = 128
-    0x1e80,0x80,
-    0xa2,0x65,0x1a,0x53,0x88,0xa,0x7f,0x1e,0x42,0x25,0xba,0xc,0xde,0x3e,0x53,0xfa,
-    0x83,0x8d,0xb1,0xf1,0xfa,0xf1,0x70,0xeb,0xd5,0x43,0x70,0x38,0x8e,0x24,0x34,0x73,
-    0x1e,0xe4,0xde,0x5d,0xe9,0xe4,0x8c,0xd7,0x84,0x97,0x51,0x4a,0x5f,0x47,0x89,0x26,
-    0x26,0xd9,0x7c,0x1f,0x1f,0xa9,0x35,0x5c,0x41,0x4b,0x85,0xaf,0xfe,0xe0,0x16,0x4e,
-    0xb6,0xc,0xb3,0x80,0x93,0xec,0xc2,0xf5,0x34,0x21,0xb0,0x97,0x7a,0x63,0xb9,0x41,
-    0x7b,0x30,0xe5,0x17,0x19,0xca,0x3,0xd,0x21,0x23,0xc9,0x3d,0xb8,0x88,0x36,0x96,
-    0xbf,0xd3,0x36,0x51,0xa,0xe7,0x50,0xe6,0x47,0x41,0xdf,0x88,0xa0,0x99,0xe6,0xeb,
-    0x4c,0x75,0xda,0x62,0xc4,0xa5,0xac,0x77,0x17,0x21,0xe1,0x7e,0x50,0xa1,0x24,0x21,
-
-    // Record 30: Address = 0x1f00, Length = 128
-    0x1f00,0x80,
-    0x1d,0x26,0x43,0xf2,0xeb,0x52,0x99,0x1b,0xbc,0x16,0x2,0xc0,0xbd,0xa,0x6,0x4c,
-    0x5e,0xc7,0xf5,0x7b,0x78,0x8b,0x88,0x99,0x14,0xb1,0x77,0xa7,0x1d,0x38,0x73,0x5d,
-    0x22,0x88,0x63,0x37,0x9a,0x60,0xd7,0xd2,0x8a,0x39,0xcb,0xd2,0x1e,0x12,0xfd,0xdb,
-    0x34,0xaa,0xa6,0x35,0x39,0x54,0x2d,0x18,0x27,0xde,0x33,0xd2,0x0,0xbb,0x83,0x9d,
-    0xf8,0x6b,0x87,0xe6,0x14,0xb3,0xa8,0x30,0x12,0xdc,0x3f,0x75,0xa2,0xe7,0x9c,0x72,
-    0x58,0xc3,0x1b,0x3,0xfb,0x77,0x71,0x11,0x44,0x8,0x72,0x9b,0x89,0xb7,0x77,0x62,
-    0x4c,0x5f,0x90,0x1d,0x42,0x12,0x65,0x97,0x11,0xee,0xcb,0xb0,0x54,0xae,0x5e,0x24,
-    0xa3,0xee,0xcf,0x16,0xd9,0x2d,0x9c,0xbe,0xc3,0x7c,0xa4,0xda,0x8b,0x3b,0x89,0xcc,
-
-    // Record 31: Address = 0x1f80, Length = 128
-    0x1f80,0x80,
-    0x3f,0x5c,0x1,0x28,0xa2,0xd9,0x8b,0x33,0x4e,0xec,0x2a,0xf6,0xdd,0x8c,0xad,0xe8,
-    0xe0,0xe8,0x6e,0x46,0xe9,0x1e,0x3f,0x27,0xbf,0x64,0xe8,0x27,0x80,0x5c,0xaf,0xfa,
-    0xb3,0x33,0x98,0x13,0x62,0x16,0xdc,0x3e,0xcc,0x39,0x1f,0xa0,0x30,0xa0,0x88,0x94,
-    0x57,0xd1,0x42,0xc8,0xfc,0x48,0xe,0x33,0x2b,0x0,0x6c,0xd5,0xcb,0x4a,0x64,0xc3,
-    0xb2,0x91,0x4d,0xe9,0xbd,0x39,0xd3,0xa6,0xc6,0x6c,0xf4,0x6b,0x55,0x7,0x84,0xb2,
-    0x1f,0x67,0x80,0xf7,0xa2,0x4b,0xd7,0xfc,0x31,0x23,0x99,0xd1,0xf1,0x37,0xcc,0x3c,
-    0x4f,0xa3,0x74,0x67,0x1f,0x77,0x2c,0x6d,0x4c,0x6,0x1d,0x15,0x9d,0xee,0x60,0x8,
-    0x90,0xd9,0x22,0x2d,0xf2,0x55,0xc6,0x95,0x1c,0xc5,0x47,0x17,0xe,0xfc,0x73,0xaf,
-
-    // Record 32: Address = 0x2000, Length = 128
-    0x2000,0x80,
-    0x7f,0x5a,0x5a,0x31,0xde,0x28,0x41,0x91,0x5b,0xb9,0x31,0x30,0x25,0xec,0xd1,0x97,
-    0xd3,0x0,0x24,0x2b,0xa8,0x63,0x97,0x10,0xe1,0x16,0x48,0x2b,0xae,0xd5,0xf5,0x3b,
-    0xcb,0x80,0xfd,0x67,0xd6,0xa7,0x2e,0x16,0xb3,0x8f,0x84,0x62,0x5e,0x2,0x46,0x49,
-    0xa4,0xf9,0x72,0x6c,0xf1,0x65,0x1b,0x3a,0x1a,0x16,0xc8,0x8f,0x17,0x85,0xbd,0x47,
-    0x53,0xc4,0x2,0xf6,0xf,0xcf,0xec,0x11,0xa4,0xc9,0x77,0xf,0x0,0x5b,0xc5,0xaa,
-    0x62,0x5f,0xdb,0x11,0x1c,0x6c,0x6b,0xc,0x57,0xb5,0x16,0xf8,0x10,0x8e,0x3b,0x2e,
-    0x63,0xfd,0xa9,0x23,0x3e,0xe7,0x3,0x71,0xbc,0x75,0xf7,0x58,0x47,0xfa,0x1e,0xfb,
-    0x4f,0x85,0xca,0x7d,0x6f,0x64,0xe8,0x7a,0x5f,0x2,0x52,0xe1,0x6e,0x48,0xf,0x1f,
-
-    // Record 33: Address = 0x2080, Length = 128
-    0x2080,0x80,
-    0x63,0x57,0xd9,0xd0,0xfb,0xe,0xa6,0x59,0xe0,0x21,0x33,0x2b,0x9a,0xc4,0xf6,0x76,
-    0xdd,0xde,0xdd,0x5e,0x3b,0x7f,0x37,0x60,0xe,0x23,0x9d,0x0,0xc6,0x46,0x44,0xdb,
-    0x81,0xfd,0xae,0x3d,0x34,0xcc,0xb,0x8b,0x8d,0x24,0xf7,0xc3,0x28,0x1b,0x65,0x20,
-    0x90,0x4d,0xf1,0x35,0xc,0x92,0xf4,0x65,0x37,0xc3,0x68,0xac,0xe,0x2d,0x30,0x89,
-    0xf0,0x61,0x34,0x70,0x37,0xbe,0x4d,0x26,0x36,0xf2,0x61,0xe6,0x2,0xdd,0x5a,0x34,
-    0xc4,0x24,0xc1,0x1c,0x5a,0x95,0x90,0xd0,0x3,0x1e,0xc2,0xe2,0x89,0x99,0xd4,0x1a,
-    0x8,0x55,0xe0,0x5a,0x9c,0xa8,0x34,0x3,0x7,0xc2,0xb,0xcb,0xdd,0xb3,0xc8,0x20,
-    0x6c,0x1c,0xa1,0xc8,0xd8,0x96,0xb3,0x73,0x2a,0x6e,0x5b,0x56,0xed,0xe,0x30,0x41,
-
-    // Record 34: Address = 0x2100, Length = 128
-    0x2100,0x80,
-    0x32,0xcf,0x39,0xab,0x5e,0x57,0xb1,0xfb,0xfd,0x4b,0x76,0xa,0x1f,0x47,0x6c,0xf6,
-    0xb,0xdd,0x53,0xe,0x3,0x3a,0x68,0xdd,0x47,0x9f,0x18,0xf3,0x1c,0x68,0x37,0x6a,
-    0xd4,0xf5,0xc5,0x3a,0x39,0x81,0x93,0xb0,0xd,0x66,0x76,0x19,0x86,0xab,0xb6,0x9,
-    0x19,0xbe,0xe0,0x3c,0x91,0xb1,0x31,0x62,0x19,0xdc,0x97,0xcf,0xdc,0x30,0x1e,0x96,
-    0xe8,0x1a,0x9c,0x9c,0xff,0x22,0x79,0x11,0xbe,0x9c,0xfe,0x9d,0xa7,0x2e,0x41,0xb0,
-    0xd5,0x9f,0x96,0x1f,0xb9,0xe7,0x8e,0x3c,0xfd,0xf6,0x21,0xe9,0x4e,0xd1,0x4,0x17,
-    0x70,0x2d,0x12,0xea,0x65,0x59,0xa2,0xbe,0x6e,0xd4,0xbf,0x8c,0xa5,0xd1,0xa8,0xd8,
-    0x81,0x7b,0x45,0x65,0x2,0x72,0xb1,0x10,0xba,0xfb,0x1c,0x2,0x4b,0x70,0xee,0x36,
-
-    // Record 35: Address = 0x2180, Length = 128
-    0x2180,0x80,
-    0x96,0x60,0x4d,0x2a,0x9b,0x22,0x8e,0x1a,0xfd,0x5f,0x4f,0x71,0x11,0xea,0x1b,0xda,
-    0xfe,0x29,0x6d,0x90,0x1f,0x75,0x4a,0x2a,0xce,0xd,0x4f,0x38,0x2b,0x30,0xe4,0x91,
-    0x32,0xa,0xd4,0x13,0x2a,0x35,0x63,0xf7,0xa3,0x57,0x5,0x71,0xeb,0xae,0xbb,0x95,
-    0xe8,0xe,0x96,0xed,0x2c,0xbf,0x43,0xf,0x7,0xd3,0xb9,0xbd,0x51,0x4a,0xb3,0x3,
-    0x8,0xe0,0x35,0x8b,0xde,0x27,0x1d,0x3d,0xa7,0x3d,0x9c,0x9a,0x97,0x15,0xff,0xb1,
-    0xce,0x7d,0xa3,0xb,0x9e,0xd,0x3d,0x7c,0x53,0xd2,0xb8,0xbf,0x9b,0x4,0x53,0x15,
-    0x2c,0xa9,0xd8,0x58,0x27,0x2e,0x70,0xb6,0x88,0x57,0xf4,0xf,0xcc,0xdf,0x31,0x58,
-    0xba,0x41,0xe3,0x65,0x85,0x0,0xcc,0x53,0xc,0x46,0xb2,0x0,0x52,0x26,0x93,0x93,
-
-    // Record 36: Address = 0x2200, Length = 128
-    0x2200,0x80,
-    0x79,0x5b,0x36,0xf5,0x7,0xf4,0x1e,0xd1,0xa7,0x1b,0x8b,0x9f,0x6d,0xfc,0xa1,0x60,
-    0x1c,0xbd,0xd1,0x84,0xc0,0xab,0xf2,0x36,0xef,0x82,0x7e,0x25,0xfb,0x93,0x84,0x76,
-    0x4d,0x44,0x14,0xcb,0x6e,0x98,0x3,0xb7,0xf5,0xd5,0x43,0x5b,0x3c,0xc4,0xb9,0x13,
-    0xfd,0xc2,0x84,0x1e,0xcc,0x10,0x42,0xdd,0xc0,0x20,0x70,0xd,0xe8,0x11,0x9b,0xc,
-    0x54,0x62,0x3a,0xa3,0x7c,0x9c,0x98,0xa4,0xd5,0x2f,0xe2,0xe8,0x87,0xea,0xf8,0x27,
-    0xeb,0x6,0x3c,0x7f,0x43,0xc5,0x39,0xed,0x42,0x7c,0x8,0x94,0x9a,0xc4,0x9c,0x82,
-    0xdd,0x3,0x2f,0x86,0x9b,0x6b,0xa2,0xb1,0x6,0x3b,0x31,0x80,0x3c,0xf1,0xdb,0x86,
-    0x23,0x41,0x1f,0xe4,0x3e,0xbf,0xc0,0x85,0xe2,0x46,0x71,0x5d,0x38,0xcc,0x9f,0xf5,
-
-    // Record 37: Address = 0x2280, Length = 128
-    0x2280,0x80,
-    0x5a,0x10,0xdd,0xa,0xd2,0xb8,0x44,0x94,0x65,0x9d,0xb8,0xc7,0x9a,0x69,0x79,0x47,
-    0x94,0x1,0xc4,0x38,0x2,0x8e,0xf5,0xe2,0xaa,0x4a,0xb9,0x47,0x6f,0x5,0x1e,0x4d,
-    0x52,0x6b,0x11,0xf9,0x7a,0xf,0xb0,0x38,0x4b,0x73,0x85,0x39,0xb7,0x3b,0x7b,0xec,
-    0xf9,0x2,0xa7,0x3f,0x18,0xe6,0xb,0xde,0x6d,0xd3,0x81,0xc3,0x4d,0x9d,0xad,0x80,
-    0x94,0x66,0xfb,0xa5,0xff,0x7a,0xbc,0xd4,0x94,0x25,0x4e,0x65,0xf5,0xa7,0x0,0x3,
-    0xdd,0xe7,0x71,0xc9,0xfb,0x26,0xa0,0x90,0x96,0x9,0xf8,0xe6,0xb7,0x88,0x23,0xba,
-    0x40,0x2,0xff,0x5f,0xf0,0xb1,0x4,0x2d,0xb0,0x12,0x69,0x73,0xc,0x1,0x62,0x8a,
-    0x2e,0x7d,0xc9,0xba,0xf2,0xe2,0xdc,0xad,0x82,0xc3,0xc7,0xcb,0x3d,0xdb,0x82,0x4c,
-
-    // Record 38: Address = 0x2300, Length = 128
-    0x2300,0x80,
-    0xe0,0x3f,0x3e,0xf7,0xe3,0xf6,0x11,0xe8,0xc7,0x64,0xd6,0xf7,0xfe,0x35,0xa,0x2c,
-    0x4e,0x4b,0xb3,0x87,0xca,0xaf,0x5d,0xf6,0x3c,0x14,0xf9,0x1b,0xef,0xd9,0x82,0x64,
-    0xcb,0xf4,0x36,0x70,0xc0,0x27,0xc0,0x80,0xe5,0x4d,0xaa,0xd4,0xd0,0xb3,0x9d,0xfe,
-    0x2d,0x9d,0x5,0x63,0x18,0x53,0xb9,0x26,0x68,0x59,0x73,0xba,0xab,0x6d,0x9b,0x94,
-    0x83,0xe9,0x33,0x83,0x71,0xd,0x75,0x76,0x32,0x1c,0x54,0x3b,0x35,0x68,0x60,0x4d,
-    0xeb,0x4c,0x29,0xcf,0x3,0xb7,0x10,0x44,0xcc,0x64,0x77,0x0,0x5,0xe2,0xa9,0xf4,
-    0xeb,0xba,0xef,0x85,0xb7,0x2b,0x4d,0x7b,0x1d,0x59,0x6a,0x36,0xe1,0xad,0x35,0x9f,
-    0x78,0xa7,0xdf,0x5e,0xce,0x6f,0x6d,0x4d,0x36,0x35,0xbb,0xdb,0x90,0x9b,0x39,0x1c,
-
-    // Record 39: Address = 0x2380, Length = 128
-    0x2380,0x80,
-    0x5,0x57,0x2d,0x3,0x51,0xa6,0x8,0xee,0xc8,0xeb,0x1,0xf2,0xd7,0xf6,0x58,0xb6,
-    0x19,0x35,0xb0,0x8d,0xc2,0x6f,0x11,0x23,0xb9,0x8a,0x89,0xab,0x57,0xe0,0x63,0x3a,
-    0x94,0xac,0xc7,0xbb,0x4d,0xc4,0x9b,0x4e,0x55,0x8a,0x2c,0xdb,0xa,0x9d,0xcb,0xb6,
-    0xfe,0x36,0x9a,0xcb,0xbc,0x8c,0xc7,0xb8,0xc8,0x25,0x8a,0x7b,0xfb,0x78,0x97,0xce,
-    0x55,0xc5,0x85,0x99,0xab,0x35,0x3d,0xfe,0xd5,0xed,0x6,0x8d,0x4b,0xdf,0xf0,0x5,
-    0x58,0x74,0x29,0x2a,0x96,0xca,0x20,0x8f,0xda,0xaf,0x73,0x9b,0x1d,0x32,0xf6,0xf0,
-    0x76,0xd2,0xf8,0xc1,0x6e,0xb1,0xf9,0xc2,0x42,0xfe,0x9,0xa2,0x84,0x89,0x76,0xf0,
-    0xef,0x81,0x96,0xa8,0xec,0x8c,0x41,0x57,0xf1,0x9c,0x2a,0x51,0x29,0x57,0x73,0x34,
-
-    // Record 40: Address = 0x2400, Length = 128
-    0x2400,0x80,
-    0x77,0xf6,0xf3,0xa9,0xb,0x90,0x13,0x8,0xcb,0xc1,0xcb,0x64,0xac,0xea,0x27,0xec,
-    0xfc,0xa4,0xfb,0x7c,0x15,0x7c,0xd0,0x33,0x84,0xa3,0x5f,0xef,0x17,0x91,0xbf,0xad,
-    0xf1,0x91,0xdc,0xc8,0xae,0xbc,0x1e,0x4e,0x92,0x8f,0xce,0xe7,0x5f,0xba,0x48,0x77,
-    0x5b,0x2d,0x7b,0x83,0x96,0x71,0x63,0x6c,0xa8,0xfb,0xaf,0x5b,0x45,0x70,0x1,0x75,
-    0xa4,0x38,0xab,0x8d,0x62,0x68,0x96,0x3b,0xe1,0xfc,0x1c,0xe9,0x8e,0x1c,0x91,0xe8,
-    0x9e,0x13,0x5c,0x5d,0x51,0x45,0xec,0x86,0x52,0x62,0xaf,0x12,0x2c,0xd0,0xbb,0x0,
-    0x5c,0xea,0x98,0xa8,0xb1,0x45,0xf1,0xd8,0x5c,0xf0,0xf8,0x7c,0xe0,0x2d,0x75,0xb4,
-    0x95,0xa2,0x6b,0x4e,0xe6,0x4,0xc0,0x4,0xd,0x82,0x60,0x36,0x1d,0xc1,0xa7,0x4d,
-
-    // Record 41: Address = 0x2480, Length = 128
-    0x2480,0x80,
-    0x36,0x1e,0x32,0x61,0xc5,0x2f,0xf1,0x4b,0xed,0x52,0xac,0x48,0xb5,0x99,0xb7,0x14,
-    0x1d,0x84,0x7f,0xbd,0x52,0x43,0xcc,0x2,0xa5,0xf6,0x3a,0x8c,0xde,0x56,0x49,0xd3,
-    0xe6,0xa1,0xc3,0x97,0x4d,0xdb,0xcb,0x95,0x93,0xe9,0x41,0x2a,0x33,0x46,0xd8,0xba,
-    0xf2,0xf3,0x13,0xf1,0xbc,0x12,0xa0,0x8f,0x16,0x8,0xe3,0xa3,0xb9,0xbf,0xde,0x2d,
-    0x52,0xfd,0x80,0xa1,0x9c,0xf,0xe8,0x47,0x44,0x8a,0x55,0x29,0x3b,0x80,0x4a,0xf7,
-    0x11,0xad,0x3e,0xe,0x5c,0xf9,0x37,0x47,0x44,0x1d,0x9d,0xd1,0xeb,0x14,0x90,0x6e,
-    0x83,0x37,0xa4,0x56,0xe5,0xf9,0x28,0x60,0xa6,0xe6,0x25,0x1f,0x77,0x54,0x2f,0x8d,
-    0x3b,0x17,0xe5,0x5e,0x1b,0xb7,0xb,0xbe,0x91,0xf8,0x7d,0x23,0xa6,0x78,0xac,0x83,
-
-    // Record 42: Address = 0x2500, Length = 128
-    0x2500,0x80,
-    0xad,0x4,0x93,0x21,0x1d,0xe7,0xc3,0x82,0xa9,0xdd,0x98,0x12,0x5d,0xb0,0x93,0x9b,
-    0x6b,0x13,0x65,0x7,0x1e,0x44,0xf0,0x9f,0x2,0xc7,0xeb,0x20,0x8b,0x75,0x5b,0x47,
-    0x1f,0xcf,0x76,0x4a,0x7a,0x40,0x6a,0x5d,0xa7,0x8b,0x88,0x4,0x91,0x79,0x15,0x22,
-    0x9e,0x1d,0xfb,0x6d,0x55,0xf9,0x74,0xe9,0xdc,0x82,0x71,0x87,0x38,0xb6,0xd9,0xe9,
-    0xb,0x96,0xf4,0x5a,0x0,0x0,0x5d,0xb5,0xea,0xf1,0xea,0xb0,0xf2,0x14,0x10,0xf1,
-    0x9c,0x83,0x18,0xbe,0xd6,0x9,0x95,0xa2,0x3,0x70,0x90,0x42,0xbd,0x85,0xd8,0xdc,
-    0x52,0xc8,0xb8,0x2c,0x6d,0x73,0x50,0x3,0xaa,0x3d,0x22,0x16,0xb6,0x8e,0xed,0xa5,
-    0x90,0x5c,0x51,0x42,0x97,0x30,0x2,0x8d,0x40,0xc2,0xf5,0xa6,0xfe,0x78,0x6,0xa6,
-
-    // Record 43: Address = 0x2580, Length = 128
-    0x2580,0x80,
-    0x44,0x1,0x24,0xa3,0x2c,0x45,0xb4,0xed,0x2c,0x80,0xae,0xdf,0x82,0x48,0xf5,0xca,
-    0x27,0x90,0x2b,0xde,0x13,0xfe,0x8d,0x60,0xbe,0x8e,0x63,0x5e,0x10,0xd1,0xb4,0xcf,
-    0xec,0x1f,0x71,0xf3,0x77,0xda,0x8,0xd4,0xdc,0x5b,0xc9,0x4,0x3c,0x63,0xb8,0x41,
-    0x88,0x54,0x88,0x5d,0xc8,0x8e,0x4d,0x9b,0x13,0x7d,0x82,0x6e,0xaf,0x27,0xbb,0xcf,
-    0xa,0xb3,0x21,0x86,0x25,0x5c,0x36,0xb3,0x12,0x90,0x5d,0xc4,0x30,0x70,0x5,0xb2,
-    0x25,0x65,0xba,0xf8,0x14,0x6,0x32,0x10,0xca,0x7a,0xe2,0x35,0xac,0x3d,0x1e,0x67,
-    0xf7,0xf0,0xc9,0xa3,0xe5,0x4f,0xb6,0xba,0x94,0xd8,0xa3,0xc3,0xec,0x3f,0x7a,0x27,
-    0x95,0x5d,0x82,0x45,0xed,0x7a,0x10,0xa3,0x6,0xff,0x3a,0x8b,0xf7,0xc6,0xef,0x7a,
-
-    // Record 44: Address = 0x2600, Length = 128
-    0x2600,0x80,
-    0x65,0xa4,0xa,0x12,0xb3,0x41,0xd,0x54,0xaa,0x40,0x8c,0xe0,0xd9,0x92,0x8,0x3c,
-    0xab,0x74,0x75,0xe3,0x7d,0xe7,0x6e,0x37,0x31,0xfc,0x75,0x4,0x61,0xe6,0xdf,0xe2,
-    0x90,0xcb,0x52,0x34,0xe,0xbf,0xd7,0xcd,0x28,0x5e,0x41,0x43,0x59,0xc4,0x1b,0xf8,
-    0xc5,0xa2,0xe2,0xce,0x13,0x9e,0x23,0x69,0x48,0x82,0x79,0x11,0xfb,0x56,0xa5,0x35,
-    0x5b,0xff,0xdb,0x95,0xd8,0xc7,0x4d,0xf0,0xcb,0x85,0xd5,0xf1,0x7d,0x40,0x23,0xec,
-    0xa3,0x1d,0x42,0xf1,0xcb,0xba,0x1f,0x13,0x27,0x5,0x58,0xbc,0xd9,0x83,0x72,0x9c,
-    0xa0,0x5a,0x19,0x5e,0xb5,0x53,0x59,0xef,0x5a,0x6c,0x8,0xf7,0x6f,0x8,0x67,0xa6,
-    0xb8,0x4f,0x18,0xb0,0xf4,0xdc,0xc7,0xb0,0x43,0xac,0xe9,0xfb,0xa0,0xac,0x9c,0x7c,
-
-    // Record 45: Address = 0x2680, Length = 128
-    0x2680,0x80,
-    0x3c,0x86,0x5c,0xbb,0x61,0xbb,0x9d,0x8d,0xa8,0x96,0x9d,0xcd,0xfd,0xf6,0xd4,0x71,
-    0xc5,0xe2,0xa0,0xc1,0x7e,0x2d,0x4c,0x35,0x6c,0xe,0xb2,0x6b,0x99,0x37,0xe1,0x57,
-    0x10,0x68,0x56,0xf,0xd4,0xf,0xbb,0xd8,0x3a,0xab,0xb2,0xeb,0x58,0xd3,0x22,0xc2,
-    0x27,0xdc,0x37,0xbe,0x30,0xb9,0x38,0x68,0x4a,0xb4,0xfe,0x5a,0x3,0x4e,0xa0,0xf0,
-    0x8,0x0,0x67,0x4e,0xbf,0xba,0xf0,0x68,0xd2,0x8a,0x5a,0x34,0xac,0x4,0xf1,0x26,
-    0xef,0xe1,0x9,0x25,0x4d,0x62,0xec,0x5d,0x0,0xaa,0xc5,0x66,0xb7,0xde,0xaf,0xce,
-    0xe7,0xc,0x1b,0x68,0xd3,0x9d,0xf1,0x5b,0x7d,0x91,0x5,0x80,0xf,0x23,0x70,0x42,
-    0x9f,0xba,0x6b,0x29,0x5,0x1a,0x3c,0xaa,0x82,0xd6,0xc7,0x2a,0xd7,0x15,0x5d,0x61,
-
-    // Record 46: Address = 0x2700, Length = 128
-    0x2700,0x80,
-    0x55,0xef,0xb7,0x44,0xb9,0x71,0xf9,0xa2,0x96,0x8a,0x72,0x53,0x57,0x93,0x76,0x22,
-    0x90,0x8e,0xbe,0xf1,0xcc,0x4,0xb2,0x85,0x51,0xf4,0xc7,0x86,0xc1,0x74,0x40,0x3a,
-    0x9c,0x72,0xe0,0xe0,0x54,0xc7,0x38,0x6,0xfe,0x4b,0x6a,0x94,0xdd,0xa0,0x23,0x74,
-    0x42,0x5b,0xa0,0xc5,0x7c,0x52,0xb4,0xa2,0x32,0xcd,0xf5,0xb3,0xd5,0x4a,0xf7,0xb9,
-    0x25,0x52,0xd4,0x98,0x9,0x89,0x72,0x1d,0x86,0x80,0xab,0xa2,0x8a,0xd3,0x21,0x80,
-    0xe5,0x24,0x51,0xdd,0xcb,0xcb,0xdc,0x78,0xba,0xfd,0x11,0x11,0x4a,0x41,0xed,0x89,
-    0xf,0x9b,0xe6,0x28,0xa,0x94,0xc2,0xc4,0xb7,0x63,0x80,0x42,0x21,0xee,0xb7,0x68,
-    0x24,0xdc,0x8,0x87,0x8c,0xb9,0xb4,0x5d,0x29,0x1e,0xad,0xc,0xe6,0x1c,0xd4,0x6e,
-
-    // Record 47: Address = 0x2780, Length = 128
-    0x2780,0x80,
-    0x86,0xe3,0x35,0x7c,0x32,0x71,0x7a,0x43,0x6e,0x9a,0xf0,0x13,0xe9,0xe2,0x90,0xf2,
-    0x9a,0x3a,0x31,0x3e,0x64,0x6d,0xc4,0x8b,0x5b,0xdc,0xd7,0xc8,0x9e,0x6f,0x5b,0xbf,
-    0x7e,0xe2,0x5c,0x50,0x3d,0x20,0x94,0x1a,0x96,0x37,0x23,0x2d,0xa7,0xbb,0xb7,0x4a,
-    0x93,0xae,0xbe,0xb6,0xe4,0x48,0x8f,0xb4,0xf4,0xaf,0x38,0x64,0xc8,0x97,0x8a,0x12,
-    0xec,0xbf,0xef,0x57,0x4a,0xbe,0x2,0x79,0xae,0xc3,0x1,0x1c,0xfc,0x1b,0x1,0xdc,
-    0x26,0xbe,0x3a,0x56,0xd4,0xa1,0x80,0x67,0x16,0x8c,0xe5,0xbf,0x93,0xd,0xaa,0xa8,
-    0x1d,0xe0,0xd1,0x16,0x54,0xc2,0xc,0xe7,0x4d,0xc6,0x3b,0x3c,0x91,0x8f,0x46,0x1c,
-    0x3a,0x2c,0x11,0x8d,0x99,0xc,0x11,0x10,0xb,0x57,0x53,0x50,0x3a,0x7d,0xe5,0xe1,
-
-    // Record 48: Address = 0x2800, Length = 128
-    0x2800,0x80,
-    0x9c,0xd5,0x23,0x7d,0x43,0x99,0xf8,0xf0,0x47,0x62,0xeb,0xc0,0xac,0xdc,0x84,0x16,
-    0x1,0xfc,0xd9,0x9b,0x5b,0x36,0xb8,0xbd,0x95,0x70,0x72,0x0,0x25,0x5f,0x80,0x3,
-    0xd6,0x9c,0x21,0x9c,0x7c,0xdb,0x31,0xd4,0x7c,0x57,0x12,0xd5,0x13,0x4,0x9d,0x82,
-    0x8e,0xbd,0x65,0xaf,0xf2,0x67,0xc2,0xae,0xc0,0xeb,0xdb,0x6c,0xf8,0xd9,0xfd,0xb4,
-    0x54,0x87,0x38,0xe4,0x3e,0xbf,0xf0,0x3b,0xbb,0xcd,0x32,0x22,0x1,0x1d,0x80,0xa1,
-    0xa6,0xb,0xf3,0xdd,0x1b,0xe3,0x78,0x88,0x86,0x76,0xe9,0x50,0xba,0x35,0xe8,0x4f,
-    0x9,0x8,0x9,0x3,0xcf,0x11,0x8f,0x47,0xfc,0x72,0xf6,0xb3,0xee,0x75,0x9c,0x3b,
-    0x7f,0xf,0x11,0xeb,0x45,0xc,0x5,0x76,0x86,0x29,0xf1,0x4c,0xce,0x7b,0xb0,0x3d,
-
-    // Record 49: Address = 0x2880, Length = 128
-    0x2880,0x80,
-    0x53,0x8c,0x46,0x61,0x84,0xe3,0x51,0x79,0xc8,0x49,0x69,0xd5,0x57,0x33,0x31,0xc2,
-    0xb5,0xce,0x63,0x7b,0xb8,0xcc,0xde,0x22,0x91,0x35,0xdf,0xa0,0x2f,0xfa,0x51,0xd8,
-    0x96,0xf5,0x6d,0x9c,0x29,0x29,0x5c,0x58,0xed,0x29,0x2e,0x94,0x5b,0x49,0xdf,0x1e,
-    0xe,0xbb,0x99,0x21,0xaa,0xf7,0x67,0x2c,0x98,0xed,0x90,0xca,0xff,0xb2,0x42,0x54,
-    0x19,0xed,0x6e,0xee,0x20,0x27,0xbe,0xa8,0x27,0xf0,0xcd,0x95,0x9,0x4e,0x80,0xc4,
-    0x11,0xcd,0xe9,0x95,0xce,0xc2,0xa8,0xd7,0x1a,0x3,0xb1,0xd7,0x47,0x3a,0x72,0x1e,
-    0xbb,0x62,0x8e,0xbc,0xcf,0xff,0x6b,0x75,0x8c,0xc5,0x93,0x37,0x82,0xce,0x39,0xd9,
-    0xfc,0xa1,0x9,0x4,0xc7,0xed,0xf2,0x3,0x14,0x86,0x35,0xcb,0x1e,0x8,0x68,0x14,
-
-    // Record 50: Address = 0x2900, Length = 128
-    0x2900,0x80,
-    0xff,0x85,0x4f,0xf8,0x87,0xd0,0x3d,0xc1,0x2d,0x35,0x6b,0x16,0x8b,0x6b,0x2b,0x9a,
-    0xde,0xf8,0x11,0xb6,0xd6,0xe7,0x88,0x74,0x5e,0x62,0x38,0xb9,0x29,0x75,0xd4,0x80,
-    0x9b,0xd6,0xf6,0x5b,0x84,0x5,0xb7,0x56,0xde,0xcb,0x9c,0x4f,0xd3,0x83,0x9f,0x29,
-    0x7c,0x83,0x97,0xc9,0x2d,0xfb,0xde,0x43,0x26,0x89,0xa5,0xdb,0x4a,0xac,0x46,0xc3,
-    0xe0,0xe2,0x55,0x20,0x50,0xcc,0x45,0x10,0xa,0xbd,0xff,0x14,0x72,0xbb,0x5,0x2d,
-    0xf5,0xca,0x10,0x35,0xcb,0x2,0x7d,0x25,0x17,0x4a,0xca,0x33,0x4e,0xfe,0xb1,0x2,
-    0x20,0x3b,0xf4,0x1c,0x37,0x5a,0x5a,0x7c,0xb5,0x50,0x55,0xb,0x65,0xba,0x8c,0x61,
-    0x45,0x3a,0xd0,0x20,0xbe,0x6,0x97,0x8c,0xe,0x3a,0xa8,0xf5,0xdd,0xad,0xa9,0xb0,
-
-    // Record 51: Address = 0x2980, Length = 128
-    0x2980,0x80,
-    0x36,0xf8,0x1a,0xbf,0x9c,0xb9,0xca,0x2e,0x35,0x2a,0x8,0x9,0x58,0xa8,0x6f,0x9a,
-    0x9e,0xc9,0xb9,0xdf,0x5b,0xfe,0x4b,0x51,0xe0,0xd3,0x1,0xf5,0xee,0x8a,0x3a,0x99,
-    0x7b,0x4e,0xd1,0xbd,0x60,0x76,0x1d,0x73,0xff,0x5a,0x43,0xb9,0x2c,0xf6,0x0,0xb0,
-    0x6a,0xea,0xb,0xfd,0xd2,0x8c,0x18,0xc7,0xe6,0xe5,0x42,0xc2,0x21,0xa1,0x79,0xce,
-    0xaa,0xcb,0xbb,0x1f,0x6,0xb2,0x7a,0xa,0x7c,0x18,0x13,0x44,0x4c,0x2b,0xac,0x46,
-    0x2a,0xcd,0x16,0xd2,0x8d,0x20,0x26,0xbe,0xd4,0x99,0x94,0xfb,0xe4,0x45,0x99,0x28,
-    0x6f,0x69,0xb7,0x4c,0x96,0xb4,0x15,0xa2,0xb3,0x6a,0x21,0x5f,0xca,0xd,0xc3,0xf2,
-    0xb3,0x10,0x4b,0x22,0xdc,0x32,0xce,0x80,0xd7,0xc0,0x75,0xb1,0xdc,0x57,0x27,0x46,
-
-    // Record 52: Address = 0x2a00, Length = 128
-    0x2a00,0x80,
-    0xff,0x65,0x54,0xc4,0xfc,0x72,0x33,0x8d,0xc3,0x7d,0x14,0x6,0x3,0x98,0x32,0xf9,
-    0xaf,0xa1,0xea,0x5,0x80,0x54,0x23,0x94,0x12,0x4f,0x98,0xaf,0xb,0xc7,0x19,0xa2,
-    0x9a,0x9,0xd,0x66,0x66,0x77,0xe4,0x72,0xea,0x80,0xf9,0x2b,0x37,0x39,0xe3,0x2f,
-    0xe1,0xc,0x28,0xa,0xbc,0x7c,0xab,0x7c,0x3,0xa6,0x6d,0xd7,0xa0,0x5f,0x59,0xa6,
-    0xc9,0xea,0x1,0x2f,0xf6,0xfa,0xc3,0xb0,0xd5,0xc8,0x2c,0xbf,0x50,0x43,0xc1,0xc9,
-    0x88,0xf2,0x88,0xc0,0x5e,0x6d,0x8,0xc3,0xbe,0xc,0x4b,0x76,0xe8,0x9c,0xbe,0x53,
-    0x76,0x16,0xdb,0xb5,0x96,0xce,0xea,0xae,0x7f,0x49,0xcd,0x62,0xd7,0x65,0x11,0x5d,
-    0x34,0xf2,0x86,0x3d,0x56,0x88,0x5b,0x4e,0xda,0xa0,0xa0,0xca,0xfc,0xb4,0xb1,0xaa,
-
-    // Record 53: Address = 0x2a80, Length = 128
-    0x2a80,0x80,
-    0xa3,0x57,0xec,0x2e,0x9d,0xc8,0xc5,0x81,0x59,0x60,0x61,0xa,0x1,0xc4,0x1e,0x53,
-    0x74,0xdb,0xcf,0xef,0xe8,0xd,0x59,0x42,0xd7,0x4d,0x83,0x3b,0x9a,0x84,0x55,0xf8,
-    0xe6,0x24,0xa5,0x84,0x7,0xd6,0xd9,0xe9,0x55,0xcc,0x9f,0x8a,0x54,0xa9,0xa2,0x88,
-    0x2d,0x7,0x3a,0xb,0x6f,0xef,0x0,0x3a,0xae,0x86,0x4f,0x76,0x99,0xb3,0x71,0x82,
-    0xbb,0xcb,0x85,0xf7,0x7c,0xdb,0x44,0x51,0xcb,0x8,0x9c,0x7c,0xf,0x7d,0x1d,0x27,
-    0x61,0x39,0x70,0xa2,0xec,0x12,0xeb,0xa5,0xc8,0xf2,0xdf,0xfb,0x91,0x79,0x7c,0xa5,
-    0x4,0xb8,0x62,0x1f,0xcb,0x35,0x6c,0xc,0xd4,0x32,0x62,0xb2,0x10,0x12,0x0,0x64,
-    0x81,0xed,0x16,0x75,0xff,0xb3,0x2,0xe5,0x5,0x2,0x36,0x31,0xe9,0xad,0x1d,0x13,
-
-    // Record 54: Address = 0x2b00, Length = 128
-    0x2b00,0x80,
-    0x2e,0x84,0xdd,0xbd,0xef,0x93,0x3a,0xc7,0x2f,0x4d,0x55,0x34,0xfc,0xe3,0x37,0xdf,
-    0x6,0xcf,0xfc,0xee,0x77,0xb1,0x1c,0x85,0xcc,0x22,0x73,0x5b,0xe2,0x10,0x11,0xf2,
-    0x2e,0xf0,0x1e,0xaa,0x2,0x87,0x9,0xf8,0x10,0x5d,0x67,0x44,0x5c,0xd3,0x40,0x67,
-    0xad,0xa3,0x70,0x51,0x42,0x8e,0x5e,0xc0,0xd4,0x1e,0xcf,0x7a,0xd1,0x25,0x84,0xb5,
-    0x3b,0xcf,0xd3,0xb2,0x37,0xfe,0x8f,0xc0,0x65,0x63,0xdb,0xed,0x9f,0x1b,0x15,0xef,
-    0x66,0x92,0x2d,0x1,0x33,0x88,0x81,0xad,0xca,0x4,0xe6,0x48,0x3b,0x7,0x6b,0x3b,
-    0x65,0x55,0x8e,0x53,0x3c,0x72,0x95,0xb6,0xfd,0xb9,0x41,0x1c,0x14,0x12,0x35,0x2e,
-    0xf3,0x1c,0xda,0xbc,0xec,0x6f,0xaf,0x54,0x46,0x31,0x27,0x16,0xde,0xe8,0x30,0x1f,
-
-    // Record 55: Address = 0x2b80, Length = 128
-    0x2b80,0x80,
-    0x40,0x6e,0x36,0xd4,0x54,0x1,0x47,0x80,0xde,0xf5,0xc2,0xd1,0x1a,0x22,0xda,0xa5,
-    0xd3,0x7c,0xb4,0x49,0x1d,0x5a,0xe0,0xb7,0xd7,0x88,0x21,0x42,0x7c,0xfc,0x8f,0x41,
-    0x48,0x20,0xf3,0x1b,0xeb,0xea,0xc0,0x5c,0x14,0x41,0xbd,0x31,0x4d,0x55,0x24,0xd0,
-    0x22,0x2c,0x13,0x7,0x2c,0xdb,0x47,0x7c,0xf3,0xd,0xe5,0x6d,0x3c,0x8f,0xa1,0xaa,
-    0xaf,0xe6,0xce,0x71,0xbc,0xd3,0xce,0xc7,0x50,0x2f,0x1f,0x3b,0x1f,0x18,0x71,0xab,
-    0x7c,0xe5,0x32,0x1c,0xd,0x8,0x7b,0x27,0x7b,0x6c,0x1c,0x33,0x8d,0x56,0xd9,0x8,
-    0x51,0x7,0xcf,0x12,0xc,0x4c,0xa3,0xed,0x12,0xc9,0x91,0xb1,0xa2,0x99,0x51,0x56,
-    0x10,0xc8,0xb8,0xa3,0x4a,0x1f,0x72,0xe2,0xfa,0xfb,0x9a,0x77,0x77,0x17,0x84,0x65,
-
-    // Record 56: Address = 0x2c00, Length = 128
-    0x2c00,0x80,
-    0x5f,0x29,0x7b,0x71,0x57,0x59,0xf5,0x95,0xd8,0x19,0x94,0x95,0x70,0x68,0xc,0x8b,
-    0xa2,0x1a,0xbf,0x9f,0x96,0x58,0xd1,0xdc,0xb2,0x44,0x77,0x4a,0xb5,0x98,0x11,0xa0,
-    0xae,0x11,0x81,0x8f,0x48,0xca,0x50,0xbb,0xf8,0x4e,0x4c,0x1,0xe1,0xd0,0xa0,0x45,
-    0x12,0xfa,0x5f,0xc3,0xb7,0xe,0x37,0xad,0x31,0xd7,0xb3,0xfe,0xfc,0xa8,0x55,0xff,
-    0x7e,0x63,0x86,0x68,0xbc,0x6e,0xea,0xc0,0x6b,0x5d,0xbc,0x87,0xbb,0x34,0x1c,0xde,
-    0x7c,0x5e,0x80,0xf5,0x39,0x1d,0xed,0xa7,0xd7,0x92,0xc2,0xa6,0x24,0x6b,0x3c,0x73,
-    0xf9,0xf9,0xc,0x88,0x5a,0xb2,0xbc,0xf5,0x41,0xbf,0x3f,0xc9,0x3b,0x76,0x44,0x74,
-    0xff,0xcd,0x1d,0xf6,0x7e,0xda,0xa5,0xe1,0xb4,0xb,0x35,0x92,0xc7,0xd8,0xd0,0xff,
-
-    // Record 57: Address = 0x2c80, Length = 128
-    0x2c80,0x80,
-    0x6d,0xb9,0x78,0xe4,0xc5,0xa9,0x4d,0xb5,0xf2,0x17,0x68,0x77,0xfa,0x8c,0x1,0x7c,
-    0x65,0x83,0x99,0x80,0xd,0xf2,0x4f,0x94,0xf,0x8e,0xb9,0xa5,0xb0,0xbc,0x84,0xca,
-    0x68,0x3f,0x22,0xde,0x36,0xc2,0x12,0x66,0x36,0x10,0xe2,0x3b,0x1b,0xd3,0xef,0x9f,
-    0xc9,0x95,0x9d,0x3b,0xa0,0x3b,0x58,0x6e,0xa6,0x98,0x3b,0xab,0xd3,0xe6,0x3e,0xc,
-    0x52,0xb6,0x9,0x44,0xd6,0xe2,0x9a,0x4d,0xe5,0xe1,0xa,0x24,0x3b,0xa4,0x67,0x17,
-    0xaa,0xbf,0x86,0x58,0x56,0x3c,0x46,0x50,0xf4,0x22,0x64,0x74,0x7,0xdc,0x9,0x3c,
-    0xed,0xec,0x27,0x90,0x91,0xd4,0xdb,0x73,0x86,0xb3,0x54,0xd8,0x30,0x15,0x8e,0xe3,
-    0xa7,0x3e,0xfe,0x1c,0x1e,0xde,0x0,0xc,0x0,0x3d,0xb8,0xc0,0x4,0x63,0xdb,0xdc,
-
-    // Record 58: Address = 0x2d00, Length = 128
-    0x2d00,0x80,
-    0x3a,0xea,0x2c,0xd4,0x17,0xae,0x82,0xa6,0xd2,0x84,0x33,0xc,0x8b,0xb4,0xb4,0xb0,
-    0xd6,0x72,0xfd,0xcf,0xd2,0xae,0xd8,0x2a,0xdb,0xde,0x13,0xad,0x98,0x65,0xbd,0x46,
-    0x2c,0x34,0x31,0x2f,0x4d,0xee,0xa1,0xf2,0xb2,0x1a,0x9f,0xfa,0x65,0xca,0xd8,0xca,
-    0x66,0x48,0x25,0x5f,0x50,0x26,0x84,0xff,0x2a,0x36,0xf6,0x28,0xe7,0x36,0xda,0x34,
-    0xda,0xb5,0xa7,0xe8,0x46,0x8a,0xd5,0x22,0x72,0x46,0x4c,0xc8,0x5,0x9a,0xb9,0xee,
-    0x7,0xf3,0x4a,0x16,0xbb,0x38,0xad,0xfd,0xd4,0x3,0xb6,0x1,0x51,0x2c,0x44,0x83,
-    0x99,0x66,0xd8,0x3,0x3e,0xd5,0x91,0xf4,0xd7,0xff,0xdf,0xf3,0xaf,0x7,0x56,0xf0,
-    0x2c,0x8d,0xe2,0x7d,0xd4,0x6a,0x9e,0x67,0x77,0x2f,0xfe,0x93,0x3d,0x3e,0x7a,0x76,
-
-    // Record 59: Address = 0x2d80, Length = 128
-    0x2d80,0x80,
-    0xd6,0x59,0xfc,0x2e,0x29,0x2e,0xf5,0xb7,0x3d,0x54,0x6c,0x13,0x3d,0x93,0xc3,0x24,
-    0xe3,0xa,0x6f,0xc6,0xbe,0x98,0x70,0xad,0x6c,0xb0,0x2b,0xd3,0x1a,0xbd,0x87,0x43,
-    0xce,0xfd,0x52,0xc2,0xd7,0xf1,0xf4,0xa2,0x3f,0xa1,0x22,0x56,0xaa,0x8d,0xa5,0x55,
-    0x93,0x5a,0x2e,0xd8,0xe2,0xe5,0x10,0x8,0xeb,0xb9,0xfd,0xd5,0x4d,0xfc,0xea,0xd,
-    0x1e,0x7e,0xee,0x4,0x1a,0xdc,0x3d,0x56,0xcf,0xa4,0x65,0x38,0xdf,0x92,0x3e,0xee,
-    0x6,0x23,0x47,0x8b,0x27,0xd8,0xfd,0x6b,0x1c,0x99,0xe3,0xdd,0x59,0x71,0xcb,0x42,
-    0x7e,0x8a,0x34,0x2b,0x21,0xeb,0x70,0x78,0x9f,0x34,0xf1,0x3d,0xf4,0x54,0xaa,0x34,
-    0xfa,0xa3,0x66,0xf2,0xe,0xf3,0xa8,0x3a,0x2d,0xe2,0xe5,0x5c,0xa4,0x54,0xb4,0xce,
-
-    // Record 60: Address = 0x2e00, Length = 128
-    0x2e00,0x80,
-    0x5e,0x7d,0x5c,0x87,0x9d,0x70,0x9d,0x56,0x53,0x24,0xe7,0xc7,0x6,0x10,0xd4,0x94,
-    0xd4,0x7b,0x17,0x1f,0xb2,0x4e,0x84,0x9e,0x1d,0xfc,0x7a,0x8d,0x9b,0x93,0x6f,0x2e,
-    0xd0,0xda,0x6d,0xef,0x4f,0x86,0xae,0xdb,0x7e,0x6b,0xd,0xef,0x66,0x12,0x3c,0xc4,
-    0xe7,0x2c,0x9f,0x8b,0xb5,0x72,0xc9,0x36,0x19,0x53,0x42,0xe6,0x33,0xb,0x1b,0x31,
-    0xf1,0x3b,0x51,0xc8,0x9c,0x85,0x24,0xef,0x17,0x26,0xb1,0xb0,0x44,0xde,0xd3,0xd4,
-    0x9a,0x7b,0xa7,0xb,0xc0,0x17,0x6c,0x94,0x4e,0xe1,0x50,0xa9,0x84,0x44,0x2d,0x90,
-    0x26,0x74,0xb9,0x5e,0x1a,0x4e,0x38,0xa9,0xba,0xc5,0xd1,0xaf,0x83,0xf,0xa7,0x72,
-    0x3a,0x4b,0xc1,0xa9,0xa5,0xd3,0xa1,0x51,0x9d,0x50,0xb3,0xbe,0xf7,0x57,0xfa,0xb2,
-
-    // Record 61: Address = 0x2e80, Length = 128
-    0x2e80,0x80,
-    0x89,0x20,0x4a,0x16,0x1,0xf0,0x2a,0xe5,0x3b,0x65,0x29,0xfc,0x4a,0x11,0xc1,0xfe,
-    0x6a,0x21,0x55,0xee,0x59,0x7b,0x3a,0x48,0x49,0x4a,0xec,0x69,0xd0,0x97,0x79,0xbc,
-    0xa,0x52,0x86,0xc1,0x6d,0x83,0xe0,0xce,0x1a,0x75,0xb5,0x56,0x59,0xfb,0x39,0x78,
-    0xf6,0x4e,0x1f,0xf3,0xaa,0x83,0x61,0x22,0x18,0xf7,0x6d,0xc8,0x84,0xd1,0xba,0x9,
-    0x19,0x56,0xdc,0xe3,0xa8,0x92,0x96,0x62,0x1d,0xb4,0x4c,0x70,0x7d,0x0,0x41,0xf3,
-    0xcc,0x5f,0x2d,0xc4,0xce,0xc,0x94,0xae,0x97,0x90,0xb7,0x29,0x53,0x40,0x2e,0x51,
-    0xd0,0xbd,0x72,0x1f,0x90,0xae,0xaf,0xac,0x8f,0xa1,0x74,0xdc,0xc7,0xde,0x70,0xf1,
-    0x81,0xdc,0x45,0x9a,0xd0,0xea,0xe6,0x57,0x6e,0xce,0xaf,0xd3,0x18,0xf5,0x3d,0x1b,
-
-    // Record 62: Address = 0x2f00, Length = 128
-    0x2f00,0x80,
-    0x29,0x2d,0xa5,0xed,0x16,0xd1,0x43,0x48,0x20,0xe7,0x95,0x2a,0x9,0x3e,0xba,0x6b,
-    0x5d,0x83,0xd6,0x69,0xc6,0xab,0xea,0xd5,0x41,0xc3,0xf1,0x4,0xe7,0xab,0xd1,0x4b,
-    0xa2,0xc6,0xbc,0x40,0xfa,0x22,0x4a,0x50,0xe6,0xde,0x45,0x6b,0xdd,0xe3,0x68,0xdf,
-    0x5e,0x2,0xb9,0x25,0x86,0xca,0xfb,0x5c,0x21,0x9b,0x37,0x63,0xa5,0x32,0xec,0xeb,
-    0x1b,0x84,0x5f,0xe0,0x43,0x47,0xee,0xf4,0xd1,0xcb,0xd,0xdb,0xeb,0x20,0x76,0x10,
-    0x2f,0x21,0xf4,0x24,0xf0,0xf1,0x81,0x30,0x56,0x7,0x2,0xbe,0x97,0xf9,0x92,0x15,
-    0xbe,0x9b,0x15,0xe4,0x69,0x48,0x88,0x44,0x77,0x48,0xb0,0xae,0x15,0xdd,0xcc,0xc3,
-    0xc,0x6c,0x2b,0xb1,0x97,0x55,0xb8,0x81,0x4b,0xd4,0xab,0xa3,0x1c,0xa8,0x8d,0x80,
-
-    // Record 63: Address = 0x2f80, Length = 128
-    0x2f80,0x80,
-    0x62,0x6a,0x97,0xc9,0xc2,0x30,0xfe,0x9d,0x5f,0x54,0xdd,0x4a,0xa6,0xc9,0x81,0x35,
-    0x30,0x9c,0xe8,0x99,0x82,0x25,0x1b,0x53,0x2f,0x30,0xcc,0x6a,0x3a,0x2f,0x23,0x8,
-    0x5c,0xd3,0x34,0x79,0x23,0xa,0x77,0x4e,0x8f,0x8e,0x1f,0x65,0x4f,0x55,0xe9,0x2f,
-    0xd4,0xb2,0x2a,0x7d,0x65,0x11,0x4,0xdb,0xcc,0xfb,0xb6,0xe,0x75,0x4c,0x33,0x66,
-    0x32,0x35,0xb3,0x86,0x13,0xd6,0xfe,0xdf,0x99,0xce,0x1b,0x1e,0x89,0x18,0xa,0x94,
-    0x6d,0x3a,0xf9,0xdd,0xff,0x3d,0x88,0x88,0xc5,0x1b,0x61,0x1d,0x65,0x50,0x9a,0x78,
-    0x63,0xff,0xbf,0xce,0x88,0x28,0x26,0xb,0x14,0xfc,0xae,0x41,0x23,0xd0,0x8,0x6,
-    0xba,0xed,0xf,0xd8,0x5f,0xf1,0x66,0x38,0x4e,0xc1,0x2d,0x8b,0xf6,0x63,0xc7,0x14,
-
-    // Record 64: Address = 0x3000, Length = 128
-    0x3000,0x80,
-    0xfd,0xf,0x1a,0x8d,0xfd,0xf2,0xe4,0x43,0x1f,0x9,0x7c,0x97,0xf7,0x29,0x5,0x7,
-    0xda,0x7c,0xc8,0x77,0x91,0xca,0xf7,0xcf,0x87,0x12,0x33,0x32,0x2b,0x92,0xd0,0x6a,
-    0x40,0x74,0x12,0xbb,0xb0,0xf8,0x4b,0xa7,0x1e,0x30,0xdc,0x8a,0x58,0xbe,0xaf,0x18,
-    0x8f,0xea,0x2,0x9b,0xba,0xa9,0xa9,0xa8,0xd2,0x92,0xb8,0x8b,0xb9,0xb2,0x1f,0xc1,
-    0x3e,0x36,0xcd,0x93,0xce,0xa6,0xaf,0xd4,0x2d,0xbf,0xc1,0x25,0x9f,0xb2,0x6e,0xdb,
-    0xda,0x6d,0xb8,0x73,0xe,0x84,0xde,0x4e,0x89,0xee,0xe3,0xb,0xf,0x6d,0xcf,0x99,
-    0x96,0xc6,0xdc,0xbf,0x17,0xb1,0x16,0x59,0xe4,0x84,0x53,0xdd,0xce,0xcf,0x1d,0x4a,
-    0x49,0xf7,0xc3,0x7d,0xe7,0xbf,0xb7,0xa,0x69,0x21,0x6f,0xfa,0x29,0x69,0xb1,0x32,
-
-    // Record 65: Address = 0x3080, Length = 128
-    0x3080,0x80,
-    0x12,0x28,0x53,0x2d,0xf3,0x4a,0x2b,0x8a,0x18,0x40,0x79,0x42,0xce,0x3d,0x66,0xc5,
-    0x90,0xb6,0x0,0xac,0xfd,0xbb,0xd2,0x84,0x9e,0x86,0x9c,0xb7,0x4,0x41,0x45,0x7d,
-    0x3c,0x8f,0x7a,0x2d,0x64,0xab,0x93,0x78,0xf2,0xa1,0x1a,0xd,0x14,0xf3,0xc4,0xb6,
-    0x90,0xd6,0x98,0x5c,0x40,0x3c,0xeb,0x68,0x2,0xb7,0x82,0x17,0xe4,0x5c,0xb0,0xde,
-    0x94,0xe2,0x29,0x3c,0x33,0xda,0xfa,0xd7,0x47,0x55,0xd4,0x32,0x1,0x7d,0x52,0xb6,
-    0x8c,0x34,0xd5,0x9d,0x21,0x66,0x7a,0x93,0x9b,0x4d,0xe2,0xe3,0x31,0xb8,0xfa,0x71,
-    0x85,0xe2,0xe0,0x19,0x6f,0x62,0xd6,0xd2,0x9,0x96,0xc9,0xf0,0x6,0xa1,0x6b,0x4c,
-    0x4a,0xcf,0xdd,0xe6,0x1d,0x2d,0xe,0x8a,0xcc,0xf1,0x2,0x6,0xa2,0x95,0xa6,0xd0,
-
-    // Record 66: Address = 0x3100, Length = 128
-    0x3100,0x80,
-    0xa4,0xf2,0x85,0xd3,0x28,0x74,0x79,0xd1,0x1a,0xed,0x52,0x2e,0x5d,0xd7,0xfc,0x99,
-    0xe5,0x61,0x6d,0x1e,0x9b,0xf0,0xaf,0x88,0x24,0x4b,0x0,0x9f,0x47,0x19,0xa5,0x3a,
-    0x52,0x8c,0x2f,0xcb,0x6a,0x26,0xe1,0x2b,0xa0,0x80,0xcc,0xb6,0x2c,0xd8,0xa4,0x19,
-    0x96,0xb4,0xdc,0xf8,0x91,0x59,0xe9,0xee,0x27,0xd7,0x1f,0x4e,0xe,0x21,0x80,0x12,
-    0xa7,0xa1,0xb9,0x15,0xde,0x63,0xd5,0x4c,0x63,0xe2,0xb,0x38,0x8a,0x5,0x53,0x2d,
-    0x14,0xa3,0x41,0xc2,0x16,0x8a,0x69,0xe2,0xb,0x47,0xe1,0x8,0x35,0x16,0x28,0xc8,
-    0x88,0x11,0x1c,0x32,0x33,0x33,0x7c,0xbd,0x92,0xfe,0x99,0x6c,0x4f,0x10,0xd8,0xd1,
-    0x23,0xa5,0xf8,0xda,0x11,0x32,0xe1,0x18,0xac,0xff,0xc,0xed,0x1f,0xb8,0xde,0xc,
-
-    // Record 67: Address = 0x3180, Length = 128
-    0x3180,0x80,
-    0xe9,0x6c,0x2b,0x49,0xc4,0x1,0xf,0x5a,0x73,0xf9,0x3c,0x21,0x59,0x6e,0x23,0x2b,
-    0xb5,0xfa,0x2,0x41,0x6d,0x7b,0x6b,0xdb,0xd0,0xcc,0xfb,0x82,0xcc,0xbd,0x91,0x32,
-    0x9e,0xc4,0xfa,0xb6,0x47,0xa2,0xf4,0xdf,0x17,0xf9,0x97,0xa5,0xe8,0xb9,0xf2,0x5c,
-    0x51,0x51,0xc9,0x7,0x9a,0x34,0x81,0x97,0xc0,0x64,0x86,0x54,0xc5,0x19,0x49,0x5d,
-    0x6d,0x2,0x9d,0xfa,0x62,0x6a,0x26,0xed,0x31,0xe3,0xf0,0xfe,0xf5,0x8,0x14,0xe,
-    0x41,0x34,0x92,0x4f,0x16,0x6,0x16,0xcd,0x20,0x9d,0x32,0x60,0x5,0x5b,0xaf,0x5,
-    0x5f,0xd0,0x55,0x47,0xf2,0x4f,0x52,0x72,0x79,0x51,0x88,0x20,0xe,0xa,0xd1,0x54,
-    0x4a,0xb5,0xdd,0x5b,0x66,0x99,0xcb,0xad,0xc0,0x4d,0x28,0x6a,0x75,0x2e,0xa,0xf2,
-
-    // Record 68: Address = 0x3200, Length = 128
-    0x3200,0x80,
-    0x87,0xe,0x90,0x75,0x6,0xda,0xaa,0x4,0xd1,0x2d,0x8d,0x17,0xb,0xc2,0x17,0x74,
-    0x4a,0xec,0xba,0x63,0x56,0xf,0x18,0xea,0x13,0xa8,0x47,0x5d,0x99,0xdb,0xb8,0x90,
-    0x76,0x67,0xd8,0xfe,0x14,0x1f,0x1,0x3e,0xc,0xbf,0x12,0x64,0x29,0x97,0x6a,0x80,
-    0xcb,0x5e,0x5a,0xf9,0x23,0x92,0x32,0xe,0x34,0x91,0x88,0x91,0xa0,0xa0,0x63,0xe0,
-    0xb8,0xf,0x30,0xc6,0x9c,0x89,0x54,0x40,0x86,0x59,0x42,0xf8,0xf4,0xe1,0x65,0x1c,
-    0x3b,0xc3,0x47,0xa8,0x3a,0x24,0xd8,0x7f,0x98,0x94,0x40,0xcf,0x55,0x6a,0x61,0x3d,
-    0xeb,0x19,0x4a,0xa7,0x5b,0x70,0xe7,0x43,0xa7,0xfd,0x65,0xc2,0xbf,0x99,0xb2,0xd,
-    0xc2,0xe6,0x63,0x26,0x3f,0x9f,0x1a,0xf9,0x7a,0x50,0xe2,0x34,0x41,0x9a,0xbc,0xe4,
-
-    // Record 69: Address = 0x3280, Length = 128
-    0x3280,0x80,
-    0x69,0x4,0x57,0x70,0x8,0x2a,0xb0,0xb2,0x1,0xc,0xbc,0x75,0x5d,0xcf,0x60,0xb8,
-    0xec,0x60,0xcb,0xd8,0xb8,0x45,0xba,0x5b,0xb0,0xcb,0xf5,0x9a,0xfc,0x39,0xf7,0x2d,
-    0x9e,0x84,0x48,0x6c,0xb4,0x16,0xd1,0x4a,0x13,0x59,0xf0,0xb8,0x78,0x71,0xf1,0x52,
-    0x1,0x7c,0xfa,0xfa,0x2c,0xe2,0xc6,0xc5,0x94,0xe2,0x32,0x54,0x28,0x9c,0xf1,0xa6,
-    0x70,0x3d,0xe1,0x9e,0xf3,0x21,0xb5,0xf0,0x82,0x2a,0x2,0xda,0x72,0x2a,0x76,0x15,
-    0xaa,0xcb,0xbf,0x7d,0x2,0xd,0x3d,0x86,0xaf,0x10,0x9b,0xb5,0x9d,0x5c,0xc0,0xc7,
-    0xe3,0xae,0x47,0xe2,0x9b,0x9b,0x70,0x8f,0x30,0x93,0xa6,0x4b,0xa8,0xd4,0xdb,0xc8,
-    0xe1,0xe4,0xe3,0xcd,0xb6,0x10,0x26,0xf9,0xc0,0x15,0x4d,0x4a,0xd0,0x7d,0xb,0x51,
-
-    // Record 70: Address = 0x3300, Length = 128
-    0x3300,0x80,
-    0xea,0xdd,0x15,0x38,0xb9,0x4c,0xce,0x68,0xb6,0x61,0x34,0x21,0xc4,0xe0,0x6d,0xf6,
-    0x78,0x2,0x69,0x33,0x6f,0x3c,0xb8,0xe9,0x91,0x9c,0x2c,0x8b,0x3e,0x8c,0x3b,0xcf,
-    0xa9,0x58,0xf8,0x75,0x57,0x6c,0xdc,0xab,0x7f,0x57,0x2d,0x40,0x97,0x5f,0x5e,0xac,
-    0xe5,0x56,0x6f,0xcd,0x45,0x6c,0x78,0x4a,0x56,0x24,0x4c,0x41,0x7a,0xc4,0x52,0x1,
-    0x3e,0x0,0x86,0x8f,0x46,0x99,0xc0,0x8b,0x7c,0x6b,0xc,0x68,0x32,0xca,0xf7,0x1f,
-    0x7f,0xa0,0xe5,0xef,0xbf,0xf7,0x14,0xaa,0xae,0x9a,0x9c,0x1c,0x9d,0x90,0xa6,0xd,
-    0x9d,0xa7,0x44,0xb,0x9,0x77,0xa7,0x92,0x65,0x1c,0xde,0x10,0xb,0xf9,0x94,0x99,
-    0x8c,0x43,0x8c,0x89,0x7e,0x31,0x16,0xe0,0xed,0xf5,0x44,0xc9,0xd5,0xd,0x7b,0x10,
-
-    // Record 71: Address = 0x3380, Length = 128
-    0x3380,0x80,
-    0x99,0x57,0xb9,0x48,0xe0,0x1b,0x6a,0x8f,0x69,0x47,0xf2,0x0,0xcb,0x2c,0x68,0x31,
-    0xe9,0xa4,0x43,0xd8,0xa3,0xa6,0x9f,0x50,0x8f,0x55,0x16,0x97,0x19,0x6f,0xd,0x9f,
-    0xf,0xc1,0x4a,0xa8,0xc8,0xcf,0x34,0x40,0xfc,0xfa,0x30,0x5f,0x61,0x53,0x4a,0xd0,
-    0x5e,0xd4,0x7c,0x6b,0xcd,0x39,0xe7,0x41,0xb6,0xc9,0x5b,0x7b,0xf0,0x5a,0xaf,0xdd,
-    0x8e,0xa6,0x28,0x4a,0x27,0xec,0xd2,0xf9,0xa9,0xb5,0x33,0xbc,0x1b,0x7f,0x5,0x19,
-    0x9,0x89,0x22,0xb4,0x8b,0xd,0x74,0xa7,0x44,0x42,0xef,0x2f,0xae,0xcd,0xd5,0x61,
-    0x48,0x95,0xa6,0x2f,0x7d,0x6b,0x3b,0x54,0x62,0x5d,0x9,0x7c,0x9b,0x73,0xaf,0x58,
-    0xfb,0x8e,0xbb,0x73,0xfd,0xbb,0x63,0x85,0x87,0xcb,0x97,0x63,0x39,0x61,0x14,0x1a,
-
-    // Record 72: Address = 0x3400, Length = 128
-    0x3400,0x80,
-    0x66,0x4a,0x44,0xe4,0x7b,0xf8,0x57,0x2f,0x1e,0xbe,0xc2,0x53,0x7b,0x54,0xdc,0x5,
-    0x50,0xcd,0x35,0xca,0x9,0x5b,0x20,0xf,0x71,0x48,0xa8,0xf5,0x6d,0x60,0x3b,0x8f,
-    0xc3,0x3a,0x6c,0xe,0xbd,0xb1,0x37,0xf9,0xdf,0xad,0x7f,0xc2,0x12,0x89,0xdd,0xf1,
-    0xeb,0xdb,0x30,0xbe,0x29,0xc5,0x76,0xc1,0x81,0x6,0x54,0x30,0xdb,0xf2,0x58,0x54,
-    0xb,0x3d,0xd2,0xbb,0x1e,0x14,0x64,0x7d,0x7c,0x8,0x74,0x18,0x73,0x6,0x4e,0x7,
-    0x12,0xcf,0xe8,0x28,0x71,0xdd,0x9e,0xd6,0x13,0xe4,0x7a,0x18,0xda,0x62,0x84,0x9f,
-    0x62,0x16,0x2d,0xb6,0x53,0x9b,0x15,0xa5,0xaa,0x8f,0xd2,0x39,0xdc,0xcb,0x68,0x78,
-    0x1f,0x3b,0x3f,0x35,0x82,0x8c,0x82,0x75,0xcd,0xcd,0xee,0x36,0x26,0xf2,0xc8,0xcb,
-
-    // Record 73: Address = 0x3480, Length = 128
-    0x3480,0x80,
-    0xf8,0xc5,0xb1,0xb7,0x8f,0xb8,0x67,0x16,0x6e,0xc9,0x36,0x57,0xab,0xcf,0xc2,0x2c,
-    0x31,0x59,0x57,0xf3,0x45,0xae,0x2a,0x8d,0xca,0xbe,0x36,0x3b,0x11,0x9a,0x82,0x86,
-    0x6f,0x2f,0x96,0x35,0xec,0xfb,0x41,0xfd,0xf5,0x44,0x45,0xdd,0x37,0x13,0x2c,0x2a,
-    0x32,0xc6,0x7b,0xef,0xfa,0xf2,0x6b,0x1b,0xe7,0xf5,0x55,0xf,0x74,0x16,0xe8,0x1a,
-    0x8,0xb6,0x6d,0xe,0xa,0xc3,0x40,0xdb,0xde,0xcf,0xc7,0xeb,0x85,0x76,0xe5,0x54,
-    0xf6,0xfd,0xbb,0xd7,0xcd,0x50,0x3d,0x35,0x7c,0xc4,0x83,0xa9,0x9d,0x71,0x5f,0xe0,
-    0x66,0x7a,0x40,0x17,0xe3,0xf4,0xdf,0x29,0x64,0x6d,0xf5,0x41,0xeb,0xc8,0x1,0x67,
-    0x43,0x74,0x85,0xb5,0xb8,0x70,0x32,0xa4,0xf,0xad,0x79,0x88,0x22,0xd7,0xf1,0x55,
-
-    // Record 74: Address = 0x3500, Length = 128
-    0x3500,0x80,
-    0xe8,0x26,0xee,0xb2,0x3,0x1d,0xe1,0xb8,0xae,0xd1,0xf7,0xb7,0xa1,0x2f,0xe,0x7b,
-    0xf5,0xdd,0xf9,0x72,0x95,0x13,0x2a,0xb4,0x48,0xe8,0x1b,0xe5,0x2d,0x51,0x8b,0x88,
-    0xfb,0x72,0x4d,0x62,0xfc,0xc6,0x49,0xc7,0x77,0xdc,0x9f,0xd9,0x13,0x3c,0xda,0xff,
-    0x30,0x80,0x3a,0xb0,0xdf,0xdf,0x26,0x3f,0xe8,0xe2,0xab,0xa9,0x22,0x48,0x60,0x43,
-    0xd9,0xd3,0xf9,0x0,0xc9,0x2a,0xd7,0xde,0x97,0xc2,0x37,0xa5,0xa8,0x39,0xbc,0xe2,
-    0x11,0xa0,0xd0,0x61,0xfa,0xec,0x96,0xf2,0x9c,0xa6,0xd2,0x13,0x8a,0x32,0xc1,0x9d,
-    0x18,0x9b,0xe8,0xbb,0x20,0x35,0x83,0xe0,0x6c,0xca,0x35,0xd9,0x4b,0xf3,0x48,0xe2,
-    0x58,0x70,0xdc,0x54,0xb3,0xfe,0x16,0x9d,0x37,0xba,0x47,0xb8,0x58,0xde,0x30,0x6f,
-
-    // Record 75: Address = 0x3580, Length = 128
-    0x3580,0x80,
-    0xb2,0x1,0x46,0x3a,0xb1,0xbe,0xf7,0x58,0x7c,0x63,0xf7,0x71,0xd1,0xb9,0x87,0xb1,
-    0x57,0x8d,0xf4,0x31,0x73,0x21,0x65,0x8f,0x7c,0xa8,0x31,0xfe,0x69,0x70,0xf1,0x93,
-    0x7,0x9d,0xfc,0x4a,0x27,0x41,0xa9,0xee,0x0,0x15,0xfe,0x2d,0xf5,0x17,0x98,0xd1,
-    0x5d,0x2d,0xd7,0x99,0x3c,0x92,0xf0,0xbd,0xdb,0xfe,0x9,0x2f,0xc7,0xe3,0xd3,0x37,
-    0xca,0x58,0x39,0xbc,0xc5,0xe4,0xc7,0x1e,0x98,0xf6,0xf6,0x4c,0x77,0x5,0xa5,0x58,
-    0xa8,0x43,0xaf,0x80,0x30,0xdc,0x2a,0x1,0x33,0xad,0x52,0x74,0xb1,0xc1,0x21,0x3d,
-    0xb4,0xe1,0x8e,0x44,0xcf,0x9,0x36,0x59,0xa7,0x35,0xd8,0x50,0xd3,0x94,0x1c,0x8f,
-    0xb8,0x56,0x63,0x35,0xbb,0x10,0x31,0x4b,0x3d,0xaa,0xa,0xf9,0x15,0xbe,0xef,0xfc,
-
-    // Record 76: Address = 0x3600, Length = 128
-    0x3600,0x80,
-    0x9d,0x4,0xe6,0x66,0xa2,0xba,0x90,0x5b,0x27,0xb,0xb9,0x1b,0x3b,0x61,0xa0,0xc4,
-    0x96,0x1d,0xec,0xaa,0xef,0x16,0xa2,0xad,0x51,0xae,0x3,0x63,0x7d,0x65,0x3e,0xf8,
-    0xaa,0x3e,0x51,0x8b,0x24,0x9e,0xa4,0xa8,0x45,0xdd,0x82,0xca,0x1,0x19,0x6d,0x21,
-    0x2c,0x75,0xbe,0x6c,0xc5,0x41,0xbe,0x5b,0x57,0x72,0x49,0x12,0x20,0xa0,0x1d,0x67,
-    0xdf,0x6c,0x39,0x74,0x48,0x27,0x3f,0xc2,0x39,0xc7,0xe7,0x2f,0x4,0x7e,0x2a,0x21,
-    0x66,0x70,0x79,0x0,0xb1,0xa9,0xf3,0xcb,0xa1,0xd4,0xff,0x6f,0x54,0x7b,0xf0,0x7e,
-    0xc0,0x9c,0x8e,0xec,0x7d,0x72,0x94,0x9c,0xbb,0xd6,0x20,0x16,0x6c,0x7c,0xff,0xc3,
-    0x56,0xd5,0xe5,0xe0,0x3c,0x9d,0xbb,0x90,0x2a,0xae,0x39,0xb,0x16,0x44,0x83,0xb2,
-
-    // Record 77: Address = 0x3680, Length = 128
-    0x3680,0x80,
-    0xf7,0xa2,0x68,0x1e,0x8e,0x34,0xf6,0x79,0x3,0xb4,0x41,0x4f,0x47,0xa2,0x14,0xf3,
-    0x81,0xd0,0xa2,0x53,0x3b,0x87,0xf2,0x7f,0x4b,0xe,0xc2,0x23,0x87,0x63,0x2,0x14,
-    0xb1,0x5c,0x1d,0x5,0x52,0x61,0x6b,0x49,0x87,0xda,0x23,0xef,0xf0,0xe,0xe0,0x1e,
-    0x36,0xe0,0xdc,0xc6,0x79,0x7,0x62,0x41,0xe8,0xae,0xe8,0x5c,0x96,0xfc,0x8a,0xbe,
-    0x42,0x24,0xd8,0x79,0x8f,0x50,0xf6,0x69,0x58,0x68,0x67,0x48,0xfa,0xab,0x7,0xb7,
-    0x8d,0x43,0x3d,0x52,0x6e,0x3c,0x8b,0xfe,0x80,0x56,0xb5,0xa1,0x5,0x65,0x49,0xc,
-    0x27,0x73,0x29,0xd1,0xdb,0xbc,0xc1,0x4c,0xe,0xf8,0x12,0x29,0xdd,0xa7,0x5b,0x55,
-    0x67,0xc6,0xb6,0xd5,0x5,0x4e,0x2b,0x57,0xa7,0xb8,0x4a,0x5,0xef,0x7a,0x78,0xfa,
-
-    // Record 78: Address = 0x3700, Length = 128
-    0x3700,0x80,
-    0x56,0x1,0x68,0x1f,0x2d,0xec,0x79,0xe5,0xaf,0x47,0x17,0x53,0x8b,0x5c,0x8,0xd0,
-    0xfc,0xf4,0x12,0x66,0xbb,0x5a,0xea,0x86,0x40,0x61,0xc9,0x88,0x17,0x1a,0xd3,0x2,
-    0xde,0x6a,0x2c,0xe6,0xd6,0xa3,0x48,0x8b,0xe7,0x4f,0x89,0xda,0xb2,0x63,0x82,0x8,
-    0x3d,0xde,0x2,0x8a,0x3b,0xd8,0x46,0x41,0x9f,0xcd,0xfd,0xe2,0x8c,0xc4,0xc2,0xf6,
-    0x14,0xc1,0xc1,0x95,0xf,0xa8,0x35,0x11,0xc8,0xa2,0xff,0xd7,0x63,0x44,0x3b,0x8,
-    0x5f,0x3d,0x7,0xc2,0xf8,0x4e,0x86,0x7c,0x2d,0xfb,0x95,0xf7,0xc1,0xa0,0xf6,0xcc,
-    0x7c,0x50,0x35,0x7e,0xd3,0x64,0x7,0xa5,0xaa,0x1d,0x94,0x25,0xf0,0x25,0x7a,0x5c,
-    0xa8,0x85,0x4f,0x4,0xbb,0xd4,0x6,0x8d,0xfd,0xe9,0xa,0x24,0x92,0x1e,0x2e,0x52,
-
-    // Record 79: Address = 0x3780, Length = 128
-    0x3780,0x80,
-    0x10,0x10,0x9b,0x98,0xe1,0xaf,0x13,0x51,0x6c,0x51,0xf9,0xac,0x5,0x94,0xe5,0x9,
-    0x0,0xe9,0x95,0xae,0x88,0x28,0x59,0xd1,0xd,0xe7,0x4b,0xa8,0xf5,0x2d,0xd3,0x7e,
-    0xb,0xf1,0x15,0x8e,0x82,0xc2,0xd5,0x5a,0x1d,0x65,0x87,0xd9,0x48,0x71,0x8d,0xe8,
-    0x89,0xfa,0x71,0xb4,0xd,0x13,0x27,0xa5,0x17,0xd9,0xe9,0xe8,0x36,0x6b,0x30,0x68,
-    0x62,0xe7,0x3e,0xb5,0x8b,0x11,0xc2,0x5a,0x99,0x82,0x2,0xbf,0xb4,0xfc,0x38,0xe6,
-    0x38,0xe3,0xe4,0x0,0xd4,0x44,0x9d,0x86,0x9c,0xda,0x2b,0x31,0xdc,0x5e,0xa3,0x92,
-    0x45,0xb5,0x7d,0x24,0xc,0x84,0xe8,0xc2,0x6b,0xc5,0xc0,0xa1,0x8f,0xd8,0x21,0x23,
-    0x97,0x9e,0x6d,0xd4,0x2a,0x74,0x5,0xda,0xe,0xb4,0xc4,0x2,0x89,0x46,0xc3,0x50,
-
-    // Record 80: Address = 0x3800, Length = 128
-    0x3800,0x80,
-    0x93,0xc2,0x82,0x75,0xda,0xf1,0x1b,0xa9,0xec,0xf7,0xc7,0x55,0xeb,0x1d,0xb4,0xc6,
-    0x88,0x84,0x26,0x11,0x28,0xba,0x45,0xf1,0xa3,0x81,0x70,0x4a,0x57,0x36,0xce,0x69,
-    0x7a,0x7,0xbc,0xbb,0x85,0xd9,0xad,0x92,0x16,0xe1,0x8c,0xfb,0x4e,0x38,0xd3,0xfe,
-    0x39,0xa2,0x8a,0x98,0x42,0x47,0x83,0xcf,0x5d,0x86,0x91,0x16,0x1c,0xb9,0xd4,0xdf,
-    0xb3,0xf5,0xa3,0x36,0x73,0x2c,0xbb,0x83,0x9a,0xa9,0x2a,0x44,0xb9,0x51,0x29,0x70,
-    0xdd,0x2f,0x58,0xad,0x3,0xca,0x9a,0x7d,0x89,0x9,0x9,0x1a,0xa0,0xf4,0x50,0x68,
-    0x1c,0xb3,0xe7,0xd5,0x94,0x82,0xc3,0x55,0xf5,0xda,0x0,0x7a,0x5,0x33,0x11,0x82,
-    0x7a,0xc3,0x6c,0x6,0x39,0x88,0x88,0xb8,0xeb,0xe3,0xc2,0xa3,0x57,0xa1,0xeb,0x31,
-
-    // Record 81: Address = 0x3880, Length = 128
-    0x3880,0x80,
-    0x9f,0x9b,0x9,0xa5,0x4a,0x83,0xb,0xf4,0xbb,0xfb,0x56,0x8a,0x26,0x90,0x1d,0xc2,
-    0xdc,0x88,0xb8,0xb7,0xb7,0x7f,0x32,0x72,0xb4,0xea,0x55,0x88,0x9d,0xcd,0xe7,0x1d,
-    0x8e,0xce,0x17,0x2f,0x99,0xd7,0x4b,0x11,0xbb,0xe1,0x7e,0x4f,0x37,0x83,0x26,0x75,
-    0xe,0x37,0x44,0xe5,0x21,0x27,0xc4,0x5d,0x2a,0xfa,0x3e,0x74,0xc6,0x48,0xaa,0xa2,
-    0x98,0xa4,0x90,0x17,0x5a,0xf7,0x87,0xed,0x6c,0xc4,0x95,0x88,0x73,0xe5,0xe0,0x37,
-    0xe2,0x51,0x81,0x70,0x29,0xe5,0x56,0x82,0x55,0x31,0x3a,0xa,0x87,0x29,0xbd,0x7c,
-    0x69,0xc6,0x31,0xaa,0x9d,0x52,0x5a,0x94,0xe6,0xbb,0xf3,0x3a,0xad,0xf7,0xd7,0x55,
-    0x1b,0x20,0x83,0xdb,0x2a,0xd4,0xd6,0xef,0x75,0xa6,0x5c,0x51,0x6d,0x94,0xa9,0x7c,
-
-    // Record 82: Address = 0x3900, Length = 128
-    0x3900,0x80,
-    0x96,0xc7,0xbb,0x53,0x55,0xde,0xed,0x41,0xfb,0xfa,0xff,0xfa,0x98,0xe1,0xac,0x38,
-    0x6f,0x95,0xe,0x39,0xf3,0x73,0xdb,0xe8,0x86,0x17,0x1e,0xf3,0x6,0xc6,0x39,0x3a,
-    0x3b,0x48,0x5c,0x86,0x62,0xef,0x2,0x63,0x67,0x8f,0x54,0x99,0xbc,0x1d,0xee,0x98,
-    0x16,0x7,0x99,0xc7,0x85,0x5c,0x3b,0x41,0x24,0x23,0x9c,0x8d,0xde,0x53,0x21,0x3b,
-    0xe1,0x2f,0xa5,0x5b,0xe7,0x5e,0xf8,0x25,0xdc,0xaf,0xe9,0xab,0x17,0xfa,0xd9,0x1b,
-    0x16,0xed,0xb7,0xcc,0xf9,0x58,0xd1,0xcd,0x4d,0xc8,0x4d,0xfb,0x38,0x1f,0xd7,0x3e,
-    0xc5,0xfb,0x1,0xe3,0xaa,0x80,0xa3,0x4d,0xdb,0xd0,0x4d,0xb2,0x53,0x7d,0x26,0xb,
-    0x32,0x4f,0xe8,0xe2,0x66,0xc3,0x52,0xa1,0x10,0xe7,0x7b,0xac,0x37,0x77,0x22,0xa1,
-
-    // Record 83: Address = 0x3980, Length = 128
-    0x3980,0x80,
-    0xf8,0x75,0x6e,0x11,0x88,0x1a,0x59,0x85,0x4,0x33,0x17,0xe7,0x10,0xc7,0x3e,0x3f,
-    0x21,0xaf,0x9a,0xce,0x8a,0x4c,0x96,0x65,0x35,0xe3,0x70,0x99,0x1e,0x4d,0x33,0xe,
-    0x79,0xee,0xe1,0x22,0x9d,0x7b,0x9c,0x9f,0xa5,0xfc,0x92,0xb2,0xf8,0xdc,0xdd,0x9a,
-    0xd3,0xd5,0xfe,0xfb,0x72,0xae,0xc4,0x17,0x29,0x2f,0xdf,0x44,0x5a,0xc5,0x67,0x83,
-    0x78,0xdd,0xdf,0xf7,0x5a,0x6a,0x13,0xe3,0x86,0x3e,0xdc,0x65,0x68,0x9e,0xcd,0x7e,
-    0xe,0x84,0xb2,0xa,0x4b,0xb8,0x54,0xdd,0x18,0xd4,0xa6,0x1b,0xc7,0x74,0x2e,0x46,
-    0xcd,0x8,0x24,0x87,0x7f,0x13,0xc8,0x81,0xb9,0x2,0x78,0x77,0x4c,0x6b,0x10,0x91,
-    0x1d,0xb6,0x58,0x50,0x74,0xb9,0xc2,0x6,0xcc,0x28,0x3d,0x61,0x7a,0xa0,0xb,0x8b,
-
-    // Record 84: Address = 0x3a00, Length = 128
-    0x3a00,0x80,
-    0x5c,0xe5,0xc5,0xf5,0x9d,0x59,0x92,0xe5,0x99,0xc5,0x0,0x17,0x2b,0x4e,0xb1,0xe4,
-    0x3d,0x30,0x54,0xad,0x90,0x37,0x7e,0xb9,0xdc,0xb3,0x7f,0xd5,0x5,0xd2,0x8b,0x20,
-    0x68,0xd7,0x5c,0x8d,0x27,0x95,0xb,0x60,0xa5,0x55,0xc2,0xb0,0x8c,0x55,0xa5,0x3d,
-    0x1f,0x55,0x44,0xe9,0x5e,0xce,0xed,0xdd,0xef,0x18,0xb9,0x5d,0x4,0xe3,0xdb,0x64,
-    0x6a,0xce,0xf,0x9b,0x19,0x86,0xe8,0x9c,0x4e,0x9,0x5e,0x76,0xbe,0xb2,0x83,0x45,
-    0xd0,0x77,0x6e,0x32,0x99,0xf1,0x0,0xb7,0x90,0x75,0x91,0x93,0x30,0x76,0xd3,0x9f,
-    0x84,0x3c,0x8e,0xb4,0xe4,0xaf,0x44,0x7f,0xe6,0x10,0x8f,0xd6,0x13,0xe9,0x20,0x29,
-    0x78,0x54,0xef,0xaf,0x4a,0x25,0xea,0xf9,0x78,0x68,0xdc,0x83,0x57,0xec,0x22,0xa1,
-
-    // Record 85: Address = 0x3a80, Length = 128
-    0x3a80,0x80,
-    0xcc,0x36,0xc9,0xa0,0xd0,0xca,0xfb,0xfc,0xd3,0x2c,0x73,0xde,0x35,0x1f,0xa7,0x98,
-    0xfd,0x9,0xb,0xa,0xf9,0x6,0x8b,0xcf,0x96,0x2,0xd6,0x74,0x45,0xd,0xc2,0xec,
-    0x3e,0xf4,0xa7,0x67,0x43,0x20,0x41,0x43,0x16,0x3c,0x93,0xa1,0xc9,0x6d,0x79,0x43,
-    0x6c,0x5d,0xe7,0xf1,0xad,0x4f,0x5b,0xf7,0xc5,0x8b,0x20,0xdb,0x9b,0xd7,0xd6,0x1,
-    0x1d,0x8b,0x19,0x5b,0xc5,0x2b,0xd9,0x1d,0xff,0xcf,0xa,0x89,0x7e,0x9f,0xe6,0xa9,
-    0x28,0x61,0xee,0x4d,0x64,0x75,0x94,0x8c,0x58,0x48,0xf5,0xee,0xa,0xb9,0xa7,0x3b,
-    0xe,0x28,0x7d,0x4b,0x11,0x49,0x11,0x52,0x42,0x8c,0x2,0x69,0xdc,0x5a,0x64,0xbf,
-    0xbc,0x34,0xde,0x6a,0xcf,0xd8,0xf3,0x16,0xec,0xe4,0x22,0xf4,0x1e,0xc1,0xc1,0xb4,
-
-    // Record 86: Address = 0x3b00, Length = 128
-    0x3b00,0x80,
-    0x10,0xff,0xfc,0x74,0x8f,0xc7,0xc6,0xa0,0x33,0x91,0x51,0x39,0xe3,0xfb,0x3c,0x53,
-    0x5a,0xcd,0xaf,0x15,0xf,0x77,0x97,0xc5,0x23,0xb3,0xdf,0xf8,0xf4,0xea,0x83,0x1e,
-    0x25,0xde,0x2a,0xed,0x59,0x3c,0xdd,0x1d,0xa8,0x35,0xaa,0xdf,0x14,0xd2,0x2f,0x57,
-    0xdb,0xcc,0x3e,0x76,0x9b,0xa0,0xff,0x2f,0x45,0xc2,0x21,0x8f,0xb8,0xa9,0xe4,0x6d,
-    0xdb,0x65,0x27,0x21,0x90,0x86,0x18,0xf0,0xf9,0x32,0x53,0x99,0x20,0x48,0xa9,0x82,
-    0x6c,0x73,0x4a,0xa2,0x21,0xfe,0xde,0xd1,0x8a,0xe6,0x9b,0x82,0x8b,0x63,0x98,0x5b,
-    0x4e,0x17,0x16,0x9c,0x7,0x9e,0x7f,0x76,0x87,0xb0,0x54,0x9,0xfa,0x40,0x81,0x36,
-    0x90,0x45,0xa6,0x6e,0xa9,0x46,0xf3,0xc,0x6,0x1d,0xcf,0xb8,0xf3,0xaf,0x1b,0x51,
-
-    // Record 87: Address = 0x3b80, Length = 128
-    0x3b80,0x80,
-    0x9b,0x32,0xdb,0x1d,0x96,0x9e,0x80,0x76,0x2e,0x8d,0x1,0x99,0x97,0x26,0x9c,0xb7,
-    0xca,0xda,0x42,0x7c,0x2c,0x27,0x66,0x5f,0x2f,0x49,0x4b,0xb4,0x1c,0x4c,0xe8,0x18,
-    0xd0,0xac,0x69,0x48,0x1,0x52,0xe,0x58,0xae,0xb8,0x98,0xd1,0xd0,0x26,0x4,0x55,
-    0xf,0xc1,0x43,0xcc,0xf2,0xe2,0xfa,0x2c,0xd4,0xa4,0xb3,0xe2,0xe1,0xe6,0xe2,0xc7,
-    0xbf,0xb0,0x44,0x4e,0xc7,0x6c,0x47,0x18,0x10,0x21,0x78,0x96,0x19,0x1e,0x9e,0xa,
-    0x77,0x92,0x8d,0xca,0x8f,0x6c,0xdf,0x92,0xfd,0xd2,0xcf,0x1e,0x17,0x21,0x8a,0x66,
-    0x36,0x59,0xb,0x97,0xda,0x84,0x26,0xab,0xff,0xb7,0x1,0x41,0x40,0x7f,0xb6,0xfa,
-    0xe8,0x33,0x68,0xc7,0x86,0x4d,0x98,0xe4,0xb,0xf0,0x63,0xc1,0x96,0xd,0x20,0xbb,
-
-    // Record 88: Address = 0x3c00, Length = 128
-    0x3c00,0x80,
-    0x76,0xf1,0xf,0xcc,0xd7,0xcb,0xc0,0x41,0x12,0x7b,0xb1,0x92,0x3,0x3d,0xb6,0xa1,
-    0x7e,0x4e,0x86,0x93,0x8b,0xc,0x51,0xcd,0xc3,0xc4,0x98,0xe0,0xe1,0xac,0x2f,0x16,
-    0x28,0x64,0x49,0x75,0x49,0x30,0x89,0xe,0x95,0x9d,0x78,0x7,0xcc,0x4b,0xbc,0xb8,
-    0x6f,0xaf,0x9f,0x48,0x76,0x82,0x53,0x2b,0x77,0x76,0x2e,0x1b,0x26,0xa0,0xd5,0x24,
-    0xe4,0x95,0x3d,0x25,0x6a,0xea,0x77,0xa6,0xbe,0x15,0x6f,0x5e,0xe8,0xb2,0xd3,0x90,
-    0xbc,0xa0,0x71,0x0,0xa9,0x50,0x18,0x71,0x59,0x88,0xa0,0x89,0xfa,0xd6,0xf9,0xaa,
-    0xa6,0x81,0xfd,0x7e,0x6,0xc3,0xa2,0x33,0xf6,0x4f,0x82,0xda,0x53,0xab,0xb2,0x51,
-    0x7e,0xce,0xba,0xef,0x19,0x54,0x3c,0x7f,0xba,0x5f,0x9c,0xc,0x4c,0x7,0x18,0x61,
-
-    // Record 89: Address = 0x3c80, Length = 128
-    0x3c80,0x80,
-    0xb4,0xfd,0x2b,0xc8,0xdd,0xa6,0x29,0xaa,0xcd,0xac,0xd,0x61,0xb9,0x90,0xda,0x37,
-    0x39,0x12,0x99,0xdb,0x4c,0x55,0xfb,0x0,0xf6,0x2,0xe9,0xfb,0xd1,0xc,0xf8,0xca,
-    0x2b,0x2d,0x75,0xb8,0x30,0xb8,0x4f,0x97,0x7d,0xc1,0xfe,0xd9,0x29,0x27,0x3a,0x42,
-    0x58,0xea,0xd4,0x9d,0x46,0xd4,0xfe,0x1b,0x7f,0x27,0x1a,0x3,0x63,0x1e,0xa3,0xf,
-    0x69,0x6b,0x5d,0xe2,0x8d,0xf7,0xe,0x79,0x18,0xf9,0xe3,0x5f,0xee,0x51,0x70,0xe2,
-    0xf1,0xa4,0x3e,0xb8,0x40,0xaa,0x81,0xec,0xdd,0x51,0x25,0xda,0x29,0x93,0x8d,0x30,
-    0x11,0x15,0x1a,0x8b,0xc1,0x6a,0x6b,0xf0,0xed,0x7c,0x88,0x6b,0xd1,0xe8,0xbb,0xe5,
-    0x4b,0xfa,0x2,0xd6,0x50,0xa2,0x32,0xa3,0x60,0x49,0x84,0x7c,0xca,0xb3,0x96,0x26,
-
-    // Record 90: Address = 0x3d00, Length = 128
-    0x3d00,0x80,
-    0x36,0x2e,0xd8,0xe7,0x7f,0x1,0xa0,0xd9,0x96,0x8c,0xfd,0x68,0xd,0x86,0xe0,0xb7,
-    0xbf,0x60,0x3,0xb7,0x7d,0xa1,0xa8,0xdc,0x71,0x4f,0x4,0x61,0x61,0x45,0x78,0x8c,
-    0x49,0x7b,0x67,0x30,0xd4,0x96,0x7,0x38,0x2e,0x9f,0x15,0x8,0xc7,0xd9,0xa3,0xa5,
-    0xa2,0x37,0xe6,0xcd,0x3,0x2a,0xd3,0xcb,0xd8,0x1e,0xa6,0x12,0x42,0xfe,0x7,0x60,
-    0x36,0x4e,0xe9,0x4,0x7f,0x41,0xd3,0x70,0x6a,0x3e,0x51,0x92,0xfd,0xab,0xf6,0xb0,
-    0x83,0x4e,0xdf,0xce,0xc4,0x4d,0xce,0xac,0xd7,0xd9,0xb0,0xf6,0xb9,0xbe,0x4e,0x27,
-    0xaf,0x7e,0xf,0xee,0xa8,0xe2,0xe5,0x8,0xf0,0x93,0xab,0x8c,0x35,0x1a,0x6,0xaa,
-    0x10,0x9b,0x78,0x9e,0xd0,0xe9,0x19,0xc5,0xc0,0x9b,0xe5,0x8d,0xa5,0xda,0x4e,0x44,
-
-    // Record 91: Address = 0x3d80, Length = 128
-    0x3d80,0x80,
-    0x55,0xd7,0x7,0xbd,0x3e,0xdc,0x49,0xe9,0x84,0xbf,0x1f,0x5,0xea,0xee,0xec,0x38,
-    0x33,0x7d,0x58,0xdf,0x90,0x96,0xb0,0x7d,0x37,0x45,0xda,0x7f,0x1b,0x9d,0x9e,0xb6,
-    0xa7,0x36,0xc8,0x58,0x1,0x71,0x98,0x9,0xad,0xa1,0x78,0x3d,0x7d,0x80,0x92,0xac,
-    0x9a,0x36,0xac,0xb3,0xe3,0xf0,0x28,0x89,0x68,0x3d,0x79,0x71,0xe4,0x9,0xe,0xc4,
-    0x2b,0x92,0x9e,0x92,0xec,0x97,0x17,0x68,0xa1,0xc0,0x20,0xd0,0x2a,0x24,0x36,0x21,
-    0xb1,0x1a,0x25,0xb0,0xe9,0xba,0xd,0xb,0xdb,0x2c,0x5f,0x7,0x3b,0x8d,0xa8,0x6b,
-    0x12,0xba,0x75,0x4d,0x2b,0x1,0x88,0x39,0x1a,0x48,0xd,0x88,0x78,0x4,0xd,0xb7,
-    0xba,0x3b,0xcd,0xc5,0xd3,0xf8,0xb5,0xd9,0x85,0x18,0x26,0xf2,0xb2,0xba,0x15,0x57,
-
-    // Record 92: Address = 0x3e00, Length = 128
-    0x3e00,0x80,
-    0x79,0x2e,0x38,0x19,0xfb,0x4,0x54,0x81,0x9,0x63,0x16,0x67,0x15,0x7d,0xb5,0x54,
-    0x2b,0xfa,0x30,0x90,0xf5,0x4d,0x21,0xe,0x58,0xa9,0xe4,0xd8,0xd8,0xc1,0x5a,0x66,
-    0xbc,0x39,0xe8,0x24,0xd9,0x55,0x1e,0xba,0x3,0xd5,0x4d,0xc5,0x53,0x57,0x7b,0x7e,
-    0x42,0x5e,0xc6,0x4b,0x30,0x20,0x59,0xc2,0xc2,0xef,0x77,0x7e,0x26,0x48,0x51,0x1a,
-    0x2c,0x40,0x45,0xc3,0xd8,0xdb,0xe0,0x6c,0x27,0xae,0xa9,0xa5,0xbd,0x65,0x34,0x40,
-    0xf1,0xf0,0xb3,0x2c,0x98,0xd0,0x22,0x51,0x78,0x51,0x8e,0x5c,0x9d,0x3f,0x8b,0xee,
-    0x2a,0x10,0x7f,0x90,0x5,0xb4,0x17,0x39,0x92,0x9f,0xcb,0x95,0x32,0x71,0x9b,0xe3,
-    0xd6,0xa0,0x4a,0xff,0x23,0x8a,0xa3,0xa8,0x55,0xa8,0xd4,0xa8,0xbc,0xe9,0x88,0x48,
-
-    // Record 93: Address = 0x3e80, Length = 128
-    0x3e80,0x80,
-    0xdc,0xd1,0xd9,0xc7,0x8a,0xfd,0x37,0xe8,0x5b,0x6a,0x23,0x30,0xf7,0x75,0x64,0x67,
-    0xa4,0xb7,0x4c,0x26,0x72,0x5a,0xf0,0x9a,0xb0,0x53,0x53,0x3d,0x9e,0xa3,0x1f,0xad,
-    0x2f,0x72,0x55,0xd0,0x6a,0xc0,0xf0,0x8a,0x3f,0x29,0xca,0xea,0x97,0x5c,0x7d,0x66,
-    0xe6,0xe,0xd8,0x4,0x14,0x6a,0x7c,0x52,0x33,0xb7,0xb5,0x36,0x68,0x58,0xcd,0x89,
-    0x1b,0x90,0x4a,0x3,0x2a,0x6b,0xce,0xd3,0x63,0xa4,0x67,0x10,0xe1,0x8e,0xbc,0xf,
-    0x89,0xe4,0x2b,0xbe,0x32,0x1f,0x5,0x6f,0xfb,0x7e,0x3f,0x10,0x8c,0x59,0x40,0xb6,
-    0xaf,0x27,0x5,0x89,0xa5,0x3,0xc0,0x82,0x74,0x6a,0xef,0x78,0x1e,0x19,0x17,0x35,
-    0xbc,0x19,0x1,0x15,0x46,0x82,0xa,0xb9,0x48,0xdd,0xe0,0xd,0xe9,0x2f,0x2b,0x61,
-
-    // Record 94: Address = 0x3f00, Length = 128
-    0x3f00,0x80,
-    0x1e,0xc,0x52,0x3e,0x5f,0xfe,0xe,0x1a,0xa4,0x51,0xf3,0x19,0xd4,0x7b,0xd6,0x21,
-    0x22,0x15,0x22,0x3d,0xaa,0x5a,0xac,0xeb,0x1c,0x87,0x97,0x2e,0x74,0x95,0xba,0x26,
-    0x1,0xb5,0x70,0xc0,0x23,0xec,0x46,0x73,0x2f,0x43,0x25,0x5f,0x93,0x1a,0xb1,0xa6,
-    0x32,0xee,0x7d,0xe4,0xc0,0x17,0xd5,0xad,0x7,0xe2,0x24,0x9a,0x8e,0x4e,0xa8,0x33,
-    0x78,0x3f,0xeb,0xce,0x4a,0x5a,0x73,0xae,0x63,0x79,0xd3,0x7e,0xbe,0x46,0xae,0x29,
-    0xb2,0x97,0xae,0xb9,0xd1,0xac,0x38,0x52,0xa5,0x4,0xbf,0x6a,0xed,0xfd,0x43,0x54,
-    0x53,0xe0,0x39,0x4a,0xb4,0xcd,0xe5,0x12,0xcf,0xdf,0x70,0x3d,0x23,0x4a,0x3b,0x0,
-    0xd7,0xd,0xc6,0xdf,0x44,0x30,0xc2,0x87,0x58,0x89,0x7f,0xca,0xa4,0x76,0x4e,0xa9,
-
-    // Record 95: Address = 0x3f80, Length = 128
-    0x3f80,0x80,
-    0x42,0x85,0xb0,0xb4,0xdc,0x62,0xda,0x7a,0xa4,0x63,0x8e,0x7a,0x85,0xfd,0x93,0x6a,
-    0x45,0xd8,0x36,0xe9,0x9f,0x2e,0x81,0x56,0xa6,0xf5,0x99,0xec,0x2c,0x83,0xd1,0xf3,
-    0xc2,0x95,0x22,0xba,0x9e,0xd8,0x53,0x88,0x85,0x27,0x9d,0xf2,0xc6,0x6c,0xc6,0x2d,
-    0x40,0x5e,0x85,0x92,0x21,0xbb,0xdc,0xeb,0x93,0xc9,0x26,0x4f,0x9e,0x8,0xc,0x88,
-    0x29,0xda,0x9f,0x31,0xeb,0xc8,0xb,0x90,0xf1,0x21,0xff,0x19,0xb1,0x52,0xba,0xfd,
-    0x36,0xb8,0xcc,0xa0,0xe5,0x8c,0xdb,0xdb,0x79,0x13,0x9b,0xe7,0x8f,0xd1,0xd7,0x30,
-    0xba,0x48,0xb7,0x84,0xc6,0xf4,0x60,0x3,0x4b,0x2c,0x8b,0xe3,0x3,0x50,0x63,0xd7,
-    0x5e,0x64,0x38,0x3a,0x8e,0xed,0xbe,0x1b,0x42,0xe1,0x55,0x9,0x35,0x35,0xb,0xc7,
-
-    // Record 96: Address = 0x4000, Length = 128
-    0x4000,0x80,
-    0x2a,0x19,0xba,0xb6,0xaa,0xc8,0xab,0xf6,0xe9,0xdb,0x28,0x20,0x22,0x50,0x7c,0xac,
-    0x3b,0x1a,0x4d,0xfe,0xe3,0x56,0xa6,0x76,0x7c,0xbd,0x7a,0xef,0xdb,0xe0,0xfd,0xeb,
-    0x3,0xb7,0xdd,0xca,0x85,0xbc,0xe1,0x6c,0x92,0x9c,0x6,0xb6,0xc,0x0,0x64,0xd8,
-    0xc5,0x7,0xb,0x9e,0x77,0x6a,0xa1,0xb2,0x80,0x7,0x4b,0xc0,0x47,0xa0,0x36,0xca,
-    0xc0,0x35,0xfa,0x1b,0x31,0xf8,0xf2,0xd2,0x6d,0xa5,0xce,0x41,0x44,0x2e,0xcc,0x9f,
-    0xb0,0x9,0xa3,0xe4,0x5d,0xd3,0x8e,0xde,0x45,0xa6,0x71,0xd,0xc9,0x56,0x54,0xef,
-    0xda,0x8a,0x9c,0xde,0x77,0x60,0x1c,0x34,0xbf,0xb4,0x59,0xf2,0x87,0xe7,0x57,0x17,
-    0x6,0x4f,0x96,0xc8,0xbe,0x2a,0x2a,0x76,0xed,0x12,0xa4,0x5f,0xfb,0x57,0x80,0x81,
-
-    // Record 97: Address = 0x4080, Length = 128
-    0x4080,0x80,
-    0xd4,0xdb,0xf7,0x90,0x1e,0x6a,0xba,0x4e,0x2b,0xe4,0xe5,0xf3,0x1a,0x2,0x30,0x97,
-    0xaa,0x2d,0x89,0x79,0x8,0x86,0x3b,0x89,0x30,0xe8,0xe2,0x3b,0x10,0x94,0x60,0x80,
-    0xd8,0xfb,0xb7,0x8a,0x3,0x3,0x46,0x2b,0x2e,0x47,0x42,0x5d,0xfa,0xe0,0xd7,0x20,
-    0x8c,0x2e,0xc7,0x53,0x40,0xa2,0x6f,0x51,0x8b,0x46,0x99,0x5f,0x17,0x6a,0xce,0x57,
-    0x9c,0xcf,0x9a,0xe5,0xf8,0x7f,0x2d,0x55,0x65,0x31,0x21,0xb1,0x83,0xf0,0xd3,0x82,
-    0x25,0xca,0x63,0x2f,0x65,0xe,0xf2,0x31,0xe7,0xf5,0xa3,0x21,0x91,0xc3,0x17,0xa,
-    0x97,0x97,0xb2,0xbc,0xb4,0xcc,0xde,0xc4,0xf1,0xf0,0x89,0x1f,0x7d,0x93,0x3b,0xe7,
-    0x52,0x81,0xe3,0xc4,0xe3,0xc1,0x70,0xfc,0xf5,0x97,0x72,0xef,0xd4,0x78,0xa6,0xed,
-
-    // Record 98: Address = 0x4100, Length = 128
-    0x4100,0x80,
-    0xc6,0x44,0xd7,0x22,0xba,0x8,0x8a,0xd,0x4f,0x5d,0x80,0x1c,0x7c,0x7a,0x6f,0x1e,
-    0xeb,0x45,0x7c,0xb8,0xfa,0xfd,0xbe,0xc1,0x92,0xa5,0x3d,0x0,0x1a,0x4a,0xa6,0x65,
-    0xdb,0xa2,0x6c,0xae,0x7c,0x36,0xa2,0xa6,0x58,0x35,0x9d,0x1c,0xd1,0x13,0x6a,0xd,
-    0x68,0xd7,0x8d,0x55,0x44,0xe0,0xef,0x88,0xd7,0x1d,0xab,0x5,0x71,0x1a,0xe2,0x20,
-    0x1a,0xc8,0xd0,0xd0,0x20,0xad,0x85,0xc0,0xba,0x6,0x6b,0x1b,0xa2,0xba,0x8,0x38,
-    0xfa,0x8,0x5f,0x60,0x94,0x2a,0xb4,0x3d,0xa,0xda,0xb0,0x1,0x31,0xf8,0x74,0x49,
-    0x21,0x1,0x28,0xd7,0x31,0x28,0x4e,0xd2,0xcb,0x65,0xe,0x68,0x43,0x25,0x70,0x14,
-    0xa0,0xfb,0x48,0xc5,0xbc,0x20,0xc7,0x8e,0x7f,0xfb,0xe1,0x3a,0x8f,0xf1,0xaf,0x4f,
-
-    // Record 99: Address = 0x4180, Length = 128
-    0x4180,0x80,
-    0xaa,0x74,0x35,0x10,0xeb,0x7e,0x9f,0x8f,0xf8,0xe0,0xa1,0x71,0x21,0x5,0xe7,0x3e,
-    0xe0,0xd5,0xd0,0x2d,0x66,0x8a,0xf9,0xcc,0x32,0x73,0x4c,0xc8,0xc2,0x55,0xba,0x48,
-    0x8a,0x14,0x69,0x38,0xe0,0xf7,0x4d,0xc,0x67,0xb1,0xc2,0xee,0x19,0x55,0xd0,0x37,
-    0x38,0x2a,0xdc,0x14,0x57,0x1,0xf0,0xde,0xa5,0xec,0x28,0xff,0x83,0xef,0xd4,0xb9,
-    0x44,0x95,0xeb,0x8a,0xb5,0x7b,0x1d,0xb2,0x64,0xde,0xcf,0xa0,0x68,0x8,0xea,0x53,
-    0x3b,0x67,0xb7,0x48,0xf2,0xf4,0x81,0xc9,0x17,0xe8,0x61,0x74,0xf3,0xcf,0x4d,0x75,
-    0xba,0x88,0x52,0x4b,0xe8,0xde,0xd9,0xdb,0xfb,0x44,0x39,0xfe,0x7e,0xe5,0xfa,0xf6,
-    0xf,0xb8,0x5,0x48,0xb1,0x2c,0xe4,0x7c,0xc2,0xc0,0xd7,0x34,0x64,0x58,0xc5,0x54,
-
-    // Record 100: Address = 0x4200, Length = 128
-    0x4200,0x80,
-    0x7b,0x97,0x1b,0xd7,0xb5,0x56,0x67,0x2a,0x5,0x90,0x8c,0x90,0xe1,0x7c,0x5d,0xa5,
-    0x33,0xfb,0x83,0x7e,0xbe,0xe7,0x2b,0xac,0x78,0xe7,0x8f,0x8d,0xa6,0xab,0x1a,0x9,
-    0x99,0xd8,0xa6,0xd5,0x7d,0xe9,0xfc,0x36,0x85,0xb9,0x13,0xe3,0x70,0xe4,0xd7,0x8f,
-    0xd8,0xb7,0xbe,0x98,0x6d,0x4c,0xe5,0x25,0xb4,0xa3,0x2c,0x53,0x9e,0x19,0xec,0x5a,
-    0x53,0xa0,0x80,0xd5,0xd7,0x79,0x70,0x5c,0x42,0x7a,0xfa,0x13,0x4e,0x2,0xe6,0xde,
-    0x91,0x82,0xbc,0xdc,0x64,0x2d,0x94,0x9e,0x46,0x37,0x78,0x49,0x58,0x4,0x89,0x95,
-    0x8f,0x8,0x4c,0x46,0xa8,0x48,0x61,0x3d,0xd1,0xae,0x23,0x62,0xfe,0x9f,0x76,0x1,
-    0x1c,0x9a,0x9e,0xc2,0x7,0x57,0x53,0x1,0x66,0x41,0xf5,0xb7,0x17,0xc4,0x59,0x80,
-
-    // Record 101: Address = 0x4280, Length = 128
-    0x4280,0x80,
-    0xb1,0xe1,0xa7,0x57,0x61,0xa3,0x80,0x4a,0x77,0xee,0x72,0xfa,0xed,0x41,0xb2,0x25,
-    0x65,0xe1,0xa2,0x42,0x6d,0x8c,0xa1,0xe5,0xa3,0x7f,0x93,0x80,0x72,0x5a,0xe2,0xa6,
-    0xe2,0x87,0x10,0x37,0x0,0xc0,0xf5,0x81,0xb5,0xbf,0xa3,0xdf,0x21,0x58,0x54,0x3e,
-    0x99,0x5,0xd9,0x4c,0xe8,0x56,0x87,0xf1,0x57,0xbc,0x3e,0x7b,0x25,0xd4,0x17,0x21,
-    0xb7,0xc0,0x19,0xaa,0xf1,0x87,0xf6,0x8e,0x85,0x13,0x80,0x56,0x69,0x4,0x93,0x9e,
-    0x1e,0x67,0xaf,0xa7,0x6a,0xf6,0x93,0x87,0x5,0xd1,0x79,0xd7,0x5c,0xcd,0x3e,0xa5,
-    0x6b,0x43,0xd8,0xa1,0xa4,0xb7,0x1e,0xa3,0x21,0x95,0x11,0xb3,0x4e,0xe4,0x8d,0x50,
-    0x90,0x30,0x77,0x6e,0x5a,0xd,0x2a,0x25,0x9d,0x47,0x89,0xe3,0xb3,0xec,0x3f,0x54,
-
-    // Record 102: Address = 0x4300, Length = 128
-    0x4300,0x80,
-    0x49,0xe7,0x29,0xaf,0x5e,0xbe,0xaf,0xb5,0x69,0x2a,0x67,0x5c,0xe3,0xfd,0x2,0x59,
-    0x99,0xe8,0xdc,0x3e,0x7d,0xfd,0x61,0x69,0x29,0x5e,0x9c,0x9e,0xa2,0xff,0x58,0x86,
-    0x32,0xd8,0x8a,0x77,0xc2,0xcd,0x4d,0x82,0xc5,0x97,0xa4,0x6f,0xfa,0xa4,0xe3,0x64,
-    0x27,0xc7,0x8f,0x4a,0xe3,0x4f,0x71,0xae,0xd7,0x52,0xae,0x1b,0x59,0xc3,0x2e,0xd1,
-    0xfd,0x13,0x96,0x7,0x32,0xb8,0xe2,0xb,0x78,0x52,0xc1,0xcf,0xcb,0x7c,0x5d,0x3e,
-    0x9a,0x21,0x93,0xde,0xe9,0xa9,0x52,0x8,0x75,0xe4,0x3c,0x6d,0xfa,0x3d,0xf8,0x79,
-    0xeb,0x49,0xe4,0x97,0xf3,0xf,0xa3,0xbd,0xa0,0x46,0xd6,0x24,0x1a,0x2a,0x22,0xf7,
-    0x46,0x77,0xe7,0x45,0x73,0x6b,0x34,0x4e,0x2e,0x47,0x12,0xc1,0xbd,0x27,0x53,0x66,
-
-    // Record 103: Address = 0x4380, Length = 128
-    0x4380,0x80,
-    0xe0,0x17,0xc8,0xb,0x75,0x4c,0x5c,0xcd,0x8a,0x80,0x1c,0x61,0x1,0x7b,0xe8,0xbe,
-    0x5,0x4d,0x60,0xf3,0xd3,0xb9,0x3e,0xab,0xb0,0x35,0x1e,0x77,0x14,0x4e,0xb2,0xe2,
-    0xb7,0xc6,0x2a,0xa2,0x5,0x66,0x85,0x9e,0x83,0x78,0x95,0x58,0x2e,0x9d,0x20,0x44,
-    0xa8,0x90,0xf6,0xae,0x92,0x58,0x2,0x4f,0xd,0xa3,0xf5,0x2e,0xee,0xca,0x99,0xa2,
-    0x29,0x56,0xa3,0x97,0xe8,0x46,0xda,0x39,0xed,0xe9,0xa7,0x4a,0x89,0xf5,0xf3,0x86,
-    0x92,0xce,0xe3,0xae,0x35,0x17,0x57,0x42,0x4b,0x82,0x12,0x80,0xc1,0x7d,0xff,0x40,
-    0x8b,0x64,0x44,0x19,0xb6,0x98,0xc9,0xa7,0x6a,0xd0,0xde,0x5f,0x8,0xcc,0x84,0xd4,
-    0x27,0xbc,0x3b,0xd,0xb5,0x66,0x22,0x56,0x39,0xe9,0x71,0x6c,0x6d,0x72,0xe8,0x41,
-
-    // Record 104: Address = 0x4400, Length = 128
-    0x4400,0x80,
-    0xbb,0x9a,0x91,0x29,0x0,0x3b,0xcc,0x55,0x30,0xc,0xdc,0x21,0x35,0x89,0x4a,0xae,
-    0x88,0x53,0xdc,0xc3,0xe6,0x24,0xa5,0x65,0xce,0xdb,0x50,0xf9,0x37,0xf2,0x99,0x62,
-    0x9d,0xb7,0xa7,0x79,0xd0,0xf1,0x41,0xd5,0xd0,0x7e,0xbf,0x64,0x3a,0xe2,0x5f,0x7,
-    0x9d,0x24,0x52,0x8d,0x2a,0xdf,0x46,0x24,0x8b,0x85,0x2b,0x8a,0x29,0xf8,0x1b,0x80,
-    0xfe,0xb1,0x57,0x21,0x6d,0x18,0xf1,0x61,0x9,0xa5,0x0,0xe8,0x88,0x4c,0x13,0xf4,
-    0x1f,0x9,0x9,0x91,0x47,0xb1,0xc9,0x8,0x8a,0xf6,0x35,0x38,0x3e,0x50,0xb5,0xec,
-    0x23,0xb5,0xc9,0xc5,0xa9,0xb0,0xde,0x5b,0x8a,0xc7,0x6a,0x71,0x53,0x44,0xc3,0xeb,
-    0x41,0x2c,0x23,0x74,0x21,0x81,0x12,0x45,0xce,0xe5,0xe5,0xa2,0xa4,0xea,0x4d,0x5d,
-
-    // Record 105: Address = 0x4480, Length = 128
-    0x4480,0x80,
-    0x54,0x5,0x24,0xd8,0xf9,0x1f,0xe8,0xc4,0x41,0x4f,0xe3,0xdb,0x13,0xce,0xe6,0x71,
-    0x68,0x4a,0x32,0x37,0x50,0x9,0xb8,0x1c,0xc1,0x20,0xe,0xd9,0x3f,0x39,0x66,0xd0,
-    0x1e,0xc4,0xf6,0xce,0xd8,0x95,0x73,0x75,0xac,0xa7,0x69,0x3c,0xcf,0x8,0x9e,0xbc,
-    0x63,0x30,0xd1,0xbd,0x63,0xf,0x51,0x11,0xa7,0x98,0x87,0xe2,0x96,0x6f,0x66,0x51,
-    0x2,0x3f,0xdd,0xce,0xec,0xe2,0x5d,0xf3,0x10,0x1e,0x2e,0xfe,0xfe,0x1b,0x44,0xe1,
-    0x1f,0xdf,0x8c,0x33,0x42,0xa9,0x1c,0x0,0xab,0x3b,0xcf,0x8b,0xa2,0xf3,0x96,0x1e,
-    0x34,0x76,0x2a,0x68,0xee,0x92,0x72,0xf5,0xf6,0x2f,0x9,0x22,0xd,0xd4,0x21,0xfe,
-    0x22,0xc7,0x6e,0x11,0x83,0xbf,0x91,0x95,0x87,0xe2,0xd0,0x9a,0xc0,0x7b,0x92,0xd6,
-
-    // Record 106: Address = 0x4500, Length = 128
-    0x4500,0x80,
-    0x69,0xf5,0x53,0xe9,0xab,0x20,0x7a,0xc8,0xce,0x99,0x66,0xe3,0xae,0xc1,0xbb,0xb0,
-    0xb9,0x33,0xfe,0x3c,0xd1,0x42,0x22,0xd7,0x3d,0x8a,0x75,0x53,0xf2,0x78,0xf9,0xac,
-    0xdd,0x26,0xc9,0x78,0xb3,0x46,0x3e,0xb5,0x53,0xb8,0x44,0xcc,0xab,0xaf,0x49,0xa4,
-    0xcc,0xe,0xfd,0xeb,0x74,0xa1,0x62,0x82,0x63,0x11,0x1c,0xb1,0x79,0x29,0x6d,0x8b,
-    0xb3,0x6c,0x7e,0xf3,0xf2,0x21,0xb3,0xdc,0x8f,0x42,0x9f,0x4b,0xbc,0x3a,0x6e,0xfe,
-    0xa0,0x17,0x8d,0x3b,0x8,0x35,0x76,0x28,0x3d,0x73,0x56,0x7e,0x5e,0x83,0x32,0x49,
-    0x1c,0xa2,0x83,0xcb,0x91,0xff,0x30,0x2e,0x27,0x28,0xc2,0xb7,0x30,0xb4,0xeb,0x13,
-    0x18,0x7c,0x7,0x13,0x7d,0xf9,0x69,0x46,0x28,0xc0,0x59,0x44,0xf9,0x0,0xdd,0xee,
-
-    // Record 107: Address = 0x4580, Length = 128
-    0x4580,0x80,
-    0x7f,0x3f,0x90,0xb5,0x6a,0xf5,0xe7,0x21,0x1f,0xea,0xb0,0x91,0xb0,0x17,0xba,0x8,
-    0x71,0xb9,0x49,0xc5,0x7d,0x6c,0xc5,0xd1,0x2a,0x39,0xed,0xf5,0xd6,0x4d,0x13,0xd2,
-    0x10,0x5a,0x66,0xbe,0x2b,0xc3,0x44,0x89,0xea,0x4,0x6b,0x2c,0x4e,0x8c,0x31,0x19,
-    0xf5,0xd1,0x4f,0x41,0xa7,0xf5,0x4e,0x2a,0xdb,0x55,0x37,0x73,0x95,0x4f,0x7f,0x90,
-    0x4e,0xc9,0x46,0x2f,0xc2,0x4f,0xd8,0x88,0xd0,0xf7,0xcf,0x33,0xb5,0xcb,0x78,0x1e,
-    0xc7,0x48,0xce,0xbf,0x24,0x31,0x3,0xa2,0x3e,0x9a,0x94,0x8a,0x12,0xb1,0x4c,0x59,
-    0xc6,0x1c,0x50,0x7a,0x30,0xe7,0xac,0x26,0x8c,0xb5,0xf9,0x62,0xe8,0xc,0xd5,0xfe,
-    0x58,0x93,0xf3,0xbe,0x9,0x50,0x8a,0x2f,0x25,0xa8,0x20,0x68,0xf0,0x1f,0xd0,0x85,
-
-    // Record 108: Address = 0x4600, Length = 128
-    0x4600,0x80,
-    0x93,0x47,0xf1,0x66,0x69,0x6a,0x6a,0x9,0x6,0xea,0x40,0x38,0xb5,0x66,0xa3,0x1f,
-    0xbb,0x3a,0x2,0x4a,0x4,0xa7,0x1f,0x9c,0xcc,0x52,0xd3,0xde,0xe4,0x39,0x9f,0xe3,
-    0xe2,0x68,0x1c,0x77,0x85,0xb4,0xba,0x6e,0xbf,0x8,0xa7,0xcc,0xc6,0x98,0x76,0x4c,
-    0x74,0x7d,0x60,0x86,0xca,0x81,0x20,0x1e,0x6c,0xa0,0xf1,0x81,0xef,0xa9,0x8b,0x6a,
-    0xe4,0xdb,0x31,0x93,0xae,0xb,0x65,0x21,0x37,0xe1,0x2c,0xd5,0xaa,0xf5,0xa5,0x8c,
-    0xb0,0x53,0x8c,0x3,0xcc,0xa8,0xf0,0x54,0x6d,0x98,0x24,0xd6,0xc6,0x53,0xba,0x5c,
-    0xdf,0x5c,0x3e,0x85,0x8b,0x2e,0xe3,0xd4,0x63,0xbb,0x9c,0xb4,0xf3,0x7d,0xa4,0x28,
-    0xcb,0x81,0x9b,0xe5,0x0,0x82,0x4,0xd9,0x14,0x9a,0x33,0x97,0x68,0xbb,0x91,0x44,
-
-    // Record 109: Address = 0x4680, Length = 128
-    0x4680,0x80,
-    0x89,0x34,0x8e,0x9e,0xb,0xc8,0xa4,0xe4,0xe5,0xd0,0x5d,0xbc,0xeb,0xb0,0xfa,0x84,
-    0x2f,0xe8,0x58,0x1,0x1a,0x2a,0x8a,0x13,0x4b,0xa0,0x52,0xf9,0x4b,0x1c,0x4c,0x81,
-    0x9c,0x2e,0xeb,0xa8,0x83,0xee,0x45,0xe0,0x21,0xaa,0x36,0x53,0x42,0x56,0x5e,0xea,
-    0x8a,0x24,0xe,0x1,0x4d,0x28,0x18,0x33,0x8,0xb0,0x9f,0x43,0xdc,0x58,0x5,0xbc,
-    0xa2,0x99,0x60,0x85,0xc9,0xef,0x37,0x29,0xa5,0xae,0xc7,0x4f,0x11,0x76,0xd9,0xaf,
-    0x35,0xc8,0x96,0x42,0x66,0x6,0xa8,0x2f,0x61,0xf,0x6f,0xff,0xcc,0x2f,0x64,0x7e,
-    0xf6,0x63,0x30,0x9e,0xc6,0xc1,0x1d,0x6c,0xd9,0xb6,0x25,0xb5,0xaa,0xa9,0x14,0x5c,
-    0x28,0x2b,0xc5,0xfe,0x7e,0xe5,0xce,0x2b,0x8a,0xea,0x22,0x12,0x15,0x4,0x5a,0xe7,
-
-    // Record 110: Address = 0x4700, Length = 128
-    0x4700,0x80,
-    0x40,0x58,0x43,0xd,0x12,0x34,0xf9,0x2b,0x5e,0x53,0x73,0x14,0x20,0x39,0xce,0xa8,
-    0x2d,0x6c,0xdc,0x4d,0x4b,0x34,0x74,0x7d,0xde,0x7b,0x86,0x83,0xe1,0x3d,0x56,0x38,
-    0x6,0xcb,0xad,0x8f,0x35,0xbb,0xec,0xfc,0xc8,0xd2,0xe7,0x3,0x3d,0xd,0xaf,0x45,
-    0xc,0xa8,0x96,0x94,0x6a,0x20,0xec,0x6a,0x4a,0xa6,0x51,0xdc,0x8e,0x2,0xa4,0x8d,
-    0xb9,0x8c,0x6f,0x9c,0xa0,0x58,0x4,0x58,0x5b,0xab,0xff,0x77,0x9,0xab,0xd9,0x7a,
-    0xba,0x74,0x8,0xdb,0x37,0x8a,0x69,0xd4,0x2e,0xaa,0x56,0xa3,0xb6,0x89,0x14,0x43,
-    0xc0,0xa9,0xbf,0x34,0x96,0xee,0xd1,0x8a,0x78,0xe1,0xd1,0x64,0x98,0xa0,0x3e,0xa3,
-    0xca,0x29,0xcb,0xa9,0x3,0x8d,0x6d,0xcb,0xf1,0xca,0xb2,0xd3,0x7c,0x8f,0xe9,0x10,
-
-    // Record 111: Address = 0x4780, Length = 128
-    0x4780,0x80,
-    0x40,0x85,0xb5,0x29,0xd9,0x96,0x8e,0x1e,0x10,0xd8,0xf5,0x45,0x33,0x74,0xb7,0x1d,
-    0xe3,0x92,0x8a,0x65,0x9f,0x2c,0x7f,0x40,0x52,0x42,0x58,0xd3,0x54,0x1c,0xd6,0xfa,
-    0xb3,0xe3,0x52,0xfc,0xf6,0x45,0xe9,0x12,0xb8,0x7,0x29,0xd2,0x7d,0x3b,0x41,0x7e,
-    0x7a,0xa4,0x3b,0x72,0x3,0x36,0xde,0x85,0x6,0x55,0x15,0x34,0x6a,0x59,0x61,0x36,
-    0xc8,0xd3,0x41,0x62,0x95,0x7a,0xfe,0x58,0x13,0x19,0x2c,0x13,0x9c,0x3d,0x80,0xa7,
-    0xe4,0xa5,0x2a,0x52,0x6c,0xba,0x84,0x4d,0x75,0x59,0xbc,0x44,0xf0,0xb6,0x1e,0xfd,
-    0xd0,0xc9,0xc5,0x8d,0x21,0x71,0x78,0x46,0xd5,0xb3,0x4a,0x42,0x3e,0x4b,0x2b,0x1c,
-    0xc6,0xe7,0xab,0xe8,0x41,0xe,0x72,0x37,0x22,0xa4,0x35,0xc9,0x72,0xd1,0x89,0x2c,
-
-    // Record 112: Address = 0x4800, Length = 128
-    0x4800,0x80,
-    0x1a,0x6a,0x44,0x59,0xec,0xc1,0xd8,0xcb,0x59,0x60,0xbb,0xbb,0x27,0xe7,0x5e,0x34,
-    0x30,0xc4,0xb0,0x76,0x22,0x41,0xc7,0x37,0x37,0x1f,0x4b,0x42,0x98,0x57,0x39,0xad,
-    0xd0,0x3c,0x1e,0xf8,0x70,0x25,0x34,0x96,0x39,0x1c,0x39,0x51,0x3a,0x55,0x21,0x93,
-    0xf0,0xa4,0xb0,0xac,0xb1,0xe4,0xfe,0x81,0x8b,0x3b,0x81,0xdc,0xe6,0xe6,0x12,0x89,
-    0xdb,0x90,0x7a,0xcd,0x4b,0x57,0x97,0xc3,0x7d,0x35,0x28,0x6f,0x59,0xe9,0x5e,0xe2,
-    0x6c,0x38,0x8,0x79,0x1b,0x62,0xb,0xa8,0x7,0xb0,0xdf,0x1f,0x22,0xa,0xab,0xb,
-    0x72,0x1f,0x5,0x8,0x24,0x41,0xc3,0xf9,0x59,0x9,0xfc,0xfd,0xab,0x32,0xeb,0x9b,
-    0xa4,0x45,0x24,0xd2,0x34,0xe7,0x21,0x1f,0x2b,0xf2,0x20,0xdc,0x17,0x55,0x80,0x12,
-
-    // Record 113: Address = 0x4880, Length = 128
-    0x4880,0x80,
-    0xa3,0x16,0xf9,0x75,0xd9,0x5d,0x15,0x1a,0xc6,0xf,0x4a,0x46,0xf5,0x75,0x67,0x22,
-    0x9b,0x46,0x57,0x12,0x81,0xfc,0xbb,0xc2,0xb6,0x22,0x9e,0x17,0xf9,0xef,0xdf,0x43,
-    0x29,0xf2,0x71,0x2e,0x12,0x41,0xfc,0x8f,0x15,0x1b,0xab,0x75,0xd2,0xc3,0xf1,0xc7,
-    0xa5,0x22,0xc,0xd9,0x76,0xdf,0xa2,0xcb,0xac,0x55,0xd4,0xf0,0x79,0x13,0x6e,0xc8,
-    0x19,0x79,0xf2,0x5e,0xc,0x2a,0xf6,0x4a,0x30,0xfa,0xc5,0x6c,0x26,0xce,0x71,0xea,
-    0xbd,0x86,0xc4,0x74,0x78,0xeb,0x48,0xa6,0xc2,0x8d,0x86,0x37,0x42,0x79,0xa,0xd0,
-    0xb1,0x68,0xe0,0xc4,0xdc,0xaf,0xb5,0xbf,0x51,0xbf,0x2c,0x1,0xab,0x6a,0xdd,0x1b,
-    0x1f,0xe9,0x60,0x57,0xd8,0xcc,0xbf,0x52,0x57,0x27,0xdd,0x4c,0x7d,0xa7,0x7f,0xa6,
-
-    // Record 114: Address = 0x4900, Length = 128
-    0x4900,0x80,
-    0xce,0x87,0x14,0x34,0x12,0x2f,0x73,0x50,0x2b,0x5b,0x9d,0x91,0xc,0x45,0xd3,0xeb,
-    0x32,0xcb,0xa2,0xe1,0x4f,0xd9,0xe6,0x4a,0x55,0x4d,0xb,0x7c,0x6a,0x2d,0x48,0xc5,
-    0x45,0x8a,0x98,0x7e,0x59,0xa5,0x48,0xfb,0xb8,0xa6,0xa6,0x35,0x4d,0x41,0x78,0x9d,
-    0x2e,0xa3,0x87,0x8,0x8f,0x94,0x2c,0x6,0xf,0x8c,0xa2,0x31,0x23,0x2d,0xae,0x71,
-    0x8b,0x7d,0xc6,0xda,0x22,0x9d,0x20,0x77,0x24,0x22,0x9b,0x30,0x26,0x30,0x5b,0xca,
-    0x3b,0xf3,0x94,0xdd,0x44,0x4c,0x92,0x30,0xd1,0x51,0xd3,0x6c,0x1a,0x1c,0xff,0x46,
-    0x86,0xf5,0xfc,0x20,0xe7,0x82,0x60,0xa7,0x99,0x9c,0x33,0x1c,0xf2,0x47,0x54,0xf5,
-    0xd9,0x56,0xfc,0xe7,0x5a,0x19,0xf8,0xe6,0xb7,0xcd,0xd2,0x21,0xef,0x6f,0x5a,0x7a,
-
-    // Record 115: Address = 0x4980, Length = 128
-    0x4980,0x80,
-    0x56,0x75,0x47,0xf8,0x7f,0xab,0xbd,0xc1,0x2,0xed,0x15,0x88,0x2d,0xa5,0x5f,0x44,
-    0x49,0x5c,0xec,0xeb,0xbc,0xd3,0xb2,0x92,0xd6,0xa2,0xe7,0x9,0x20,0x43,0x54,0x64,
-    0x6,0xf0,0x2,0x16,0x46,0x47,0xeb,0xd9,0xb4,0x75,0xb5,0xd6,0x8d,0x8a,0xb1,0x87,
-    0xdf,0x26,0xa6,0x42,0xd9,0x21,0xb3,0x72,0xda,0x5b,0x8f,0xa8,0x86,0xa7,0x80,0x87,
-    0x8d,0x8d,0x56,0xcf,0x7c,0x13,0x27,0xbd,0x28,0xfd,0x8c,0xc2,0x22,0x84,0x2c,0x85,
-    0xa6,0xca,0xd0,0x72,0x5b,0x71,0xb4,0x76,0x6f,0x92,0x42,0x9b,0xec,0x1d,0x28,0x70,
-    0x79,0xba,0xf,0x20,0x3a,0xfd,0x2a,0x36,0xa2,0xa4,0xb4,0xe9,0xcd,0xcc,0x16,0x5f,
-    0x26,0x75,0xca,0x1c,0x58,0x3f,0x9e,0x71,0xec,0xa6,0x67,0xc9,0xee,0xc0,0x44,0x72,
-
-    // Record 116: Address = 0x4a00, Length = 128
-    0x4a00,0x80,
-    0xd0,0x8d,0xc1,0xd6,0x76,0xcf,0x39,0x96,0xce,0x28,0x7,0x3f,0xe,0x41,0xca,0xe9,
-    0x14,0xd9,0xdf,0xcb,0x3d,0x83,0xce,0x55,0x62,0xd2,0x78,0x15,0xbe,0x42,0x17,0xb7,
-    0xc8,0x32,0xc7,0x6d,0x38,0x79,0x60,0xc9,0x2a,0x5d,0xb1,0x44,0x24,0xff,0x42,0x8f,
-    0x51,0x87,0x60,0xcb,0xf9,0x44,0x2a,0xb0,0x71,0x7a,0x38,0x96,0xf2,0x9f,0x8,0x75,
-    0x7d,0xb7,0x60,0xb4,0x66,0x9e,0x76,0xe,0x51,0x0,0xd3,0x31,0xec,0x80,0x72,0xbe,
-    0x64,0x90,0x51,0x5a,0x1,0x3,0x37,0x11,0xa9,0x1e,0xf5,0xcd,0x5f,0x84,0xa0,0xdd,
-    0xf,0x73,0x47,0x95,0x73,0x94,0x30,0x8a,0xa8,0x82,0x43,0x30,0x38,0x6c,0xc4,0xc6,
-    0xb4,0x85,0x48,0xc5,0x54,0x74,0xc6,0x1e,0xf8,0x36,0xb7,0x7b,0xd7,0x6e,0xc2,0xc9,
-
-    // Record 117: Address = 0x4a80, Length = 128
-    0x4a80,0x80,
-    0xde,0x99,0x76,0xc7,0x4e,0x3,0xd1,0x64,0x7f,0x37,0xb2,0xc2,0x44,0xf5,0x81,0xcc,
-    0xb1,0x9e,0x56,0x9b,0x25,0x5c,0x38,0x38,0xf4,0x91,0x74,0x9b,0xf7,0x86,0xbb,0x1e,
-    0x5d,0x37,0x17,0xd7,0x2d,0x8b,0xe4,0x45,0x1c,0xaf,0xe3,0xb6,0xaf,0xf1,0x98,0x1c,
-    0x3c,0xf0,0x50,0xf,0xe5,0x3c,0xdf,0x2c,0xf7,0x1,0x1b,0xea,0x90,0xa,0xc6,0x3c,
-    0xcf,0x3,0x6f,0xa9,0x2c,0x3f,0xd,0x35,0x7e,0x27,0xbe,0xae,0xae,0x8e,0xa4,0x8e,
-    0x75,0xf,0x3e,0xe6,0x46,0x4f,0xa4,0xef,0xd7,0xd3,0x8b,0x58,0xc,0x4a,0x99,0x21,
-    0xd9,0x4d,0x23,0x1f,0xfe,0xb9,0x70,0xa4,0x20,0x0,0xad,0x49,0x33,0xc7,0x60,0xdf,
-    0xb4,0xd5,0x2,0x4a,0x80,0xab,0x6c,0x46,0x2,0x78,0xb2,0x4e,0xaf,0xe,0xf3,0x52,
-
-    // Record 118: Address = 0x4b00, Length = 128
-    0x4b00,0x80,
-    0xb,0x88,0x3e,0x79,0x59,0x47,0xfe,0xd1,0xa,0xe1,0x35,0xac,0xe4,0x3b,0x3c,0xe6,
-    0xe0,0xb7,0x14,0x2a,0xa8,0x34,0xf9,0x88,0x14,0x9d,0x5b,0x7f,0x6f,0x72,0x6a,0xe1,
-    0x12,0x52,0x75,0xc,0x69,0xa8,0x2a,0x9f,0x5a,0x6,0x43,0xc2,0xf7,0x41,0x7f,0x1d,
-    0x36,0x48,0xc8,0x49,0x7d,0xf9,0xf4,0x79,0xf9,0xbb,0xad,0x2,0x67,0x15,0x0,0x47,
-    0x4a,0xbf,0xd3,0xd0,0xf7,0xa1,0x6e,0x4b,0x6c,0x59,0xc1,0xa3,0xcb,0xa7,0x22,0x1c,
-    0xa1,0x1e,0x76,0x8b,0x76,0x20,0xa0,0x1a,0x9d,0x86,0xbb,0x59,0x4,0x94,0xc0,0x93,
-    0x1e,0x8f,0xd3,0x16,0xf9,0x76,0x4c,0x8b,0xc6,0x68,0xf,0xfd,0x20,0xa8,0x1d,0x76,
-    0x88,0xaa,0x55,0x8c,0x27,0x19,0x25,0x80,0xc,0x39,0x9a,0xc8,0xc8,0x93,0x8b,0x50,
-
-    // Record 119: Address = 0x4b80, Length = 128
-    0x4b80,0x80,
-    0x14,0x88,0xe2,0x18,0xfc,0x5,0x50,0xb1,0x76,0x8d,0x9a,0xf1,0xb1,0x38,0x4d,0xe4,
-    0xf6,0x49,0x92,0xc6,0xbd,0xb,0x2f,0xca,0xd4,0x8,0x45,0xb8,0x68,0x13,0x50,0x16,
-    0xd3,0x28,0xd1,0x3c,0x80,0x93,0x8d,0xac,0x9d,0x5a,0x3f,0xd1,0x63,0xd4,0x5e,0x2b,
-    0x46,0xb6,0x63,0x5f,0x5c,0xfa,0xc8,0x4,0xbe,0xef,0xb2,0xad,0xae,0xcc,0x22,0xd1,
-    0xce,0x73,0x9c,0x6d,0x6a,0xe,0xe8,0x79,0x85,0xe6,0x3e,0x38,0x16,0x51,0x90,0xf7,
-    0xd8,0xd5,0x21,0xd0,0x88,0xbf,0xfa,0xa,0x3f,0xcb,0xff,0x35,0x92,0x88,0x9b,0x3a,
-    0x1e,0x12,0xbf,0xc8,0x75,0xed,0x7b,0xd7,0xb1,0x1f,0xaa,0x23,0x93,0x21,0x3,0xc2,
-    0x29,0xbd,0x6f,0x75,0x70,0x9f,0xd6,0xbc,0x12,0x55,0xbe,0x36,0x6d,0x16,0x24,0x58,
-
-    // Record 120: Address = 0x4c00, Length = 128
-    0x4c00,0x80,
-    0x4d,0xf7,0x88,0x86,0x19,0xad,0xd7,0x4a,0xdf,0x9d,0xe8,0x7f,0xc1,0x12,0x40,0xed,
-    0x0,0x8c,0x96,0xca,0x9b,0x6a,0xe9,0x3b,0x42,0x20,0xcc,0x15,0xa0,0x27,0x5,0xf2,
-    0x4,0x7c,0xa3,0x12,0x87,0x27,0x3d,0x54,0x6e,0x7d,0xb2,0x1,0x2,0xfb,0xb2,0x50,
-    0x6a,0x43,0xa6,0xe6,0x3d,0x10,0x2,0x77,0x5e,0x94,0xec,0xb2,0x4,0xe1,0xc9,0x8,
-    0x7c,0x78,0x4c,0xac,0x89,0x97,0x17,0xb7,0xdb,0x4f,0x75,0x56,0x76,0xa,0x2d,0xe1,
-    0xeb,0xc2,0x12,0x10,0xe8,0x91,0x49,0xa4,0x22,0x4f,0x3f,0x95,0x4c,0x6d,0x45,0xbd,
-    0x91,0x32,0x49,0xb0,0x1d,0xba,0x87,0xb6,0x5,0xeb,0xb,0x2e,0xd,0x7b,0x36,0x10,
-    0x43,0x3c,0x1,0x95,0x50,0xb7,0xac,0x54,0xac,0xb3,0x19,0x9e,0xf2,0x93,0x27,0x58,
-
-    // Record 121: Address = 0x4c80, Length = 128
-    0x4c80,0x80,
-    0xa8,0xfd,0xf9,0x1c,0x42,0x8,0xa8,0x12,0x5b,0xa8,0xd1,0x16,0xd5,0x50,0x54,0xc6,
-    0xca,0xaa,0x48,0xe4,0xaf,0xe3,0x2e,0xc2,0x8c,0x52,0x15,0x22,0x55,0x10,0x5,0x9f,
-    0xb1,0x62,0x51,0x44,0x2f,0xa4,0x49,0xd4,0x9f,0xd5,0x19,0x8b,0x2a,0x2b,0x4f,0x97,
-    0x3,0x79,0x6,0xa3,0xc9,0xc1,0x2a,0x42,0x25,0xee,0x3a,0x4,0x9,0x57,0xa5,0xca,
-    0x93,0xf0,0xd6,0xee,0xa6,0x2c,0x29,0x60,0xf9,0x55,0xf9,0xd0,0xff,0x8a,0x46,0x4f,
-    0xd0,0xdf,0x39,0xd8,0xc8,0x5b,0x6c,0x3b,0xa6,0xb1,0xcf,0x5c,0x13,0x27,0x81,0xfe,
-    0xb3,0x1f,0x4f,0x62,0x48,0xf0,0xf9,0x31,0xa4,0xcc,0x23,0x84,0xe2,0xe9,0x38,0xa9,
-    0x31,0x5a,0x99,0x48,0xeb,0xc9,0xd0,0x9d,0x49,0xa4,0x6f,0xfa,0x34,0x47,0xa2,0xbe,
-
-    // Record 122: Address = 0x4d00, Length = 128
-    0x4d00,0x80,
-    0x8f,0x8b,0x39,0xf9,0x22,0x3c,0x60,0xcf,0x10,0xa1,0xdf,0x0,0x6e,0xd5,0x48,0xaf,
-    0x95,0xca,0x5b,0x1c,0x98,0x34,0x1f,0x37,0x53,0x84,0x70,0xee,0xdf,0x0,0x20,0x6f,
-    0x42,0xc6,0x4d,0x5a,0xaf,0x8e,0x4b,0x96,0x3c,0x90,0xd1,0xa8,0x57,0x1f,0x53,0x4d,
-    0x2b,0x19,0x31,0x65,0x17,0xd8,0x84,0x3b,0xff,0xb5,0x5,0x53,0x68,0x88,0x1c,0x4d,
-    0x5c,0x1,0x93,0x2e,0x16,0x3e,0x4c,0x80,0x6d,0x6b,0x4,0x6a,0x4a,0x57,0x5e,0x35,
-    0xbf,0xf9,0x47,0x36,0xd5,0x32,0x78,0x3,0x6e,0x11,0x85,0x8b,0xf3,0x44,0xbf,0xaa,
-    0xa1,0x33,0xc,0x3f,0xfe,0xb,0x69,0x7c,0x81,0x17,0xa1,0x2e,0xbc,0xde,0xe3,0x2b,
-    0xdd,0xd,0x6,0x10,0xae,0x83,0xe,0x70,0x98,0x3f,0xd8,0x9d,0x5,0x18,0x7a,0x19,
-
-    // Record 123: Address = 0x4d80, Length = 128
-    0x4d80,0x80,
-    0x9,0xbe,0x72,0x47,0x3b,0x94,0xf1,0x97,0x22,0x54,0xc3,0x2b,0x83,0xd2,0x34,0xcd,
-    0x48,0xb4,0x35,0x4c,0x27,0x66,0x8,0xd3,0xb1,0xd,0xc3,0x10,0xfe,0x33,0x1a,0x34,
-    0x9d,0xcd,0xe,0x95,0xba,0x3e,0xf5,0x4f,0xc4,0xc0,0xd1,0xcf,0xf2,0x48,0xec,0x81,
-    0x6e,0xf3,0xac,0xbe,0xc1,0x29,0xd0,0xc9,0xf5,0x42,0x4a,0xb5,0x20,0x22,0x9a,0xab,
-    0x44,0xef,0xee,0xfe,0x81,0x2c,0x2e,0x22,0x60,0x49,0x4f,0x15,0xfc,0x66,0xf1,0x56,
-    0xa8,0x54,0x8a,0xa8,0xbe,0xc3,0x2d,0xd2,0x4e,0xe6,0xd8,0x86,0x0,0x2e,0xb5,0x40,
-    0x89,0x5d,0x39,0x13,0x5f,0xe6,0xa2,0xb7,0xd8,0x9d,0x71,0x54,0x24,0x3,0xb1,0xa6,
-    0xd3,0x29,0xb8,0x1d,0xf1,0xe,0x2b,0xcc,0xd9,0x88,0x60,0x42,0x51,0xef,0xb1,0x45,
-
-    // Record 124: Address = 0x4e00, Length = 128
-    0x4e00,0x80,
-    0xb3,0xdb,0x14,0x95,0xd8,0x64,0xb1,0x40,0xcd,0xac,0xa1,0xaa,0x19,0x43,0x95,0xa7,
-    0x57,0xd4,0x18,0xf1,0x58,0xa6,0xb4,0x53,0x7c,0x1e,0xc8,0xa0,0xc4,0x36,0x85,0xc,
-    0x8c,0x56,0xea,0xfd,0x7a,0x8e,0xd0,0xd3,0xec,0x2c,0xf3,0x18,0xae,0x63,0x5,0xf6,
-    0x10,0x8f,0x5d,0xb4,0x9a,0xe8,0xd5,0x3f,0xcc,0x1f,0x2b,0x4,0x4c,0x43,0xf1,0xc5,
-    0x4,0xee,0x9e,0xef,0xcb,0x24,0xf0,0x10,0x48,0x3a,0xa5,0xc0,0x60,0x6b,0x9a,0xe5,
-    0xcf,0xd,0xaa,0x1f,0xfc,0x16,0xad,0x81,0xf5,0x45,0xc0,0x78,0xcf,0xde,0x2b,0xba,
-    0x46,0x2,0x10,0xf3,0x79,0x2b,0xb4,0x64,0x91,0xe8,0x9e,0x6a,0xce,0xfc,0xf7,0xc6,
-    0x2f,0x12,0xd4,0x8a,0x17,0x0,0x72,0xc9,0x82,0x65,0xf4,0x41,0x49,0x77,0x8d,0xaa,
-
-    // Record 125: Address = 0x4e80, Length = 128
-    0x4e80,0x80,
-    0x3a,0x4,0x1b,0xe5,0xeb,0xf8,0xf4,0xbd,0x63,0xec,0xab,0x40,0xd9,0xe5,0xc8,0xc8,
-    0xd4,0x8f,0x49,0x70,0xe7,0xb1,0x9d,0x82,0x8,0x1c,0xab,0xa,0x59,0x9b,0x66,0xf5,
-    0x16,0x9a,0xce,0x8a,0xee,0x3d,0x3a,0xc5,0xc6,0x2d,0x6e,0x4a,0xb1,0x43,0xeb,0x32,
-    0x2d,0x6a,0x53,0x29,0x46,0x1b,0xb4,0xa1,0x7b,0x7c,0x92,0x4c,0xc0,0x1b,0xf6,0xa5,
-    0xd8,0x90,0xd9,0x91,0xf9,0x63,0xb,0x8,0x59,0x7d,0x20,0x28,0x1b,0x61,0xae,0x86,
-    0xdc,0x6d,0xa1,0x1,0x12,0x5b,0xdf,0x29,0xfa,0x2d,0xa2,0xad,0x18,0x10,0x24,0xe2,
-    0xe8,0xf1,0x26,0xee,0xae,0xbb,0xab,0xa6,0x41,0x75,0x6e,0x10,0x25,0xb,0xc6,0xc,
-    0xfe,0x65,0x6a,0x1b,0x1f,0xb4,0xf9,0x9,0x4d,0x34,0x76,0xaa,0x0,0x83,0xcf,0xf5,
-
-    // Record 126: Address = 0x4f00, Length = 128
-    0x4f00,0x80,
-    0x84,0x84,0xd7,0x5c,0xfe,0xc7,0xde,0xa9,0xb5,0xf9,0x57,0x3a,0xa6,0x5b,0x23,0xc4,
-    0xa1,0x19,0x6f,0x34,0x3d,0x1e,0x9c,0xa,0xc6,0x38,0x96,0x74,0xc4,0xc2,0xa,0x56,
-    0xe4,0x5a,0xb1,0x62,0x48,0x5,0xd2,0xc5,0xf,0x42,0x85,0x97,0x43,0x82,0xcb,0x86,
-    0x3d,0x42,0x7,0xd2,0xff,0x40,0xed,0xf6,0x1c,0xd8,0x7e,0x4b,0x3a,0x45,0xdc,0x36,
-    0x6e,0xa,0x1b,0xd4,0x40,0x4b,0xdd,0xa8,0xe2,0xfb,0x4a,0xb2,0xe8,0x70,0xb9,0xb8,
-    0x47,0x9,0xc6,0xa1,0xa5,0x64,0x3c,0x4,0xa5,0x78,0xdc,0xc8,0xfa,0x1,0x31,0x91,
-    0x4b,0xc7,0xc,0x64,0xe3,0x69,0xc6,0x82,0xee,0x4a,0x16,0x43,0x75,0x75,0xfa,0x47,
-    0xb3,0x77,0x78,0xb0,0x3c,0x4b,0xf8,0xa6,0x26,0x37,0xb3,0x11,0xc,0x72,0x5e,0x98,
-
-    // Record 127: Address = 0x4f80, Length = 128
-    0x4f80,0x80,
-    0xa4,0xdd,0x62,0x96,0xfc,0xaf,0x87,0xd0,0xf7,0xe0,0xc3,0x5a,0x91,0xad,0x50,0x44,
-    0x20,0x9b,0xf2,0xfc,0x15,0x5d,0xdd,0xd9,0xa7,0x80,0x90,0x1f,0x21,0x46,0xac,0xb9,
-    0xb4,0x58,0xc2,0xf3,0x54,0x91,0xcd,0x7d,0x12,0x41,0x86,0xa7,0xe4,0xbb,0xe0,0x1,
-    0x90,0x4a,0x1,0xf,0x85,0xf6,0x48,0xd1,0xac,0x2e,0x6b,0x26,0xf7,0x3c,0xc6,0x16,
-    0xb8,0x34,0x67,0x45,0x7,0xa0,0xcb,0x4b,0xd2,0xa2,0xf7,0xec,0x1c,0x5c,0x36,0xd0,
-    0xae,0xb3,0x98,0x48,0x90,0xd,0x7e,0x1b,0x46,0x7d,0xf4,0x4d,0xb1,0x45,0x62,0xc5,
-    0xe1,0xcc,0xab,0xaf,0xa,0xca,0x17,0x3a,0x31,0x7,0xdd,0x2,0xcc,0xf7,0x90,0x65,
-    0xbc,0x10,0x5e,0xe6,0xc4,0x2e,0xab,0x98,0x56,0x9,0x5d,0xb3,0x39,0x13,0xd9,0xe2,
-
-    // Record 128: Address = 0x5000, Length = 128
-    0x5000,0x80,
-    0xce,0xa,0x79,0xda,0x1b,0x59,0x75,0x8c,0x1a,0xa9,0x7e,0x9f,0x3c,0xa4,0x34,0xfa,
-    0x3e,0x59,0xb,0x55,0x54,0x81,0x69,0xff,0x24,0xfc,0x15,0xc9,0x89,0x43,0x9a,0xa,
-    0xd4,0xee,0x28,0xc0,0xa5,0xc1,0x9b,0x80,0x10,0x71,0x84,0x55,0x4a,0x55,0x2a,0x8f,
-    0xac,0x51,0x75,0xf9,0x95,0xf1,0xf0,0xaf,0x63,0x20,0xc0,0x3d,0x5,0x79,0xa0,0xb4,
-    0xd3,0x40,0x1c,0xfe,0xd6,0x31,0x8c,0x95,0xe7,0xc4,0xad,0x6,0x89,0x79,0xda,0xb4,
-    0xdc,0xd9,0x30,0xfc,0x37,0xdc,0x64,0xb3,0x1a,0x16,0xca,0x8f,0xe8,0x7e,0x5e,0x71,
-    0x35,0xfd,0x29,0x97,0x1f,0x1f,0x7d,0xd2,0x31,0x91,0x7e,0x65,0xdd,0xb9,0x4a,0x4a,
-    0xc1,0xe5,0x7a,0xa0,0xeb,0xaa,0x53,0xdf,0x5d,0xc9,0xea,0xab,0x43,0x9d,0x2f,0xd4,
-
-    // Record 129: Address = 0x5080, Length = 128
-    0x5080,0x80,
-    0x75,0x69,0x59,0x53,0x55,0x5b,0xd2,0xfa,0x7e,0xbe,0xcf,0xcd,0x70,0x2,0x7b,0x3a,
-    0xc3,0x41,0x4c,0x11,0x58,0x7f,0x74,0x20,0x6c,0x51,0x35,0x75,0xc6,0x6f,0xdf,0xf5,
-    0xa0,0x69,0xd6,0x41,0x40,0x19,0x20,0xe2,0x33,0x9e,0xcd,0x36,0x40,0x37,0x81,0xb5,
-    0x75,0x4,0xb5,0x8f,0x54,0xa1,0x52,0xa0,0xd8,0x52,0x21,0xeb,0x52,0xc7,0xa6,0x54,
-    0x1d,0x4f,0x46,0x5b,0xa7,0xef,0x80,0xd2,0x2,0xb3,0x4a,0xd,0x27,0xa8,0xda,0x3b,
-    0x25,0x8f,0x36,0x6b,0xd,0x52,0xde,0xbc,0x8c,0xd0,0x3e,0x82,0x50,0xff,0x77,0xa1,
-    0x57,0x45,0xe,0x5e,0xd3,0x4e,0xb0,0x67,0xe3,0xe7,0xda,0xa2,0x5c,0x72,0xe8,0x87,
-    0x59,0xc0,0xa,0xd8,0x6e,0x9c,0x10,0xbe,0x1c,0xb1,0x4f,0x6d,0xdb,0xa4,0x60,0xbc,
-
-    // Record 130: Address = 0x5100, Length = 128
-    0x5100,0x80,
-    0x95,0x40,0xd0,0x4f,0xc8,0x9,0x15,0xc6,0xf9,0x60,0x1d,0xb4,0x50,0x65,0xc0,0x13,
-    0x64,0x19,0xe8,0xbf,0xd4,0x93,0xcc,0xb6,0x9f,0xfa,0x72,0x8d,0xce,0xab,0xb1,0x90,
-    0x70,0xae,0x53,0xaf,0x7e,0x4f,0x5,0x4b,0xbd,0x8a,0x62,0xa5,0x5d,0x91,0x43,0x17,
-    0x60,0x6d,0xcc,0x61,0x95,0x29,0xd9,0x65,0x72,0x2d,0xff,0x82,0x4c,0x2d,0x60,0xb5,
-    0xd7,0xd7,0xf9,0x6a,0xf4,0x5c,0xb9,0x88,0xd0,0x60,0x65,0x9d,0x7b,0x13,0xe8,0x97,
-    0x19,0x34,0xfd,0x2,0x42,0x77,0xe9,0x81,0xb0,0x37,0xe7,0x76,0x3,0x50,0x6e,0xff,
-    0xf4,0x81,0xea,0xf,0x2f,0xe9,0x23,0x59,0x13,0xa3,0xdc,0x1c,0x93,0x24,0xd,0x94,
-    0xa6,0xed,0xd9,0x5f,0x32,0xe8,0x63,0x49,0x6d,0x5f,0x1f,0x39,0x1a,0xe0,0x5e,0x6,
-
-    // Record 131: Address = 0x5180, Length = 128
-    0x5180,0x80,
-    0x9d,0xa7,0x2e,0xe0,0xe,0x72,0xaa,0xb7,0x64,0xfb,0x50,0x37,0xc1,0xdd,0xd5,0xa2,
-    0x5,0xbf,0xc3,0x0,0x6a,0x58,0x8b,0x64,0x1f,0x10,0x76,0x6d,0x1e,0x9e,0x28,0xda,
-    0x87,0x6f,0xe4,0x52,0x8d,0x57,0x1d,0xee,0xc3,0x82,0x67,0x30,0x34,0xfc,0x46,0x89,
-    0x5,0x1f,0x98,0x79,0x64,0x1d,0xbb,0x78,0x31,0x94,0x9e,0xd2,0xe0,0x32,0x75,0x49,
-    0x16,0xd2,0x1,0xc3,0xe3,0x24,0x69,0x41,0x16,0x36,0x4c,0x6a,0x17,0x1,0xbe,0x33,
-    0x1d,0x3e,0xd7,0x4f,0xf8,0xbb,0x29,0x7f,0x49,0xaa,0xae,0xa9,0xd,0x74,0xf4,0xf7,
-    0x52,0x36,0xeb,0x7d,0xc8,0xc0,0xbf,0x52,0xd3,0xce,0xec,0x66,0x28,0x86,0xce,0x79,
-    0x5d,0x36,0xa9,0x19,0xc8,0x1f,0xb8,0x84,0x4d,0x95,0x53,0xa6,0xe1,0x9f,0x3a,0x71,
-
-    // Record 132: Address = 0x5200, Length = 128
-    0x5200,0x80,
-    0x15,0x51,0xc2,0xdd,0x90,0x39,0x2,0xe4,0xef,0x66,0xe0,0xb,0x94,0x19,0x7d,0xd5,
-    0xe3,0x94,0xc6,0xca,0x67,0x61,0x4e,0x43,0x50,0x80,0x78,0x46,0x31,0xef,0x3f,0xe,
-    0x31,0x63,0x36,0xfa,0x2a,0xc8,0xc3,0xcf,0xd0,0x28,0x15,0x1c,0xf5,0x15,0xc4,0xb6,
-    0x27,0x4a,0x9f,0xf6,0xb9,0x1d,0x96,0xea,0xbc,0x9c,0xee,0xae,0xf6,0x35,0x52,0x6d,
-    0x78,0xe5,0xa7,0x55,0xde,0x1e,0x4c,0x53,0x3d,0xb9,0xcf,0xb8,0x29,0x5,0xe5,0xb3,
-    0x30,0x21,0x59,0xbf,0x51,0x70,0xe0,0xa9,0x6d,0x1c,0x2f,0xf4,0xaf,0xe1,0xe,0x38,
-    0x57,0xd,0xe8,0x16,0x9f,0x45,0xb0,0x50,0xcd,0xb9,0x37,0x57,0xfa,0x0,0x22,0x78,
-    0x85,0x13,0x87,0xc0,0x4b,0x2c,0xae,0xda,0xb0,0xb3,0xb8,0xe9,0x97,0xa4,0x75,0x61,
-
-    // Record 133: Address = 0x5280, Length = 128
-    0x5280,0x80,
-    0x81,0xe3,0x3b,0xb9,0x78,0xd4,0x37,0x34,0x3e,0x64,0x58,0xa1,0xe4,0x5d,0xd0,0x2f,
-    0xae,0xf8,0x47,0xf0,0x12,0xc6,0x1e,0x4f,0x5a,0xba,0xaa,0xb5,0x9f,0x50,0x98,0xd1,
-    0xa8,0xf8,0xc4,0x34,0x7,0xc1,0x95,0x69,0x7d,0x19,0xb1,0xa6,0xb1,0x87,0xda,0x1c,
-    0x94,0x45,0xb3,0xa8,0x7d,0xca,0xc0,0x38,0xe2,0x9c,0x52,0x55,0x7,0xc,0x43,0x42,
-    0x59,0x38,0xed,0x4,0x54,0x8d,0xf6,0xe9,0xce,0x85,0x12,0x74,0xd4,0xec,0xe3,0xd9,
-    0x9d,0xef,0xd3,0x19,0x89,0x9c,0xbd,0x89,0x14,0x81,0x1b,0x3b,0xe4,0x3d,0x9a,0x42,
-    0x7a,0xf6,0xa4,0x2d,0x1,0x70,0x13,0xa3,0xb,0x75,0x9,0x57,0x9e,0x62,0x1b,0x9f,
-    0x2b,0x40,0xa7,0x9d,0x41,0xc6,0x40,0xb7,0x2,0xc6,0x18,0xaf,0x12,0xbb,0xa8,0x7,
-
-    // Record 134: Address = 0x5300, Length = 128
-    0x5300,0x80,
-    0x96,0xc2,0x41,0x44,0xc1,0x5a,0xd6,0xa1,0xf4,0x69,0x73,0x49,0xed,0x6c,0xe8,0x2b,
-    0x3e,0x83,0x6a,0x81,0x45,0xb9,0x7c,0x2b,0x57,0xc0,0x69,0xee,0x3e,0x1f,0x52,0xa4,
-    0xb7,0xd4,0xad,0x96,0x43,0x31,0x90,0x63,0xf2,0x86,0x67,0x85,0x32,0x76,0x29,0xd8,
-    0x24,0x2,0x25,0xfc,0xba,0xe9,0x3,0x44,0xe4,0xe6,0x28,0xa0,0xdd,0xf1,0xfa,0x42,
-    0x81,0x93,0x4f,0xf1,0xf2,0x1a,0xf7,0x3e,0x4f,0x11,0xdb,0xe0,0x49,0x2f,0x58,0x4d,
-    0x1c,0xec,0x18,0xb5,0xb8,0x81,0x24,0x7a,0xf6,0xea,0x76,0x1,0x35,0xad,0xcd,0x68,
-    0x5,0xbd,0xcc,0x68,0x9b,0xc1,0xfc,0x65,0xf3,0xd2,0xce,0xe3,0x1d,0xb7,0x40,0xc1,
-    0xc6,0xc0,0x86,0x6b,0x4b,0x47,0xde,0x2b,0xcb,0x1,0x5d,0x8c,0x9d,0xf4,0xbd,0x5b,
-
-    // Record 135: Address = 0x5380, Length = 128
-    0x5380,0x80,
-    0x2,0xc1,0xa7,0xd5,0xb,0xe3,0xd,0x1f,0xc2,0xe6,0x6f,0x29,0x15,0xa2,0x5a,0x96,
-    0xac,0x61,0x34,0x6a,0x16,0x56,0x92,0x28,0xde,0x93,0x5,0x24,0x60,0xf7,0x74,0xbc,
-    0x7e,0xd8,0x8a,0x8f,0xb1,0xb8,0xfc,0xab,0xaf,0x78,0xfe,0xb1,0xde,0xd9,0x23,0x67,
-    0xf3,0x2d,0x17,0x65,0xa7,0xbe,0x50,0xda,0x3c,0x92,0xa5,0x56,0xdc,0x14,0x23,0xae,
-    0xab,0x97,0x32,0x3,0x4b,0xce,0x98,0xa4,0x10,0xfe,0x4f,0x92,0x68,0x7e,0x4f,0xe4,
-    0xaf,0x21,0xdd,0x61,0x35,0xc0,0x11,0xa3,0x5e,0x11,0x50,0xe5,0x25,0xd1,0xb8,0x47,
-    0xa0,0xc0,0x7d,0x4f,0x7d,0x8e,0xbc,0xd7,0x53,0x97,0x9e,0x91,0x1c,0xd3,0xcc,0x34,
-    0xae,0xc,0x8b,0x19,0xd4,0xd8,0xd3,0x46,0x9f,0x41,0x28,0x93,0x9f,0x5f,0x39,0xd1,
-
-    // Record 136: Address = 0x5400, Length = 128
-    0x5400,0x80,
-    0x8b,0x4f,0x40,0xc8,0xa2,0x83,0x82,0xc2,0x9f,0x25,0x93,0xe6,0x28,0xfe,0x4d,0x8d,
-    0x17,0x96,0x89,0xfd,0x28,0xe7,0xee,0x43,0x4b,0xc0,0x64,0x70,0x5,0xec,0x13,0x39,
-    0x89,0x2a,0x31,0xaa,0xc0,0x47,0x35,0x2b,0xbd,0xad,0x80,0xad,0x20,0x4f,0x30,0x6c,
-    0x44,0x31,0x16,0xcf,0x7,0xdd,0x32,0xb5,0xed,0x33,0x5a,0x5f,0x1f,0x1c,0xc2,0x38,
-    0xbd,0xbb,0x55,0x45,0xc5,0x70,0xa,0x63,0x6b,0xa5,0xf5,0xee,0x2b,0x78,0x2f,0xd7,
-    0x54,0xaf,0x9d,0x74,0x6e,0x0,0x4c,0xf8,0xbe,0x49,0xac,0xf0,0xb3,0xa9,0xec,0x6,
-    0xc0,0x65,0xa9,0x99,0xb1,0xff,0x3b,0x3,0x9c,0x30,0xe1,0x23,0xc7,0x21,0xa1,0x1d,
-    0x5a,0x11,0x59,0x8e,0xf5,0x54,0x6b,0x69,0x26,0x76,0x55,0x49,0x10,0x8e,0xb4,0xe9,
-
-    // Record 137: Address = 0x5480, Length = 128
-    0x5480,0x80,
-    0xcd,0xad,0x4c,0x9,0x5d,0x71,0xd8,0xe,0x57,0xb4,0x1,0xb5,0xac,0x98,0x96,0xfe,
-    0xca,0x5,0x40,0x39,0xae,0x50,0x83,0x91,0x42,0xc9,0x26,0xba,0xc,0xac,0xc6,0x6c,
-    0x3c,0xcd,0x62,0x87,0x67,0x1f,0xf0,0x2c,0x4b,0xc5,0xe,0xab,0x67,0x52,0xe4,0x1d,
-    0xd8,0x4b,0x5c,0x81,0x2d,0x4b,0xdb,0x8d,0xc9,0xb8,0x4a,0x9b,0x7e,0xb2,0x92,0xd2,
-    0x60,0x17,0x2a,0xe1,0x7e,0x94,0xa4,0xa3,0x15,0xf6,0x26,0x14,0x19,0xbb,0xee,0x35,
-    0xb3,0xc4,0x5a,0xb4,0xf5,0xb3,0x53,0xd8,0x37,0xa9,0xde,0xda,0xa5,0x91,0xa1,0x29,
-    0x84,0x5f,0x78,0x1f,0xc8,0x26,0x4b,0x21,0x40,0x5c,0x60,0x5b,0x1b,0xf6,0xf,0xaa,
-    0xb9,0x5a,0x71,0xb3,0x78,0x83,0xbc,0x1b,0x5c,0xd3,0x8e,0xb,0x1f,0x76,0xfc,0x31,
-
-    // Record 138: Address = 0x5500, Length = 128
-    0x5500,0x80,
-    0xb5,0x13,0x81,0x65,0xb3,0x7d,0x59,0x24,0xd8,0xd6,0x7f,0xdd,0x6d,0xb2,0x21,0x34,
-    0x97,0xa5,0x48,0x6a,0x17,0xf6,0xa1,0x84,0xad,0x51,0xdb,0xd0,0x9a,0x37,0xc5,0x29,
-    0x5f,0x31,0x14,0xb4,0x1c,0x3c,0x74,0x89,0x7,0x53,0x19,0x22,0xbe,0x2a,0x86,0x6,
-    0xe7,0x58,0xb3,0x2e,0xdf,0x89,0x5c,0xf6,0x16,0xf3,0x3e,0x46,0x4b,0x16,0x2b,0xe9,
-    0x86,0xb7,0xd8,0x73,0xd9,0x84,0xb4,0xfe,0xc0,0xca,0xe,0x3c,0x9f,0x74,0x4c,0xde,
-    0xfc,0xe,0x5a,0xdd,0x41,0x62,0x90,0x49,0xf8,0x30,0xa8,0x9f,0xa9,0xa9,0xed,0xb9,
-    0x54,0x92,0x3a,0x4f,0x74,0xb3,0xb5,0x3a,0xad,0x5b,0x6f,0x55,0x4,0x91,0xe5,0x6a,
-    0x5d,0x3e,0xb7,0x4c,0xe6,0x9,0x42,0x43,0x39,0x77,0xf3,0xe7,0x9e,0xaa,0x4f,0x2,
-
-    // Record 139: Address = 0x5580, Length = 128
-    0x5580,0x80,
-    0xfd,0x42,0x98,0x15,0x67,0xcd,0x6a,0x40,0x49,0x77,0xcf,0x20,0xbc,0x7d,0x22,0xca,
-    0xa5,0x9b,0xc7,0x65,0x71,0x42,0x55,0x67,0x70,0xe5,0xbc,0x8,0xc,0x9d,0xe,0xa0,
-    0x2c,0x2f,0x91,0x76,0xf4,0xcf,0x4a,0x82,0xfa,0x9e,0x33,0xc4,0xbd,0x76,0x0,0xec,
-    0x71,0xab,0xbd,0x64,0x62,0x33,0xd4,0xbd,0x3a,0xbb,0xd5,0x56,0x7a,0xf2,0x7e,0xc8,
-    0xff,0x1d,0xfb,0x11,0x49,0xb6,0x40,0x74,0x4f,0x1c,0xea,0x48,0xe2,0x68,0x72,0x6b,
-    0x3f,0xc2,0x9,0xa2,0x38,0x82,0x51,0x71,0xe9,0xf3,0x76,0x68,0x81,0x6c,0x37,0x16,
-    0x43,0x92,0xd6,0x63,0x68,0x40,0xce,0xc9,0xb3,0x2,0x9b,0xf8,0x34,0x30,0xd,0x68,
-    0xc2,0xc8,0x7c,0x43,0x1a,0x5e,0xcf,0x21,0xf9,0x2,0xae,0xe0,0x25,0xb4,0xd7,0x3e,
-
-    // Record 140: Address = 0x5600, Length = 128
-    0x5600,0x80,
-    0xf3,0x90,0xb3,0x2b,0xd4,0xc6,0xe0,0x4c,0x62,0xf6,0xa3,0x25,0x3c,0x8a,0x91,0x68,
-    0x7,0x6,0x1c,0x3d,0xaa,0x76,0xc1,0x8e,0x8d,0xcf,0x5e,0xb2,0x74,0xdc,0x4d,0x62,
-    0x60,0xc9,0xed,0xda,0x25,0xd6,0x28,0xd7,0x87,0x9b,0x52,0xbd,0xc8,0xad,0x5e,0x75,
-    0xb1,0xbe,0xe1,0x6e,0x27,0x6a,0x18,0xc4,0x99,0xb7,0xc2,0x4f,0xca,0xc,0x4a,0xe6,
-    0xd9,0x76,0x16,0x18,0x1c,0xed,0xf5,0xb4,0xcc,0xe4,0xe4,0x45,0xa9,0x8a,0xcd,0x31,
-    0xf,0x57,0x4c,0x8c,0x20,0x83,0x3f,0xdc,0xba,0x9f,0x0,0xdf,0x7b,0x2d,0x3a,0x16,
-    0x6d,0xb6,0x48,0x11,0xc,0x59,0x2e,0x8e,0x86,0x91,0xde,0xd0,0x17,0xb0,0x4d,0xdd,
-    0x68,0x96,0x8c,0x65,0xd0,0xb7,0x1f,0x3b,0xe1,0x2d,0x8b,0xd,0x22,0x67,0xf6,0x56,
-
-    // Record 141: Address = 0x5680, Length = 128
-    0x5680,0x80,
-    0x6f,0xfb,0xfb,0x5d,0xc2,0x79,0xa6,0x8e,0x92,0x68,0xe1,0x47,0xa3,0xe8,0x59,0x75,
-    0x22,0x5b,0x52,0xdf,0xb3,0x4f,0xfc,0x87,0x68,0xbb,0xed,0x29,0x3c,0xc5,0xec,0xc3,
-    0xa1,0x9e,0x1e,0xcc,0x37,0x2c,0x3d,0x57,0x2f,0xf8,0x29,0x72,0x97,0x11,0x2a,0x5b,
-    0xda,0x5e,0xce,0xe1,0x64,0x4,0xfb,0x7,0xeb,0xa1,0x5c,0xd8,0x17,0x11,0xe0,0x8d,
-    0x1c,0xe4,0x5b,0x6c,0x4b,0xde,0xd7,0x4,0x9e,0x2,0x7c,0xec,0x34,0xd6,0x79,0x3,
-    0xb4,0xad,0x25,0x45,0xd8,0xb2,0x6d,0xc,0x50,0xd7,0x1,0x3b,0x7c,0xe4,0x3e,0xe6,
-    0xb,0xc8,0xc7,0xf9,0x42,0x68,0x4b,0x75,0x97,0x71,0xea,0x24,0xa2,0x20,0x43,0x87,
-    0xf8,0x23,0x80,0xa5,0xab,0x84,0xbc,0xe6,0x93,0x4c,0x14,0x4c,0xca,0xf9,0x6d,0x5b,
-
-    // Record 142: Address = 0x5700, Length = 128
-    0x5700,0x80,
-    0x5a,0xde,0x5e,0xcf,0x24,0x2d,0x20,0x11,0x87,0x4c,0x55,0x68,0x16,0xd7,0x8f,0x8d,
-    0x28,0xa0,0x71,0xc0,0x3b,0x33,0xcb,0x18,0xeb,0x2f,0xf9,0xac,0x7b,0x60,0x8d,0x8f,
-    0xa6,0x2d,0xe,0xcd,0xc9,0x14,0x8a,0x62,0x2f,0xc7,0x80,0xfb,0xcc,0xe4,0x24,0xaf,
-    0xd,0x44,0x9a,0x25,0xbd,0x68,0x66,0xc9,0xb5,0xd3,0x83,0xe0,0xac,0x5f,0x6e,0x1,
-    0x6,0x57,0x3,0xe6,0xd2,0x46,0x9c,0xb5,0x36,0x64,0xaa,0xec,0xa3,0xad,0xd6,0x18,
-    0x40,0xba,0xde,0xf9,0xb9,0xfd,0xa4,0xa1,0x94,0x25,0x20,0x37,0x9a,0x65,0xe1,0x60,
-    0x6c,0x18,0xec,0x5b,0x2d,0x72,0x26,0x58,0xf4,0x3a,0xde,0x73,0x65,0x5a,0xb8,0xc3,
-    0xe7,0x7b,0x36,0xcd,0x41,0x5a,0xfc,0x8f,0xe7,0xc8,0x81,0x19,0x10,0x96,0xe2,0x99,
-
-    // Record 143: Address = 0x5780, Length = 128
-    0x5780,0x80,
-    0x54,0xc6,0x12,0x1e,0xae,0xdc,0xe3,0xd6,0xdd,0xf6,0x83,0x7c,0x22,0xb,0xe8,0xe0,
-    0x5c,0xab,0x9c,0x90,0x2,0xd1,0x52,0xb9,0x36,0xec,0x9d,0xd4,0xd9,0x67,0x8,0x57,
-    0x17,0x9e,0x6a,0x2e,0x2a,0xa4,0x84,0xc0,0xa6,0xf4,0xb6,0x7c,0x80,0x59,0xc2,0xdd,
-    0xc7,0x9e,0x85,0xa1,0x3f,0x41,0x85,0x7f,0xe2,0xca,0xd5,0xac,0x77,0xa6,0x75,0x3d,
-    0x5d,0xee,0x54,0x85,0xd3,0xca,0xe1,0xb3,0x86,0xa,0xe3,0xbd,0x2d,0x9a,0x47,0x3e,
-    0x53,0x23,0xe3,0xcc,0x37,0x84,0xc4,0x6b,0x91,0xab,0x8f,0xdc,0x77,0x55,0xb9,0xd1,
-    0xcd,0xba,0x65,0xc2,0x7f,0xa3,0xad,0x8,0xc1,0xb4,0xaa,0x1,0xab,0x41,0x72,0x14,
-    0x8b,0x59,0x65,0x20,0xb5,0xa,0x84,0x1c,0xcb,0xea,0xec,0x46,0x1f,0x88,0xf4,0xd,
-
-    // Record 144: Address = 0x5800, Length = 128
-    0x5800,0x80,
-    0x17,0x36,0x49,0x35,0x81,0xaa,0x11,0x10,0x22,0xce,0xa,0x0,0xb1,0x16,0x7,0xd2,
-    0xa3,0x9b,0xee,0x22,0x23,0x66,0x1d,0x88,0x17,0xbf,0x9e,0x6c,0x20,0xd6,0xe1,0x4a,
-    0x14,0x44,0x3c,0x92,0xdc,0xac,0xb4,0x39,0x11,0xe7,0xc6,0x96,0xf0,0xe9,0xc6,0x11,
-    0x73,0x97,0x59,0xba,0x8b,0xc4,0x8,0x60,0xf8,0x9f,0x44,0x45,0xd8,0xd0,0x67,0x19,
-    0x5d,0x5c,0x9,0xd,0xe3,0x8,0x1,0x6b,0xc1,0x49,0x3b,0xc6,0x1d,0xbc,0xb2,0xc,
-    0x49,0x49,0x24,0xe5,0x55,0x27,0x8c,0x23,0x78,0x10,0xa1,0x34,0x2d,0x3,0x1,0x3a,
-    0x71,0x44,0x4f,0x4,0xd5,0x96,0xc,0x1,0x51,0xe4,0xf9,0x59,0x20,0xf6,0x64,0x5d,
-    0x8b,0x75,0xf1,0xf7,0xea,0x3e,0xd8,0x34,0x50,0x89,0x93,0x5c,0x55,0x25,0xd5,0x91,
-
-    // Record 145: Address = 0x5880, Length = 128
-    0x5880,0x80,
-    0xd0,0x2b,0x8,0x19,0x48,0x67,0x6b,0x31,0x7c,0xd5,0x28,0x54,0x85,0x14,0xc9,0xda,
-    0x77,0x98,0xaa,0x9e,0xe1,0x33,0x55,0x21,0xe2,0xec,0x40,0x16,0x87,0x4,0x41,0x4,
-    0xd0,0x27,0x89,0x7a,0x96,0x3f,0x44,0xb3,0x17,0xb4,0x4d,0x16,0x9b,0xc,0x31,0xe5,
-    0x91,0xa4,0x92,0xa,0x3f,0x5c,0x58,0xd8,0x27,0x9f,0xdb,0x2,0xa9,0x6b,0xbe,0x37,
-    0xd,0x1e,0xf2,0x46,0x10,0x70,0xb2,0x3e,0x6b,0xdb,0xde,0xc7,0x9b,0xb9,0x5d,0x44,
-    0xbd,0x1c,0x7c,0x1c,0x27,0x26,0x8f,0x0,0xd4,0x57,0xe3,0x23,0x8,0x63,0x77,0x26,
-    0xa8,0x6a,0xad,0xcf,0x47,0xce,0x91,0xf2,0x1d,0x16,0xde,0xa9,0xbf,0x7,0xb9,0x91,
-    0x85,0x9e,0xed,0x35,0x14,0x4b,0x20,0xcd,0x36,0x78,0xed,0x3,0x8a,0x4e,0x5,0xc6,
-
-    // Record 146: Address = 0x5900, Length = 128
-    0x5900,0x80,
-    0x59,0x76,0xea,0x2b,0x74,0x7,0xbb,0x62,0x27,0xa1,0x5b,0xc1,0x84,0x75,0x3c,0x7f,
-    0x2d,0x43,0xbe,0x89,0x80,0xe0,0x47,0x19,0x34,0x13,0xb1,0x9b,0x31,0x4b,0x77,0x87,
-    0xeb,0x15,0xc7,0x98,0x76,0x9e,0xa0,0x1a,0x40,0x20,0x46,0x7e,0xe7,0x9c,0xc7,0xd8,
-    0x32,0x3d,0xb4,0xab,0x9c,0x3b,0xd8,0x9a,0x32,0x92,0x1b,0x15,0x67,0x21,0xd4,0x62,
-    0xe7,0x25,0xe3,0x67,0xb9,0x2f,0x50,0x45,0xf6,0xe6,0x1b,0xa4,0xa7,0xbf,0x3b,0x7a,
-    0x6e,0xd0,0x83,0xc9,0xcd,0xc,0x8a,0x75,0xb7,0x66,0x64,0x3e,0x32,0x9f,0x71,0xa8,
-    0x61,0xf4,0xce,0x81,0xa8,0xcf,0xa,0x3b,0x69,0x1e,0x66,0x36,0xf6,0xf0,0x89,0xb9,
-    0xb6,0xb2,0x64,0x2d,0x78,0x75,0x7a,0x4a,0xf1,0xc5,0xd9,0xbe,0x51,0x99,0xb2,0xe5,
-
-    // Record 147: Address = 0x5980, Length = 128
-    0x5980,0x80,
-    0xb9,0x9a,0x53,0xb7,0xca,0x79,0xe4,0x87,0x74,0xe2,0x28,0x3b,0x15,0xc0,0xb3,0x90,
-    0xc8,0xf,0x36,0xdd,0xee,0xe0,0xd6,0xa2,0x6f,0x5e,0x60,0x15,0x62,0x63,0xa4,0xc1,
-    0xb1,0x63,0xc9,0xb1,0xe0,0x12,0xb6,0x47,0x6c,0x11,0xde,0xb5,0xa5,0xe9,0x2c,0xd3,
-    0x74,0x38,0x1b,0xb6,0x65,0x70,0x30,0x61,0x58,0xa7,0xe2,0xbb,0xe8,0x79,0xe3,0x85,
-    0x9e,0x48,0x64,0xe1,0xaf,0xe5,0xc1,0xeb,0xef,0xbf,0xbd,0xcd,0xce,0xd,0x0,0xd8,
-    0x9f,0xd,0x2a,0x1c,0x2c,0x60,0xba,0xe,0x51,0xf5,0xbe,0x53,0xb9,0xbb,0xe4,0xd1,
-    0xf7,0xc4,0xe4,0x89,0x33,0x50,0xc5,0xc8,0x75,0xc6,0xdf,0x84,0x53,0x4e,0x3b,0x46,
-    0xf7,0x61,0x4c,0xa7,0x33,0xa0,0x7b,0x69,0xb2,0xee,0x9d,0xf4,0xfa,0x9e,0xc,0xd,
-
-    // Record 148: Address = 0x5a00, Length = 128
-    0x5a00,0x80,
-    0x6a,0xc7,0x4,0x59,0xa4,0x20,0x7c,0xb,0x74,0xb1,0x94,0x67,0xb3,0x6f,0xed,0x8c,
-    0x8,0x15,0xbd,0x87,0x7,0x18,0xe6,0x26,0x8b,0x61,0x69,0x31,0x9b,0xf6,0x44,0x44,
-    0x20,0xce,0xb9,0xc5,0x6f,0x7e,0x36,0x4e,0xc3,0x22,0xc1,0xa3,0xdd,0x1b,0x3a,0xb9,
-    0x16,0x71,0x1,0x2a,0xb7,0x2e,0x7b,0xeb,0xe2,0x3b,0x82,0x2a,0xc9,0xe9,0x7b,0x59,
-    0xd,0x64,0x87,0x6b,0x46,0xb9,0x5c,0x18,0xde,0x55,0x15,0x29,0xfa,0x87,0xe2,0xc1,
-    0x33,0xf9,0x71,0xa1,0x71,0x78,0x4a,0xb1,0x31,0x77,0x48,0x41,0x24,0x6e,0x68,0x77,
-    0xff,0x9f,0x84,0x1c,0xdc,0x2d,0x47,0x2b,0xd4,0x3,0x9c,0xa1,0xbe,0xff,0xcb,0xb6,
-    0x5b,0xa,0x14,0x1,0xc,0x62,0xe8,0x5,0xb0,0xd1,0x5a,0xec,0xc9,0x1f,0x3a,0xa1,
-
-    // Record 149: Address = 0x5a80, Length = 128
-    0x5a80,0x80,
-    0x60,0xcd,0xe5,0x60,0xd5,0xac,0x84,0x36,0x3a,0xb2,0xf4,0xb0,0x9,0xa9,0xbb,0x9e,
-    0x5f,0xe9,0xf7,0xfc,0x82,0xd1,0x7e,0x67,0x14,0x7a,0x17,0xa3,0x94,0xc6,0x7e,0xff,
-    0xa,0xa4,0x3e,0x26,0xf0,0xf7,0x57,0x44,0x2a,0xae,0x12,0x6d,0xfd,0xb5,0xbb,0x43,
-    0xa2,0x60,0x19,0x53,0x56,0x6,0xc7,0x3d,0xb5,0x4e,0x29,0x5d,0xa6,0x6b,0xab,0xb2,
-    0x5,0x1d,0xa1,0xbf,0xe3,0x4b,0x3f,0x6b,0x5a,0xc8,0xce,0x9f,0xd0,0x24,0xcf,0x70,
-    0xb8,0x32,0xd,0xe4,0xc1,0x4f,0x52,0x58,0x54,0xb4,0x6d,0x8a,0xe9,0xd6,0x98,0xf1,
-    0xa8,0x4c,0x97,0x3e,0xfd,0xcd,0x4c,0x54,0x5a,0x20,0x6d,0x87,0xc2,0xd6,0x22,0x29,
-    0xce,0x36,0x2c,0x49,0x2a,0x3c,0x22,0x89,0xee,0x78,0x90,0x90,0xd4,0x9,0x99,0x44,
-
-    // Record 150: Address = 0x5b00, Length = 128
-    0x5b00,0x80,
-    0x28,0x36,0xa8,0x91,0x3c,0xf8,0x5a,0xbc,0x90,0x86,0x87,0xf8,0xa5,0x30,0x93,0xeb,
-    0x1c,0xd4,0x76,0x77,0x9e,0x26,0x9f,0x75,0x10,0x61,0xb6,0x91,0xa8,0xc6,0xf2,0x26,
-    0xdb,0x88,0x8c,0x63,0x6b,0x81,0xc0,0xdc,0xe1,0x4d,0xb6,0xca,0x6c,0x49,0xd2,0xf0,
-    0xc,0x8a,0x26,0xfc,0x59,0xf2,0xbb,0x8a,0x4c,0xd6,0xa4,0xdb,0xc2,0xf9,0x5a,0x94,
-    0x4e,0x8b,0xaf,0x25,0x40,0x1d,0x2,0xc1,0x6c,0x72,0x51,0x78,0x35,0x7e,0xb4,0x37,
-    0x8,0x52,0x4b,0x4e,0x9d,0xff,0x4d,0xf6,0xe7,0x62,0x28,0xec,0xe1,0xdd,0x39,0x72,
-    0x20,0xb7,0x25,0xdf,0xe5,0xbc,0xd7,0x25,0x31,0xe4,0x16,0x28,0x64,0x3d,0x1a,0x85,
-    0x92,0x7b,0x11,0x39,0x2c,0x23,0x6a,0xef,0xb6,0xc8,0x1a,0xa1,0x7f,0x8c,0xc2,0x98,
-
-    // Record 151: Address = 0x5b80, Length = 128
-    0x5b80,0x80,
-    0x28,0xbe,0xc3,0x80,0x79,0xd2,0xf7,0xb9,0xf6,0xcc,0x1f,0xd2,0x97,0x91,0x8a,0xe1,
-    0xac,0xb3,0x18,0x9e,0x47,0x8c,0x76,0x2c,0xc9,0xec,0x9,0x30,0x4b,0x7,0xa0,0x97,
-    0x77,0xb8,0x12,0xf1,0x3,0x6a,0xde,0xa6,0x25,0x62,0xd4,0xc5,0xc2,0x10,0xeb,0xa9,
-    0xb4,0xde,0x4,0x31,0x3f,0x4a,0xfc,0xb3,0x5f,0xfd,0x33,0xf6,0x90,0x6f,0xd3,0xd9,
-    0x9a,0x2b,0x8c,0x78,0xe0,0x8e,0xaf,0x88,0x14,0x91,0x6,0x70,0x58,0x81,0xed,0x2e,
-    0x19,0x98,0x6d,0xf5,0x16,0xa8,0x46,0x87,0x5b,0xb9,0x6,0x35,0xfd,0x6e,0xb2,0xa8,
-    0x4a,0x9a,0x23,0x1f,0xaa,0x28,0x95,0x37,0x9a,0x5e,0xb3,0x61,0x19,0xb8,0x54,0xbc,
-    0xd8,0xfc,0xed,0x5b,0x1e,0x57,0xde,0xc0,0xd5,0xd3,0x94,0x1c,0x44,0xfd,0xc8,0xb8,
-
-    // Record 152: Address = 0x5c00, Length = 128
-    0x5c00,0x80,
-    0xb5,0x79,0xa5,0xa1,0xe6,0xeb,0x25,0x7,0x2a,0x74,0x7c,0x52,0x81,0xa0,0xd2,0xa4,
-    0x2a,0x6,0xbc,0x1c,0xe5,0xab,0x73,0x92,0x8f,0x26,0x98,0xea,0x66,0x7b,0xb1,0x54,
-    0x12,0xd6,0x9a,0xa,0x66,0xfd,0x84,0x85,0x90,0x5a,0x5d,0xe8,0xb4,0xef,0xf7,0x78,
-    0x93,0xf8,0xcc,0xe8,0x12,0x6d,0x9,0x3b,0x21,0xd1,0xc8,0xa,0x9a,0x3f,0xfe,0x3f,
-    0x2a,0x61,0xc4,0x41,0x7,0x1d,0xf3,0x62,0xdc,0xb9,0x56,0xa2,0xe0,0xa2,0x28,0x49,
-    0x44,0xbd,0x31,0x3,0x0,0xdb,0x16,0xf,0x6c,0x43,0x3b,0x17,0x3d,0x9a,0xd6,0x2f,
-    0xa6,0xa5,0xe1,0x2f,0xa2,0x20,0xe5,0x32,0x51,0x62,0x45,0xeb,0x97,0xda,0x2c,0xe8,
-    0x77,0x6c,0x56,0xca,0x1,0x18,0x7,0xc9,0xab,0xd6,0x99,0xbd,0x4d,0x84,0xd7,0xed,
-
-    // Record 153: Address = 0x5c80, Length = 128
-    0x5c80,0x80,
-    0xc2,0x9f,0xf8,0x8c,0xcc,0x1f,0xb9,0x52,0x7c,0x97,0x14,0x3b,0xc9,0x2c,0x5c,0x4d,
-    0x56,0x16,0xe1,0xcc,0x93,0x1d,0xae,0xe4,0x9f,0x2a,0x94,0x76,0xac,0xa4,0xde,0xae,
-    0x79,0x57,0x38,0x71,0x96,0xbb,0x52,0x8d,0xa9,0xd,0xc6,0xb8,0xd0,0x3e,0xde,0x17,
-    0x72,0x2a,0x78,0x6b,0x13,0x0,0xed,0x14,0x5a,0xbb,0xa9,0x6c,0x23,0x31,0xc6,0xf4,
-    0x81,0xa2,0xf9,0xf6,0xf5,0xc,0xa6,0xf7,0x76,0x19,0xf3,0xfa,0x31,0xaa,0xe1,0x45,
-    0x5a,0x21,0xa4,0x16,0x52,0x45,0xf9,0x4a,0x41,0xff,0xd9,0xd3,0x7e,0x54,0x52,0xf7,
-    0x70,0x46,0x79,0xbd,0x66,0xcb,0x53,0xfe,0x54,0x56,0xfb,0xab,0x1c,0x76,0xe5,0x7a,
-    0x2a,0x32,0x25,0x18,0xc3,0x5a,0x21,0x45,0xeb,0xbb,0xec,0x6a,0xd9,0x5f,0xb0,0x97,
-
-    // Record 154: Address = 0x5d00, Length = 128
-    0x5d00,0x80,
-    0xe1,0xd9,0xb8,0xee,0xda,0xc9,0x12,0xad,0x42,0xa3,0xbb,0x7,0x5a,0x12,0xe9,0xcb,
-    0xbd,0xb6,0x30,0x25,0x50,0x8d,0xf2,0xb,0xe,0xe6,0xea,0xbe,0xed,0xb0,0x5e,0xcd,
-    0x6b,0x4c,0x60,0x22,0x91,0xfe,0x35,0xde,0xf1,0xfe,0x7d,0xca,0xe4,0xd7,0xc5,0x3d,
-    0xa6,0xcc,0xa6,0x76,0x5d,0x3c,0xaa,0xdb,0x26,0x55,0xa4,0xbd,0x99,0x8e,0xe3,0xef,
-    0x2b,0xea,0x1d,0xf8,0x17,0x7e,0xce,0x63,0x7,0xf5,0x71,0x69,0x6d,0xa,0x6d,0x8e,
-    0xb,0x10,0xcf,0x1c,0xed,0x1f,0x1f,0x11,0x94,0x8,0x4a,0xd6,0x50,0x38,0x3a,0x57,
-    0xc7,0xc6,0xe3,0x9b,0x2b,0x6c,0xcb,0xac,0xe1,0x4f,0xda,0xe2,0x54,0x89,0x7a,0x55,
-    0x67,0x68,0xf,0x9b,0x15,0xb2,0x99,0x4a,0x4d,0x88,0xc7,0x4e,0x14,0x81,0x61,0x30,
-
-    // Record 155: Address = 0x5d80, Length = 128
-    0x5d80,0x80,
-    0x18,0xe4,0x54,0x46,0x7f,0x49,0xd3,0xec,0x3a,0xb5,0xf8,0xa0,0xa5,0xe7,0x40,0x34,
-    0x80,0x7b,0xb1,0xac,0x4b,0x9c,0xc0,0x9b,0x28,0x97,0x67,0xa0,0xdb,0x2c,0x58,0x6f,
-    0x1b,0x6d,0x54,0x8,0x3e,0x84,0xc9,0x39,0x8f,0x9c,0xa8,0xf4,0xf9,0x79,0x26,0xf2,
-    0x29,0x21,0xdf,0x3c,0xbc,0xce,0x9a,0x16,0x6a,0xe7,0x9c,0x12,0x66,0x8b,0xf0,0x40,
-    0x6b,0x9,0x88,0x61,0x2a,0x21,0xed,0xf2,0x31,0xc0,0xed,0x86,0x5d,0x33,0xb4,0xd6,
-    0xe0,0xda,0xe8,0x6c,0xbc,0x90,0xa1,0x48,0xce,0x34,0x13,0x2e,0x1,0x98,0xb6,0x93,
-    0x38,0x4,0xd3,0xf9,0xca,0x40,0x37,0xf9,0x52,0xc2,0x5c,0x92,0xf2,0x4e,0x7a,0x39,
-    0xe9,0xeb,0xa1,0x8a,0x11,0xf,0x2f,0x55,0x50,0x1a,0x26,0x94,0xa2,0x1d,0xd3,0xf7,
-
-    // Record 156: Address = 0x5e00, Length = 128
-    0x5e00,0x80,
-    0x24,0x95,0x77,0xda,0xa3,0xb5,0x66,0xf5,0xec,0x11,0x1,0x3c,0xf8,0xd2,0xc,0x7f,
-    0xc,0x4e,0x3c,0xb3,0x55,0x3,0x21,0x1b,0x9c,0x62,0x3f,0x10,0x5d,0xd,0x8d,0x84,
-    0xec,0x65,0xd4,0x12,0x8,0xcf,0xf2,0x15,0xda,0x53,0xa0,0xf3,0xb2,0x39,0xbf,0xf9,
-    0x59,0xb4,0xa4,0x25,0x45,0xc9,0x99,0xb9,0xeb,0xab,0x8f,0x89,0xbe,0x62,0x9c,0xe5,
-    0x37,0x4c,0xb1,0xd7,0x21,0x39,0xc8,0xb2,0x98,0x6b,0xe5,0xb0,0xf7,0x54,0xf7,0xe2,
-    0x5a,0xb7,0x6e,0x67,0x21,0x5c,0x8e,0x61,0x4e,0xa4,0x8c,0x35,0x18,0x65,0x5,0x68,
-    0x47,0x32,0x13,0x78,0xb7,0xc3,0x3e,0xfc,0xfb,0x12,0x2e,0xcb,0xcd,0x1d,0x3c,0x18,
-    0x42,0xf9,0xbe,0x1f,0xbb,0xd5,0x71,0x1b,0x77,0x1a,0xc9,0x2b,0x14,0xc8,0x5c,0xb4,
-
-    // Record 157: Address = 0x5e80, Length = 128
-    0x5e80,0x80,
-    0xc8,0xce,0x72,0xf9,0x12,0x90,0xb,0x86,0xb7,0xa7,0x83,0x84,0x9a,0x8b,0xd,0x9a,
-    0xa0,0x91,0x7,0x62,0x9a,0x3f,0x29,0x37,0x28,0xe9,0x3b,0xa4,0xd7,0xd5,0x2d,0xca,
-    0x20,0xd,0x56,0x3a,0xf1,0xdf,0xaf,0x8f,0xbb,0x38,0x2,0x9f,0xf2,0x3e,0x91,0x9b,
-    0x17,0xa4,0xa2,0x87,0x61,0x82,0xb4,0x22,0xd8,0x1c,0x3b,0xe6,0x99,0x97,0xd6,0x98,
-    0x5c,0x1f,0xe1,0xc8,0x28,0x80,0x6d,0x86,0x74,0xc,0xf3,0x34,0x1d,0x9e,0x32,0x17,
-    0x7,0xab,0x53,0xbe,0x55,0x56,0x5e,0x32,0xfc,0x48,0x71,0x8b,0xc8,0x9f,0xd8,0xb4,
-    0x2a,0x3f,0xe6,0xe6,0xd1,0x8c,0x4a,0xbe,0xf9,0xc0,0xfc,0xa7,0xef,0xde,0xc5,0xdb,
-    0x65,0xfa,0x6a,0x8c,0x27,0x37,0x4f,0xe7,0xaa,0x2e,0x6,0xfe,0xff,0x91,0x4,0xf3,
-
-    // Record 158: Address = 0x5f00, Length = 128
-    0x5f00,0x80,
-    0x92,0xde,0x5a,0x31,0x30,0x8f,0xcb,0xd4,0xd9,0x5d,0x22,0x93,0xca,0x8f,0x46,0x58,
-    0xf6,0x95,0x93,0x61,0xac,0x2c,0x36,0x52,0xed,0xc8,0x5d,0xb3,0xfe,0x66,0x82,0xe,
-    0x3d,0x81,0x45,0x3a,0xa4,0x34,0x80,0xe,0x59,0x6,0x90,0x84,0xc4,0x13,0xac,0x6c,
-    0x97,0x3a,0x26,0xca,0xe,0x4f,0xe0,0x8d,0x60,0xfc,0x7a,0x36,0xa,0x0,0xf9,0xb6,
-    0xc9,0xe2,0x7e,0xda,0x67,0x24,0x1b,0x28,0xa9,0x35,0xe4,0x39,0xaa,0xb3,0x7b,0x50,
-    0xd0,0x96,0x18,0x40,0x5f,0xf7,0xfc,0x50,0x8c,0x1c,0x60,0xa4,0xf1,0xf8,0x5c,0x4f,
-    0x25,0xf6,0xc1,0xed,0xe1,0x8a,0x8b,0x44,0xbe,0x4e,0x9c,0x8b,0xf3,0x41,0xdf,0xc2,
-    0x25,0x7a,0x6c,0xd7,0x67,0x30,0x4d,0x76,0xeb,0x53,0x10,0x34,0x29,0x96,0xa9,0x91,
-
-    // Record 159: Address = 0x5f80, Length = 128
-    0x5f80,0x80,
-    0x18,0x39,0xab,0xd7,0x31,0xcc,0x91,0x97,0xeb,0x21,0x61,0xf4,0x6d,0xf6,0xed,0xb0,
-    0x60,0x48,0xb6,0x53,0x37,0xe7,0x53,0x94,0x5b,0xc7,0xd0,0x27,0xcc,0x58,0x7c,0x45,
-    0x17,0xe4,0x73,0xa4,0x6,0x5a,0x58,0xb3,0xb7,0x2f,0xb2,0xeb,0x88,0x7a,0x2f,0x45,
-    0x5,0xfe,0x48,0x7a,0xfa,0xc4,0x4f,0xad,0xf9,0x2c,0x6c,0x5f,0x19,0x7e,0xa4,0xa2,
-    0xac,0x12,0xdc,0xdb,0x73,0x81,0x64,0x72,0x9f,0x61,0x54,0x69,0xf9,0x5b,0x5b,0x0,
-    0x9f,0x5d,0x51,0x69,0xa1,0xcd,0xb6,0x14,0x61,0x90,0xc9,0x8f,0x69,0x48,0x64,0x6d,
-    0x3f,0x8,0xff,0x1f,0xbd,0x40,0x5e,0x2c,0x54,0xa2,0xa2,0xe2,0xcc,0x39,0xd0,0xa6,
-    0xa5,0x21,0xe9,0x88,0x72,0xa9,0x3d,0xa,0x7f,0x44,0x50,0x22,0x28,0x63,0xab,0x80,
-
-    // Record 160: Address = 0x6000, Length = 128
-    0x6000,0x80,
-    0x61,0xe5,0xcc,0xd4,0xd6,0x69,0xab,0xed,0x83,0xff,0xce,0x5e,0x67,0x4e,0x8,0x67,
-    0xf2,0xc,0xa2,0x75,0x2f,0x68,0x84,0x25,0x93,0x4e,0xe1,0x7,0xf5,0x14,0x60,0xec,
-    0x9c,0xfd,0x2c,0xf7,0xb3,0x29,0x4a,0xe7,0x45,0x27,0x53,0x6f,0xda,0x3e,0x45,0x13,
-    0x77,0xa3,0x42,0x18,0x47,0xb,0xea,0x7d,0x82,0x19,0xe1,0x96,0x60,0x38,0x2,0x86,
-    0xf7,0x12,0xa8,0x4c,0x83,0xde,0x4a,0xfc,0x7d,0xdf,0x78,0xb5,0xb4,0xe4,0x4,0xa9,
-    0xe6,0xeb,0x59,0x9d,0x4a,0x5d,0xd8,0x23,0xf9,0x85,0x6a,0x55,0x1b,0xe,0x95,0x9c,
-    0x83,0x1e,0x70,0x8b,0x58,0x1,0xdd,0x7f,0x71,0x67,0xa3,0xb9,0x15,0x8b,0x54,0x88,
-    0x41,0xf7,0x38,0xfa,0xe1,0x51,0x7c,0xf5,0x41,0x20,0xb7,0xf5,0x31,0x4,0x7f,0x35,
-
-    // Record 161: Address = 0x6080, Length = 128
-    0x6080,0x80,
-    0x8a,0x39,0xe3,0x2b,0xf,0x99,0x49,0xef,0x93,0x8b,0xda,0x7e,0xd5,0xbe,0x34,0x99,
-    0xbb,0x87,0x4b,0xec,0x75,0x36,0x25,0xd4,0xa7,0x4f,0x92,0x3c,0x48,0x2,0x95,0xab,
-    0x91,0xd3,0xbc,0xdd,0x47,0x91,0xad,0xda,0x2f,0x21,0xf,0xda,0x47,0x25,0x28,0x18,
-    0x2d,0xdb,0xa3,0xce,0xde,0xce,0xc5,0xbf,0x64,0x3,0x45,0x69,0x9,0x94,0xa3,0x9d,
-    0x1d,0x12,0x58,0x97,0xaf,0x63,0x63,0x56,0xf4,0x59,0x26,0xce,0x4f,0xd2,0x1a,0xf2,
-    0x32,0x79,0x26,0x4c,0xaf,0x21,0x2e,0x7f,0x38,0x6,0x17,0x4a,0x6c,0x7d,0xdd,0xd8,
-    0x22,0x85,0x25,0x96,0xb9,0x73,0xe7,0xc4,0x35,0xfd,0x96,0x79,0x94,0xc7,0x65,0xad,
-    0xb5,0x6b,0x60,0xb4,0x5f,0xb0,0x92,0xac,0x3d,0xfc,0xa6,0x1d,0xd9,0xd9,0x13,0xc0,
-
-    // Record 162: Address = 0x6100, Length = 128
-    0x6100,0x80,
-    0xa,0x5c,0xf5,0x2f,0x9f,0x21,0x69,0x97,0xe8,0x1a,0x68,0x44,0x4a,0xc0,0xdb,0xf,
-    0x36,0xe0,0xad,0xde,0x5a,0xe,0x79,0x43,0x14,0xf9,0x90,0xfe,0xd2,0x2a,0x57,0xbe,
-    0x4e,0x23,0xc4,0x7f,0xc3,0xa0,0x55,0xf4,0x37,0x13,0xf6,0xf0,0x58,0x96,0xdd,0x46,
-    0x32,0x19,0x46,0x6c,0xfc,0x8d,0xb6,0xc8,0x37,0x36,0x1a,0xb9,0x17,0xab,0xf8,0x40,
-    0x72,0x44,0x7d,0x4c,0x49,0xce,0x29,0x60,0x6c,0x18,0xd4,0xa4,0x20,0x16,0x12,0xb5,
-    0x26,0xaf,0x47,0x97,0x15,0xe1,0xe2,0xd4,0x4b,0x35,0x2c,0x2a,0xc3,0x7e,0x3,0x36,
-    0x30,0xf3,0x64,0x74,0xe0,0xfc,0x9e,0x1c,0x7f,0x63,0x66,0xe0,0xe2,0xcc,0x60,0xc2,
-    0xf7,0xfb,0x8c,0x26,0xa,0x82,0xe5,0xf4,0x58,0x38,0xd7,0x47,0xd2,0xa4,0x54,0xf6,
-
-    // Record 163: Address = 0x6180, Length = 128
-    0x6180,0x80,
-    0xcd,0x8f,0x9c,0x92,0xcc,0x22,0x64,0x8f,0x44,0xd7,0x86,0x0,0xee,0xbc,0xb5,0x83,
-    0x21,0xd3,0xba,0x87,0x3d,0x3b,0x14,0x3,0x15,0x3,0xd5,0xe7,0xce,0x3e,0xf6,0x9,
-    0xb3,0x5e,0xf,0x41,0x44,0x30,0xc6,0xd,0x50,0xd5,0xfd,0xaa,0xc3,0x4c,0x81,0x10,
-    0x69,0x1,0x1e,0x9c,0x3b,0xe9,0x9d,0x39,0x4f,0x23,0xff,0x4,0xf,0xa8,0x1e,0x48,
-    0x52,0x5,0xee,0x6e,0xce,0x74,0x8f,0x39,0x3d,0x26,0x4,0xc2,0x55,0x7a,0xfe,0x16,
-    0x84,0x64,0x45,0xd5,0x8f,0x81,0x65,0x45,0xeb,0x62,0x8f,0xef,0x24,0x27,0x5a,0x38,
-    0xc5,0xc4,0xab,0x86,0x8c,0x35,0x3a,0xb9,0xa2,0x8e,0x68,0x6b,0x9f,0xf5,0x76,0xe0,
-    0x70,0xf2,0xe3,0x63,0xbd,0x76,0xaf,0x58,0xfa,0xd3,0x10,0xc3,0xdb,0x46,0x7a,0xcc,
-
-    // Record 164: Address = 0x6200, Length = 128
-    0x6200,0x80,
-    0x30,0x48,0x87,0x7b,0x1d,0xb4,0x4e,0x4c,0xc0,0x3c,0x8,0x36,0x1e,0xeb,0x27,0xe,
-    0x60,0x7,0xfc,0xe0,0x9d,0xf8,0xa0,0xfd,0x2b,0x7b,0xcc,0x75,0x7e,0xf3,0xa2,0xf8,
-    0xda,0x31,0xa5,0x5e,0x13,0xb7,0x36,0x99,0x5b,0x1f,0xd9,0x71,0x74,0x8f,0x22,0xf,
-    0xd0,0xb5,0x4b,0x62,0x7b,0x2f,0x7b,0x10,0x28,0xd6,0xaf,0xfa,0xe2,0x64,0x43,0x73,
-    0x4,0x38,0xa2,0xfd,0x86,0xd0,0x72,0xae,0x9f,0x84,0x1f,0x9b,0x6c,0x4b,0xb0,0x20,
-    0xbe,0xf4,0x34,0xc4,0xf,0xa,0xf4,0x89,0xeb,0x4d,0x29,0x11,0x4e,0xba,0xd8,0xc6,
-    0x44,0x60,0x5f,0x90,0xb7,0xc6,0xe6,0x37,0x79,0xff,0xa5,0x6e,0x3d,0x3d,0x73,0x4,
-    0xb4,0x52,0x27,0xd3,0x27,0x57,0xc3,0xfb,0xb6,0xbb,0x71,0x43,0x6b,0x9b,0x9a,0x2f,
-
-    // Record 165: Address = 0x6280, Length = 128
-    0x6280,0x80,
-    0x2,0xe7,0x6e,0x95,0x69,0x87,0x84,0x24,0x6d,0x40,0x62,0xf0,0x7c,0xd5,0x48,0x52,
-    0x3,0x2d,0x23,0xc6,0xcc,0x2,0x18,0xb,0xbc,0xe2,0x22,0xc0,0xf6,0x65,0xa1,0x48,
-    0xea,0xeb,0xa3,0x2c,0x76,0xe7,0xe1,0x50,0x86,0x4e,0xff,0x4a,0xbc,0x8,0xd8,0x8a,
-    0x6d,0x59,0x61,0x77,0xbf,0xa9,0xfd,0xed,0x49,0xb,0x14,0xf8,0x5b,0x6f,0x58,0xba,
-    0xcf,0x4c,0xb9,0x64,0x51,0xfb,0xed,0x59,0xcb,0x8c,0xfd,0x2,0x23,0x51,0x20,0xa6,
-    0x62,0xb8,0x66,0x83,0x5f,0x63,0xd2,0x31,0xf1,0xc,0x6f,0xe5,0x68,0x8b,0x50,0x72,
-    0x94,0x45,0x43,0x56,0x6e,0x2b,0xdd,0xbe,0x3a,0xfc,0x99,0x8d,0x70,0xc4,0xf9,0x3,
-    0xd8,0xc7,0x4c,0x58,0x30,0xa4,0x79,0x23,0xcd,0x6a,0x36,0x25,0xb3,0xed,0x62,0xb3,
-
-    // Record 166: Address = 0x6300, Length = 128
-    0x6300,0x80,
-    0x69,0x65,0xc6,0xab,0xd6,0x91,0x49,0xdd,0x6d,0xda,0x74,0x26,0xb4,0x1d,0x74,0x5e,
-    0x16,0xcb,0xee,0x7,0x7,0x8a,0x66,0xad,0xda,0x40,0xb8,0xc1,0xfe,0x6,0x1,0x9b,
-    0x6e,0x20,0xb6,0xcc,0x1f,0x9d,0xcb,0xbd,0x9d,0x49,0x54,0x83,0x6a,0xc1,0xb2,0xdf,
-    0x3c,0xf,0xec,0x44,0xfc,0xe7,0xd,0x88,0x9e,0x86,0xb0,0x4c,0x9a,0xa1,0x9,0xa2,
-    0xe6,0x2b,0x10,0x2b,0xa9,0xc,0xe4,0x51,0x35,0x2c,0x72,0xe,0xcf,0x9f,0xe0,0x1b,
-    0x9e,0x69,0x69,0xce,0x4e,0xc5,0x12,0xf7,0x7e,0xcc,0xb,0x45,0xc3,0x62,0x27,0x57,
-    0x72,0x6e,0x5a,0xb2,0xf2,0x10,0x26,0xa9,0x77,0xd,0xd7,0xfc,0x87,0x87,0x64,0x44,
-    0x22,0xea,0xc2,0xd8,0x84,0x27,0x98,0x4c,0x1c,0xc,0xd2,0x57,0x92,0x2d,0xdd,0xbb,
-
-    // Record 167: Address = 0x6380, Length = 128
-    0x6380,0x80,
-    0x36,0x94,0x28,0xb4,0xd,0x3b,0x2f,0x54,0x67,0x1d,0x9f,0x63,0xf7,0x1a,0xf1,0x27,
-    0x8a,0x55,0xec,0x21,0x97,0x49,0xeb,0x35,0xdb,0xf7,0x3d,0x31,0xbc,0x9d,0x5b,0xee,
-    0x7,0x4a,0x2f,0x48,0x35,0x57,0x63,0xdb,0x47,0x63,0x55,0x5b,0x30,0xa,0x7,0x85,
-    0xc4,0xc4,0xe4,0xbf,0x7c,0xda,0x4c,0xd6,0xb5,0x67,0xc7,0x17,0x77,0x82,0xe0,0xe0,
-    0xf0,0x26,0x32,0xe7,0xff,0x5a,0xa8,0x30,0x23,0x2a,0xbf,0xd4,0x84,0x5c,0xaa,0xbd,
-    0x94,0x50,0xdf,0xa9,0x4f,0xb1,0xee,0x7b,0xe9,0xb3,0x88,0xa,0x62,0xe2,0x90,0x51,
-    0xe1,0xb1,0xf4,0x7e,0x28,0x51,0x58,0x86,0x82,0xf8,0x8e,0xc9,0x2d,0x32,0x69,0xa5,
-    0x46,0x53,0xf3,0x7c,0xd9,0x11,0x40,0x7,0xf4,0x6c,0x16,0x5,0xfc,0x41,0xc0,0xcb,
-
-    // Record 168: Address = 0x6400, Length = 128
-    0x6400,0x80,
-    0xe2,0x37,0x12,0x53,0x51,0x6c,0x64,0x92,0x1e,0x8f,0x2c,0x45,0xab,0x34,0xde,0x51,
-    0xe9,0x22,0x3c,0xb1,0x71,0xfa,0x16,0xde,0xc2,0x32,0x86,0xb,0x13,0x2d,0x5d,0x18,
-    0x15,0xfc,0x8b,0x1d,0x3d,0x1b,0x10,0x7d,0xf7,0x67,0x14,0x12,0xb0,0xc5,0x4e,0x19,
-    0x1a,0xbe,0x1b,0xf9,0x5e,0x9,0x64,0x36,0x1a,0x86,0x32,0xa0,0x44,0x8d,0xc5,0x36,
-    0xf5,0xca,0xb1,0x7e,0x79,0xd1,0x0,0x56,0x8b,0x77,0xf1,0x9e,0x96,0xb8,0x3b,0x39,
-    0x41,0x56,0x2c,0x55,0xde,0xf5,0x50,0x27,0x8f,0x86,0xa4,0x3f,0x38,0xb0,0x3,0xb3,
-    0x1b,0xc4,0x8f,0x10,0xb5,0xd5,0xcf,0x1b,0x1a,0x7a,0xe5,0x2b,0x1e,0xe6,0x5b,0x4d,
-    0x71,0x53,0xe5,0x1a,0x79,0xbe,0x12,0xde,0xf9,0xe2,0x40,0x4f,0x56,0x1a,0x38,0xb,
-
-    // Record 169: Address = 0x6480, Length = 128
-    0x6480,0x80,
-    0xe6,0xbb,0xe,0xcb,0x14,0xf0,0x96,0x4c,0x48,0xae,0x65,0xb9,0x2e,0x4f,0xc7,0x95,
-    0xe4,0x90,0xb6,0xfa,0x82,0xae,0x31,0x33,0xa3,0x12,0xc9,0x55,0x3a,0x5b,0xe6,0xf,
-    0xfc,0xa0,0xe5,0x69,0xd8,0xec,0xde,0x7d,0x4a,0xcc,0x9d,0x95,0xe1,0x5b,0x13,0x96,
-    0xfa,0xd7,0x16,0x11,0xa2,0xb,0x9a,0xe0,0xfe,0x72,0xe2,0xd3,0xe7,0xe2,0x1e,0x16,
-    0xf9,0xd2,0xa6,0x49,0xef,0xc4,0xc7,0x6c,0xbf,0x75,0x32,0x1a,0x24,0xe5,0x4d,0x69,
-    0x77,0x9b,0x1,0xf5,0xf7,0x9a,0x5f,0xc3,0xa9,0x8b,0x4,0xb3,0x7d,0xd5,0xd2,0xe4,
-    0xb7,0xe9,0xfb,0x1a,0xa7,0x40,0x97,0x94,0x25,0x4a,0x56,0xab,0x82,0xbf,0xd,0xfa,
-    0x1,0x45,0x1c,0x61,0x59,0xf1,0x62,0xf6,0x8d,0xf3,0x11,0x80,0xf8,0x4f,0xcd,0x55,
-
-    // Record 170: Address = 0x6500, Length = 128
-    0x6500,0x80,
-    0x18,0x5e,0xab,0xf1,0xd2,0x1,0x73,0xfe,0xba,0x44,0xec,0xe6,0x63,0x79,0x38,0x84,
-    0x43,0x6e,0x17,0x69,0x8e,0x78,0x2d,0x5f,0x2e,0xcb,0x41,0x4e,0xc4,0xbe,0xa6,0xf5,
-    0xdb,0x7,0x35,0x5e,0x32,0x24,0x89,0x3d,0xbf,0xb9,0x9b,0x35,0x38,0x40,0xcc,0xda,
-    0x20,0x72,0x16,0x35,0xc,0x13,0xca,0x33,0xd8,0xba,0xbb,0x35,0x82,0xf,0x63,0x29,
-    0x4f,0x1b,0xe5,0x3c,0xac,0xd5,0x84,0x4f,0xdb,0x23,0x1e,0xb3,0xd1,0x5f,0x4d,0x65,
-    0x2a,0x4b,0xe7,0x78,0xb,0x69,0x96,0xc1,0x23,0x1d,0x8e,0xee,0xe0,0xe9,0xfe,0x6e,
-    0xf3,0x3d,0xa,0xbb,0x2f,0xe0,0xd4,0xeb,0x2a,0x81,0x7c,0xa,0x4e,0x7b,0xa3,0xf7,
-    0x44,0xf2,0xde,0x6,0xb,0x7f,0xe,0xaa,0xb,0xf2,0x2f,0xc8,0x87,0xb4,0xa7,0x9d,
-
-    // Record 171: Address = 0x6580, Length = 128
-    0x6580,0x80,
-    0x89,0x45,0x6b,0xe,0x90,0x9e,0x0,0x52,0xa8,0x85,0xcd,0x42,0x23,0xf5,0x43,0x29,
-    0x15,0x49,0x27,0x74,0x72,0x3d,0x45,0x4a,0x35,0x50,0xc1,0x94,0x56,0xc8,0x5,0x72,
-    0x9c,0x1f,0xc2,0x8,0x32,0xa1,0x9c,0x44,0x8c,0x6d,0xfc,0x2,0x49,0x49,0x4e,0x53,
-    0xf1,0x1,0x15,0xa7,0xba,0xd7,0xee,0x67,0xad,0xb4,0x19,0xac,0x5f,0xaa,0xc9,0xd5,
-    0x68,0x49,0x78,0x58,0xe5,0x82,0xdd,0x3e,0x47,0x44,0xaa,0xde,0x38,0x90,0x34,0xf4,
-    0x4c,0xff,0x47,0x9b,0xf0,0x33,0x12,0x46,0x95,0xd0,0x4b,0x72,0xba,0x95,0x82,0xd6,
-    0xe6,0xe8,0xd7,0xe3,0xaf,0xe6,0xff,0x85,0xf3,0xbe,0xee,0xbb,0xc8,0x73,0x9e,0x10,
-    0xe2,0x86,0x38,0x9d,0xda,0x7,0x90,0x45,0xb8,0x13,0x9d,0x6b,0x8b,0x4c,0x92,0xb0,
-
-    // Record 172: Address = 0x6600, Length = 128
-    0x6600,0x80,
-    0xf6,0x1b,0x26,0xf8,0xda,0x64,0x9c,0x4,0x15,0x53,0xae,0x7e,0xe5,0x36,0x25,0xb4,
-    0x9,0x75,0xf8,0x49,0x75,0x17,0x82,0xdb,0x4c,0xe2,0x84,0xdf,0x9,0xe9,0xef,0x44,
-    0x5d,0x5e,0xfd,0xfe,0x15,0xc3,0xb1,0x3f,0xb,0xc8,0xb5,0xb0,0x87,0x8e,0x7f,0x38,
-    0xed,0x28,0xfc,0xa,0x57,0x65,0x19,0x69,0x39,0x6e,0x5d,0xa4,0x15,0x5,0xf6,0x21,
-    0x8d,0xd1,0x88,0x56,0x6b,0xf,0x86,0x66,0x1,0x95,0x8e,0xb2,0x2a,0xd9,0xeb,0x83,
-    0x99,0xbf,0x38,0xcd,0xe8,0x2c,0x9a,0x4,0xf3,0xe7,0xf3,0x27,0x3e,0x3c,0x41,0x82,
-    0x65,0xc0,0xb6,0xd7,0xf2,0xc8,0x8,0xc3,0x8d,0x1e,0x36,0xbe,0xeb,0x5a,0x11,0xbd,
-    0x3b,0xae,0x4,0x6b,0xe2,0x73,0x30,0x7a,0x35,0x3,0xa9,0xe7,0x55,0x3e,0x63,0x7d,
-
-    // Record 173: Address = 0x6680, Length = 128
-    0x6680,0x80,
-    0xd7,0x28,0xe3,0x7b,0x18,0x94,0x8b,0x25,0x5,0x43,0x2e,0xc7,0x1b,0xa8,0x3e,0x9f,
-    0xc3,0xb1,0xef,0xa1,0x97,0xdc,0xad,0xc,0xb9,0xf5,0x3b,0xab,0x72,0x8e,0x8a,0x1b,
-    0x1e,0x7,0x14,0x39,0xdb,0x7d,0x5,0x8e,0x31,0x2f,0xf4,0xb7,0x22,0x85,0x50,0xe7,
-    0x28,0x82,0x5b,0xd4,0xbb,0x7a,0xb1,0x45,0xd5,0xae,0x62,0x46,0x3,0x45,0xe1,0x5c,
-    0xb9,0x7a,0x4,0xc3,0x3,0x30,0xe1,0x15,0x35,0x36,0x80,0x72,0xe4,0xe9,0x1b,0x9e,
-    0x9a,0x9c,0xd8,0x2,0xc7,0xd7,0xe1,0x96,0x8c,0x5b,0xc8,0x77,0x2e,0xfa,0x90,0xc0,
-    0x0,0x45,0xe4,0xd2,0x9e,0xe,0xe8,0xf,0xc9,0xf4,0xd4,0x4,0xdb,0xe1,0x92,0x86,
-    0x3b,0x91,0x7c,0x18,0xa8,0x8b,0xad,0x31,0x52,0x80,0x77,0xe7,0xbf,0x70,0xf5,0x7,
-
-    // Record 174: Address = 0x6700, Length = 128
-    0x6700,0x80,
-    0xaf,0xa7,0x3f,0xe8,0x30,0x8f,0x59,0xab,0xc7,0x47,0xc6,0xc4,0x85,0x69,0x24,0xed,
-    0x42,0x25,0x3a,0x22,0xb4,0xaa,0xac,0x1c,0x4d,0x3,0x23,0x29,0xd7,0xec,0x30,0xe4,
-    0xdc,0x4a,0x1a,0xbe,0x9e,0x77,0xac,0xec,0x8d,0x54,0xc9,0x88,0x86,0x1b,0xf0,0xd2,
-    0x5a,0xe3,0x0,0x4c,0x41,0xac,0x6c,0x17,0x9d,0x5,0x60,0x63,0x84,0x24,0x50,0xf8,
-    0xa7,0x8e,0x65,0xea,0xf1,0xc0,0x5e,0xad,0x39,0x75,0xa8,0xc7,0xcc,0x7f,0xb8,0x1c,
-    0x52,0x6a,0xaf,0xa7,0x85,0x38,0xda,0x20,0xb5,0xa5,0xdc,0xa4,0x8c,0xb9,0x58,0xe5,
-    0x57,0x2a,0xad,0xde,0x53,0xbc,0x9d,0xd8,0xf9,0x5b,0xa2,0x90,0xb,0xfc,0xc9,0x46,
-    0x58,0x99,0x67,0x58,0xab,0xe7,0x58,0x3e,0x95,0xf8,0x32,0xa1,0x4c,0x9b,0x4a,0x5a,
-
-    // Record 175: Address = 0x6780, Length = 128
-    0x6780,0x80,
-    0x5c,0x24,0x63,0x59,0xaf,0x86,0x14,0x9b,0x82,0xa9,0xb9,0xbc,0x3b,0xcf,0x1,0x41,
-    0x5d,0xea,0x5b,0xcc,0x40,0x49,0x1e,0xfa,0x4d,0x56,0x64,0xaf,0x38,0xcb,0x10,0xb,
-    0x8c,0x1,0x53,0x57,0xbe,0x4,0x93,0x85,0xda,0xa5,0x24,0x77,0xf2,0x35,0x31,0xda,
-    0xce,0xf3,0x30,0x9f,0xcd,0x32,0x81,0x7a,0xaf,0x61,0x4e,0xdc,0xdd,0x5e,0x7,0x70,
-    0x3b,0xbb,0xd5,0x8,0x63,0xf6,0x24,0x9f,0x82,0x48,0xb4,0x9b,0x31,0xa1,0xaa,0x86,
-    0xe2,0x63,0xa9,0x7e,0x2b,0x3d,0xd7,0x3f,0x27,0xb9,0x27,0x8f,0xbc,0x2b,0x7f,0x27,
-    0xe0,0xfd,0xa7,0xe4,0x17,0x62,0xf5,0x19,0xb5,0x23,0x38,0xf,0x8e,0x31,0x54,0x15,
-    0x19,0xff,0x73,0xe7,0x9b,0xd0,0x41,0x35,0x94,0x10,0xd2,0xfc,0xe2,0xc0,0xa0,0x46,
-
-    // Record 176: Address = 0x6800, Length = 128
-    0x6800,0x80,
-    0x70,0xb7,0x53,0xb8,0xe2,0xb6,0x95,0xfd,0x5f,0xfe,0x1e,0x32,0x4,0xa4,0x3,0x67,
-    0x5a,0x3,0xae,0x99,0xe9,0xf1,0xb5,0x54,0x51,0xd0,0xd3,0x93,0xdc,0xab,0x3a,0x6d,
-    0xf3,0x70,0xa6,0xd4,0x9a,0xe9,0xab,0xda,0x51,0xf8,0xa8,0x5b,0xce,0x4b,0xe,0x3b,
-    0x16,0xc,0xe7,0x3b,0x6,0xbf,0x7b,0x97,0xc9,0x71,0x1c,0x9a,0xa6,0x2d,0x19,0x1,
-    0xa2,0x37,0x19,0xad,0x8a,0xc,0xf5,0xb8,0x9b,0x31,0xe7,0xc6,0x15,0xf5,0x4,0xb,
-    0x94,0x45,0x31,0xd4,0x13,0x30,0xf9,0x25,0x9,0x80,0x20,0x1b,0x99,0x32,0x10,0x74,
-    0x4,0xb2,0x8b,0x17,0x6f,0xcd,0xb1,0x85,0x15,0x86,0x7d,0x60,0x5a,0x15,0xbd,0x44,
-    0x17,0xb2,0xc7,0xff,0x8b,0x84,0xcf,0xd0,0x36,0xdd,0x62,0x9,0xa7,0xcf,0xa0,0x22,
-
-    // Record 177: Address = 0x6880, Length = 128
-    0x6880,0x80,
-    0xfe,0xd5,0xdf,0x13,0xfd,0x79,0xd,0xd4,0xa8,0x5e,0x9c,0xf3,0xd8,0xb4,0xa6,0xa1,
-    0xf3,0x8c,0x27,0x79,0x75,0x34,0xa8,0xbc,0x6e,0x44,0x93,0xb7,0xe,0x88,0x7e,0xa1,
-    0x74,0xd1,0xbc,0x76,0xb0,0x5c,0x7d,0x75,0xb6,0x2f,0x1c,0x8a,0x6d,0xd8,0x89,0x9e,
-    0x79,0x9d,0x7e,0x61,0x0,0x85,0x61,0xa7,0x6d,0xe2,0x4b,0xcc,0x57,0x7e,0x1,0xd3,
-    0x51,0xc0,0xff,0xa9,0xe5,0xb,0xba,0x8,0xad,0x9b,0x7d,0x2e,0x78,0x37,0xfa,0xd6,
-    0xfc,0x62,0x47,0x5a,0xf2,0x10,0xe7,0x4d,0xdd,0xd8,0x2f,0xd3,0x61,0xf4,0xad,0x19,
-    0x38,0x48,0x82,0x45,0x99,0x81,0xf6,0x44,0x2c,0x8f,0x55,0xdc,0xfe,0x9d,0xa8,0x93,
-    0x2d,0x8c,0x78,0xbe,0x6e,0x5e,0xbe,0x11,0x99,0x68,0x69,0xc1,0xec,0x76,0xce,0xbf,
-
-    // Record 178: Address = 0x6900, Length = 128
-    0x6900,0x80,
-    0x3f,0xc5,0xab,0x87,0x35,0x23,0xdb,0xdc,0x2e,0xeb,0xb,0x23,0xf,0xa5,0x46,0x9a,
-    0x6e,0x5a,0x21,0x5c,0xb7,0xa0,0x9e,0x43,0x10,0xe6,0xcc,0x63,0xf5,0x5,0x5,0xc5,
-    0xf0,0x2f,0x3f,0xaf,0xd3,0x4a,0xb5,0xf1,0xe,0xce,0xd9,0xe7,0xc4,0x7,0x7e,0x4f,
-    0xba,0x14,0xba,0xfb,0xdf,0xee,0x2e,0xf3,0x7f,0x4,0x8,0x52,0xa1,0xd9,0xc1,0xa1,
-    0x87,0xfd,0xcc,0x36,0x5c,0x1c,0xb3,0xa0,0x3c,0x76,0xe,0xcf,0x3e,0xeb,0xdf,0x88,
-    0x11,0xbb,0xd6,0xd,0x8c,0x9f,0xfe,0xfb,0x39,0x74,0x1c,0xc7,0x55,0x8d,0x88,0x8b,
-    0x68,0x24,0xe8,0x82,0x72,0x75,0x87,0x2d,0xd6,0x9f,0xc8,0xd9,0x50,0x38,0x68,0xff,
-    0xf2,0xc2,0x2c,0xe8,0x18,0x7a,0x40,0xd4,0xbb,0x29,0x63,0xe7,0xd9,0xca,0x23,0x60,
-
-    // Record 179: Address = 0x6980, Length = 128
-    0x6980,0x80,
-    0xcc,0xde,0xce,0xc7,0x41,0x2,0x34,0x58,0xca,0x81,0x76,0xb7,0xae,0x3a,0xa,0xee,
-    0x10,0x4e,0xbc,0xd2,0xbf,0x86,0xbb,0x12,0x5b,0x3e,0xc3,0x86,0xfc,0x46,0xdd,0xa2,
-    0x1f,0xd4,0xa7,0x98,0x8b,0x72,0xd3,0x9,0x34,0xd2,0x89,0x4,0x5f,0x64,0x71,0xc8,
-    0x48,0xdc,0xef,0x6a,0xab,0x8,0xa5,0x5d,0x89,0x8e,0xfc,0x4,0xf6,0x36,0x33,0x6c,
-    0x7b,0x36,0xc4,0xfc,0xf5,0x93,0x44,0x42,0xcb,0x26,0xe4,0x3c,0xa6,0xbc,0x6c,0x30,
-    0x15,0x4e,0x32,0x35,0x12,0x47,0xcb,0x72,0xd,0xdd,0x4f,0xad,0xa5,0x5f,0x60,0x10,
-    0x9b,0xc4,0xd6,0x86,0x8e,0x4d,0xcc,0x7e,0x6c,0x68,0x84,0xa5,0x4c,0xfa,0x91,0x59,
-    0x37,0x67,0x3f,0xe4,0x10,0x5a,0x9c,0x5,0x6d,0x47,0x7f,0xe6,0x96,0xff,0x97,0x93,
-
-    // Record 180: Address = 0x6a00, Length = 128
-    0x6a00,0x80,
-    0xd8,0x1e,0x8b,0x7f,0xe4,0x5c,0xed,0xd1,0x6e,0x42,0xcf,0x42,0xdd,0x15,0xf3,0x82,
-    0x48,0xd5,0x43,0xe9,0x42,0x87,0x12,0xcb,0x4f,0xad,0x21,0x25,0x81,0x2b,0xe,0x1,
-    0x8e,0xa8,0x4f,0x78,0xed,0xd9,0x99,0x9f,0x11,0x3c,0x3c,0xb9,0x9e,0xee,0xda,0x71,
-    0xfe,0x7f,0xb5,0x57,0x4f,0x43,0xe2,0xbf,0xfc,0x75,0x77,0x4b,0xa5,0x5e,0x57,0x55,
-    0x91,0xba,0x86,0x67,0xac,0x5f,0xff,0x2a,0xa5,0x65,0xb7,0xba,0xad,0xb9,0x4b,0xf2,
-    0x48,0x4a,0x75,0xe3,0x8,0x3c,0xe2,0xf3,0x98,0xbb,0x37,0x50,0xd8,0x9a,0x4,0x8f,
-    0xa8,0xd7,0xf2,0x8f,0x33,0xc,0xfc,0x3c,0x34,0xa5,0x37,0xa4,0xf1,0xe6,0x42,0xfa,
-    0x6,0x80,0x34,0x11,0x25,0xc5,0xcb,0x17,0xad,0x7e,0x2e,0xc6,0x5e,0x92,0x1c,0x8d,
-
-    // Record 181: Address = 0x6a80, Length = 128
-    0x6a80,0x80,
-    0xa6,0xb7,0xe4,0x65,0x3c,0x22,0xc1,0x2e,0xab,0x47,0x98,0x55,0x40,0x43,0x1d,0x7f,
-    0x9f,0xa7,0x85,0xa5,0x2,0xd4,0x1a,0x3d,0x51,0x58,0x98,0xa3,0x40,0xfe,0x7b,0x2d,
-    0xae,0xd7,0xa4,0x4e,0x74,0xe,0x2f,0x75,0x28,0x10,0x93,0x1a,0xb0,0x58,0xf7,0xac,
-    0x4f,0xf,0x6b,0xb6,0xc6,0xbb,0x2,0xcd,0xe9,0x76,0x5a,0x63,0xfe,0xb3,0xb2,0x4c,
-    0xc9,0x50,0x4c,0x4d,0x4c,0xdc,0x5e,0xeb,0x44,0x1d,0x4a,0x80,0xc2,0x12,0x60,0xc9,
-    0x4d,0xa5,0xb7,0x66,0x8b,0x5,0x38,0x6c,0x66,0x74,0x4b,0xcf,0x72,0x96,0x6,0x77,
-    0x64,0x70,0x53,0x2,0x40,0x7d,0xb0,0x21,0x51,0x97,0x2,0x3d,0x4d,0x1d,0xc9,0xda,
-    0x32,0xc5,0xe3,0xab,0x89,0x96,0x98,0x8a,0x15,0x1,0x3e,0xcc,0x8e,0x18,0xd1,0xd9,
-
-    // Record 182: Address = 0x6b00, Length = 128
-    0x6b00,0x80,
-    0x60,0x56,0xa8,0xf1,0x74,0x43,0xdf,0xed,0x8f,0xd2,0x2d,0xfe,0xe9,0x8f,0x90,0xf9,
-    0xca,0x64,0xc3,0xfe,0x9,0x5e,0x1e,0x31,0x8a,0xf8,0x2,0x13,0xf9,0x46,0xbc,0xc5,
-    0x8f,0x33,0xb2,0x50,0x37,0x38,0x44,0x9a,0x6c,0x84,0x29,0xbc,0x5d,0xd1,0xd3,0xe8,
-    0xf1,0x17,0xac,0x78,0x2a,0x9b,0x5d,0xd5,0x83,0x6a,0x44,0x93,0x84,0x5a,0xe5,0x70,
-    0x6d,0x76,0xdc,0xad,0xa3,0xdd,0x51,0x48,0x73,0xa3,0x71,0x55,0xd4,0x2d,0x39,0x84,
-    0xa2,0x90,0xa2,0x2f,0x37,0xb,0x78,0x52,0x70,0xcc,0x60,0xd3,0x4f,0x72,0x55,0x3f,
-    0x6b,0xc0,0x5c,0x7a,0x9d,0x1f,0x49,0x73,0xba,0x26,0x94,0xbf,0xc6,0x73,0x95,0xa,
-    0x8f,0xd8,0xbe,0xde,0xd,0x5f,0xd3,0xf6,0xe1,0xf,0xad,0x4d,0x70,0x9c,0xb1,0xe1,
-
-    // Record 183: Address = 0x6b80, Length = 128
-    0x6b80,0x80,
-    0x89,0x25,0xb2,0xb0,0x2f,0x43,0xdc,0xd2,0x1b,0x46,0xf7,0xa0,0xa5,0xdd,0x36,0x18,
-    0x48,0x5b,0xf0,0x7c,0x5e,0xa3,0x39,0x6a,0x62,0x32,0x61,0x57,0x75,0xda,0xf8,0xb4,
-    0x6a,0x99,0xa8,0x1e,0xba,0xe2,0x42,0xe3,0x15,0xc0,0x49,0xb1,0x7c,0x9d,0x93,0x8,
-    0x14,0x30,0x71,0x9e,0x5a,0xaf,0x34,0x14,0x2,0xd3,0xa8,0x3,0x4,0xf,0x31,0x9f,
-    0xe9,0xbe,0xd3,0xe9,0x63,0x65,0x55,0xec,0x36,0x48,0xfe,0xb5,0xad,0x5e,0x40,0x5a,
-    0xfe,0xb5,0xf4,0x25,0x66,0x20,0xa6,0xbb,0x30,0x5a,0x2e,0x52,0xaf,0x7a,0x3a,0x6b,
-    0x4e,0xfb,0x5b,0xab,0x32,0x38,0x52,0x4c,0x4c,0x7f,0x52,0x49,0x1e,0x1c,0x79,0x3d,
-    0x26,0x41,0xa5,0xf4,0x7c,0x48,0x7,0x76,0xce,0x6b,0x6f,0xd5,0x73,0xe7,0x4e,0x8d,
-
-    // Record 184: Address = 0x6c00, Length = 128
-    0x6c00,0x80,
-    0xe0,0x9a,0x9b,0x2a,0x4c,0x1a,0xf3,0xf5,0xfa,0x3,0x91,0x54,0x9d,0x3c,0x0,0x43,
-    0x8f,0xdc,0x80,0x71,0x8b,0xe0,0x7,0x4a,0xa9,0xdd,0x6b,0xa,0xe4,0xd1,0x4d,0x96,
-    0xe0,0x6,0xd8,0xd4,0xb2,0xa5,0x99,0x90,0xd0,0x38,0xc7,0x67,0xc5,0xf5,0x3d,0x75,
-    0x31,0x45,0xd9,0x2b,0x4b,0xf1,0xf5,0x30,0x64,0x7f,0x4d,0x71,0xca,0x50,0x7b,0x34,
-    0xcc,0xfb,0x7d,0xbe,0x3e,0x5d,0x32,0x99,0x45,0xdb,0xc2,0x36,0x95,0x1a,0xba,0x9a,
-    0x8b,0x99,0x24,0xac,0xdb,0x7c,0xab,0xe7,0x3,0x97,0x50,0xc1,0x73,0x68,0xf5,0x2f,
-    0xf5,0xcd,0xb,0xbd,0x3f,0xa5,0xd3,0xec,0x97,0xca,0x4e,0xe1,0xa3,0x14,0xfe,0xf3,
-    0x8f,0x66,0xd2,0xe3,0x73,0xb7,0xaa,0x2d,0x10,0xeb,0xa2,0x8a,0x64,0xbd,0xbf,0x2d,
-
-    // Record 185: Address = 0x6c80, Length = 128
-    0x6c80,0x80,
-    0x65,0xf4,0x60,0x5,0x1e,0x5f,0x18,0xf8,0xe3,0x5e,0x7,0xa3,0xe6,0x61,0x2a,0x49,
-    0x8,0xfd,0xc3,0x49,0xd4,0xec,0xde,0xc8,0xfd,0x72,0x18,0x87,0xc5,0x6d,0x2e,0x6b,
-    0x4,0xfd,0xf0,0x6,0x27,0x16,0x61,0x82,0x96,0xec,0xf2,0x53,0x85,0xec,0x9d,0xa9,
-    0xba,0x6d,0x1b,0x9d,0xa,0x93,0x91,0x85,0x6,0xd3,0xe5,0xd3,0xbd,0x4,0x2a,0x92,
-    0xcf,0x24,0xa4,0x62,0x38,0x9,0x28,0x20,0xef,0x31,0xa3,0xf,0xfc,0xbf,0x9c,0x8f,
-    0x79,0x87,0x6b,0xc8,0x55,0x84,0x37,0xce,0x46,0x85,0x98,0xc4,0x2d,0x80,0x8d,0x83,
-    0xee,0x29,0x47,0x61,0xab,0xff,0x65,0xc0,0x3e,0x95,0x91,0x63,0xbb,0x1,0xbc,0x2d,
-    0xda,0xd7,0x1e,0x75,0x6a,0xc9,0x4d,0x27,0xcb,0x48,0xed,0x99,0x26,0x11,0xfe,0xa1,
-
-    // Record 186: Address = 0x6d00, Length = 128
-    0x6d00,0x80,
-    0xc7,0x39,0x5,0x62,0x83,0x34,0x83,0xd7,0xb2,0xea,0x7,0x1d,0x57,0x80,0xfa,0x45,
-    0x2c,0x9a,0x47,0x3d,0x24,0xe3,0x31,0x73,0x7a,0xfc,0x1b,0x5d,0xd3,0xbd,0x7,0x33,
-    0x53,0xdc,0x19,0x22,0x1c,0xbb,0xae,0x75,0x4b,0x1c,0x52,0x2b,0xce,0xe9,0x86,0x66,
-    0x66,0x4f,0x91,0xb0,0x4d,0xb2,0x24,0xb2,0xba,0x32,0xca,0x52,0xa,0x1c,0x90,0x8f,
-    0x6b,0x4d,0xc,0x39,0x20,0xbb,0xbc,0xf6,0xa4,0x7b,0x44,0x14,0x53,0x26,0x71,0x2c,
-    0xbf,0x7c,0xe7,0x33,0xca,0x25,0x6d,0x3c,0xea,0x86,0x87,0x99,0x19,0x30,0xef,0x11,
-    0xb,0x67,0x2a,0xa7,0xb7,0xa3,0x26,0x43,0xfe,0x37,0x79,0x67,0x47,0x1,0x1f,0x2,
-    0x51,0x4a,0xf5,0xe8,0x98,0xb3,0x6c,0x92,0x94,0xdd,0x47,0x27,0xd1,0xaf,0xf0,0x53,
-
-    // Record 187: Address = 0x6d80, Length = 128
-    0x6d80,0x80,
-    0x13,0xeb,0xb0,0x29,0x9c,0xca,0x8d,0x95,0x18,0xaf,0x23,0x68,0xf,0x6f,0x12,0xa,
-    0xae,0xe4,0x11,0x87,0x49,0xa,0x23,0x38,0x8,0x7a,0xe6,0x41,0x5a,0xa,0x8c,0xa8,
-    0x8c,0x5f,0xb7,0x66,0x5b,0x87,0xf3,0x3f,0x23,0xfd,0x36,0x1f,0x62,0x2b,0xaf,0xd6,
-    0x58,0xe4,0x74,0xa3,0xa3,0x9a,0x5f,0xba,0xe6,0xe7,0xce,0x7b,0xad,0x90,0x8d,0x27,
-    0x8f,0xeb,0xe4,0xb5,0x88,0x5d,0x3e,0x7b,0xe,0x2c,0xa2,0xeb,0x83,0xbf,0xa,0x3c,
-    0x2b,0xfc,0x12,0x54,0xfc,0xe,0xac,0x2,0xba,0x52,0xa9,0xfe,0x73,0xfb,0xde,0xd5,
-    0x7e,0x94,0x75,0x95,0xca,0xec,0x95,0xe2,0x3d,0x9c,0x1b,0x49,0x21,0x18,0x71,0xde,
-    0x91,0x5c,0x2c,0xef,0x5d,0x96,0x82,0xb1,0x9a,0xef,0x7e,0xc2,0x44,0x92,0xdf,0x45,
-
-    // Record 188: Address = 0x6e00, Length = 128
-    0x6e00,0x80,
-    0x79,0xa0,0x7e,0x28,0x83,0x44,0xed,0x5d,0xff,0xca,0xb7,0x10,0x65,0x24,0x32,0x3b,
-    0xe4,0x3e,0x8a,0xbf,0x32,0xfe,0xd9,0xe2,0x33,0x5,0x76,0x3d,0xfb,0x1e,0xef,0x64,
-    0x2e,0x86,0x74,0x75,0xae,0x74,0x8e,0x84,0x80,0xda,0xca,0x83,0x4,0xd5,0xc7,0x4a,
-    0x8f,0xc1,0xdb,0xbd,0x8e,0xa9,0x38,0xb2,0xb7,0x35,0x6f,0xb8,0xf7,0x69,0xb7,0xb6,
-    0xb,0x18,0x1,0x90,0xf,0xa0,0x68,0x5d,0x39,0x27,0x75,0x33,0xe4,0x76,0xe0,0x91,
-    0xbf,0x3b,0xf6,0x6a,0xc4,0x20,0xf,0xd8,0xe,0x4b,0xc3,0x98,0x57,0x44,0x2d,0xde,
-    0x39,0x2c,0xb6,0x83,0x37,0x4,0x66,0x74,0xce,0xe5,0xfb,0xde,0x1,0x48,0x3c,0xe7,
-    0xbb,0x0,0xdd,0xf8,0xbd,0x2f,0xf,0x84,0x41,0xbe,0x3e,0x56,0x70,0xe8,0x41,0xc0,
-
-    // Record 189: Address = 0x6e80, Length = 128
-    0x6e80,0x80,
-    0x6,0x98,0xaa,0x6d,0xd5,0x7,0x8d,0x33,0x77,0x80,0xe5,0xc5,0xef,0xfa,0x1,0x97,
-    0xd4,0xf7,0xc8,0x8c,0xd7,0x50,0x93,0x8c,0x1e,0x52,0xa0,0xa5,0x7f,0x5d,0xe7,0x1a,
-    0x97,0xc6,0x6a,0x23,0xa1,0x25,0x58,0x63,0x41,0x49,0x3f,0x2a,0x66,0xbc,0x43,0xed,
-    0xd0,0x94,0x12,0x78,0xc3,0xb5,0xf9,0x6f,0x4e,0x61,0x9f,0xb7,0xa2,0x49,0x41,0x5,
-    0x96,0x92,0xe0,0x13,0xc1,0x98,0x9d,0x96,0x24,0xea,0x46,0x60,0x74,0x10,0xe9,0x31,
-    0x27,0x23,0xa7,0x4f,0x8d,0xda,0x3b,0x6a,0xd2,0x7e,0xcd,0x7b,0xe0,0x9d,0x1a,0xf5,
-    0xde,0xbc,0xa1,0xec,0xcf,0x7e,0xff,0x3d,0xe1,0xf5,0x5e,0x52,0x88,0xb7,0x31,0x5,
-    0xee,0xb,0x4b,0x5,0x2f,0xc9,0x66,0xf2,0xfd,0xa4,0x7a,0xba,0x36,0x8d,0xca,0x26,
-
-    // Record 190: Address = 0x6f00, Length = 128
-    0x6f00,0x80,
-    0x65,0x6a,0x77,0x67,0xb3,0x38,0xb0,0x74,0xf9,0x2c,0xe8,0x5f,0xf0,0x6c,0x5e,0xa7,
-    0x0,0xd5,0x97,0x5d,0x4d,0x96,0x79,0x60,0xd1,0x64,0xfc,0x5f,0x58,0x33,0xa7,0x14,
-    0x38,0x1,0x44,0xdf,0x6,0xcc,0xca,0xa0,0x32,0x63,0x9e,0xc5,0xc2,0xeb,0xc2,0x4b,
-    0x40,0x96,0xa0,0x15,0xe4,0x6d,0x67,0xc2,0x7b,0x77,0x1d,0xc0,0xd,0xed,0xde,0x1a,
-    0x2c,0x9e,0x8f,0x17,0x14,0xa3,0xe6,0xd6,0x7b,0xfb,0x4e,0xb8,0x53,0x1,0x17,0x13,
-    0x1,0x5e,0x10,0xa7,0x7c,0x26,0xb0,0xe8,0xca,0xb9,0xd7,0xf7,0xd9,0xbd,0x9e,0xea,
-    0xe,0xe3,0x62,0xb1,0xf9,0x85,0x92,0x15,0xc6,0xae,0x38,0xd0,0xc1,0x33,0xc5,0x1d,
-    0x12,0x7a,0x7d,0x80,0x29,0xda,0xba,0xf1,0x23,0xdf,0x6c,0x66,0x3e,0x58,0xfd,0x62,
-
-    // Record 191: Address = 0x6f80, Length = 128
-    0x6f80,0x80,
-    0x2,0x0,0x61,0x66,0xec,0x92,0xff,0x4a,0x86,0x59,0x11,0x1d,0xe0,0xca,0x31,0x62,
-    0x11,0xef,0x38,0xcb,0xe4,0x81,0xbb,0x1c,0xda,0xde,0x52,0x73,0x17,0x30,0x74,0xc1,
-    0xe0,0xff,0xb1,0xf1,0x9a,0x43,0xc1,0x26,0xf5,0x3,0x19,0x74,0xe0,0x76,0xb9,0x27,
-    0xc2,0xc4,0x65,0xe2,0xce,0x28,0x6b,0xae,0x77,0x1c,0xa7,0x3e,0xb3,0xbf,0x84,0xba,
-    0x24,0x67,0xa,0xc8,0x1e,0x15,0x9b,0x8f,0xd2,0x1e,0xbd,0x23,0xf5,0x7d,0x41,0x98,
-    0xea,0xa9,0xae,0x86,0x25,0xab,0x47,0x37,0xcc,0x95,0xbd,0x78,0x7a,0x8e,0x4b,0x1c,
-    0x5a,0x99,0xe9,0x36,0x8e,0x8,0x54,0x98,0x8d,0x17,0x7a,0xb6,0x1b,0xc,0xc7,0x7,
-    0xd3,0x8c,0x37,0x59,0x7,0xbc,0x6c,0x22,0x18,0x92,0xb0,0xb7,0xe8,0xe8,0xee,0xe3,
-
-    // Record 192: Address = 0x7000, Length = 128
-    0x7000,0x80,
-    0x4f,0xd0,0x86,0xe4,0x23,0xa1,0x19,0xac,0x95,0x17,0x8,0x2,0xa9,0xa,0x8c,0x3a,
-    0xac,0xcc,0x96,0x34,0x35,0x19,0xd2,0xca,0x27,0x8,0x36,0x3,0x86,0xc2,0x73,0xb1,
-    0xd8,0x25,0x61,0xd6,0x53,0xc5,0x82,0x9,0x1,0xbd,0x6c,0x5f,0x52,0x98,0x3d,0x62,
-    0x65,0x39,0x28,0xd5,0xe9,0xb9,0x77,0x34,0x94,0x21,0x4d,0x8,0xd1,0x27,0x64,0x34,
-    0xc7,0xb8,0x23,0x46,0xa1,0x74,0x9c,0x8c,0x56,0x8a,0xe2,0x30,0xe5,0x98,0x64,0xd0,
-    0xa0,0xd2,0x2d,0x1d,0x3d,0x91,0x53,0xd3,0xde,0xf0,0x36,0x2d,0xf1,0x5b,0x38,0x55,
-    0xd3,0x3f,0x35,0x1d,0x65,0x1,0x19,0x75,0x83,0x5b,0xc,0x67,0x0,0xb8,0xe9,0x2b,
-    0x75,0xcd,0x91,0xe,0x2d,0x35,0xae,0x17,0xad,0xdd,0x8d,0xc4,0x3c,0x4f,0xa6,0x36,
-
-    // Record 193: Address = 0x7080, Length = 128
-    0x7080,0x80,
-    0xdc,0xb8,0xad,0xee,0xc0,0x95,0xdb,0xb8,0xfc,0xda,0xe2,0xba,0xfb,0x8e,0xa3,0xbe,
-    0x2b,0x7e,0x5f,0xcc,0x80,0x76,0xac,0x18,0x45,0x2b,0x44,0x23,0x90,0xf0,0x5d,0x2c,
-    0x39,0xbe,0x4,0xac,0xab,0xb7,0xd4,0x1,0x8e,0xe1,0x77,0x67,0xa3,0x16,0xd9,0xbb,
-    0xb7,0x68,0xcd,0xde,0xfe,0x77,0x5a,0xa3,0x3a,0x87,0x29,0x3a,0x56,0x53,0x27,0xf5,
-    0xb1,0x19,0x6a,0x86,0xdd,0x46,0xae,0x40,0xb1,0xdd,0xc7,0x34,0x5a,0x95,0x4b,0x2,
-    0x11,0x1,0x45,0x24,0x1f,0x5e,0x5c,0xc8,0xfb,0x44,0xb,0xc1,0x66,0x1,0x5a,0x9e,
-    0x1d,0x2e,0x1d,0x9d,0x9,0x12,0x55,0xde,0x2b,0xcb,0x46,0x18,0x3e,0x45,0x4c,0x81,
-    0x4a,0xe8,0xb1,0xa1,0x92,0xc3,0xb6,0xaf,0x77,0xa2,0x29,0x26,0x95,0x24,0x7,0xda,
-
-    // Record 194: Address = 0x7100, Length = 128
-    0x7100,0x80,
-    0x33,0x4d,0x42,0x94,0x9e,0xdc,0x5f,0x3c,0x9e,0xb3,0xbc,0x9e,0x5c,0xe0,0x3d,0xa8,
-    0xb4,0x8b,0x95,0x94,0x14,0x9f,0x2f,0x6b,0x3d,0x7b,0x9a,0xfd,0x4c,0x6,0x3f,0xb1,
-    0x4b,0xee,0xd1,0xab,0x43,0x81,0xc5,0x66,0xb3,0xdd,0xd9,0x1,0x60,0x12,0xb5,0xbd,
-    0x1c,0x98,0x66,0x64,0x15,0xf0,0x4e,0xa8,0x90,0xed,0x25,0xf,0xa8,0x6e,0xc2,0xb7,
-    0xc8,0xcc,0x8,0x3c,0x81,0x36,0x3,0xe3,0xfb,0x46,0xb5,0x38,0x47,0x65,0x7b,0x73,
-    0x8b,0x3a,0x6c,0x5,0x5e,0xdd,0x9a,0x1b,0xa7,0x68,0xd,0xa4,0x4,0x22,0xb0,0x1f,
-    0xb3,0xf7,0xed,0x4a,0xb1,0x8c,0x1e,0x75,0x7f,0xbb,0x44,0xe6,0x7f,0x47,0x2a,0xdc,
-    0x79,0xd4,0x2e,0xe7,0xfa,0x78,0xb2,0x75,0x14,0xa7,0x88,0x2,0x74,0xd0,0xf6,0xbb,
-
-    // Record 195: Address = 0x7180, Length = 128
-    0x7180,0x80,
-    0x98,0x4,0x90,0xc7,0x1a,0x14,0x42,0x30,0x8b,0xd7,0x2c,0xd0,0xc6,0x4,0x58,0x80,
-    0x6f,0x43,0x5a,0xb2,0x18,0x17,0x96,0x72,0x15,0x84,0xe5,0xf9,0x6f,0xba,0x31,0x7a,
-    0x42,0x8b,0x67,0xc4,0xd,0x91,0x5d,0x83,0xb1,0x7e,0x4,0x7,0x30,0x3f,0xa6,0x0,
-    0x14,0x74,0x49,0xb5,0x7f,0x22,0x78,0x14,0x64,0xef,0x1c,0x80,0x2,0x77,0xe1,0xd1,
-    0xc1,0xca,0xcf,0x28,0x62,0x5d,0x7f,0x6,0xa2,0x52,0xd9,0xfa,0x43,0x5,0xf,0x4b,
-    0xeb,0xb5,0x40,0xbc,0x0,0x16,0x95,0xbe,0xbe,0x49,0x4a,0x3d,0xe,0xe3,0x60,0xcd,
-    0x87,0xae,0xb2,0x26,0xd1,0xef,0x20,0x99,0x9b,0x12,0x52,0xa6,0xd7,0xc5,0xe3,0x7b,
-    0x7c,0xfb,0x13,0xf6,0x19,0x3b,0x2a,0x91,0xf1,0x73,0xb0,0x3a,0xb9,0x14,0x94,0xba,
-
-    // Record 196: Address = 0x7200, Length = 128
-    0x7200,0x80,
-    0xb2,0x16,0x22,0xb9,0x33,0xe6,0x22,0x0,0x16,0x9c,0x4f,0xd6,0xa4,0x18,0x25,0xc,
-    0xeb,0x5b,0xbb,0xb0,0x68,0xdc,0x33,0xc0,0x83,0x72,0xb6,0x1f,0x38,0xb4,0x97,0x7e,
-    0xd3,0x4f,0x28,0xc,0xc6,0x8d,0x4d,0xf4,0x39,0xb8,0x41,0x3d,0xe8,0xd7,0xf6,0x94,
-    0x6f,0x18,0x5e,0x5f,0x68,0xa3,0x8c,0x29,0xc2,0xde,0xbc,0xaa,0x1f,0x3d,0x92,0x18,
-    0xfa,0x70,0xbd,0x76,0x86,0x82,0x3d,0xbf,0xce,0x66,0x76,0x5a,0x62,0x9e,0xb3,0x1b,
-    0xcc,0x3,0x8f,0x21,0x83,0xd8,0x47,0xe8,0x97,0x59,0x1f,0x93,0xe0,0xeb,0x97,0x9c,
-    0xd3,0xfe,0x2d,0x54,0xd1,0x23,0x52,0x4c,0xda,0xf1,0x20,0x9c,0x87,0x96,0x16,0x6f,
-    0x47,0xac,0x28,0x16,0xd2,0x7e,0x53,0x42,0x2a,0x47,0x40,0x77,0x42,0x75,0x95,0xe8,
-
-    // Record 197: Address = 0x7280, Length = 128
-    0x7280,0x80,
-    0x16,0x76,0x8b,0x5a,0x73,0x55,0x9c,0xd7,0x8a,0x43,0x65,0xba,0xfc,0x73,0x90,0x85,
-    0xa5,0xd,0x20,0x12,0xdc,0xab,0x5c,0x28,0x64,0x82,0x22,0xae,0x8a,0x8f,0x35,0x77,
-    0x6d,0xc0,0x2c,0xd9,0x92,0x2e,0x35,0x36,0x1c,0x5,0x7b,0x46,0xc3,0xb2,0x31,0x10,
-    0x60,0x30,0x21,0x27,0x13,0x59,0x53,0x4,0x51,0x6e,0xa6,0x83,0xeb,0xbb,0xcb,0x17,
-    0xce,0xd4,0x3a,0x15,0x0,0xaa,0xe2,0x8,0x66,0x62,0x26,0xe9,0x4b,0x8e,0x7b,0x7c,
-    0xb9,0xdb,0x94,0xa5,0x3d,0xef,0x4,0x25,0x38,0x54,0x3a,0xcd,0x15,0xf1,0x22,0xa8,
-    0xdb,0x81,0x8e,0x9,0x36,0xeb,0x9,0x93,0x37,0xf8,0xcf,0xda,0x54,0xc2,0xc3,0x8e,
-    0x21,0x0,0xd1,0xb0,0xa,0x7e,0xf4,0xd8,0x22,0x23,0xb0,0xf4,0xad,0x77,0x2b,0xce,
-
-    // Record 198: Address = 0x7300, Length = 128
-    0x7300,0x80,
-    0x61,0x69,0x90,0x89,0xe5,0x44,0xff,0xf1,0xe4,0x60,0x19,0xa0,0xee,0x77,0x23,0x5a,
-    0xfa,0xd2,0x62,0x41,0x1e,0x2,0xc7,0xcc,0xc1,0x6a,0x7e,0x77,0x4f,0xe,0x3d,0xcd,
-    0xbd,0xfd,0x54,0xa6,0xc4,0xfe,0xee,0x6d,0x6d,0xc1,0xa5,0xdd,0x1a,0xb5,0xe9,0x63,
-    0xb2,0x40,0xbf,0x66,0xbd,0x48,0x6b,0x22,0x5a,0x54,0x6c,0x5f,0x4,0xd3,0x79,0x33,
-    0x69,0x2,0x68,0xd3,0x34,0x25,0x5b,0x36,0x4e,0x32,0x5c,0x42,0x7e,0x2c,0x8d,0x55,
-    0x6,0x11,0xd,0x7e,0xd1,0x12,0x0,0x4e,0xbe,0xb2,0x30,0xc4,0x46,0x81,0x91,0x9d,
-    0xac,0x11,0x4f,0x8f,0x9e,0xa8,0x17,0x2e,0x64,0x75,0x5f,0x2d,0x30,0x23,0xdf,0x6f,
-    0x55,0x56,0x9c,0xbe,0x1,0x25,0xbb,0x75,0x77,0xe6,0x63,0x14,0x80,0xd,0xa1,0xa4,
-
-    // Record 199: Address = 0x7380, Length = 128
-    0x7380,0x80,
-    0x7e,0x3e,0x9d,0xd7,0x75,0xa1,0x26,0x18,0x6c,0x7d,0x6e,0xb3,0xf6,0x46,0x68,0x41,
-    0x70,0x7f,0x7b,0x61,0x60,0x78,0xee,0xa0,0x69,0xf0,0x8b,0x18,0xbc,0xe3,0xa8,0xcf,
-    0xcd,0xb2,0x91,0xc1,0xe9,0x1f,0x83,0xc,0x2,0xb1,0xba,0xcc,0x27,0x6e,0x2e,0x60,
-    0xfe,0x13,0x9b,0xa4,0xe8,0xcb,0x91,0xee,0x8d,0xfa,0xb5,0x17,0x59,0x82,0x24,0xff,
-    0x49,0x15,0x53,0xbd,0x84,0x3a,0x99,0x94,0x45,0x6c,0x81,0x62,0xb9,0xd6,0xdf,0xe9,
-    0xc8,0x60,0xdd,0x7c,0x9,0x25,0x95,0xf6,0xa,0x3d,0xdb,0x7b,0xde,0xd9,0x55,0xe9,
-    0x73,0x6a,0x7,0x3,0x42,0x4,0xb3,0xb9,0xb,0xd2,0xbf,0xd8,0x8c,0x18,0x87,0x45,
-    0xd1,0x1c,0x81,0x84,0x21,0x74,0xc3,0x14,0x84,0x3,0x86,0x6d,0x1f,0x7,0x8d,0x10,
-
-    // Record 200: Address = 0x7400, Length = 128
-    0x7400,0x80,
-    0x10,0xab,0xd1,0xb6,0x9b,0x9a,0xf2,0xb7,0x61,0xe7,0xfb,0xb6,0xac,0x7f,0x7d,0x8d,
-    0xad,0x93,0x48,0x83,0x1,0xa8,0x81,0x2f,0xef,0xfa,0x85,0x26,0x36,0xb3,0xfd,0xdf,
-    0xe4,0xce,0xc9,0x23,0x68,0xe2,0xf2,0x7d,0x32,0x35,0xec,0x71,0x6,0x4a,0x4,0xc0,
-    0x19,0x48,0xc4,0xb5,0x52,0xb0,0x7,0x89,0xf4,0x67,0x3c,0x40,0x7a,0xaa,0x2a,0xac,
-    0x7f,0x13,0x83,0xd6,0x38,0xe2,0x96,0x6e,0xf4,0x77,0x77,0x6f,0xed,0xb8,0x37,0x26,
-    0x88,0x29,0xa2,0x50,0xae,0xf8,0x1d,0x48,0x4b,0xf5,0x13,0x93,0xc3,0xe6,0xb7,0xd6,
-    0x2f,0xf,0x14,0xc1,0x86,0x3a,0x60,0xfe,0xa4,0x9b,0x34,0x75,0x76,0x9b,0x3e,0x3e,
-    0xd,0x8,0x8b,0xa8,0x45,0x82,0x42,0xa9,0xd0,0xf1,0xcd,0xdf,0x1d,0xf9,0x17,0x51,
-
-    // Record 201: Address = 0x7480, Length = 112
-    0x7480,0x70,
-    0x3a,0x2f,0xc9,0xa7,0xc,0xef,0x18,0xb8,0xec,0xc3,0xb0,0xa5,0xee,0xd2,0x88,0x76,
-    0xbd,0xf8,0x76,0x0,0x2f,0xbf,0x66,0x92,0xd9,0x6,0x10,0x15,0xa6,0xb3,0x2f,0xa8,
-    0x6e,0x54,0x30,0x77,0x3b,0xee,0x34,0xbb,0x75,0x3,0x17,0x55,0x6a,0xb0,0xbc,0x73,
-    0x16,0xcd,0xbb,0xa5,0x41,0x9,0xba,0xb1,0x8f,0x8b,0xf3,0xd4,0xc9,0xa2,0xa,0xd6,
-    0xfc,0xa8,0xdc,0x65,0xd6,0xcb,0x27,0xd8,0x20,0xa3,0x60,0xc1,0x87,0x33,0x2,0xb4,
-    0xbc,0x67,0xcf,0xb6,0xf7,0x27,0xbd,0x22,0x88,0x99,0x1f,0xd3,0x6b,0x0,0xfd,0x8a,
-    0x63,0x3d,0xc3,0x2d,0xa8,0x1a,0x30,0x4a,0x20,0x4c,0xeb,0x82,0x2d,0x8c,0x37,0x6,
-    0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-
-    // Record 202: Address = 0x7500, Length = 128
-    0x7500,0x80,
-    0x56,0x34,0x11,0x99,0xff,0xff,0xff,0xff,0x0,0x1,0x2,0x3,0x4,0x0,0x0,0x0,
-    0x5,0x0,0x0,0x0,0x0,0x0,0x80,0x40,0x6,0x0,0x0,0x0,0x15,0x0,0x0,0x0,
-    0x0,0x0,0x0,0x0,0x0,0x0,0xc8,0x42,0x0,0x0,0xaf,0x43,0x0,0x0,0xaf,0x43,
-    0x0,0x0,0x83,0x43,0x0,0x0,0x74,0x43,0x0,0x80,0x34,0x44,0x0,0x0,0x40,0x3f,
-    0xa,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6,0x14,0x93,0x42,0x6,0x14,0x93,0x42,
-    0x6,0x14,0x93,0x42,0x6,0x14,0x93,0x42,0x6,0x14,0x93,0x42,0x0,0x0,0x80,0x41,
-    0x0,0x0,0x80,0x41,0x0,0x0,0x80,0x41,0x0,0x0,0x80,0x41,0x0,0x0,0x80,0x41,
-    0x0,0x0,0x40,0x40,0x0,0x0,0x40,0x40,0x0,0x0,0x40,0x40,0x0,0x0,0x40,0x40,
-
-    // Record 203: Address = 0x7580, Length = 128
-    0x7580,0x80,
-    0x0,0x0,0x40,0x40,0x19,0x8,0x0,0x0,0x35,0xc8,0x75,0x41,0xc4,0xa4,0xcc,0x42,
-    0xa1,0x7b,0x8e,0x41,0x2,0xb5,0xd5,0x44,0x0,0x0,0x48,0x42,0x0,0x0,0x2a,0xc3,
-    0x0,0x0,0x48,0x42,0x0,0x0,0x70,0xc2,0xc7,0xe1,0xfb,0xbf,0xd2,0x53,0xbf,0xc1,
-    0x33,0x3f,0xed,0xc0,0xb6,0x8b,0x4,0xc3,0x0,0x0,0x80,0x3d,0x0,0x0,0x80,0x3f,
-    0x0,0x0,0x80,0x3d,0x0,0x0,0x80,0x3d,0x0,0x0,0xe0,0x3e,0x5b,0x27,0xc0,0x42,
-    0x0,0x0,0x7f,0x43,0x0,0x0,0x80,0x42,0xf8,0x73,0x61,0xc1,0x0,0x0,0x0,0xbf,
-    0x0,0x0,0x50,0x42,0x0,0x0,0x50,0x42,0x0,0x0,0xd0,0xc1,0x0,0x0,0xd0,0xc1,
-    0x0,0x0,0x0,0x0,0xb8,0x1e,0x5,0xbf,0xb8,0x1e,0x85,0x3e,0x0,0x0,0x68,0x42,
-
-    // Record 204: Address = 0x7600, Length = 128
-    0x7600,0x80,
-    0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8c,0x42,0x0,0x0,0x0,0x0,
-    0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-    0x0,0x0,0x0,0x0,0x0,0x0,0x48,0x42,0x0,0x0,0x48,0x42,0x0,0x0,0x80,0x3f,
-    0x0,0x0,0x70,0x42,0x0,0x0,0x70,0x42,0x0,0x0,0x70,0x42,0x0,0x0,0x70,0x42,
-    0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-    0x0,0x0,0x80,0x3f,0x0,0x0,0xc8,0x41,0xe8,0x3,0x0,0x0,0xa,0x0,0x0,0x0,
-    0x1e,0x0,0x0,0x0,0x78,0x0,0x0,0x0,0x32,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-    0x0,0x0,0x80,0x3f,0x0,0x0,0x80,0x3f,0x0,0x0,0x80,0x3f,0x0,0x0,0x80,0x3f,
-
-    // Record 205: Address = 0x7680, Length = 128
-    0x7680,0x80,
-    0x33,0xb3,0x33,0xb3,0x82,0x0,0xff,0x0,0x83,0x0,0xff,0x0,0x0,0x0,0x0,0x0,
-    0x0,0x0,0x0,0x0,0xa,0x0,0x32,0x0,0x64,0x0,0x0,0x0,0x32,0x0,0x32,0x0,
-    0x64,0x0,0x0,0x0,0x64,0x0,0x64,0x0,0x64,0x0,0x0,0x0,0x96,0x0,0x64,0x0,
-    0x64,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xd0,0x7,
-    0x0,0x0,0xff,0xff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x2,0x0,0x3c,0x0,
-    0x0,0x0,0xff,0xff,0x92,0xcc,0x5c,0xbf,0x51,0x3,0x0,0xc0,0x2,0x0,0x3c,0x0,
-    0x0,0x0,0xff,0xff,0x92,0xcc,0x5c,0xbf,0xd1,0x1,0x0,0xc0,0x2,0x0,0x3c,0x0,
-    0x0,0x0,0xff,0xff,0x92,0xcc,0x5c,0xbf,0x11,0x2,0x0,0xc0,0x2,0x0,0x3c,0x0,
-
-    // Record 206: Address = 0x7700, Length = 128
-    0x7700,0x80,
-    0x0,0x0,0xff,0xff,0x92,0xcc,0x5c,0xbf,0x91,0x0,0x0,0xc0,0x19,0x0,0x90,0x1,
-    0x0,0x0,0xff,0xff,0xda,0x73,0x1f,0xc1,0x32,0x0,0x0,0xe2,0x19,0x0,0x90,0x1,
-    0x0,0x0,0xff,0xff,0xda,0x73,0x1f,0xc1,0x32,0x0,0x0,0xe1,0x0,0x0,0x0,0x0,
-    0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-    0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-    0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-    0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-    0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-
-    // Record 207: Address = 0x7780, Length = 128
-    0x7780,0x80,
-    0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-    0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-    0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-    0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xa0,0x40,
-    0x0,0x0,0x80,0x40,0x0,0x0,0x66,0x3f,0x0,0x0,0xc8,0x41,0xca,0x7d,0x83,0x78,
-    0x77,0x3,0x1,0x2,0x4,0x0,0xff,0x5f,0x7,0x1f,0x0,0x0,0x7f,0x0,0xff,0xff,
-    0x1e,0x0,0x1f,0x0,0x3f,0x78,0x1,0x7,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-    0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-
-    // Record 208: Address = 0x7800, Length = 128
-    0x7800,0x80,
-    0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-    0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5,0x5,0x5,0x5,
-    0x5,0x5,0x5,0x5,0x5,0x5,0x5,0x5,0x4,0x0,0x0,0x0,0x14,0x64,0x0,0x64,
-    0x50,0x1,0x1,0x43,0x0,0x0,0x0,0x0,0x56,0x34,0x11,0x99,0x7,0x0,0x1,0x0,
-    0x2,0x10,0x3,0x10,0x4,0x10,0x5,0x10,0x6,0x20,0x7,0x20,0x0,0x0,0x0,0x0,
-    0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,
-    0x5,0x8,0xb,0xe,0x12,0x16,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-    0x0,0x0,0x4,0x0,0xa,0x0,0x10,0x0,0x16,0x0,0x1c,0x0,0x24,0x0,0x2c,0x0,
-
-    // Record 209: Address = 0x7880, Length = 128
-    0x7880,0x80,
-    0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-    0x0,0x0,0x0,0x0,0x61,0x78,0x74,0x3f,0xea,0x5f,0x7a,0x3d,0xf3,0x79,0x38,0x3d,
-    0x1,0x5a,0x70,0x3f,0xb0,0x70,0x4d,0x3f,0xaf,0xc5,0x99,0x3e,0x0,0x0,0x80,0x3f,
-    0x3e,0x3d,0x4a,0x3e,0x28,0x1d,0x33,0x3f,0x0,0x0,0x0,0x0,0x37,0xde,0x4d,0x3f,
-    0x43,0x75,0x7e,0x3f,0x0,0x0,0x80,0x3f,0x25,0x87,0x48,0x3e,0x4f,0x5e,0xc5,0x3b,
-    0x0,0x0,0x0,0x0,0x49,0xb1,0x3b,0x3f,0x72,0x49,0x15,0x3f,0x0,0x0,0x80,0x3f,
-    0x6f,0x9d,0x88,0x3e,0x1c,0x6d,0xd5,0x3e,0x0,0x0,0x0,0x0,0xa9,0x2b,0x18,0x3f,
-    0xc5,0xf6,0xf,0x3f,0x0,0x0,0x80,0x3f,0xaf,0xa8,0xcf,0x3e,0x75,0x12,0xe0,0x3e,
-
-    // Record 210: Address = 0x7900, Length = 128
-    0x7900,0x80,
-    0x0,0x0,0x0,0x0,0xcb,0xda,0x71,0x3f,0x98,0x93,0x76,0x3f,0xf9,0x91,0x72,0x3f,
-    0x9f,0x1f,0x70,0x3f,0x4d,0x53,0x62,0x3d,0x7b,0xc6,0x16,0x3d,0x6a,0xe0,0x56,0x3d,
-    0x11,0x6,0x7e,0x3d,0x2d,0xd6,0x72,0x3f,0x1f,0xdf,0x6e,0x3f,0x69,0x94,0x5e,0x3f,
-    0x24,0x75,0x6c,0x3f,0x32,0x9d,0x52,0x3d,0x7,0x7,0x89,0x3d,0x5b,0xae,0x5,0x3e,
-    0xdc,0x56,0x9c,0x3d,0xb2,0x9b,0x8b,0x3a,0x3c,0x8f,0xf8,0x3e,0xe,0x39,0x74,0x3d,
-    0x1a,0x9c,0xa1,0x38,0x4b,0x5e,0xaf,0x3d,0xb0,0xb7,0xed,0x3b,0xe4,0xc9,0xc8,0x3d,
-    0x1d,0x1f,0xa0,0x32,0xd2,0x4b,0x98,0x3a,0x25,0x4c,0xdc,0x3d,0x66,0x50,0x7,0x3d,
-    0xe6,0xe6,0x80,0x32,0x26,0xd,0xa8,0x3d,0xac,0xb8,0x37,0x32,0x96,0x6a,0xac,0x3d,
-
-    // Record 211: Address = 0x7980, Length = 128
-    0x7980,0x80,
-    0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,0x0,0x9e,0x3c,0x3e,0x0,0xc9,0x7f,0x3b,
-    0x2c,0xba,0x9d,0x3d,0x54,0xfa,0xed,0x39,0x30,0x4e,0xfa,0x3c,0x8d,0xac,0x8b,0x3d,
-    0x7a,0xad,0x71,0x36,0x78,0x45,0x18,0x32,0x10,0x96,0xdc,0x3d,0xc0,0xa3,0x6f,0x3d,
-    0xd5,0xa5,0x22,0x39,0x29,0x9b,0xc6,0x3d,0xc8,0x9c,0x54,0x33,0x79,0x81,0xa7,0x3e,
-    0x6c,0x96,0xe8,0x30,0xdc,0x24,0x34,0x28,0xe1,0xeb,0xfd,0x28,0x65,0x6c,0x8e,0x3d,
-    0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,
-    0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,
-    0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,
-
-    // Record 212: Address = 0x7a00, Length = 128
-    0x7a00,0x80,
-    0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,
-    0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,
-    0xdc,0x24,0x34,0x28,0x59,0x8b,0x10,0x3d,0x28,0xa5,0xde,0x3e,0x73,0x32,0x6e,0x3f,
-    0x35,0x5e,0x87,0x36,0x8b,0x93,0x54,0x3e,0xc3,0x49,0x20,0x2f,0xdc,0x24,0x34,0x28,
-    0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,
-    0xdc,0x24,0x34,0x28,0xf2,0xb7,0xb3,0x3b,0x36,0xf5,0xb6,0x3e,0xc4,0xd2,0xcb,0x2f,
-    0x97,0x8f,0x75,0x3f,0xd7,0xe4,0x5e,0x39,0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,
-    0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,
-
-    // Record 213: Address = 0x7a80, Length = 128
-    0x7a80,0x80,
-    0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,0xe0,0xaa,0x58,0x3d,0x53,0x5e,0x23,0x3e,
-    0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,0xa7,0xfa,0x41,0x3d,
-    0x62,0x78,0x59,0x3f,0x8d,0xe2,0x1a,0x33,0x6f,0x1,0xbd,0x3b,0xc,0xec,0xc5,0x3d,
-    0x5f,0x40,0xbf,0x3c,0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,
-    0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,0x30,0x32,0x1,0x3d,
-    0x7f,0xb9,0x7d,0x3a,0x50,0x40,0x3f,0x3c,0x30,0x53,0x6a,0x3f,0xb2,0x6f,0xc5,0x31,
-    0x52,0x58,0xa7,0x3d,0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,0x53,0x58,0xa7,0x3d,
-    0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,0x5f,0x40,0x3f,0x3c,0xdc,0x24,0x34,0x28,
-
-    // Record 214: Address = 0x7b00, Length = 128
-    0x7b00,0x80,
-    0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,
-    0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,0x5f,0x40,0xbf,0x3c,
-    0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,0x5c,0x46,0xb9,0x3e,0xdc,0x24,0x34,0x28,
-    0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,
-    0x7d,0x4,0x7b,0x3e,0xdc,0x24,0x34,0x28,0x71,0x6e,0xcf,0x39,0x3c,0x6a,0x75,0x3e,
-    0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,
-    0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,
-    0xdc,0x24,0x34,0x28,0xfe,0x67,0xb4,0x32,0xf7,0x82,0x6a,0x3e,0xf3,0xb3,0x2e,0x3f,
-
-    // Record 215: Address = 0x7b80, Length = 128
-    0x7b80,0x80,
-    0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,0xcd,0x82,0x23,0x36,
-    0x11,0xf0,0xff,0x3d,0xdd,0xcf,0x23,0x37,0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,
-    0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,0x6c,0xdf,0x4,0x3d,
-    0xdc,0x24,0x34,0x28,0xee,0x73,0xbe,0x2a,0x97,0x5,0x3a,0x3d,0xdc,0x24,0x34,0x28,
-    0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,
-    0xdc,0x24,0x34,0x28,0x84,0x19,0xa8,0x36,0xce,0x4,0x25,0x3f,0x7e,0x83,0x22,0x38,
-    0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,0x83,0xff,0x7f,0x3f,
-    0xd1,0x8,0x85,0x3a,0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,
-
-    // Record 216: Address = 0x7c00, Length = 128
-    0x7c00,0x80,
-    0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,0xa3,0x6c,0xb0,0x30,0x6a,0x8e,0xb1,0x3d,
-    0xb5,0x7d,0x7c,0x33,0x9d,0xff,0x78,0x3e,0x32,0xce,0x69,0x3f,0xdc,0x24,0x34,0x28,
-    0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,0x9,0x1d,0x53,0x3d,0x14,0x57,0x17,0x3f,
-    0x44,0x22,0xdf,0x32,0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,
-    0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,
-    0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,0xa8,0xc4,0xa0,0x3c,0x93,0x98,0xc5,0x30,
-    0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,
-    0x5e,0x77,0xd,0x3a,0x15,0xf0,0x28,0x3e,0x73,0x10,0x0,0x32,0xdc,0x24,0x34,0x28,
-
-    // Record 217: Address = 0x7c80, Length = 128
-    0x7c80,0x80,
-    0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,0xab,0xa4,0x6d,0x3f,0xcd,0xfb,0x33,0x3a,
-    0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,
-    0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,
-    0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,
-    0xdc,0x24,0x34,0x28,0xbb,0xe3,0xde,0x3a,0xc2,0x98,0xfc,0x3d,0x67,0x90,0xfd,0x3b,
-    0x22,0xd9,0x96,0x3a,0x41,0xbf,0x64,0x3b,0x5e,0x50,0xc1,0x38,0x73,0x7b,0x22,0x3e,
-    0x68,0xcb,0xed,0x2c,0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,0x1b,0xf4,0x62,0x3e,
-    0x4d,0xa2,0x24,0x3c,0xec,0xc4,0x8f,0x3a,0x94,0x1e,0xcf,0x33,0x37,0x93,0x3,0x3f,
-
-    // Record 218: Address = 0x7d00, Length = 128
-    0x7d00,0x80,
-    0xa9,0x9a,0xb4,0x39,0xab,0x94,0x0,0x3e,0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,
-    0x66,0x18,0xe1,0x2f,0x8b,0xf9,0x70,0x2e,0xd6,0x31,0xc,0x3b,0xe3,0xbf,0x81,0x3b,
-    0xd9,0x62,0xd6,0x3a,0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,0xdf,0xb0,0x10,0x3d,
-    0xf0,0xfe,0xd5,0x3e,0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,0xb2,0xd0,0x34,0x3d,
-    0x61,0xab,0x8d,0x3d,0x43,0x43,0x72,0x3b,0xc9,0x14,0xe2,0x3e,0xdc,0x24,0x34,0x28,
-    0xdc,0x24,0x34,0x28,0x88,0x22,0x5e,0x2c,0x9d,0xb6,0x97,0x3e,0xdc,0x24,0x34,0x28,
-    0x9f,0xbe,0xae,0x3a,0xdc,0x24,0x34,0x28,0xbb,0x87,0x1a,0x36,0xdb,0xb7,0x6a,0x3b,
-    0xdc,0x24,0x34,0x28,0xf7,0x65,0x4a,0x3a,0x4f,0xe9,0xec,0x3d,0x2d,0x89,0x6f,0x3a,
-
-    // Record 219: Address = 0x7d80, Length = 128
-    0x7d80,0x80,
-    0xc0,0x41,0x7b,0x3c,0x83,0x7e,0x42,0x3f,0x98,0xf1,0x4a,0x3b,0xe,0x81,0x92,0x3a,
-    0x1f,0xc2,0xd2,0x3a,0x30,0x66,0xab,0x3d,0x76,0x16,0x73,0x3c,0xdc,0x24,0x34,0x28,
-    0x4c,0x50,0xe,0x3b,0x92,0x14,0x4b,0x3a,0x4a,0xff,0x91,0x2c,0xe7,0x60,0xf0,0x3b,
-    0x39,0x46,0xcb,0x3e,0xe5,0x7a,0x9f,0x3c,0xcd,0x5a,0x40,0x3b,0xcf,0x1d,0xd3,0x3a,
-    0x6b,0x61,0xa8,0x3d,0xb3,0x63,0x85,0x3a,0x12,0x9f,0x93,0x3b,0x2a,0xa7,0x15,0x3e,
-    0xfc,0xbe,0x1d,0x3b,0xdc,0x24,0x34,0x28,0xfa,0xe1,0x86,0x3a,0xfb,0x8a,0x26,0x3f,
-    0xa1,0x31,0x74,0x3b,0x35,0x62,0xb,0x3b,0x48,0xf9,0x86,0x3e,0xa3,0xb7,0x8e,0x3b,
-    0x62,0xcb,0x1c,0x3b,0xe8,0xc8,0x81,0x3b,0xf5,0x60,0x35,0x3f,0x4f,0x12,0xbf,0x3c,
-
-    // Record 220: Address = 0x7e00, Length = 128
-    0x7e00,0x80,
-    0x5,0xf,0xa2,0x3b,0x97,0x53,0xb0,0x3c,0x62,0xff,0x19,0x3a,0xbd,0x11,0xdc,0x3a,
-    0x52,0x1,0x53,0x3a,0xdc,0x24,0x34,0x28,0xdc,0x24,0x34,0x28,0x1,0x9d,0xd,0x3b,
-    0x6e,0x2a,0x13,0x3a,0xd,0xeb,0x60,0x3e,0x70,0x59,0x31,0x3c,0x42,0x30,0xab,0x3c,
-    0x2e,0x3a,0x45,0x3b,0xa6,0x15,0x73,0x3d,0xc5,0xef,0xcb,0x35,0xa9,0xf6,0x91,0x3c,
-    0xc9,0xec,0xa5,0x3e,0x71,0x65,0x7c,0x3d,0x84,0xd1,0x7b,0x3a,0xb7,0x2a,0x3a,0x3c,
-    0xb8,0xed,0xaa,0x3c,0xbb,0x3,0x27,0x39,0x73,0x5a,0x19,0x36,0x0,0xf3,0x7e,0x3d,
-    0x32,0x54,0x9f,0x3e,0x36,0x4,0xa5,0x3a,0x53,0xee,0x0,0x38,0x6f,0x9d,0x1c,0x3b,
-    0xd8,0xc8,0x22,0x3b,0x2c,0x85,0xb4,0x39,0xdb,0x6e,0x8f,0x39,0xa9,0x20,0xa5,0x3c,
-
-    // Record 221: Address = 0x7e80, Length = 128
-    0x7e80,0x80,
-    0x2b,0x57,0x2e,0x3c,0xc6,0x22,0xb5,0x3e,0x26,0xa2,0x79,0x29,0x6c,0x6c,0x4a,0x3c,
-    0xca,0xa8,0x10,0x3c,0xcf,0xa1,0x9,0x2b,0xb6,0x88,0xf7,0x39,0x64,0x86,0x7d,0x3b,
-    0xfe,0x58,0x36,0x3e,0x68,0x2d,0x8c,0x3e,0x3e,0x38,0x1,0x3c,0xa,0xd7,0x27,0x3c,
-    0x20,0x33,0x52,0x3b,0x9e,0x5c,0xbb,0x3a,0x6c,0xb5,0xa9,0x3a,0x62,0x12,0x2b,0x3c,
-    0xd2,0x79,0xfb,0x3d,0x0,0x0,0x0,0x3f,0x0,0x0,0x0,0x3f,0x0,0x0,0x80,0x3f,
-    0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3f,0x0,0x0,0x0,0x0,
-    0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3f,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-    0x0,0x0,0x80,0x3f,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x80,0x3e,
-
-    // Record 222: Address = 0x7f00, Length = 124
-    0x7f00,0x7c,
-    0x0,0x0,0x80,0x3e,0x0,0x0,0x80,0x3e,0x0,0x0,0x80,0x3e,0x0,0x0,0x80,0x3e,
-    0x0,0x0,0x80,0x3e,0x0,0x0,0x80,0x3e,0x0,0x0,0x80,0x3e,0x0,0x0,0x0,0x0,
-    0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-    0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-    0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-    0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-    0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-    0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x4,0x4,0x4,
-};
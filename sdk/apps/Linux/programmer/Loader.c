@@ -1,1227 +0,0 @@
-// This file was generated with mgcconv, which is part of the Microchip GestIC SDK 1.1.8
-
-struct {
-    int record_count;
-    unsigned char iv[14];
-    unsigned char fw_version[120];
-    struct {
-        unsigned short address;
-        unsigned char length;
-        unsigned char data[128];
-    } data[109];
-} Loader = {
-    // Record-Count
-    109,
-
-    // IV
-    0x42,0xff,0xff,0x11,0x66,0xe6,0x95,0x55,0xbd,0x54,0xb8,0xcc,0xa7,0x68,
-
-    // FwVersion: LL0:100.19;p:HillstarV01                     ;;i:B;f:22500;s:Beta2r1266:1281:MO;c:MKI;t:2014/09/11 15:26:26;
-    0x4c,0x4c,0x30,0x3a,0x31,0x30,0x30,0x2e,0x31,0x39,0x3b,0x70,0x3a,0x48,0x69,0x6c,
-    0x6c,0x73,0x74,0x61,0x72,0x56,0x30,0x31,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3b,0x3b,0x69,
-    0x3a,0x42,0x3b,0x66,0x3a,0x32,0x32,0x35,0x30,0x30,0x3b,0x73,0x3a,0x42,0x65,0x74,
-    0x61,0x32,0x72,0x31,0x32,0x36,0x36,0x3a,0x31,0x32,0x38,0x31,0x3a,0x4d,0x4f,0x3b,
-    0x63,0x3a,0x4d,0x4b,0x49,0x3b,0x74,0x3a,0x32,0x30,0x31,0x34,0x2f,0x30,0x39,0x2f,
-    0x31,0x31,0x20,0x31,0x35,0x3a,0x32,0x36,0x3a,0x32,0x36,0x3b,0x0,0x0,0x0,0x0,
-    0x0,0x0,0x0,0x0,0xe1,0xfc,0x0,0x0,
-
-    // Record 0: Address = 0x1000, Length = 128
-    0x1000,0x80,
-    0x4f,0xa2,0x40,0x18,0xd,0xb3,0x3,0x7b,0x98,0x9c,0xd9,0xa3,0xc4,0x37,0xfb,0xaa,
-    0xf7,0xb3,0xd4,0x94,0x80,0x1e,0xc3,0xf9,0x99,0x44,0xfa,0x7f,0xff,0xba,0xce,0x6b,
-    0x6e,0x5d,0xd,0x91,0x15,0x3,0xf,0xf5,0x3e,0xa2,0xe2,0x69,0x5e,0x46,0x6c,0x2d,
-    0xaf,0xd2,0x5c,0x8d,0xb2,0xf0,0x6f,0xf9,0x73,0x79,0xc1,0x19,0x53,0x3f,0x4c,0x82,
-    0x0,0xc,0xc4,0x5e,0xba,0x8f,0xa6,0x8d,0x3d,0xca,0xff,0x9a,0x94,0x2a,0xf8,0x2c,
-    0x59,0x67,0x77,0xb6,0x4b,0xf0,0x2b,0x6a,0x2f,0xbf,0x73,0xa1,0xa7,0xb0,0x3d,0x14,
-    0xb1,0x5f,0x7f,0x76,0x1d,0x68,0x84,0xee,0x24,0x34,0x16,0xe2,0x43,0x3e,0xa9,0x37,
-    0x60,0x4,0xd0,0xca,0x94,0x7a,0x53,0xf,0x82,0x64,0x68,0x8d,0x50,0x9d,0xa7,0x19,
-
-    // Record 1: Address = 0x1080, Length = 128
-    0x1080,0x80,
-    0xf9,0x86,0xec,0xea,0x15,0xa7,0xf9,0x94,0xc6,0xc1,0x10,0x1a,0x3e,0xbd,0x44,0x2c,
-    0xc8,0x58,0xcc,0xe1,0x9d,0x85,0xa6,0xbf,0x86,0xa1,0x3a,0x3b,0xef,0xe1,0xfb,0x59,
-    0x37,0x5d,0x58,0xc6,0xff,0x60,0xfa,0x89,0xec,0x87,0xa0,0x4a,0x41,0x75,0x7f,0xbb,
-    0xc8,0x81,0x93,0x76,0x40,0x5d,0x3b,0x85,0xf9,0xb2,0x2d,0x3a,0x3e,0x58,0x1,0x2d,
-    0xb0,0xa7,0x1d,0x2f,0x2c,0xe2,0x39,0x51,0x6,0x6d,0xb3,0x54,0x78,0x55,0xb3,0x32,
-    0xf4,0x0,0x94,0xe9,0x13,0xf3,0x35,0x31,0xbf,0xca,0x1b,0x33,0x99,0x1f,0x6d,0x8d,
-    0xca,0xcf,0xb9,0x36,0xdf,0xfc,0x3f,0x10,0x9c,0xb8,0x4f,0xb0,0x11,0x98,0xe5,0x9c,
-    0x9e,0x4a,0xea,0x5f,0x6e,0x29,0x58,0xfe,0xea,0x13,0xa6,0xda,0x9f,0xad,0xd6,0x17,
-
-    // Record 2: Address = 0x1100, Length = 128
-    0x1100,0x80,
-    0x40,0x9c,0x53,0x29,0xc2,0x38,0x9f,0x18,0x1,0x4a,0x5d,0xd9,0xa9,0xf,0x48,0xae,
-    0x4b,0x36,0x86,0x85,0x1f,0xca,0x39,0x1,0xc7,0x3e,0xb9,0x89,0x9c,0x62,0xd8,0xe9,
-    0x76,0x4b,0x5b,0x19,0x5d,0xf5,0x71,0x9a,0x38,0x9e,0xc9,0x75,0xa8,0x81,0x59,0xe8,
-    0x76,0xd8,0x95,0x68,0x9,0x26,0xf,0xe6,0xc7,0xa7,0x83,0x4a,0x16,0x4a,0x7a,0x2a,
-    0x1,0xb4,0x65,0x9e,0x50,0x3f,0xb5,0x97,0x1,0xa4,0xff,0x39,0x20,0x30,0x4,0xfe,
-    0xfa,0x21,0x2d,0x5d,0xa3,0x5,0x12,0xd7,0xc9,0xbc,0x1f,0x8c,0x6c,0x1f,0xf3,0x50,
-    0x94,0xbb,0xcf,0x8,0xa,0x31,0x38,0xbe,0x6c,0x36,0x91,0x59,0xca,0x93,0xc5,0x13,
-    0xa2,0xad,0xfa,0xea,0x4b,0x8a,0xc8,0x66,0x76,0x6,0x77,0xbd,0xe4,0x4f,0xe4,0x5b,
-
-    // Record 3: Address = 0x1180, Length = 128
-    0x1180,0x80,
-    0x76,0xc1,0x3a,0x42,0xa4,0x91,0xcd,0xb6,0xaa,0xe8,0x48,0xab,0x48,0xf9,0x44,0xc1,
-    0x2,0x16,0x25,0xad,0xf3,0xe1,0xd4,0xaf,0xc1,0x20,0xb4,0x99,0xb0,0xc5,0xc,0x4b,
-    0x9d,0x9,0xe1,0xaa,0x27,0xb7,0xa6,0x8c,0x4c,0xa9,0x60,0x62,0x53,0x2c,0xb9,0x30,
-    0xad,0x8a,0x74,0xf2,0x43,0x21,0x25,0x47,0x83,0x5c,0x73,0x26,0xda,0xd0,0x34,0x4d,
-    0x52,0x88,0x3c,0xcc,0xce,0x19,0xa3,0xf7,0xc7,0xd8,0x2a,0xd,0x91,0x20,0xf8,0xc2,
-    0xdb,0x9e,0x43,0x38,0x17,0x7a,0x1a,0x38,0x4a,0xaf,0x8c,0xc6,0xeb,0xe9,0xed,0x79,
-    0x1b,0xe9,0x9c,0xc9,0x37,0xb3,0xc,0x49,0x82,0x13,0x43,0x73,0xa3,0x96,0x39,0x8c,
-    0xec,0xb9,0x26,0x24,0x1c,0x42,0xe9,0xfc,0xae,0x6b,0xfd,0x16,0x8f,0xee,0xb6,0x2f,
-
-    // Record 4: Address = 0x1200, Length = 128
-    0x1200,0x80,
-    0x2c,0x12,0xc1,0x9e,0x5d,0xb7,0xb5,0xac,0x64,0xab,0x72,0x56,0x3b,0x8,0x44,0xc1,
-    0x9,0x67,0xf,0x3f,0xe0,0x5d,0xfd,0xc3,0xed,0xc8,0x89,0xbc,0x8e,0x8d,0x17,0xb6,
-    0x1a,0xe7,0x31,0x3e,0x35,0x52,0x5f,0x82,0x2c,0x57,0xde,0x1a,0xea,0xb0,0x89,0x65,
-    0x6f,0x3c,0xaa,0x18,0x9e,0xbd,0xbf,0x8,0x38,0x62,0x42,0xca,0x7f,0xfa,0x9d,0xa2,
-    0xe8,0xe0,0x24,0x7d,0x64,0xbe,0x22,0x54,0xe8,0x2a,0xc8,0x47,0x13,0x56,0x96,0x84,
-    0x25,0x7e,0xe,0xd,0xe6,0x7b,0xff,0xf9,0x55,0x3c,0x1c,0xac,0x27,0xfa,0x83,0x3c,
-    0x6,0xfd,0x18,0x3b,0x44,0x8a,0xb8,0x4e,0xac,0xd1,0xfd,0xe9,0xcc,0xd5,0xf6,0xb5,
-    0x3,0x1a,0x4c,0x9d,0x5d,0x31,0x80,0xab,0xf5,0x4a,0x68,0xdc,0xf4,0x45,0x77,0xb1,
-
-    // Record 5: Address = 0x1280, Length = 128
-    0x1280,0x80,
-    0x15,0xf1,0x48,0x41,0x8a,0x51,0xc2,0xcb,0x2a,0x64,0x86,0x6,0xfc,0x7b,0x27,0xcc,
-    0x38,0x4c,0xab,0xf0,0xf9,0x16,0xb8,0x54,0xd4,0x3b,0x38,0xc1,0x2c,0x30,0x8f,0xa7,
-    0xdf,0x20,0xe0,0x1a,0x9a,0x83,0x17,0x8b,0x55,0x51,0x81,0x81,0xaa,0xe9,0x23,0xa6,
-    0xb9,0x2f,0xa3,0xca,0x25,0xf7,0x47,0xf3,0x20,0xb3,0xc1,0x19,0xdc,0x55,0x38,0x8d,
-    0xef,0x58,0xf8,0x31,0xb6,0xeb,0x7f,0x51,0x5,0x50,0x54,0x29,0x6e,0xd8,0xd2,0xd2,
-    0xc3,0x83,0x8c,0xa8,0x2,0xf6,0x96,0xf,0x3b,0x2f,0x3b,0xaf,0x8e,0xbe,0xc3,0x6,
-    0xdc,0x23,0xf9,0x6e,0xae,0xd5,0xc,0x86,0x4c,0x6a,0xf6,0xe4,0x86,0xce,0xac,0x3f,
-    0x49,0x8,0xc4,0x9e,0x27,0x42,0xa6,0x73,0x5,0xa2,0x47,0x92,0x8a,0x15,0x38,0x15,
-
-    // Record 6: Address = 0x1300, Length = 128
-    0x1300,0x80,
-    0xb2,0x6b,0x23,0x71,0xb5,0xd5,0x44,0x45,0x41,0x45,0x81,0x40,0x84,0x64,0xdf,0xe4,
-    0x8c,0xcc,0x50,0x8d,0xe9,0x65,0x1a,0x72,0xf6,0x8,0xa1,0xe1,0xf1,0x7,0x42,0x14,
-    0x3c,0xfd,0x8a,0x3b,0x15,0x3f,0xd1,0xcb,0x86,0x40,0x13,0xdc,0xa0,0xda,0x6a,0xdb,
-    0xba,0xb8,0x12,0x70,0xc1,0xde,0x75,0x91,0xef,0x2b,0x22,0xe6,0x48,0x6,0x16,0xe2,
-    0xdc,0x3c,0x2f,0xee,0x36,0x65,0x29,0x49,0x25,0x40,0xac,0xc3,0x53,0xe2,0xcd,0x92,
-    0x2f,0xdc,0x32,0x1e,0x6a,0x89,0x98,0xc0,0xe8,0xaa,0x10,0x99,0x71,0x97,0x60,0xaf,
-    0xb4,0x64,0x77,0xb6,0xf,0xdd,0xe1,0x3e,0xdc,0xa4,0x3a,0x44,0x79,0x2a,0xd8,0xab,
-    0x9b,0xe7,0x5c,0x6c,0x14,0x26,0x90,0xac,0xb,0x15,0xa7,0x63,0xc1,0xdf,0xc6,0x8,
-
-    // Record 7: Address = 0x1380, Length = 128
-    0x1380,0x80,
-    0x39,0x99,0xee,0x16,0xda,0x51,0xe4,0x2e,0x45,0xb4,0x92,0x27,0x53,0x5a,0x1d,0x22,
-    0x12,0x97,0x12,0x92,0x73,0x6f,0x21,0x86,0x60,0x55,0x61,0xf8,0x83,0x31,0x83,0xa7,
-    0x51,0xd7,0x70,0x7b,0x55,0x30,0xeb,0x3b,0xaa,0x1c,0xd6,0x53,0x15,0x33,0x9c,0x4,
-    0x67,0x8a,0xf4,0xe5,0x68,0xc9,0x26,0xd8,0xab,0x81,0x98,0x85,0xe3,0xc,0x17,0x49,
-    0xc6,0x6a,0x10,0x25,0x3c,0x88,0x8e,0x96,0x67,0x71,0xb0,0x9d,0x7d,0xae,0x90,0x96,
-    0x21,0x78,0x4d,0x8e,0x50,0x1e,0xb0,0x96,0xaa,0x72,0xe6,0xc1,0x8e,0xd,0x57,0x83,
-    0x34,0x1c,0x2a,0xd5,0x4,0x7,0x61,0xcf,0xb,0x4f,0x81,0xaa,0x56,0xa7,0x8d,0xcd,
-    0xa9,0x47,0x68,0x47,0x59,0x6,0x3d,0x2f,0xc3,0x7b,0xb0,0x5a,0xec,0x1a,0x87,0x12,
-
-    // Record 8: Address = 0x1400, Length = 128
-    0x1400,0x80,
-    0xbb,0x7d,0x3f,0x11,0x18,0xc3,0xc2,0x65,0x1c,0xe4,0x37,0x2b,0x88,0xdf,0x7,0x4c,
-    0x35,0x31,0xbb,0xd,0x98,0xa4,0x25,0x57,0x18,0x9d,0x39,0xaa,0x9a,0x5c,0x3c,0xaf,
-    0xa,0x3,0x87,0x4,0xfa,0x9e,0x6e,0xc6,0xff,0xdd,0x68,0xb2,0x6d,0x33,0x7f,0x28,
-    0xc5,0x1b,0x3c,0x77,0x2d,0xd2,0xfa,0x98,0x43,0x99,0x8d,0xd9,0x35,0x70,0x4c,0x43,
-    0x32,0x71,0x21,0x8d,0x6f,0x80,0xf8,0xb,0x9a,0xd0,0x57,0x26,0xcf,0xfa,0x30,0xd9,
-    0x8d,0x35,0x51,0xf6,0xc4,0x71,0x8e,0x23,0xd5,0x34,0x75,0x6c,0xf0,0xcf,0x34,0xf7,
-    0xce,0x26,0x10,0x2b,0x36,0xf9,0xcf,0xf3,0xbd,0xf,0x6a,0xa6,0xaf,0x57,0x69,0xac,
-    0x8a,0x43,0xa8,0xdd,0x7,0x29,0x38,0x11,0x43,0x5,0x43,0x12,0x83,0x1c,0xad,0xc2,
-
-    // Record 9: Address = 0x1480, Length = 128
-    0x1480,0x80,
-    0x80,0x1d,0xa8,0x49,0xf6,0xe9,0x95,0xa2,0x23,0x3c,0xc0,0x6e,0x19,0x4f,0x4,0xad,
-    0xfc,0x4d,0xd3,0xdc,0xca,0xb0,0xa7,0x64,0xf1,0x86,0x24,0xc,0xc4,0x30,0xe7,0x32,
-    0xe7,0xe3,0xb8,0x44,0xfc,0x5c,0x4b,0xd0,0x89,0x52,0xc3,0x1c,0x9d,0x29,0xc9,0x9c,
-    0x5d,0x91,0x8c,0xa8,0x16,0xc0,0x82,0x1d,0x6c,0xb2,0xe1,0xfa,0xed,0x1d,0x32,0xbd,
-    0x82,0x48,0x6e,0x6b,0x57,0x16,0x2d,0xd,0xb6,0xd3,0x60,0xdf,0x1f,0x89,0xeb,0xae,
-    0xf4,0x6c,0x1a,0x99,0xf9,0x58,0xef,0x9,0xfd,0x60,0x42,0x23,0x48,0xd8,0xf7,0x34,
-    0x43,0xd7,0xb3,0x9f,0x9e,0x6a,0x2d,0x9c,0x6,0x27,0x73,0x98,0x47,0x4b,0x13,0xf,
-    0x4a,0x14,0xee,0x4c,0x9c,0xa3,0x51,0x8f,0xe7,0xb2,0xda,0x8a,0x4d,0xda,0x45,0xc6,
-
-    // Record 10: Address = 0x1500, Length = 128
-    0x1500,0x80,
-    0xbc,0xab,0x32,0x7c,0xb3,0x5f,0xae,0x82,0xc4,0x40,0x89,0xf4,0x4a,0x7d,0x16,0x66,
-    0x2,0x9,0x5c,0xcb,0xfa,0x3b,0x3d,0x8e,0xfd,0x87,0xf7,0x64,0x86,0x84,0x62,0x34,
-    0xe5,0x6c,0x50,0x33,0xb0,0x9a,0x72,0xe9,0xfa,0xb0,0x9a,0x76,0xf3,0xc8,0x83,0x18,
-    0x23,0x92,0x1f,0x77,0x2c,0xcf,0x37,0xec,0x39,0xcc,0x37,0xb2,0xe4,0xcd,0xe3,0x57,
-    0x18,0x7f,0xec,0xa6,0x31,0x97,0x73,0xbe,0x14,0x64,0xc9,0x7a,0xb7,0x23,0xa0,0x65,
-    0xd,0xf,0x9f,0x99,0xc,0xc6,0xfd,0xec,0xff,0xe3,0x23,0xb5,0xb6,0x3f,0x7c,0xe9,
-    0xdf,0xf,0xd9,0x33,0xe6,0xf3,0xd0,0xd1,0x30,0xd1,0xcb,0x6e,0xb2,0xde,0xe4,0x1a,
-    0x82,0x47,0xa7,0xdb,0xa8,0xa2,0x71,0xc2,0x75,0x7a,0x5e,0x38,0x4a,0x1,0x65,0xa7,
-
-    // Record 11: Address = 0x1580, Length = 128
-    0x1580,0x80,
-    0x4e,0x4c,0x17,0xa0,0xbe,0x18,0x9d,0xe4,0xd4,0x13,0xe0,0x52,0xea,0x1f,0xb6,0xa8,
-    0xfd,0x3d,0xbe,0x3e,0x63,0x7,0xec,0xb7,0xc3,0x77,0x38,0x53,0x5f,0xd6,0xb,0x46,
-    0x6e,0x89,0x57,0xf5,0x2b,0xc3,0x80,0xef,0x2d,0x75,0xe8,0xf7,0xa5,0x7,0x14,0x67,
-    0xfd,0x45,0xa4,0x4d,0xda,0x59,0x36,0x3d,0x2f,0xd4,0xa,0x6c,0x99,0x5,0x94,0xd4,
-    0xb7,0xec,0x6b,0xdd,0xfa,0xf0,0x15,0x91,0x8e,0x2,0x10,0x8f,0x75,0xaf,0x85,0xc6,
-    0x96,0xe1,0x42,0xf0,0x93,0xf7,0x19,0x48,0x4a,0x41,0xdd,0x1b,0xa3,0x33,0x3,0xd4,
-    0xed,0x9a,0xeb,0x7f,0x4e,0xae,0x27,0x4d,0xcd,0x4,0x3b,0x62,0x9c,0xf3,0x82,0xfa,
-    0x4b,0x6f,0x54,0x99,0xd9,0x1c,0x97,0xe7,0x98,0x47,0x7c,0x1f,0x7a,0x50,0x22,0xde,
-
-    // Record 12: Address = 0x1600, Length = 128
-    0x1600,0x80,
-    0xce,0xcc,0xd8,0xa3,0x41,0x33,0x13,0xc9,0x2,0x4d,0xe6,0xa6,0x47,0x64,0xc1,0xbc,
-    0xda,0x8d,0x3e,0xae,0xfa,0x46,0x1b,0x59,0x4b,0xe6,0x18,0x24,0xe,0x34,0xde,0x27,
-    0x7e,0x13,0xcf,0xea,0x92,0xe,0x28,0xd5,0xfa,0xe1,0x4c,0x66,0xa0,0xc9,0x7a,0x4e,
-    0x3c,0x83,0x8e,0x6a,0x58,0xf,0xb0,0x3,0x1a,0x9,0x78,0xe8,0x24,0xab,0x3f,0x4a,
-    0x9f,0x26,0x21,0x2f,0xdd,0x6b,0x11,0xdc,0x79,0xbb,0xc9,0xb4,0x1,0x35,0x61,0x31,
-    0xe5,0x44,0x71,0xc7,0xae,0xda,0xe9,0x0,0x9f,0x80,0x4b,0xcb,0x9c,0x33,0x50,0xa8,
-    0x20,0x82,0x20,0x5d,0x7f,0x42,0x43,0x2c,0xcb,0xb5,0xe6,0x99,0xa,0xbf,0x2a,0x6f,
-    0x7f,0xc7,0xef,0x88,0xed,0xb2,0x3b,0x3,0x9,0x31,0xd7,0xf7,0xf,0x60,0x4c,0x22,
-
-    // Record 13: Address = 0x1680, Length = 128
-    0x1680,0x80,
-    0xe0,0xca,0xd2,0x19,0xd1,0x9c,0x29,0xc0,0x31,0x15,0xce,0x8c,0x71,0xdb,0x33,0x82,
-    0x1b,0xf8,0xf3,0x2,0xe8,0x26,0xf8,0x80,0xc9,0xc,0xf3,0xfe,0x24,0xb5,0x61,0x95,
-    0xf9,0xa6,0x18,0xb1,0xc6,0x2,0x43,0x99,0x12,0xcf,0x52,0x6c,0x6c,0x27,0xf4,0x7c,
-    0x5a,0x1e,0x6b,0xbb,0xdb,0xa9,0xa3,0xff,0xa1,0x8a,0x0,0x5d,0x9d,0x7a,0x89,0x4a,
-    0x2d,0x44,0x86,0x2a,0x5d,0x9d,0xf0,0x29,0x37,0x2,0xfd,0x14,0x82,0x45,0xb6,0x49,
-    0xb1,0xa8,0x3c,0x6f,0xc7,0xe5,0x9f,0x11,0x17,0x76,0x3f,0xde,0xc,0x82,0x4,0x8a,
-    0x23,0x1e,0x18,0x2b,0x6d,0x37,0x63,0xe4,0xf,0xbe,0x18,0x43,0x2a,0x3a,0x36,0x86,
-    0xde,0x7a,0xd9,0xde,0x6a,0x3,0xc4,0xdc,0x6d,0x9d,0xce,0xa3,0xe1,0x93,0x39,0x86,
-
-    // Record 14: Address = 0x1700, Length = 128
-    0x1700,0x80,
-    0xce,0x98,0x5c,0x27,0xbc,0x6,0x2c,0xbb,0x22,0xde,0xb7,0xcb,0x8,0xb1,0x70,0x4b,
-    0xbb,0xec,0xc3,0xd1,0x6a,0xe6,0xce,0x19,0x37,0x7d,0xa2,0x29,0x53,0x8e,0xcf,0x58,
-    0x83,0x6a,0x61,0xd9,0xfc,0x3e,0x3a,0x2e,0x77,0xf2,0x2e,0x9a,0x94,0x11,0x66,0xbb,
-    0x7e,0xf8,0x82,0x73,0x68,0x77,0xc4,0xbb,0xd7,0x86,0x4,0xd4,0x7c,0x81,0x6,0xd5,
-    0xe1,0xd2,0xde,0xdd,0x36,0x1f,0xb6,0x27,0x2,0x6a,0x45,0xe7,0xc0,0x41,0xb6,0xbe,
-    0x8c,0xf3,0xf,0xf1,0x81,0x9a,0x24,0xfe,0xb,0xff,0x8e,0xb,0x2,0xb0,0x74,0xb6,
-    0x93,0xcc,0x88,0x1e,0x7d,0xd6,0x32,0x54,0x9c,0xda,0x31,0x5b,0x53,0xa,0xc7,0xf1,
-    0x1c,0x77,0x68,0xfe,0xd,0xb4,0x84,0x32,0x86,0x81,0x38,0x69,0x1c,0x5c,0xa8,0xdb,
-
-    // Record 15: Address = 0x1780, Length = 128
-    0x1780,0x80,
-    0x81,0x8c,0x69,0x9c,0xb0,0x5e,0x71,0x34,0x96,0x5d,0x50,0x91,0x67,0x30,0xde,0x24,
-    0x8b,0x69,0x8a,0xaa,0x62,0x88,0x30,0x3d,0x25,0x7f,0x5e,0x81,0x6c,0x4c,0x3,0xed,
-    0x25,0x1e,0x3,0x7a,0x5d,0xf1,0x11,0xf2,0xea,0x9a,0xe1,0x7c,0x60,0x62,0x70,0xfe,
-    0x1a,0x89,0x26,0x8d,0x9c,0x5c,0x7f,0x3,0x15,0xc5,0xff,0xaa,0xa1,0x82,0x9f,0x14,
-    0x46,0x81,0x11,0xa8,0x45,0xfd,0x82,0x88,0x3d,0xb0,0x7d,0x6b,0x1f,0xa7,0x84,0x5c,
-    0x8d,0xc3,0x2a,0xae,0xe3,0x48,0x2,0xcf,0x55,0x7e,0x27,0x35,0xcf,0x8e,0x38,0x73,
-    0xe7,0x1c,0x5a,0x72,0x2b,0x14,0x93,0x7c,0xf1,0xbf,0xec,0x9b,0x41,0x15,0x1e,0x3,
-    0x42,0xd2,0x21,0x22,0xbb,0x4a,0x5c,0x6,0x33,0xd5,0x61,0xc2,0x32,0xac,0x3e,0xa1,
-
-    // Record 16: Address = 0x1800, Length = 128
-    0x1800,0x80,
-    0x50,0x6b,0x62,0xef,0xcd,0xac,0x86,0x5e,0x73,0xe5,0x21,0x94,0x94,0x21,0xc2,0x10,
-    0x0,0x7b,0x58,0x85,0x6f,0x23,0x8d,0x94,0x66,0xb9,0x68,0xd1,0x87,0x24,0x38,0xbc,
-    0x95,0xe5,0x32,0x82,0xd2,0x8d,0x48,0xfb,0x20,0xec,0x6d,0xc4,0xdd,0x36,0xfe,0x8b,
-    0x93,0xd5,0x1a,0xd9,0x62,0xa8,0xa6,0x75,0x2e,0x7,0x89,0x3d,0xbb,0xbe,0x36,0xe9,
-    0xbe,0x98,0xa9,0xa2,0x51,0xc3,0x6c,0x6b,0x99,0x68,0x54,0x60,0xed,0xe4,0xdf,0x2e,
-    0x5d,0x3,0x4f,0x39,0xd,0xcf,0xaf,0x67,0x2c,0x75,0xac,0x5e,0xf5,0x4d,0xff,0x33,
-    0xc5,0x55,0xdf,0x9a,0xbf,0x3,0x9,0xa9,0x55,0xc3,0x5a,0xe8,0x3c,0xe4,0x30,0xa9,
-    0xb2,0x1e,0xc5,0xf4,0x78,0xba,0x49,0xb,0xdf,0x10,0x21,0x34,0xed,0x53,0xec,0x71,
-
-    // Record 17: Address = 0x1880, Length = 128
-    0x1880,0x80,
-    0x40,0xc,0x61,0xd7,0x20,0x35,0x24,0x8,0xb3,0x63,0xbc,0x2f,0xd8,0xb5,0x8b,0xdb,
-    0xc8,0x6e,0x14,0x87,0x34,0x28,0x64,0x8c,0x8,0x28,0x2d,0x2c,0x59,0x30,0xf2,0xc5,
-    0x60,0x73,0x7b,0x38,0xbc,0x5d,0xef,0x23,0xf7,0x1e,0xe,0x47,0x91,0xc3,0xc1,0xd4,
-    0x8,0x50,0x65,0x58,0x4a,0x14,0x33,0x42,0xa5,0xde,0x6f,0x1,0x6d,0xe0,0x28,0x29,
-    0xfc,0x1f,0xee,0x7c,0xe5,0x10,0x79,0xbd,0x31,0x23,0x7c,0xe5,0x79,0xb3,0x4c,0x52,
-    0x7b,0x1f,0x82,0x17,0x45,0xc8,0xf7,0xf1,0x6c,0xaa,0x7c,0xf5,0xb6,0x2f,0x42,0xea,
-    0x32,0x3,0xa7,0x82,0x9d,0xf8,0x1b,0xa5,0xeb,0x47,0x86,0xab,0x72,0x4,0xd2,0xa8,
-    0x77,0x35,0x47,0xf4,0x3c,0x76,0x40,0x81,0x8e,0x19,0x47,0x1c,0xc5,0x7f,0xf,0x6f,
-
-    // Record 18: Address = 0x1900, Length = 128
-    0x1900,0x80,
-    0xea,0x56,0xc4,0x60,0xe2,0x1e,0xf3,0x73,0x1f,0x6a,0x1f,0x2e,0x55,0x8d,0x14,0x71,
-    0x26,0x9d,0x34,0x89,0xf6,0x89,0xd1,0x1e,0xc6,0xdd,0xd0,0x39,0xd3,0x6c,0xb1,0xae,
-    0x23,0x4a,0x9c,0xb6,0x61,0x79,0x27,0x3a,0xff,0xb9,0xf2,0xd2,0x22,0x6d,0xba,0xb1,
-    0xe6,0x73,0x9,0x5d,0x32,0xc4,0x92,0x58,0x22,0xb4,0x7e,0x66,0xc2,0x39,0x88,0x92,
-    0x6,0x7a,0xe8,0x3d,0x4b,0x91,0x80,0x39,0xd6,0xc7,0x2d,0x13,0xfb,0x5f,0xc0,0xff,
-    0xe3,0x75,0x10,0x71,0xa8,0xfc,0xd7,0x86,0xa1,0x29,0x26,0x23,0xef,0x48,0xc9,0xe0,
-    0xc0,0x12,0x9d,0x27,0x80,0x4e,0x1,0xe7,0x8d,0xc5,0xde,0x31,0x73,0x62,0x22,0x11,
-    0x8c,0xde,0x8c,0xcf,0x43,0xaf,0x94,0x7,0x71,0xe9,0xd3,0x2e,0xa6,0xc5,0xd2,0x67,
-
-    // Record 19: Address = 0x1980, Length = 128
-    0x1980,0x80,
-    0x0,0x99,0x1c,0x91,0xbd,0x74,0xa6,0xcf,0xc5,0x5e,0xd2,0x94,0xda,0x98,0xe0,0xfc,
-    0x7c,0x11,0x9c,0xa3,0x69,0x3,0xf1,0xaf,0x80,0x51,0xe4,0x77,0x12,0x23,0xa7,0xf8,
-    0xe8,0x66,0xcf,0xe1,0x40,0x10,0x84,0x9d,0x50,0xcf,0x46,0x64,0x0,0xf6,0xdb,0xd0,
-    0x87,0xb3,0xa8,0x3c,0x26,0x76,0xa9,0x26,0x7f,0xab,0x2d,0xe,0x41,0x9b,0x4b,0xf3,
-    0x8e,0x81,0xe6,0xdc,0xc9,0xe6,0xa0,0x49,0x2b,0xb4,0xf8,0xb4,0x69,0x2e,0x45,0xbe,
-    0xb3,0x9e,0xcb,0xf,0xda,0x6,0x5d,0xa6,0x2b,0x3,0xbe,0x8a,0x96,0x42,0x7d,0x46,
-    0x21,0x52,0x2,0x3a,0xf6,0x3b,0xf5,0x53,0xbb,0xe0,0x63,0x1c,0xdc,0xe9,0xef,0x29,
-    0x13,0xec,0x55,0x3a,0x3d,0x8f,0x4c,0xd3,0x91,0xaa,0x9e,0xc4,0xc0,0x16,0x74,0x81,
-
-    // Record 20: Address = 0x1a00, Length = 128
-    0x1a00,0x80,
-    0x9,0x5d,0x2,0x64,0x6a,0x4d,0x66,0x50,0x24,0x83,0xb0,0x8d,0x71,0xdd,0x80,0x97,
-    0x55,0xbf,0x4b,0x91,0x75,0x5c,0xd6,0xae,0x8b,0xcd,0xcd,0xa1,0xc0,0x22,0x98,0x24,
-    0xb4,0xce,0x73,0xc8,0xb7,0x14,0x5,0xf6,0x1b,0x95,0x3,0x39,0x17,0xce,0xb5,0xea,
-    0x40,0x98,0x58,0x98,0x81,0xd8,0xee,0x31,0xf4,0xbd,0x42,0x54,0xdf,0xea,0xd8,0xe2,
-    0x14,0x76,0xa2,0x19,0xc8,0x40,0x23,0xdd,0x16,0x34,0x69,0x42,0x4d,0x9e,0x12,0xc2,
-    0x90,0x8e,0x20,0x86,0x49,0xaf,0xdf,0x46,0x14,0x30,0x37,0xf7,0x70,0xad,0x4e,0xe3,
-    0xf6,0xdf,0x2d,0x29,0x8,0x19,0xd1,0x5c,0x5f,0xdf,0xd7,0x2d,0xfc,0x21,0x4,0x3,
-    0x70,0x42,0xb8,0x48,0xdf,0x2f,0x4a,0x3a,0x96,0xcc,0xce,0xdb,0x19,0xca,0xde,0xd1,
-
-    // Record 21: Address = 0x1a80, Length = 128
-    0x1a80,0x80,
-    0x86,0xf1,0x8c,0x5b,0x54,0xd7,0xa9,0x23,0x49,0xf5,0x73,0xcd,0x2,0xd0,0x75,0x9e,
-    0x78,0xff,0xe1,0xcd,0xed,0xa3,0x43,0x39,0x49,0xc7,0xdd,0x1b,0x88,0x49,0xc3,0x62,
-    0x9a,0x7a,0x5d,0x4e,0xb3,0x4e,0x8,0x67,0x74,0xb5,0x2,0x1e,0x65,0x25,0x20,0x8a,
-    0x33,0xa9,0xd2,0x40,0x20,0xac,0xd7,0xda,0xd,0x19,0x9f,0xd0,0x85,0x4f,0x3f,0xb8,
-    0xe,0x75,0x67,0xad,0x83,0x8,0xce,0x89,0x2e,0x68,0x1c,0xf4,0x90,0x59,0x6c,0xf6,
-    0x9c,0xee,0x78,0x45,0xc5,0x53,0x5,0x56,0x19,0x6,0x5,0x9a,0xfa,0x75,0xff,0x27,
-    0xd8,0x55,0x1e,0xc6,0xb,0xa8,0x65,0x60,0x35,0x54,0x5f,0xe2,0xd0,0xf2,0xfa,0x5c,
-    0x8f,0xe1,0x95,0x8c,0xee,0xa6,0x16,0x57,0xd6,0x38,0x2,0x3e,0x67,0x5,0x2a,0xfe,
-
-    // Record 22: Address = 0x1b00, Length = 128
-    0x1b00,0x80,
-    0x7f,0x79,0x23,0x24,0x0,0xa2,0x75,0x58,0x5e,0x96,0xc4,0x73,0xb7,0x32,0xfa,0x24,
-    0x3,0x25,0xeb,0xfa,0x6c,0x96,0x5c,0x76,0x20,0x55,0x4e,0x19,0xd,0xa2,0x1e,0xa3,
-    0xe2,0x9e,0x99,0xe7,0xdf,0xa,0x1,0x49,0xca,0x5d,0x66,0xf1,0x61,0x37,0xbc,0x1e,
-    0xff,0x11,0x42,0x85,0x4b,0x12,0x2b,0x97,0xa4,0x22,0x2c,0x53,0x42,0xc0,0xc1,0xbf,
-    0xcd,0xa7,0xd0,0x31,0x2f,0x99,0x9c,0xdd,0x1c,0xe6,0x34,0xc8,0x6a,0x3f,0x88,0x7f,
-    0x1a,0x87,0x4f,0x49,0xa5,0x85,0x85,0x6,0x52,0xd3,0xd5,0xb0,0x51,0xb9,0x67,0x1f,
-    0xf7,0xb9,0x2,0x85,0xfd,0x5,0x6,0x0,0xe9,0x9b,0x4e,0xfe,0xad,0x73,0xd6,0xc0,
-    0x60,0x3c,0x2e,0x38,0x44,0x2c,0xd0,0xa9,0x50,0x31,0x53,0x83,0x7e,0xca,0xfa,0xce,
-
-    // Record 23: Address = 0x1b80, Length = 128
-    0x1b80,0x80,
-    0xde,0x8,0xe0,0x7e,0x2b,0x9f,0x6b,0x10,0xe6,0x76,0xb5,0x9a,0xb9,0x3b,0x4b,0xb,
-    0x19,0xef,0x86,0xb,0x5b,0x62,0x9c,0x1f,0xa5,0x36,0xa7,0xb9,0x8f,0x86,0x5d,0x83,
-    0x32,0xaa,0x56,0x27,0x56,0xef,0x18,0x25,0xbb,0x6b,0xe7,0x80,0xa6,0x5c,0x70,0xd0,
-    0xda,0xe8,0x21,0x54,0x4a,0x0,0x67,0x5e,0xc4,0x24,0x62,0x46,0xb4,0x19,0x39,0x7c,
-    0x32,0x72,0x7b,0xb8,0x5d,0x1,0x9b,0x54,0x6d,0x5b,0x3a,0x2f,0xab,0xf5,0xf8,0x1a,
-    0x76,0x1b,0x7,0xa4,0xe8,0xa7,0xd0,0xcd,0x9b,0x62,0xc0,0x4e,0x56,0x7f,0xf9,0xaa,
-    0xdc,0x26,0x83,0x17,0x94,0x4a,0x97,0xcb,0xbf,0x39,0xa2,0x4c,0xc5,0xab,0x18,0x90,
-    0x16,0xa9,0x8a,0x28,0x3b,0x96,0xc4,0x41,0x2e,0xb3,0x63,0x37,0x60,0x2,0x19,0xaa,
-
-    // Record 24: Address = 0x1c00, Length = 128
-    0x1c00,0x80,
-    0xdb,0x68,0x90,0x48,0x2,0xf,0xbb,0x9a,0x22,0xbc,0x1f,0x10,0x73,0x2c,0x50,0xbf,
-    0xc,0x5c,0x5e,0xad,0xea,0xe,0xbf,0xbd,0xdc,0x57,0x8c,0x2e,0xae,0x64,0x7c,0x5b,
-    0x8f,0xfc,0xb4,0x5a,0xfa,0x6a,0x3d,0x3e,0xfd,0x49,0x74,0xdf,0xd,0x91,0x7c,0x8e,
-    0xb,0xd3,0xd3,0x6,0x71,0xd9,0xa0,0xa2,0xe5,0xcc,0x52,0xb5,0x20,0x3f,0x30,0x43,
-    0xce,0xe2,0x89,0x7c,0x34,0x7,0x12,0x6b,0x6a,0xa9,0x8,0x48,0xc0,0x6d,0x50,0x2c,
-    0x9a,0xc1,0x4a,0xd3,0x9b,0x19,0xe2,0x1,0xf4,0xb3,0x7d,0x24,0x71,0x3d,0xee,0xea,
-    0x4,0xe,0xa2,0xbc,0xcf,0x37,0x2a,0x66,0x66,0x78,0xd0,0xdf,0xe4,0xbb,0x4b,0x24,
-    0x22,0xfe,0x22,0xb8,0xca,0x4,0x35,0x26,0xf2,0xa9,0x1b,0x1e,0x21,0x68,0x63,0x47,
-
-    // Record 25: Address = 0x1c80, Length = 128
-    0x1c80,0x80,
-    0xc8,0x42,0x57,0x1b,0x68,0xec,0xac,0xcb,0x73,0x32,0x72,0x83,0x4,0x21,0x6d,0x52,
-    0x36,0x7d,0xf0,0x45,0xc1,0x17,0x3b,0x92,0xd0,0xe9,0x5b,0xfe,0xf8,0xd,0x78,0x56,
-    0x7c,0xd5,0x57,0x2c,0xff,0xa9,0x25,0x45,0xca,0x11,0x61,0x29,0xc1,0xec,0x9b,0x82,
-    0xf2,0x77,0x70,0x7f,0xf,0x1c,0x4d,0x54,0x83,0x6b,0x2f,0x19,0x69,0x81,0x46,0xe5,
-    0xb9,0x31,0x4,0x1,0xd0,0x80,0x60,0xf4,0x5,0x69,0xdb,0x66,0xed,0x68,0xe8,0xe4,
-    0x36,0xf5,0xe2,0x7e,0x2b,0x31,0x83,0x70,0x2e,0xf5,0x7c,0x5,0x72,0x6f,0xe8,0xc6,
-    0xb8,0x4f,0x99,0x9,0x71,0x6,0xa3,0x12,0x2b,0xd7,0x85,0x8e,0x47,0xe1,0x7e,0x7c,
-    0xf7,0x75,0xe6,0x99,0xf1,0xde,0xff,0xa7,0xf8,0xbe,0xd2,0x8b,0x69,0xcf,0x32,0x37,
-
-    // Record 26: Address = 0x1d00, Length = 128
-    0x1d00,0x80,
-    0xfa,0xc,0x9a,0x1,0xed,0xb2,0x51,0xb3,0x3,0xcb,0xd5,0xf3,0x76,0x52,0x12,0xeb,
-    0xc1,0x9d,0x57,0x4a,0xad,0x2c,0xe1,0x11,0x33,0x26,0x31,0x24,0x8a,0x6f,0x3b,0xa9,
-    0xad,0x86,0xcc,0x6d,0xd7,0x4c,0xe9,0xc9,0x52,0x24,0x2b,0x7c,0xc5,0xc9,0x5b,0xb2,
-    0x15,0x8,0x64,0x10,0x8f,0xcd,0xd2,0x12,0x6c,0xc9,0xdd,0x52,0xf7,0xff,0x72,0x7c,
-    0xbd,0xdd,0x30,0x9d,0xe9,0xb0,0xfd,0xbd,0x4e,0x72,0xcc,0xd7,0x5d,0x46,0xd4,0x8a,
-    0x5c,0x93,0xb,0x26,0x6,0x5c,0x44,0xaa,0x10,0xc,0x6,0x12,0xa9,0xbb,0xa7,0xea,
-    0x2f,0x49,0x55,0x7e,0x29,0x14,0xf1,0x2b,0xc6,0x8a,0x7,0xdd,0xd9,0xbe,0x66,0x1c,
-    0xda,0x42,0x27,0x7d,0xff,0xb0,0x9a,0x49,0x90,0xf3,0xff,0x4e,0xff,0xeb,0xc3,0xfc,
-
-    // Record 27: Address = 0x1d80, Length = 128
-    0x1d80,0x80,
-    0xb3,0xdc,0x84,0x22,0x49,0x16,0x89,0xdc,0xa5,0xdb,0xa8,0xd3,0x92,0xf1,0xa,0x8e,
-    0xe7,0xb3,0x9a,0xea,0x3d,0xad,0x4,0x2e,0x1b,0xcf,0xee,0x95,0x76,0xaf,0x78,0x7d,
-    0x3,0x5,0x8d,0x96,0x98,0xd7,0x7f,0x7a,0x6a,0x0,0xf,0xbf,0x68,0x8a,0x41,0xc1,
-    0xa4,0x11,0x33,0x22,0x1e,0x61,0xc,0xff,0x10,0x52,0xaf,0x7,0x6f,0x71,0xee,0x26,
-    0x76,0xf2,0x5c,0x9d,0xae,0xdb,0x1,0x9c,0x10,0xf5,0xd6,0x27,0xf2,0x91,0xe7,0x9d,
-    0x19,0xe2,0xd6,0x96,0x8d,0x19,0xb0,0xb5,0x24,0x5a,0x4f,0x30,0x73,0x3c,0x81,0x47,
-    0x2c,0xe4,0x5,0xbf,0xcf,0xab,0xad,0xa8,0x3,0x30,0x7d,0x0,0x3a,0x67,0x7,0x14,
-    0x40,0x6d,0xe8,0xec,0xd9,0x53,0xf4,0x47,0x80,0x81,0x5c,0xeb,0xd6,0xc5,0x7e,0x95,
-
-    // Record 28: Address = 0x1e00, Length = 128
-    0x1e00,0x80,
-    0x9,0x86,0x48,0xee,0xd5,0x6a,0xe1,0x8d,0x1f,0xfe,0x9c,0xae,0x7d,0xf0,0xc3,0x16,
-    0x20,0x5b,0x22,0x37,0xfe,0x7c,0xb7,0x34,0x50,0x9a,0xe7,0xf3,0x9a,0x53,0x58,0xe0,
-    0x3d,0xe8,0xb4,0x60,0x0,0x73,0x69,0xdf,0x6d,0xe,0xba,0xd0,0x2c,0x94,0xe7,0xb7,
-    0xb0,0x32,0x7d,0x37,0x48,0xc,0xea,0xa,0x69,0xb4,0x3f,0x38,0xb5,0xb9,0x42,0xcd,
-    0xa,0x46,0x30,0xbc,0x67,0x27,0xab,0xba,0x78,0xa0,0x79,0x3d,0x4e,0x8b,0xb2,0x73,
-    0x1a,0x7a,0xeb,0x91,0x61,0x2f,0xee,0x1b,0xe6,0x57,0x94,0x12,0x6a,0x99,0x38,0x35,
-    0xea,0xb7,0x79,0xd1,0xf1,0xb,0x6a,0xbc,0x94,0x65,0x33,0x30,0xbf,0x5f,0x54,0xa4,
-    0xcd,0x45,0xbe,0x1e,0x34,0x1d,0xc6,0xc8,0xc8,0xea,0x71,0x34,0x73,0x72,0x9a,0xac,
-
-    // Record 29: Address = 0x1e80, Length = 128
-    0x1e80,0x80,
-    0x1a,0x71,0xc,0xce,0xa4,0x69,0xa1,0x0,0xfd,0x21,0x31,0xe6,0xce,0x51,0xae,0x69,
-    0xf5,0x8b,0x5f,0xc9,0xeb,0xa0,0xeb,0xb1,0x86,0x94,0xfe,0x4b,0x97,0xc3,0xa9,0x17,
-    0xf0,0xd8,0xa7,0x4a,0x55,0x68,0x93,0xea,0x5e,0x64,0xe,0xad,0xcf,0x76,0x95,0x79,
-    0xea,0x8f,0x38,0x44,0xb1,0xc5,0xfb,0x2,0xce,0xfd,0x9,0x4f,0xb2,0xa3,0x55,0x6,
-    0xb4,0x81,0xb4,0x45,0xd4,0x11,0xdb,0xf7,0x52,0x3c,0xa3,0xc,0x60,0xa0,0x66,0x6,
-    0xb6,0x62,0xd3,0xfc,0xa1,0x5d,0x97,0xec,0xed,0x67,0x2b,0x6d,0x6e,0xa5,0x56,0xa0,
-    0xb0,0xca,0x35,0x72,0x10,0x49,0xd2,0x20,0x52,0xa4,0xe3,0x50,0x95,0xa,0x2e,0xdc,
-    0x4d,0xc7,0x4a,0xdd,0x3a,0x92,0xb7,0xaf,0xac,0x3c,0x52,0x41,0xeb,0x58,0x40,0x13,
-
-    // Record 30: Address = 0x1f00, Length = 128
-    0x1f00,0x80,
-    0x5,0x35,0x52,0xbd,0x7a,0x43,0x38,0x76,0x97,0x64,0xbd,0x6d,0x54,0xae,0x86,0xcc,
-    0xfc,0xcf,0xd5,0xab,0x28,0xb0,0x69,0x3f,0xa6,0x18,0x50,0xaf,0x4e,0x33,0xd6,0xbf,
-    0xd2,0x91,0xf5,0x30,0x40,0xf2,0xea,0x69,0x6a,0x59,0x5a,0xa3,0x58,0x5f,0xe8,0xb1,
-    0x9f,0xde,0x2c,0x59,0xb8,0x15,0x23,0xbe,0x16,0xe,0x9c,0x56,0xf,0x5f,0xc9,0x28,
-    0x18,0x2b,0x1d,0x60,0x60,0xa0,0x6d,0xf6,0xba,0x73,0xf5,0x19,0xcd,0x52,0x8,0x39,
-    0xab,0x8c,0xbd,0xf4,0xc7,0xa9,0x6a,0x98,0x69,0x3a,0x39,0x27,0xcf,0xe9,0x36,0xc6,
-    0x25,0xbb,0x14,0xff,0x21,0x24,0xf8,0x6,0x51,0xaa,0xe6,0x11,0x5e,0x3f,0x87,0xf6,
-    0xa,0x41,0x9d,0x20,0x75,0xac,0xc4,0xed,0x80,0xb8,0x29,0x7b,0x48,0xe8,0x6a,0x37,
-
-    // Record 31: Address = 0x1f80, Length = 128
-    0x1f80,0x80,
-    0xa8,0x50,0x9d,0xc7,0x21,0x53,0xb1,0xe2,0x31,0xe7,0x3d,0xf6,0xcd,0xc1,0xf4,0x62,
-    0x24,0xef,0xc7,0xae,0xb,0x4c,0x39,0xb7,0x48,0x62,0xb4,0xb8,0xf3,0x6f,0x4a,0x20,
-    0xd7,0xab,0x21,0x5d,0xf4,0x44,0x2e,0xce,0x85,0xd0,0x51,0x87,0xbc,0x94,0x6d,0x8,
-    0xa3,0xe6,0xa2,0x74,0xa,0xb,0x1c,0x8,0x7a,0xb5,0xd5,0x62,0x6,0x2e,0x8a,0x37,
-    0x5d,0x63,0x90,0x65,0xf0,0x75,0x71,0x57,0xcd,0xae,0xf0,0x2a,0x4e,0x3b,0xd5,0x95,
-    0xa3,0x21,0xfb,0xa,0xc6,0xb,0x56,0x83,0x5e,0x62,0x6d,0x9c,0x90,0x6a,0xc0,0xcc,
-    0x6d,0xbb,0x13,0x41,0x9,0x71,0x6c,0x26,0xd7,0x5e,0xfb,0x54,0x64,0x53,0x73,0x9a,
-    0xc9,0x66,0x2c,0x25,0x9c,0x85,0x36,0xb4,0x70,0xdf,0x28,0x94,0x60,0xe7,0x20,0x5f,
-
-    // Record 32: Address = 0x2000, Length = 128
-    0x2000,0x80,
-    0xf4,0x9f,0x2e,0x7e,0xed,0xae,0xb0,0xb9,0x1,0xf2,0xfa,0x18,0x9c,0x97,0x47,0x2a,
-    0xa7,0x43,0xe7,0x42,0xd4,0xf4,0x13,0x73,0xc9,0xcb,0xcc,0x4,0xc4,0xf5,0xf7,0x52,
-    0x4,0xf8,0xd5,0xb3,0xd7,0xeb,0xa,0x7d,0x72,0x1b,0x72,0xd2,0xb,0xb3,0xe7,0x6,
-    0x8,0x8c,0x7c,0x68,0x54,0xf4,0xea,0x2e,0x7b,0xa,0x27,0xa9,0x9b,0x61,0x1f,0x59,
-    0x88,0x76,0x92,0x92,0x39,0xb0,0xc1,0x1b,0x9e,0xf2,0x88,0xe4,0x61,0xe,0x92,0x7b,
-    0xc2,0x0,0x5d,0x83,0x81,0x23,0x98,0x25,0xe6,0x8e,0x3b,0xc2,0x72,0xf4,0x42,0xae,
-    0x92,0x40,0xb,0x20,0x10,0xde,0x2c,0x99,0xf9,0x59,0x4f,0xd,0x9d,0x34,0x2e,0xc5,
-    0xab,0xe,0x64,0xf,0xc5,0xd1,0x1,0x7c,0xe2,0xca,0xe9,0xf7,0x80,0xbd,0xe3,0xc7,
-
-    // Record 33: Address = 0x2080, Length = 128
-    0x2080,0x80,
-    0x6a,0xf2,0x75,0xeb,0x67,0xde,0xaf,0x95,0x99,0x1,0xf0,0x8,0x6c,0xd8,0x53,0xb9,
-    0x38,0x6e,0x75,0xc,0x50,0xed,0x56,0x86,0xf6,0x63,0xc9,0xe6,0xb8,0x99,0x3a,0xc,
-    0xa8,0xf7,0xe2,0x88,0xc5,0xa6,0x3a,0x36,0xf,0x60,0xc1,0x2e,0xf4,0xe7,0xd4,0xbf,
-    0x7a,0x16,0xef,0xbd,0x9d,0x27,0x4c,0x82,0xb,0x1e,0xde,0xa4,0xe7,0x32,0xaa,0x24,
-    0x50,0x37,0x11,0x44,0x5,0xcc,0xd6,0x21,0x23,0xe9,0x9b,0x26,0x5c,0x24,0x4a,0x87,
-    0x77,0xd6,0x7a,0x54,0x3e,0x6,0x12,0x86,0x68,0xf6,0xad,0xac,0xb3,0xe8,0xbb,0x2a,
-    0xb1,0xe6,0x6f,0xf4,0x8e,0xa7,0xf7,0xb8,0xa0,0xb7,0x10,0xb2,0x82,0xe9,0x61,0x58,
-    0x9a,0xf1,0xe8,0x99,0x99,0x2e,0x12,0x7d,0x1e,0x1a,0xa8,0xda,0xd8,0xe2,0xe2,0xf1,
-
-    // Record 34: Address = 0x2100, Length = 128
-    0x2100,0x80,
-    0x94,0xc8,0x40,0x4d,0x1c,0x2a,0xd3,0xef,0xed,0x3b,0xbc,0xb0,0xf,0x77,0x7b,0x50,
-    0x6c,0xf7,0xc1,0x37,0x8f,0x58,0x5e,0x53,0x8a,0x42,0x0,0x88,0x67,0xa,0x37,0x88,
-    0xb7,0xb4,0x9c,0xe5,0xe9,0x8a,0x1b,0xbe,0xe7,0xc7,0x1,0xe1,0xac,0x1,0xe9,0x72,
-    0x55,0x80,0x3b,0xcc,0x61,0x57,0xb9,0x48,0x31,0xf1,0x5,0xe9,0x95,0xa0,0x93,0x6f,
-    0x5c,0xe,0xa1,0x2f,0xf1,0x2e,0xce,0x9e,0xb1,0xfc,0xa2,0x8b,0xd6,0xe9,0xd3,0xa9,
-    0x21,0xda,0x60,0x1d,0xe7,0x92,0x9e,0xa2,0xa7,0x86,0x7f,0x6f,0x53,0x4b,0x1e,0x49,
-    0x6a,0x15,0x2f,0xfb,0xd6,0xe7,0x6,0x6d,0x8b,0x7,0x2b,0x4a,0xb1,0x7f,0xdf,0xd4,
-    0x80,0xca,0x6d,0x16,0x70,0xd0,0x15,0x7a,0x56,0x38,0x95,0xcb,0x93,0xfb,0xa9,0x5c,
-
-    // Record 35: Address = 0x2180, Length = 128
-    0x2180,0x80,
-    0xed,0xd6,0xf9,0xd0,0x6f,0x69,0xed,0xb,0xc1,0x65,0x14,0xfa,0xa7,0x6e,0x41,0x36,
-    0xf0,0x1,0x86,0xa5,0x5b,0xb,0xcc,0x30,0xeb,0x99,0x10,0xf6,0x9,0xb5,0x70,0xb2,
-    0xf,0x53,0xa,0xa2,0x18,0x69,0x3a,0x89,0xb4,0x81,0xc5,0xa,0xbf,0x2d,0xa0,0x73,
-    0x3a,0x4b,0x77,0xe5,0xaa,0x33,0x8b,0x81,0xf8,0x7c,0x3b,0xbc,0x21,0xca,0xf1,0xbd,
-    0xd7,0x54,0xcf,0xc5,0x28,0x6c,0x9a,0xf,0x81,0xa3,0xcd,0xbc,0xd6,0xed,0xeb,0x54,
-    0x63,0x48,0xb,0xdd,0x87,0x53,0xa5,0x10,0x14,0x30,0x5f,0x63,0xa4,0xfd,0x39,0x77,
-    0xa2,0xe0,0x3a,0xb6,0x86,0x10,0x28,0x4b,0x28,0x1c,0x1,0x65,0x49,0xac,0x2f,0x62,
-    0xd5,0x2e,0xf2,0xc0,0x69,0xcb,0x7b,0x6b,0x1,0xe7,0xfc,0xe7,0x13,0xe9,0x37,0x22,
-
-    // Record 36: Address = 0x2200, Length = 128
-    0x2200,0x80,
-    0x7,0x2b,0x25,0xc5,0xf9,0x35,0x2a,0x80,0x3b,0x6f,0xd6,0x97,0x79,0xa6,0x70,0xf9,
-    0xc4,0x8f,0xc7,0xe1,0x47,0x7e,0x3c,0x93,0xb3,0x17,0xe0,0xb9,0x1f,0x95,0x58,0xca,
-    0xe1,0xb0,0x9a,0xa9,0x56,0xb3,0x1c,0x99,0x80,0x64,0xc4,0x2a,0x35,0x5,0x8e,0x6e,
-    0xc5,0xf3,0xd4,0x4b,0x25,0x53,0xd6,0x6,0x2c,0x40,0xb2,0x40,0x78,0xc8,0x24,0x23,
-    0x60,0x53,0x2b,0xe0,0xda,0xda,0x33,0x1,0x33,0xfe,0x92,0x3d,0x5a,0xc0,0x7,0x20,
-    0x37,0x66,0xd7,0x79,0xc7,0x7c,0xa2,0x4b,0x70,0x88,0xf2,0x6f,0x33,0x79,0x59,0x13,
-    0x6e,0x64,0xa,0xb4,0x0,0x85,0x29,0x22,0x79,0x2a,0x3d,0x33,0x77,0x30,0xf8,0x0,
-    0xce,0xe2,0x20,0x7f,0x85,0x66,0x3f,0xf7,0x5c,0x31,0x28,0x7a,0xe,0xdd,0xc4,0xbf,
-
-    // Record 37: Address = 0x2280, Length = 128
-    0x2280,0x80,
-    0x5,0x19,0x8c,0xfb,0x69,0xf9,0x4a,0xe2,0x9f,0x21,0x47,0xe2,0xa0,0x82,0xe3,0x27,
-    0xf6,0xb1,0x78,0xb8,0xd,0x96,0x0,0xfe,0xe8,0x8e,0xac,0x6b,0xf6,0x9a,0x43,0xf0,
-    0x63,0xe2,0xa9,0xf0,0xfd,0xd3,0xd8,0x6c,0x50,0x7b,0x44,0xe9,0x76,0x5,0x48,0x2e,
-    0xf,0x9a,0xd7,0xdf,0xd9,0xdf,0x1c,0x2e,0xbe,0x55,0xc4,0x13,0x93,0xc7,0xda,0x4e,
-    0x62,0xc4,0x71,0xfa,0x4,0xb8,0x7c,0x7,0x56,0xe4,0x37,0x2c,0x8a,0x83,0xd9,0x66,
-    0x8d,0xa1,0xc,0xee,0xff,0xef,0x25,0xaa,0xe7,0xff,0xed,0x9a,0x47,0xbe,0xc6,0x25,
-    0xcc,0x99,0xc2,0xf9,0xcd,0x32,0x69,0x4b,0x75,0xd6,0xd6,0x78,0xca,0x21,0x25,0xb5,
-    0xf1,0x8b,0xa3,0x7d,0x73,0x1,0xed,0x6c,0xe,0xa,0x5d,0x99,0xe0,0x27,0xe3,0xcf,
-
-    // Record 38: Address = 0x2300, Length = 128
-    0x2300,0x80,
-    0x8b,0xaa,0x4d,0x76,0xe2,0x8c,0xb,0x20,0x4b,0x4e,0x22,0xc9,0x60,0x48,0x29,0xcd,
-    0xe2,0xc7,0x39,0xf7,0xbf,0xf9,0xa9,0xf1,0xaa,0xfa,0x64,0x40,0x5c,0x2,0xdb,0x88,
-    0x4c,0x44,0x40,0x88,0xd0,0x33,0x53,0x95,0x28,0x73,0xf0,0x92,0xff,0x4b,0x38,0x3e,
-    0xc2,0xcd,0x3a,0x91,0xf3,0xe1,0xc4,0x43,0xca,0xef,0x5d,0x66,0xd2,0x8c,0xfd,0x12,
-    0xc2,0x4c,0x49,0x36,0xd,0x81,0x42,0x19,0xdb,0xb7,0xef,0xd7,0x79,0xef,0xa1,0x1a,
-    0x16,0xcc,0x53,0x3a,0x4b,0x9,0xba,0xc8,0x94,0x78,0xc4,0x3b,0xc3,0x36,0x58,0xb9,
-    0x96,0xb0,0x7a,0xd3,0xb0,0x8f,0xf6,0x2c,0xf4,0x6e,0x74,0x8f,0x59,0xa5,0x19,0x70,
-    0xca,0x39,0x4f,0x92,0x9f,0x6a,0x2e,0x22,0xa2,0xd0,0xe0,0x3c,0xcf,0x97,0x6e,0x0,
-
-    // Record 39: Address = 0x2380, Length = 128
-    0x2380,0x80,
-    0xec,0x6e,0x73,0x5d,0x44,0x35,0x3a,0x29,0x77,0xdb,0x53,0x40,0xe3,0x38,0xf0,0x87,
-    0xde,0x82,0x54,0xff,0x69,0xbe,0x32,0xce,0x16,0xe0,0x42,0x2d,0xe2,0xa9,0x41,0x30,
-    0xab,0x4e,0x4,0xcf,0x2b,0x5e,0xb5,0xe9,0xb4,0xc,0x4d,0xf9,0xe3,0x51,0x9c,0x88,
-    0x98,0xd8,0xbe,0x8,0xa8,0xeb,0x75,0x1d,0x2d,0xf,0x63,0xe9,0xfb,0xb7,0x47,0x6d,
-    0x1e,0x29,0xf7,0xad,0x91,0x4c,0xde,0x60,0x34,0xaa,0x6e,0x63,0x1d,0x3,0x4c,0xb3,
-    0xc5,0xca,0x23,0xda,0x1b,0x10,0x32,0xf7,0xeb,0xf6,0xd6,0xf1,0xa9,0x3f,0x4d,0xa7,
-    0x8a,0x54,0x6a,0x19,0x96,0xf8,0x5a,0x3a,0x2f,0xf0,0xad,0xe4,0xa1,0x12,0x40,0xf,
-    0x97,0xf5,0xad,0x48,0x97,0xf1,0x5d,0x67,0x27,0xfd,0x71,0x39,0x2c,0x38,0x67,0x75,
-
-    // Record 40: Address = 0x2400, Length = 128
-    0x2400,0x80,
-    0xb3,0x61,0x6c,0xf2,0x1a,0x25,0xf7,0xb1,0x8a,0xc0,0xcd,0x97,0xd,0x54,0xe0,0x28,
-    0xab,0xe1,0x1d,0x69,0xdb,0x5c,0x37,0x3d,0xbe,0x72,0xf6,0x8e,0x34,0x16,0x25,0x27,
-    0xc6,0x5b,0xdc,0xab,0xd2,0x77,0x7f,0xce,0x5b,0x80,0x58,0x7b,0xf2,0xb,0xec,0x74,
-    0x36,0x83,0xab,0x57,0xe6,0x17,0xb3,0xef,0x87,0x48,0x48,0x6e,0x54,0x28,0x2b,0x7,
-    0x6a,0xa7,0x2b,0x4d,0x47,0x3f,0x15,0x59,0x13,0xc6,0xc4,0xee,0x3c,0x47,0xdd,0x7e,
-    0xe8,0xb8,0x84,0xa5,0x9e,0x78,0x99,0x99,0x4f,0x94,0x50,0x42,0xf7,0x4b,0xab,0x63,
-    0x98,0x49,0xff,0xd5,0x97,0x72,0xff,0x60,0x2c,0xba,0x8e,0xb4,0x11,0x63,0xd2,0x87,
-    0x77,0xb7,0xa1,0xf5,0x10,0x42,0xb3,0xba,0x42,0x6e,0x70,0xaa,0x50,0xec,0x76,0xde,
-
-    // Record 41: Address = 0x2480, Length = 128
-    0x2480,0x80,
-    0xa8,0x3f,0xfb,0x3d,0x9d,0x98,0xc4,0xe3,0x3,0x95,0xd8,0xa3,0x54,0x74,0x83,0x35,
-    0x8b,0x79,0xa9,0xc2,0x1b,0x52,0x38,0xe5,0xc,0x92,0x7,0x3b,0xbd,0x3a,0x12,0x8b,
-    0x6c,0x89,0x4f,0x5e,0xd8,0xc0,0x1,0x5f,0x76,0x20,0xa9,0x70,0x1b,0x1b,0x66,0xe9,
-    0x11,0xc9,0xee,0x83,0x9,0xd8,0xd0,0x9d,0x83,0x33,0xb9,0x78,0x9e,0x90,0x2e,0xb4,
-    0xd3,0xc5,0x5f,0x35,0xf6,0x14,0x5d,0x22,0x51,0x7f,0x3,0x9a,0x49,0x38,0xf5,0x41,
-    0xad,0x4d,0xa1,0x0,0xe1,0xd,0x9,0x81,0x98,0xa4,0xc9,0x3c,0x7d,0x5d,0x72,0x87,
-    0x89,0xa7,0xd5,0x67,0x30,0xdd,0x69,0xcc,0xdd,0x2a,0x58,0xa7,0x57,0x1e,0x34,0xda,
-    0x60,0xc6,0xd3,0x5b,0x7f,0x78,0x17,0x72,0xfb,0xde,0x56,0x2f,0xae,0xe6,0xeb,0xcd,
-
-    // Record 42: Address = 0x2500, Length = 128
-    0x2500,0x80,
-    0x2b,0x88,0xb,0x9a,0xa,0xcc,0x8d,0x53,0xb3,0xb4,0x11,0x36,0x88,0x7e,0xc0,0x1a,
-    0x2c,0xad,0xe6,0x12,0xde,0x9f,0xe0,0xe7,0x7a,0x1,0xbc,0x9f,0xa3,0x64,0x84,0x5c,
-    0xdb,0x4a,0x61,0x87,0xc,0xd8,0x44,0x24,0x23,0x3f,0x97,0x93,0x36,0x92,0x34,0x14,
-    0xe9,0x24,0x48,0xcb,0xca,0x5c,0xde,0xa2,0xfd,0x39,0xde,0xf8,0x29,0xe9,0xb3,0x2e,
-    0x6f,0xb5,0x54,0x35,0x19,0x3b,0x62,0x64,0x41,0xe1,0xaa,0x2a,0x58,0xbf,0x4f,0xb2,
-    0x51,0x23,0x6a,0x3b,0x7a,0x4d,0x41,0x9d,0x4d,0xbc,0x6,0x74,0x6d,0xaa,0x1e,0x40,
-    0xb8,0x92,0xed,0xa0,0x62,0x1f,0x9e,0x76,0x2c,0xcd,0x49,0x5d,0xb2,0x9c,0x19,0xf2,
-    0x7b,0x91,0x27,0xc9,0x86,0x37,0xc4,0x32,0xd6,0x2,0x48,0xb4,0xdf,0xeb,0x9b,0x15,
-
-    // Record 43: Address = 0x2580, Length = 128
-    0x2580,0x80,
-    0x9a,0xd8,0xd3,0x68,0x5a,0x3f,0x14,0xed,0xac,0x22,0x41,0xc9,0x79,0xda,0xba,0xb8,
-    0x66,0xe7,0xd3,0x70,0x7,0x54,0x61,0x58,0x2b,0xd,0x4b,0xdb,0x18,0x5d,0x88,0x18,
-    0xcb,0xb,0x74,0xac,0x62,0x43,0x7c,0xef,0x14,0x5a,0x5f,0xe,0xa2,0xb3,0x2c,0xfb,
-    0x65,0x91,0xd2,0x6d,0x1c,0xd8,0x21,0x84,0x4f,0x72,0xae,0x6e,0xcd,0x68,0xb5,0x67,
-    0x3a,0xe2,0x8,0x38,0xdb,0xed,0x7a,0x15,0x5e,0x2d,0xc3,0xba,0xd9,0x6e,0xe7,0x96,
-    0x8c,0x9e,0xf3,0x15,0x8f,0xcd,0xef,0x58,0x87,0x34,0xcc,0xa3,0xd4,0xd,0xa6,0x26,
-    0x33,0x53,0x32,0xee,0x5f,0xf0,0x84,0x2e,0x20,0x77,0x4,0xfa,0xf6,0x7b,0xf0,0xd,
-    0x68,0xa1,0x84,0x50,0xa8,0x1,0xb9,0xe8,0xa3,0xdb,0x3f,0x7e,0x91,0x99,0x2a,0x8c,
-
-    // Record 44: Address = 0x2600, Length = 128
-    0x2600,0x80,
-    0xa1,0xa0,0x7a,0x38,0x74,0xde,0x19,0xd3,0x79,0xe3,0xee,0x80,0x2d,0xf6,0x8b,0x93,
-    0xa9,0x6f,0x74,0xef,0xcd,0xea,0x91,0xaf,0xdb,0xc5,0x87,0x96,0x7f,0xcc,0x94,0x9c,
-    0x6a,0x7f,0x67,0xe8,0x70,0x2f,0xfe,0x48,0x5b,0x56,0xab,0x66,0xb4,0x41,0xe3,0xd,
-    0x95,0xc5,0xd1,0x36,0xd9,0x7d,0x4f,0x53,0xac,0xe,0xe6,0x97,0x76,0x67,0x25,0x8b,
-    0xdb,0x1d,0x9,0xc9,0x1b,0xd5,0xdc,0xd9,0xa0,0x94,0xb5,0x55,0xc2,0x4f,0xea,0xb1,
-    0xd7,0x76,0x87,0xf6,0xda,0x61,0x40,0x71,0x30,0x2c,0xff,0x40,0x5e,0x0,0x87,0x6e,
-    0x7f,0x3,0xcc,0x35,0x51,0xc2,0x59,0xb8,0xab,0x23,0x1f,0x6f,0x32,0xea,0x1d,0x49,
-    0x78,0x23,0x8e,0xd0,0x9b,0x1d,0xa0,0x62,0x49,0xdd,0x1f,0xf9,0xa4,0x1d,0xf6,0xc2,
-
-    // Record 45: Address = 0x2680, Length = 128
-    0x2680,0x80,
-    0x9a,0xe7,0xa5,0x5f,0xe6,0x1,0x58,0x3c,0x92,0xbc,0x65,0xea,0xfc,0xec,0xf,0x27,
-    0xed,0x23,0x3a,0x66,0x14,0x3d,0x22,0x69,0xd2,0xb3,0xc0,0xe7,0xfa,0x80,0xb8,0x39,
-    0x9d,0xdb,0x8c,0x1f,0x15,0x82,0xfe,0xd9,0x97,0x0,0x0,0x2b,0x6f,0xca,0x80,0xca,
-    0xf5,0x4a,0x6c,0x5e,0xd0,0x85,0xda,0x50,0x45,0xc,0x2e,0xf2,0x96,0xd6,0x3c,0xbf,
-    0x38,0xae,0x49,0xa7,0x61,0x56,0xfe,0xb5,0x65,0x3f,0x95,0x8,0x94,0x79,0x80,0xa5,
-    0xa1,0xf4,0xf,0xbf,0x36,0x55,0x2d,0x49,0x15,0xff,0x38,0xd6,0xeb,0xb6,0x87,0x76,
-    0x77,0x8a,0x27,0x65,0x1c,0xbe,0xce,0xc9,0x77,0xe8,0xc9,0xa7,0xf0,0x7e,0x93,0x94,
-    0x3,0x3d,0xcf,0x89,0x64,0x20,0xd6,0x12,0x4,0x70,0xb,0x17,0x45,0x78,0x10,0xe2,
-
-    // Record 46: Address = 0x2700, Length = 128
-    0x2700,0x80,
-    0x6c,0x2e,0xbb,0x9f,0x18,0x5b,0xa1,0x35,0xf9,0x76,0xbe,0x3,0xae,0x2d,0xbf,0x71,
-    0x91,0xbb,0x1b,0x8a,0xb6,0x38,0x9c,0xbc,0xfe,0xa3,0xb2,0x8a,0xaa,0xe0,0x19,0x60,
-    0x25,0xb5,0x60,0x5c,0x9b,0x22,0xe6,0xba,0xd0,0xc4,0x29,0xeb,0xfc,0x63,0x4d,0xb,
-    0xe5,0xfc,0x65,0x9c,0x3c,0x2d,0x1e,0xe8,0xb1,0xa6,0xe9,0xca,0xdf,0x2e,0x0,0xcf,
-    0x9b,0x3f,0xc1,0x4f,0xc1,0x25,0x69,0xd7,0xb6,0x29,0x4d,0x9d,0x5,0x72,0x28,0x16,
-    0xce,0x13,0x45,0x7c,0x9e,0xd6,0xb8,0xb6,0x1b,0x6c,0xea,0xe5,0x33,0xd1,0xa8,0xf4,
-    0xd9,0xb9,0xaa,0x5f,0xdc,0xd7,0x3a,0xb7,0xab,0x2d,0xc7,0x52,0x69,0xc3,0x78,0x78,
-    0x4,0x5b,0xd8,0xbf,0x6e,0xf8,0xf8,0x1e,0x8e,0xf4,0xe8,0xb4,0x9,0x98,0x94,0x56,
-
-    // Record 47: Address = 0x2780, Length = 128
-    0x2780,0x80,
-    0xe4,0x19,0x8d,0x13,0xa2,0xb4,0xc5,0x15,0x8d,0x90,0x66,0x54,0x7f,0x82,0xee,0x9a,
-    0x8,0x66,0xde,0x91,0x90,0xd,0x24,0x9e,0xbf,0xc4,0xb1,0xe9,0x76,0xa8,0x2c,0xd0,
-    0xec,0x4,0x5d,0xad,0xb7,0xbc,0xc7,0xa0,0xf9,0x12,0x58,0xa3,0xe1,0x5a,0xd6,0x86,
-    0x83,0xb5,0x6e,0xad,0x83,0x28,0x93,0xf0,0x58,0xec,0x32,0x19,0x53,0xbe,0x3a,0x1b,
-    0x35,0x7d,0xda,0x40,0x9b,0xde,0x25,0x6e,0x3,0x5c,0xbb,0x72,0xf3,0x6a,0x44,0xda,
-    0x7f,0xa8,0xaa,0xa1,0x44,0xf,0x18,0x5c,0x25,0xe4,0xa9,0x9b,0xc,0xc1,0x90,0x64,
-    0x63,0x94,0x23,0x9,0xe2,0x3a,0xe0,0x3c,0x3e,0x19,0xfe,0xad,0xde,0x78,0x9b,0x4c,
-    0x5b,0x1b,0x5e,0x72,0x46,0x5f,0x73,0xf4,0x8,0xed,0xd6,0x79,0x33,0xbb,0x41,0xa0,
-
-    // Record 48: Address = 0x2800, Length = 128
-    0x2800,0x80,
-    0x1b,0x72,0xbb,0x99,0xe6,0xf1,0x33,0x1a,0x18,0xc9,0x56,0xbd,0xb1,0x6a,0x9b,0x83,
-    0x19,0x4d,0x86,0xa5,0xdb,0x89,0x5a,0x78,0x7c,0xe0,0x70,0x81,0x64,0x9e,0x2e,0x43,
-    0x2e,0x4d,0x8f,0x3e,0x1c,0x78,0x79,0x14,0xf6,0x57,0xb,0xb1,0x5f,0xb1,0xdc,0xb0,
-    0x70,0x42,0xb7,0x90,0xf6,0x91,0xf3,0xda,0x43,0xd3,0xe3,0xbf,0xd9,0x73,0x11,0x42,
-    0x2c,0x1c,0x3e,0x18,0x80,0x5d,0xab,0x41,0x89,0x4f,0x91,0xa9,0x4,0xd1,0x8b,0xd6,
-    0xac,0x36,0xb3,0xf2,0x3e,0x88,0xdc,0x5d,0xb3,0xd1,0xe1,0x0,0xb3,0xcb,0x64,0xf9,
-    0xe3,0x6a,0xf8,0x3,0xc0,0x49,0xe3,0xdd,0x21,0x22,0x55,0xec,0xc3,0xc7,0x13,0x47,
-    0xd0,0xb0,0x27,0x80,0x49,0x7f,0x55,0x17,0x4c,0x1e,0x43,0xc2,0x7a,0xc2,0x73,0xd3,
-
-    // Record 49: Address = 0x2880, Length = 128
-    0x2880,0x80,
-    0xcd,0x2a,0xfa,0x2e,0xc6,0x69,0x23,0xb2,0x0,0xf1,0xe2,0x43,0x46,0x6b,0xd2,0x2b,
-    0x39,0x9d,0xc7,0x9c,0xb5,0x6c,0xc7,0xdc,0x93,0xc0,0x9b,0x88,0x24,0x37,0x23,0xd6,
-    0xe,0xee,0x9d,0x3a,0xee,0x57,0xfc,0xd1,0xa0,0xff,0x1d,0xc0,0x55,0xb8,0x4c,0x56,
-    0xbe,0x23,0x6c,0xc6,0xd1,0x35,0x24,0x6c,0xe3,0xf9,0x7a,0x77,0x5f,0x8b,0xf1,0x1b,
-    0xe5,0x13,0x99,0xcc,0x9a,0xfd,0x9e,0xca,0x32,0x39,0x3c,0x4e,0xcd,0x43,0xb3,0x9,
-    0x4,0x99,0x7f,0xb1,0xc9,0x4d,0xd2,0x6f,0xa4,0xe4,0xb8,0xdf,0xfa,0x7a,0xec,0xfa,
-    0xf5,0x3c,0x31,0xb3,0xe3,0xfc,0x15,0x17,0x22,0x75,0xfd,0xe8,0x1d,0x2b,0xe4,0x86,
-    0x45,0x6d,0x75,0x4e,0xa7,0x67,0xd9,0x9d,0xaf,0xa7,0x3b,0x8b,0xf,0x80,0xc,0x72,
-
-    // Record 50: Address = 0x2900, Length = 128
-    0x2900,0x80,
-    0x9c,0x6,0xfe,0x3a,0x37,0x2b,0x62,0x11,0x9f,0xf2,0x3a,0x95,0x52,0x36,0x77,0x4d,
-    0xa7,0x81,0x53,0x90,0x19,0x3c,0x31,0xa3,0x97,0xc,0x1,0x8,0x74,0x11,0x98,0x7a,
-    0xe1,0x59,0xd7,0x8,0xc5,0x6f,0x9b,0x54,0x29,0x74,0xf9,0x33,0xb,0x9e,0xdb,0xaf,
-    0x98,0x48,0x16,0x31,0xa4,0x4b,0x8,0xc5,0x58,0x35,0x21,0xc2,0x7e,0x7f,0x6a,0x86,
-    0xb5,0x85,0x38,0x96,0x94,0xc4,0x9d,0x65,0xbc,0xe9,0x52,0x8c,0x34,0x45,0x26,0xdb,
-    0xa9,0x39,0x45,0x61,0x9,0xb6,0x1a,0x8,0x47,0xa6,0x19,0xbd,0xa8,0xdb,0x8,0x90,
-    0x72,0x6f,0xb,0xef,0x4a,0xc3,0xea,0xb2,0x1,0xad,0x6a,0x12,0xa6,0xcb,0xed,0x5e,
-    0x7b,0x8f,0x40,0x2c,0xd7,0x70,0x5c,0x8c,0x65,0xe4,0x11,0xb4,0x9e,0x2,0xf4,0x5e,
-
-    // Record 51: Address = 0x2980, Length = 128
-    0x2980,0x80,
-    0xb7,0x2,0x4a,0xd3,0xe6,0x5b,0xd5,0xa5,0x3b,0x2a,0x24,0x6c,0xff,0xed,0x38,0x6f,
-    0xfc,0xa1,0xf5,0x4d,0xb8,0xd2,0x90,0x8,0xb6,0x32,0x7b,0xf1,0x5a,0xd7,0x3a,0x3d,
-    0x63,0xc3,0xa6,0xe8,0x1e,0x92,0xef,0xf2,0xf2,0xe8,0x79,0xa4,0x45,0xc1,0x80,0x8d,
-    0x25,0xd5,0x5a,0x70,0x66,0x4d,0x83,0x0,0xca,0x48,0x4c,0xc7,0xd7,0x0,0xa7,0x56,
-    0xc8,0xed,0xa7,0xfa,0x75,0xbf,0x7e,0xf1,0x8f,0xd,0xe9,0x88,0x97,0xc,0x78,0x99,
-    0xd9,0xd5,0x27,0x1a,0x32,0xed,0x2c,0x6a,0x5,0xae,0xd8,0xb5,0x67,0x93,0x77,0x8f,
-    0x15,0xf4,0x4,0xfb,0x9d,0xfd,0xab,0x3f,0x59,0x73,0x0,0xde,0xd6,0x95,0x8b,0xa7,
-    0xa1,0xc2,0xc8,0x26,0xc8,0xe0,0x34,0x24,0xbc,0x8a,0x28,0xa8,0x83,0x3a,0xe0,0xc3,
-
-    // Record 52: Address = 0x2a00, Length = 128
-    0x2a00,0x80,
-    0x4a,0x20,0xe5,0x95,0x36,0x8c,0xb8,0x3a,0xb7,0x87,0x93,0x47,0xcc,0xfc,0x40,0xa0,
-    0xb3,0x22,0x90,0x2e,0x14,0x68,0xa2,0x14,0x39,0x30,0xd9,0x8b,0x64,0xf3,0xdc,0xe3,
-    0x18,0x69,0x6f,0x1e,0xbc,0x7,0x43,0x1b,0x2b,0x63,0x67,0xff,0x81,0xc1,0xe8,0x10,
-    0xf7,0x3,0x8a,0x61,0xdc,0x27,0x7f,0x75,0xaa,0x86,0xc0,0x91,0x4e,0x49,0x8f,0x11,
-    0x3f,0xd,0x7b,0xb4,0xa7,0x3c,0x48,0x3e,0x89,0x7e,0xcf,0x23,0x2c,0x44,0x22,0x8b,
-    0x58,0x9c,0x5a,0xc,0x95,0x83,0x68,0x4a,0xe6,0x37,0x67,0xad,0xcb,0x65,0x4d,0x49,
-    0xd4,0xd7,0x39,0x96,0xd9,0x16,0xc0,0x5b,0xb0,0x89,0x15,0x4c,0x76,0xa1,0x32,0xc2,
-    0x8d,0xa8,0x63,0x85,0xc3,0xe3,0x5,0x21,0xaa,0x5a,0x98,0x89,0xf1,0x5a,0x26,0x31,
-
-    // Record 53: Address = 0x2a80, Length = 128
-    0x2a80,0x80,
-    0xe2,0xb,0xad,0xf4,0x49,0x4a,0x70,0x21,0xdf,0xf0,0x87,0xf5,0x7d,0x13,0xa7,0x34,
-    0x7,0xb9,0x46,0xd3,0x39,0x42,0xa9,0x32,0xd0,0xaf,0x94,0x7d,0xeb,0x1c,0xcf,0x8,
-    0x81,0x9f,0xdb,0x8f,0x91,0x59,0x3b,0x6b,0x2d,0xac,0xeb,0x34,0xdc,0x3b,0x90,0xda,
-    0x83,0xe0,0x68,0x48,0x54,0xfd,0x26,0x33,0x4c,0xde,0x3e,0x77,0xb6,0x8f,0x3a,0x83,
-    0x79,0xeb,0xd6,0xf1,0x95,0xc9,0x6f,0xed,0x54,0x49,0xc2,0x82,0x4b,0xec,0x58,0xfc,
-    0x6f,0x9f,0xd9,0xe8,0xbe,0xad,0x40,0xcd,0x47,0x72,0xb6,0x58,0x3,0xd,0xe2,0x87,
-    0x48,0x1,0x7e,0xe4,0x1,0x21,0xee,0x81,0x6c,0xcb,0x2e,0x35,0x5a,0xda,0xc5,0x4e,
-    0xe0,0x1f,0x8c,0xeb,0x24,0xd4,0xae,0xa8,0x46,0x1b,0xe8,0x84,0x83,0x9c,0x5e,0x17,
-
-    // Record 54: Address = 0x2b00, Length = 128
-    0x2b00,0x80,
-    0x3,0x63,0xa8,0x64,0x7,0x71,0xed,0xc9,0x1c,0x8d,0x3c,0xe9,0x57,0xdc,0xeb,0x6e,
-    0xa9,0x85,0x40,0x11,0x56,0x27,0x4d,0x23,0x35,0x14,0x57,0x35,0x1d,0x7a,0x6,0x44,
-    0xb4,0x1d,0xed,0xf5,0x68,0xc6,0x30,0x18,0x90,0xd7,0xe,0x73,0x4e,0x1,0xb5,0x67,
-    0xb8,0x44,0xd9,0xc2,0xcd,0xc6,0x57,0xa6,0x4b,0xdc,0x5b,0x46,0x2f,0xfa,0xaf,0x2c,
-    0xd4,0xe0,0x46,0x51,0x1,0x4c,0xaf,0x9,0x5e,0x97,0xb5,0x36,0x9,0xff,0x68,0x8,
-    0x5e,0xa6,0x2b,0xbf,0x4f,0x4c,0x57,0x5e,0x4c,0xe1,0x31,0x1e,0x9a,0x3d,0xb1,0x71,
-    0xf7,0x14,0x79,0x8,0x9f,0xae,0x6c,0xe5,0x10,0x63,0x74,0xad,0x14,0xd3,0x73,0x27,
-    0x1c,0x5c,0x5a,0x29,0x59,0xd7,0xc9,0x46,0xee,0x4d,0xca,0x83,0xa4,0x4f,0xf,0x97,
-
-    // Record 55: Address = 0x2b80, Length = 128
-    0x2b80,0x80,
-    0x65,0x1c,0x24,0xce,0x33,0xbe,0x73,0xf3,0xb6,0x9c,0xae,0xf,0xd9,0xd8,0x12,0xa1,
-    0x5,0x81,0xd8,0xcf,0x44,0x71,0xcc,0xe9,0x82,0xd0,0xfa,0x77,0xea,0xaf,0x9,0xc3,
-    0x8f,0x94,0x1b,0x51,0xb5,0xcf,0x4a,0x11,0x12,0x94,0x4e,0x7,0xf4,0x6a,0x39,0xd2,
-    0xb9,0xe3,0xd6,0x7d,0x54,0x80,0x96,0xdf,0x41,0x8b,0x7c,0x53,0x16,0x63,0xb1,0xfa,
-    0x9d,0xc3,0x70,0x39,0x48,0x47,0x76,0x5b,0x8f,0x26,0xd3,0x8d,0x12,0xc4,0x19,0x62,
-    0x9c,0x3,0x70,0x69,0x49,0x9d,0xbb,0x78,0xf,0x25,0xd7,0x6a,0x75,0x2a,0x37,0x2a,
-    0xac,0x4e,0x36,0xef,0x81,0x18,0xef,0x74,0x77,0x8c,0xd7,0x3,0xb6,0xd0,0xd8,0xed,
-    0x2f,0x65,0xed,0x7a,0xa5,0x1c,0x4b,0xd,0xec,0xff,0xce,0x47,0x81,0xf5,0x1,0x8a,
-
-    // Record 56: Address = 0x2c00, Length = 128
-    0x2c00,0x80,
-    0xd9,0xd6,0x9c,0x8a,0x15,0xf4,0xdc,0xc5,0x55,0x33,0xf4,0x62,0x69,0x46,0x8,0xe3,
-    0x98,0x54,0xf1,0x1b,0x3e,0xd6,0x5d,0x4b,0x6e,0x51,0x69,0x99,0xa0,0xef,0xdb,0xed,
-    0x79,0xb5,0xc1,0xa4,0x23,0xdb,0xbc,0xa2,0x3,0x3d,0x89,0xf1,0x4a,0x81,0xc2,0xef,
-    0x34,0x9e,0x4a,0x51,0x79,0x32,0xc9,0x22,0x32,0xaa,0x27,0xcc,0x99,0x6c,0xe8,0xc4,
-    0x2b,0xe0,0x5b,0x82,0x13,0xa5,0x35,0xa4,0x12,0xb0,0x9e,0xfd,0x45,0x1a,0x41,0xe4,
-    0x57,0xfe,0xa7,0x48,0x7f,0xbe,0x3e,0xde,0xad,0xef,0x47,0xef,0x11,0x9e,0xdf,0xca,
-    0x9e,0xfd,0x7e,0x25,0x65,0x14,0x76,0x9c,0x7c,0x3e,0x64,0x10,0x13,0xb1,0x4a,0x6f,
-    0xff,0x68,0x53,0x3,0xbc,0x78,0xf4,0x90,0x4b,0x5d,0x6e,0xa3,0x5,0xd6,0xd0,0x4d,
-
-    // Record 57: Address = 0x2c80, Length = 128
-    0x2c80,0x80,
-    0xbd,0xc9,0xb4,0x1d,0xcc,0xb3,0xe4,0xab,0x55,0x7a,0xf9,0x3e,0x68,0xdb,0xa2,0xda,
-    0xf9,0xd7,0xe8,0x93,0xfd,0x83,0x2a,0x6f,0xce,0xae,0x67,0x3b,0x6,0x2f,0x9,0xf1,
-    0x21,0x50,0xeb,0xf3,0x5e,0x60,0xc3,0x39,0x1f,0xa3,0x5,0x96,0xa4,0xc8,0xa9,0x73,
-    0x35,0xe8,0x18,0xb6,0xa,0xc6,0x74,0x37,0x8b,0xa9,0xa9,0x68,0x47,0x3,0x78,0x61,
-    0x19,0xdc,0xc0,0x91,0x89,0xb2,0x17,0xdb,0xd9,0xc3,0x92,0x4f,0xb5,0xf5,0x97,0x1,
-    0x3c,0x8b,0x13,0x37,0xaf,0xec,0x88,0xd7,0xd2,0x28,0xa8,0xbf,0x7b,0x7b,0xad,0x76,
-    0x7a,0x28,0xfb,0x5a,0x3,0x97,0xfb,0xa0,0x88,0xde,0xa3,0xc5,0xe5,0x11,0xe6,0x72,
-    0x99,0x89,0x75,0x82,0x52,0xa3,0x42,0xda,0x2b,0xc8,0xd2,0xa8,0x8c,0xbc,0x63,0xc3,
-
-    // Record 58: Address = 0x2d00, Length = 128
-    0x2d00,0x80,
-    0xdf,0xf0,0x56,0x6d,0xab,0xd0,0x7a,0x14,0xcb,0xcf,0x36,0x3,0xc,0x96,0x83,0xc5,
-    0x2b,0x40,0x75,0x1a,0x9c,0xca,0xa4,0x4a,0x12,0x60,0xee,0x42,0x17,0x43,0xe,0x37,
-    0x67,0xa5,0x5f,0x69,0xe5,0x4b,0x8e,0x74,0x86,0xdc,0x52,0x96,0xa9,0x63,0x61,0x18,
-    0x7,0x62,0xe5,0x67,0x54,0x5b,0x79,0xa5,0x1b,0x1b,0x6b,0xba,0xfc,0x50,0x2b,0x21,
-    0xcd,0x97,0xf0,0x6d,0xf,0x21,0xba,0x24,0x9c,0x84,0xe3,0x9,0xaf,0x7a,0xb8,0x70,
-    0xc5,0x99,0x34,0xdd,0xc2,0x73,0x35,0x2e,0xcc,0x41,0x72,0x1a,0xe,0x51,0xbc,0x5d,
-    0xc9,0x34,0xa7,0x28,0x9c,0x55,0x36,0xdb,0xc9,0x87,0x40,0x32,0xc0,0xeb,0x9f,0x8a,
-    0x3e,0xe0,0x3a,0xf1,0xdd,0x54,0xdb,0xdf,0xa5,0x5b,0x83,0x2e,0xe2,0xb8,0x68,0x2e,
-
-    // Record 59: Address = 0x2d80, Length = 128
-    0x2d80,0x80,
-    0x92,0x3c,0xe6,0xaa,0xad,0x57,0x8,0x91,0x43,0x1f,0x8c,0x79,0xd0,0xab,0x5e,0xa4,
-    0x94,0x6b,0xa1,0x87,0xcf,0xd5,0xb9,0x6a,0x7c,0x98,0xf3,0x18,0xa5,0x88,0x2c,0x54,
-    0x48,0xd2,0x50,0xd6,0x81,0x2c,0xc3,0x45,0x19,0x3c,0x2,0x87,0x45,0x60,0x77,0x2a,
-    0x5d,0xbb,0x73,0x3b,0x21,0x67,0x55,0x96,0xb6,0x2,0xe4,0x71,0xd4,0x4a,0x1b,0x9f,
-    0xd,0xba,0x89,0xbb,0x3d,0x33,0xb6,0xc0,0x30,0x6e,0x1c,0x1b,0x66,0x2d,0x68,0x16,
-    0xd8,0x75,0x68,0x20,0xd5,0x5,0x76,0x3,0xf,0x14,0x46,0x34,0x72,0x8b,0x36,0xf1,
-    0xd7,0xe4,0x1d,0xbc,0xbf,0x1f,0xa4,0xe9,0x4a,0x35,0x6a,0x81,0x41,0xb2,0x5b,0x2,
-    0xa0,0xbc,0x53,0xd5,0x72,0x40,0x32,0xf7,0xed,0x9b,0xef,0x4a,0xa0,0x35,0x9f,0x2c,
-
-    // Record 60: Address = 0x2e00, Length = 128
-    0x2e00,0x80,
-    0xcb,0x74,0x58,0x1,0x50,0x54,0x20,0x88,0x8,0x10,0x7e,0x60,0x60,0x5f,0xdb,0xa5,
-    0xc4,0x14,0xb9,0x8d,0xd6,0xa2,0x18,0x49,0x61,0x4,0x46,0x81,0xda,0x7c,0x80,0xba,
-    0x96,0x10,0x6f,0x7f,0xca,0x58,0x19,0xeb,0x76,0x8,0x53,0x7b,0x12,0xab,0xb8,0x93,
-    0x3b,0x7c,0x37,0x9f,0x20,0xeb,0x88,0x31,0xe7,0xc,0x72,0xf8,0x8b,0x5b,0x93,0x8f,
-    0x67,0x64,0xff,0x3e,0x51,0xc3,0xe1,0x64,0xe0,0x4,0xf5,0xd8,0x4a,0xee,0xb1,0xbf,
-    0xd4,0x47,0xed,0xa2,0xe0,0xa,0x5,0x54,0x6a,0x5c,0xcb,0x84,0x44,0xbf,0xfa,0xb7,
-    0xcb,0xc,0x8c,0x17,0x25,0x50,0x32,0xc1,0x99,0x6f,0x3a,0x8a,0xae,0xc,0xd,0x7e,
-    0x20,0xac,0x8d,0xf5,0xba,0xd7,0x2f,0x3a,0xe2,0x5,0xd2,0x7e,0x93,0x65,0xd2,0x9a,
-
-    // Record 61: Address = 0x2e80, Length = 128
-    0x2e80,0x80,
-    0x99,0xc2,0x8a,0x4d,0xfd,0x46,0x65,0xcd,0xf1,0x3d,0xaa,0x24,0xd4,0xbe,0xd2,0xad,
-    0xff,0xf,0xed,0xb2,0x4c,0x24,0xf9,0xa8,0x80,0xa,0x0,0xbe,0x16,0xad,0x7b,0x55,
-    0x8b,0x17,0x9,0xc6,0x3b,0x37,0xe5,0xdf,0xca,0xb,0x2c,0xb5,0xb2,0x1c,0x8d,0xfa,
-    0xba,0xd2,0xd4,0x3f,0x89,0xdd,0x90,0x2d,0xa7,0x2f,0x18,0x9d,0xd9,0xd5,0xc6,0x37,
-    0x3b,0x3,0x25,0x9f,0xf5,0x13,0xd,0x58,0x4b,0xc,0x3,0xad,0x58,0xed,0x34,0x70,
-    0x25,0x6e,0x15,0x9,0x72,0x62,0x51,0x4f,0xb6,0x2f,0x65,0x7c,0xc3,0x52,0x79,0x9f,
-    0x8,0xda,0x37,0x3a,0xe0,0x30,0xf1,0x69,0xaa,0x58,0x92,0xc,0x7e,0x15,0x22,0x2,
-    0xf2,0xa9,0xfc,0xaa,0xf6,0x66,0xbc,0x6b,0xc2,0xd5,0xe0,0x9f,0xf0,0xe1,0xc1,0x5b,
-
-    // Record 62: Address = 0x2f00, Length = 128
-    0x2f00,0x80,
-    0x69,0xc5,0x36,0xc0,0x4e,0x43,0x6,0x12,0x2a,0xa5,0x2a,0xac,0x6c,0x8e,0x53,0x6,
-    0x1e,0x27,0x56,0xcf,0x44,0xac,0xc4,0x5,0x4c,0xfe,0x1b,0xb9,0x1f,0x99,0x6,0x39,
-    0xa7,0xf5,0x37,0x33,0x37,0x93,0xdd,0xc4,0x70,0x74,0xb2,0x23,0x93,0x18,0xa,0x1f,
-    0xec,0x64,0xb0,0x7e,0x23,0x9a,0x9d,0x9d,0x31,0xf4,0x1b,0x7c,0x2,0xc6,0x55,0xe0,
-    0x1,0x47,0x6f,0x28,0x4a,0x8d,0x40,0xce,0x1c,0x50,0x8a,0xb,0xd8,0x67,0x87,0xd6,
-    0xa4,0x4c,0x14,0xc8,0x3d,0x79,0xc1,0xfb,0x82,0x28,0x7c,0xcb,0xfc,0x30,0x24,0x3f,
-    0xc5,0x29,0xee,0xa6,0xa,0x23,0x77,0x62,0x79,0x4,0x1c,0x9,0xf3,0xcd,0xd3,0x26,
-    0x71,0x86,0xfb,0x40,0x89,0x84,0x28,0xb7,0x94,0xe1,0xaa,0x4e,0x34,0xf7,0x24,0xd3,
-
-    // Record 63: Address = 0x2f80, Length = 128
-    0x2f80,0x80,
-    0x40,0xb3,0x48,0xbb,0x2,0x9f,0x35,0x6c,0xda,0x43,0x19,0xd,0xfe,0x33,0xac,0x26,
-    0x11,0x20,0x3,0x58,0x8d,0xaf,0xe,0x16,0x1e,0xde,0xff,0x71,0x34,0x28,0x3,0x19,
-    0xb,0x81,0x90,0xc3,0x40,0x5b,0x87,0x36,0x74,0x4,0x23,0x47,0x42,0x75,0xa7,0xbb,
-    0x14,0x44,0xba,0x55,0x16,0x41,0xf3,0x7b,0xf7,0xc9,0x21,0x6d,0x16,0xe9,0x5b,0x21,
-    0x9f,0xd3,0x6f,0x3a,0x5,0x83,0xec,0x3a,0xd0,0x4,0xc9,0x5d,0x75,0xd4,0xbe,0x17,
-    0xd0,0x32,0x6e,0x16,0x7a,0x81,0x5a,0x37,0x65,0xba,0x99,0xb2,0xe2,0x3b,0x8a,0x59,
-    0x17,0x67,0x2a,0xf2,0xa4,0xd8,0xbe,0x7b,0x76,0xfa,0xcd,0xad,0xc4,0xe8,0xa0,0xa7,
-    0x4f,0x1a,0xe7,0x25,0x99,0x31,0x19,0x3b,0x60,0xbf,0xa9,0xb,0x94,0xce,0xcc,0x2f,
-
-    // Record 64: Address = 0x3000, Length = 128
-    0x3000,0x80,
-    0x27,0x20,0xa9,0xac,0x22,0xb2,0xa9,0x54,0x4b,0x7d,0x6f,0xaa,0x97,0xb7,0xfa,0xb1,
-    0x54,0x97,0x9d,0x86,0xc3,0xb3,0x71,0x4,0x57,0xc3,0x3c,0x9c,0xd7,0x8b,0x12,0x2d,
-    0x13,0x94,0xe4,0xc1,0xf5,0x98,0xca,0x78,0xd7,0x28,0x1b,0xdc,0xd7,0xef,0x6c,0xdd,
-    0x6a,0x0,0xf2,0xa3,0xb0,0x66,0x9b,0xea,0x7b,0xf0,0x7,0x40,0x53,0xdd,0x39,0x5f,
-    0x3d,0xe4,0xa5,0x6a,0xf0,0x63,0x2c,0xc1,0xcd,0x9a,0x83,0xd7,0x69,0x61,0xfa,0x10,
-    0x86,0x84,0x7a,0x35,0x9a,0x90,0x45,0x90,0xac,0x94,0xa9,0xc0,0xdb,0xe5,0x34,0x9b,
-    0x54,0xe7,0xd1,0x94,0xa8,0x7c,0x32,0xe2,0x8d,0x24,0x8e,0x67,0x2c,0xa4,0xe1,0x39,
-    0xa6,0xe5,0x8e,0xcd,0x0,0x41,0x1e,0x37,0x23,0x2c,0xe3,0x15,0xb0,0xe8,0xad,0x8f,
-
-    // Record 65: Address = 0x3080, Length = 128
-    0x3080,0x80,
-    0xbf,0xd9,0xe8,0x99,0xe5,0xc2,0x38,0x98,0xf8,0x30,0x3f,0x92,0x4b,0xbf,0xc5,0xab,
-    0x69,0xa7,0xac,0xfe,0x11,0x82,0xbc,0xd1,0xd9,0xb2,0x2c,0x43,0x79,0xf4,0x3a,0x4c,
-    0xca,0x2d,0x63,0x86,0x20,0x51,0xc5,0x6b,0xd6,0x2e,0x29,0xbb,0x5a,0xc9,0x8b,0x7c,
-    0x29,0x82,0xbb,0x5c,0xd9,0xf9,0xa1,0xbf,0x5f,0x64,0xd9,0x8,0xd9,0x8d,0xa1,0x4a,
-    0xcd,0xe3,0x3a,0x69,0x79,0xd6,0xd,0xdf,0x30,0x1f,0x8b,0x22,0x80,0x94,0xc7,0x45,
-    0xb9,0x4d,0xb3,0x8e,0xba,0x49,0x22,0x6d,0x27,0x73,0x8d,0xc3,0x7c,0x2b,0xed,0x27,
-    0x87,0xa4,0x14,0xae,0xe3,0x21,0xd0,0x82,0x9b,0x4,0x8b,0x2f,0xd3,0xda,0x8a,0x8a,
-    0x7e,0xe9,0x6c,0xb1,0x64,0xce,0xdb,0x61,0xd3,0x3e,0x24,0x76,0x9e,0x50,0xa6,0x8e,
-
-    // Record 66: Address = 0x3100, Length = 128
-    0x3100,0x80,
-    0x73,0x42,0x84,0xf3,0x97,0x61,0xe7,0x6e,0x7b,0xa,0x3e,0x73,0x29,0xb0,0xd,0x6d,
-    0x56,0xff,0x8e,0xcc,0x71,0xa5,0x13,0xd0,0x46,0x85,0x2d,0x1f,0xea,0x5a,0x4c,0xcb,
-    0x74,0xa2,0x98,0x5e,0xc6,0x39,0xe9,0xb,0x3e,0xfd,0xef,0x72,0x3a,0xda,0x4f,0x62,
-    0x51,0x5,0x4,0x19,0xdc,0x94,0x67,0x46,0x13,0x4c,0x68,0xb7,0x25,0xf9,0x3d,0x5a,
-    0xe0,0x1b,0xfd,0x1a,0xa4,0xf0,0xc3,0xa4,0x7b,0x87,0xd4,0xb5,0xab,0x35,0x4f,0xed,
-    0xa5,0x6,0x7,0x1c,0x9c,0x60,0xcd,0xe9,0xfd,0x11,0x75,0x0,0xf,0x5d,0x70,0x70,
-    0x2b,0xdb,0x5d,0x55,0x7d,0x84,0x6b,0xe5,0x8d,0xd4,0x30,0x78,0x52,0xcc,0x66,0xf5,
-    0x2,0x2d,0xa,0xa9,0xa2,0x8f,0x8c,0xdc,0x88,0x23,0xbd,0x4d,0xaa,0x78,0xa2,0xa6,
-
-    // Record 67: Address = 0x3180, Length = 128
-    0x3180,0x80,
-    0xb4,0xb5,0xca,0xa9,0xa7,0x91,0x95,0xd0,0xad,0x13,0x23,0x6,0xbf,0xf7,0x5b,0x44,
-    0xa0,0x3a,0x10,0x8c,0x3f,0x7,0xf,0x9a,0x83,0xfc,0x29,0x4a,0x55,0x34,0x52,0xae,
-    0x52,0x44,0x9e,0xbc,0xa5,0x2a,0xce,0x71,0x4,0xcb,0xc1,0xe5,0x7c,0xd1,0x98,0x0,
-    0xba,0xba,0x8a,0x1,0xe1,0x63,0x65,0x5,0x34,0x78,0x2b,0xa2,0x59,0x1b,0x25,0xd5,
-    0x15,0x26,0x2a,0x3e,0x23,0xc9,0xab,0x73,0x83,0xaa,0x5e,0x7c,0xc1,0xe8,0x40,0xba,
-    0x10,0x88,0xf3,0xb2,0xac,0x9b,0x98,0x9f,0xc5,0xc4,0xf,0xb9,0xda,0xd9,0xe6,0x63,
-    0x44,0x2c,0xc5,0x8,0x96,0xff,0xda,0xd7,0x3e,0x76,0xb9,0xf6,0x1a,0x3b,0x40,0xd9,
-    0x54,0x48,0xcc,0x4e,0x0,0x82,0x50,0xd4,0x55,0x73,0x8c,0x5d,0x40,0x72,0x6e,0xd8,
-
-    // Record 68: Address = 0x3200, Length = 128
-    0x3200,0x80,
-    0x51,0x23,0xbe,0x7f,0xe0,0xf0,0x1e,0x17,0x75,0x7c,0x46,0x5f,0xfb,0xab,0xd5,0x66,
-    0x72,0x1b,0x18,0xf4,0xbb,0xc4,0x12,0x5f,0xef,0xa8,0x98,0xd8,0x12,0xc6,0x3d,0xab,
-    0x3a,0x60,0x4c,0xa4,0x64,0xc4,0x6e,0xc5,0x25,0xce,0xc0,0x25,0x20,0xa8,0x33,0x25,
-    0x60,0xfa,0xe4,0xad,0xf8,0xb6,0xc5,0x5f,0xe6,0xdd,0xae,0x6f,0x7,0xda,0x8e,0x5,
-    0x98,0xc,0xe6,0x70,0x13,0xf3,0xd3,0xbb,0x40,0xf6,0x64,0x26,0x8f,0xd9,0x14,0xb5,
-    0x37,0xd0,0x37,0xb5,0x92,0xef,0xfa,0xad,0xff,0xfd,0x8b,0xf7,0xeb,0x48,0x67,0x65,
-    0x2e,0x19,0x88,0x1,0x62,0x5d,0xee,0xb5,0x38,0x35,0xe8,0xc3,0xa2,0x2f,0x6b,0x45,
-    0x71,0x33,0xc9,0x74,0x31,0x16,0x46,0xae,0x86,0xc5,0x55,0xdb,0xc3,0x79,0xee,0xc3,
-
-    // Record 69: Address = 0x3280, Length = 128
-    0x3280,0x80,
-    0x74,0x49,0x20,0xb3,0xf6,0x4d,0xe9,0xda,0xa4,0xde,0xd6,0x44,0x84,0xab,0x5c,0xeb,
-    0xe,0x3,0xf5,0xce,0x32,0xe4,0xf7,0xe7,0x81,0x83,0xb8,0xb4,0x36,0xb5,0x87,0xfe,
-    0x4a,0xcd,0x9b,0x79,0x5d,0x38,0x5d,0x9,0xc8,0xf6,0x58,0x3b,0x5c,0x8b,0x95,0xaa,
-    0x32,0x80,0x0,0xa3,0xb6,0x7b,0x91,0x60,0xe3,0xfe,0x3d,0x67,0x11,0xb0,0x84,0x9a,
-    0x3e,0x5e,0xc4,0xaa,0xe8,0xd7,0x91,0xc2,0xf,0xf3,0x42,0xa8,0xb5,0x1d,0x6e,0xc0,
-    0x23,0x64,0x5e,0xf0,0x7d,0x64,0xf3,0x4d,0x4e,0x90,0xb3,0xc5,0x9,0x3a,0xa0,0x29,
-    0xb7,0x64,0x5d,0x7,0xa8,0x92,0x8f,0xe8,0xbf,0x60,0xab,0x5d,0x88,0xc2,0x4b,0x8c,
-    0x9f,0xd9,0x62,0x9e,0x3d,0x70,0x17,0x98,0x8,0x3b,0xa2,0xfb,0x1e,0x73,0x10,0xf7,
-
-    // Record 70: Address = 0x3300, Length = 128
-    0x3300,0x80,
-    0xdf,0x7,0x81,0x52,0x42,0x2e,0x4b,0x4f,0x9e,0x4c,0x74,0x98,0xc1,0x9a,0x63,0x8e,
-    0x87,0x32,0xd2,0x2d,0x5e,0xab,0x20,0x6e,0x7,0xb9,0x3d,0x1f,0x4c,0xaf,0xcc,0x3e,
-    0xfe,0xe2,0x59,0x72,0x87,0x3,0xe6,0xc,0xcb,0x57,0xf5,0xbb,0xe2,0xa9,0x15,0x6e,
-    0x70,0x5,0x75,0x54,0x13,0x7a,0x58,0xf2,0xf1,0x7a,0x3e,0xc3,0xd,0xa8,0xe7,0xdf,
-    0xc0,0xd7,0x43,0x20,0xe5,0x48,0x54,0x82,0xce,0x21,0x9c,0xf9,0xbb,0xf2,0x67,0x52,
-    0x78,0x3d,0x3c,0xf4,0x1a,0x2a,0xca,0xa5,0x1f,0x4e,0x8d,0x45,0x2a,0x8b,0x4c,0x86,
-    0xfc,0xc0,0x51,0x49,0x5a,0xb8,0x55,0xe3,0x96,0xa3,0x84,0xe7,0xcb,0x2f,0x1c,0x9,
-    0x61,0xa9,0xcb,0x8c,0x89,0xa6,0xc3,0xd6,0x93,0x8d,0x3b,0x11,0x2f,0x70,0x5c,0x80,
-
-    // Record 71: Address = 0x3380, Length = 128
-    0x3380,0x80,
-    0x26,0x25,0x4f,0x23,0x25,0x72,0xf2,0x42,0xa3,0xe9,0x7d,0x17,0xc2,0x88,0x8a,0x1e,
-    0x9b,0x45,0xf0,0xb9,0xdf,0xc1,0xb,0x12,0x19,0x29,0x5a,0x1d,0x43,0xd4,0x4f,0x37,
-    0xb4,0x7c,0xb1,0x7a,0x99,0xec,0xd8,0x8e,0x37,0x3e,0xca,0x64,0xea,0x92,0x2d,0x11,
-    0xc4,0x5d,0x86,0x26,0x71,0xd9,0x8,0x7b,0xca,0xdd,0xa,0x79,0xf3,0xb0,0x80,0xfb,
-    0xe2,0x91,0x14,0x19,0x5a,0xd8,0x83,0xc4,0xc7,0x11,0xd8,0xb2,0x94,0x18,0x5a,0x79,
-    0x9c,0x52,0xcb,0xd1,0xef,0x93,0xf7,0x47,0xb2,0xa2,0xfb,0x51,0xdf,0xb2,0x2c,0xc6,
-    0xc5,0xcb,0x67,0xce,0x7,0x67,0xdc,0xa8,0xd7,0x3a,0x52,0x51,0xc4,0x3c,0xf6,0x95,
-    0xb5,0xed,0xb2,0x86,0x99,0x36,0x12,0x1d,0xd8,0xd0,0x78,0xf6,0x90,0x8,0x46,0xaf,
-
-    // Record 72: Address = 0x3400, Length = 128
-    0x3400,0x80,
-    0x82,0xfa,0x9a,0x2b,0xf7,0x65,0x75,0x77,0x16,0x97,0x89,0x27,0xe0,0x46,0xa9,0x12,
-    0x24,0x8a,0x1c,0x54,0x6f,0xa4,0x9e,0xaf,0xb7,0x22,0xae,0x68,0xa4,0x56,0xbb,0xe8,
-    0xcb,0x54,0xa9,0x32,0xb,0xa8,0xe6,0x73,0xba,0x25,0xb8,0x8e,0x91,0x76,0xc7,0xe0,
-    0xac,0xb6,0x45,0x14,0x3,0xba,0xeb,0x1,0x49,0x78,0xe7,0x6,0x88,0x4e,0x30,0x31,
-    0xa4,0xe7,0xf8,0x5b,0xb1,0xe1,0x4,0xe1,0x33,0x3d,0x43,0xb3,0xe4,0xe5,0x94,0x22,
-    0x8a,0xa2,0x2b,0x70,0xc7,0x30,0xce,0x27,0x7b,0x6e,0x5e,0x3c,0x98,0x15,0x94,0x8,
-    0xb3,0x94,0xd6,0xf5,0xbd,0x4e,0xb1,0x29,0xc3,0xdb,0x87,0x95,0x8c,0x3,0xa,0xbd,
-    0x1a,0xde,0x94,0xfd,0xe8,0x35,0xca,0x41,0xae,0x6d,0xb4,0x6a,0x3c,0x51,0x86,0x3c,
-
-    // Record 73: Address = 0x3480, Length = 128
-    0x3480,0x80,
-    0x18,0x4,0xd8,0x2e,0x93,0x6a,0x7,0x92,0x6d,0xf9,0xbe,0x7,0xd7,0xa7,0x98,0x62,
-    0xab,0x5b,0xa5,0x3a,0x3e,0x3d,0xc5,0xb6,0xce,0x97,0xdc,0x16,0x18,0x5,0x97,0x85,
-    0xf6,0x73,0x4a,0x88,0x16,0xe3,0x35,0xb1,0x17,0xeb,0x40,0x46,0x99,0x90,0xa,0x57,
-    0xdd,0xa9,0xb1,0xbb,0xac,0x47,0x6b,0x71,0xe2,0x8,0x37,0x62,0x84,0x3c,0x91,0xf8,
-    0x3e,0x7b,0xb9,0xbd,0xaf,0xb9,0x52,0x9e,0x32,0x14,0x70,0xcf,0x1f,0x95,0xc8,0x1f,
-    0x9e,0xfd,0x7b,0x53,0xd7,0x17,0x25,0xcb,0xd7,0x4d,0xe0,0x73,0xd7,0x8a,0x8f,0x67,
-    0x36,0xfc,0x99,0x8d,0x9c,0x68,0x54,0x4f,0xfe,0x2a,0x5c,0x8e,0xd2,0x2f,0xbe,0x28,
-    0xba,0xa5,0x18,0xec,0xe2,0x2,0xa3,0xfd,0x25,0xc1,0x57,0x8d,0xcb,0xf2,0x9c,0x8f,
-
-    // Record 74: Address = 0x3500, Length = 128
-    0x3500,0x80,
-    0xa2,0x8c,0x33,0xd,0xb4,0x54,0xb0,0x2e,0xcf,0xb5,0x1d,0xf1,0xea,0x1a,0x30,0x92,
-    0x48,0x24,0xee,0xf0,0x82,0x99,0x8a,0x32,0x1b,0xcd,0xaa,0xa,0x17,0x53,0xa1,0x56,
-    0x3f,0xec,0xd3,0x46,0x8f,0x1a,0xfb,0xa0,0xbc,0x19,0xe,0x6f,0x93,0xe4,0xe3,0xc3,
-    0x43,0x54,0x3e,0xe5,0xa2,0x2a,0x88,0x39,0x8c,0x81,0x2a,0x7c,0xd4,0x34,0xb3,0xeb,
-    0xde,0xd5,0xac,0x45,0xd1,0x80,0x9a,0x70,0x98,0x23,0x91,0x23,0xf6,0xf0,0x5,0x5d,
-    0xf7,0xec,0x6,0x68,0xea,0x2d,0x43,0x97,0x36,0xbd,0x1f,0xe5,0x30,0xe2,0xfb,0x30,
-    0x18,0x27,0x28,0x92,0x30,0x84,0x5b,0x6c,0x5c,0xce,0x57,0xc2,0xf1,0x1d,0x87,0xa7,
-    0x6,0xab,0x5d,0xe2,0x6c,0xaa,0xba,0xa6,0x14,0x3a,0x27,0xb6,0xc6,0xa,0x74,0x2,
-
-    // Record 75: Address = 0x3580, Length = 128
-    0x3580,0x80,
-    0xd5,0x82,0x28,0x93,0x94,0x8c,0x7c,0xf0,0x8d,0x3b,0x7c,0x19,0xd1,0x66,0x9d,0x45,
-    0x73,0x77,0x1b,0xa5,0x73,0x4e,0xad,0xa7,0x0,0x8b,0xea,0x59,0x18,0xaa,0x53,0xbd,
-    0x40,0x48,0x73,0x94,0x8c,0x59,0x1d,0xbd,0xa6,0xf3,0x48,0xc6,0xb6,0x9d,0xac,0xa5,
-    0x67,0x3e,0xea,0xe2,0x20,0x61,0xc5,0xd,0x3f,0xb2,0xf6,0x7f,0x7,0xb1,0xab,0x90,
-    0x6e,0x58,0x2a,0xd8,0xbe,0xe2,0x4e,0xb1,0xf8,0x9c,0x50,0x12,0x8b,0x73,0xb9,0x6a,
-    0xbe,0xfb,0xf,0x2b,0x88,0xd6,0x8a,0x4,0x8c,0x1b,0x11,0xcf,0x52,0x4b,0x84,0xe1,
-    0xb4,0xec,0xb9,0x1b,0x62,0xb,0x87,0x9d,0x17,0xdc,0x69,0xee,0x45,0xee,0xad,0x37,
-    0x51,0x79,0x7a,0xd5,0x3b,0xfa,0xab,0x8f,0xc4,0x2e,0x5b,0x89,0xdc,0xcc,0x10,0x49,
-
-    // Record 76: Address = 0x3600, Length = 128
-    0x3600,0x80,
-    0x8,0xdd,0xc9,0x37,0xe1,0x33,0x43,0x7a,0xc5,0xd1,0x4c,0x97,0xe9,0xb9,0x24,0x60,
-    0x9b,0xd3,0x3d,0x44,0x7e,0x8a,0x22,0x6d,0x91,0xf3,0xb,0xda,0x68,0xad,0x52,0x88,
-    0xdf,0x35,0x78,0x6a,0x28,0xc7,0xd9,0xa,0x73,0xeb,0x97,0xb9,0x3c,0x8f,0x47,0x42,
-    0x59,0x9b,0xd5,0xb8,0xc0,0x98,0x3e,0x40,0xcd,0xe3,0xfa,0x4c,0xeb,0x6d,0xea,0x7b,
-    0x1e,0xb1,0xf5,0x80,0x78,0x68,0x2b,0x2d,0x4b,0x6b,0x8f,0xa5,0xdd,0x75,0xbc,0xe9,
-    0x99,0x59,0xe0,0xf0,0x3c,0x5f,0x5d,0x69,0xab,0x1,0xc9,0x5b,0xaf,0x2d,0x48,0xff,
-    0x6,0xb8,0xd8,0xf2,0xeb,0x8a,0xa0,0xa,0x2f,0xda,0xd7,0x34,0x8a,0xeb,0x90,0xfe,
-    0xf7,0x1e,0xdb,0xd3,0xbd,0x1a,0x8f,0x81,0x83,0x14,0x8c,0x40,0xfb,0xf,0x21,0x13,
-
-    // Record 77: Address = 0x3680, Length = 128
-    0x3680,0x80,
-    0x97,0x9e,0xb3,0xf4,0x70,0x4a,0x48,0x8b,0x14,0xc4,0x4f,0x3b,0x67,0x2b,0x58,0xdf,
-    0x9d,0x5a,0xa8,0x1d,0x41,0x3f,0x24,0x60,0x9e,0x41,0x2a,0x4f,0x0,0xfb,0xe1,0x3a,
-    0xd4,0x7e,0x40,0x86,0xe0,0xb3,0x3e,0xdd,0xc0,0x1,0x9e,0x3a,0xa6,0xef,0x75,0x5,
-    0x41,0x1f,0x35,0x55,0x12,0x35,0xdf,0xb4,0x8e,0xa9,0xa3,0xf4,0xa6,0x47,0xcf,0xe1,
-    0x42,0xd,0x84,0xa8,0xc1,0xf3,0x58,0x14,0x4f,0xc8,0x2d,0xd,0x34,0x40,0x2e,0x53,
-    0xfe,0x8e,0x54,0xbb,0xeb,0x9a,0xe7,0xa4,0xe5,0xc6,0x9,0x2e,0x2b,0xe6,0xd2,0x26,
-    0xa2,0x2b,0x17,0x4f,0xd,0x5a,0xf5,0x1c,0xd7,0x88,0xd9,0xc2,0xf8,0xc,0xba,0x9,
-    0x60,0xb0,0x63,0x22,0x86,0x26,0xce,0x7b,0xc9,0x6c,0x67,0xa,0x85,0xf7,0x67,0xa1,
-
-    // Record 78: Address = 0x3700, Length = 128
-    0x3700,0x80,
-    0x57,0x4e,0x3c,0x6d,0x2,0x54,0xe7,0x1f,0xd7,0xce,0xc3,0xd9,0xae,0xef,0x49,0xcc,
-    0x6b,0x48,0x76,0x4c,0x70,0x30,0x5b,0x42,0x2c,0xfd,0x3,0xeb,0x70,0x45,0x89,0x36,
-    0xae,0x49,0x66,0x72,0x72,0x8b,0x1e,0xc4,0x64,0x35,0xba,0xd6,0x72,0x1e,0x12,0xc9,
-    0xac,0x95,0x8f,0x38,0xb7,0x5c,0x86,0xff,0x71,0xf6,0xcd,0xd5,0x14,0xbf,0xe9,0xe3,
-    0x31,0xb2,0x20,0xfb,0x6,0x51,0x91,0x4,0x8a,0x1a,0x6,0x77,0x89,0xf0,0x60,0xe3,
-    0x72,0x7,0xb7,0x66,0x49,0x57,0xd5,0x81,0x1c,0x87,0xb1,0x2c,0xaa,0xd3,0xb6,0x42,
-    0x51,0x99,0x17,0xba,0x89,0xca,0x26,0x68,0xc3,0x36,0x36,0x5f,0x85,0xd3,0x48,0x88,
-    0x4b,0xe2,0xd6,0xcc,0x5c,0xb2,0xba,0xc4,0x82,0x9e,0xd0,0x69,0x1c,0xfb,0x85,0xaf,
-
-    // Record 79: Address = 0x3780, Length = 128
-    0x3780,0x80,
-    0xff,0x40,0xb7,0x5e,0xb6,0x9b,0x2b,0x91,0xed,0xe3,0x34,0xa8,0x9d,0xab,0xe6,0xb7,
-    0xed,0x1a,0x1f,0xb,0x77,0xaf,0xf3,0xc,0x22,0x82,0x47,0x6d,0x58,0x8e,0x44,0x60,
-    0x1,0xc7,0x3d,0x2c,0x58,0x75,0x10,0xd9,0x74,0xa5,0xd9,0xbc,0x72,0x9f,0xed,0x51,
-    0x71,0xe9,0xc1,0x7b,0xe9,0x31,0x8c,0x61,0x6,0x2e,0x24,0xa8,0xb4,0x97,0x8,0xdb,
-    0x34,0x8d,0xf,0xad,0xb9,0xe7,0x69,0x77,0xb8,0x8c,0xad,0x62,0x4a,0x5b,0x9d,0x83,
-    0x5f,0x96,0xf4,0xbe,0x66,0xe3,0x4e,0xcb,0xc,0xb3,0xcd,0x26,0x10,0xac,0x49,0x62,
-    0xad,0xc2,0x93,0x75,0xc0,0x32,0x32,0x54,0x16,0xbd,0xb5,0xa8,0xd4,0xd2,0x1b,0x5d,
-    0x9c,0x7e,0xd4,0x28,0x7f,0x53,0x47,0x92,0x5b,0x2e,0x50,0x2,0xef,0x36,0xc6,0xdc,
-
-    // Record 80: Address = 0x3800, Length = 128
-    0x3800,0x80,
-    0xc6,0xaa,0x2b,0xbc,0x3a,0xbf,0x85,0x16,0x87,0x8f,0x8a,0xe5,0x67,0x6a,0x49,0x1b,
-    0x1b,0x22,0xba,0x2a,0xf2,0x6a,0x91,0x27,0xde,0x45,0x4a,0xed,0xbf,0x71,0xbd,0x48,
-    0x83,0x74,0x1c,0x1d,0xcc,0x56,0x99,0x60,0xcb,0xf1,0xa0,0xf4,0x7e,0xe2,0xa0,0x2f,
-    0x41,0x39,0x6,0x82,0x2d,0x1f,0xd3,0x15,0x56,0xe2,0x61,0xab,0x83,0xf,0xc1,0xff,
-    0x26,0xc0,0x1c,0xff,0x1e,0x5a,0xdd,0xe5,0xad,0x87,0xe5,0x2e,0x5,0x56,0xd1,0xd2,
-    0x81,0x51,0x1b,0x10,0xf6,0xd3,0x57,0x9e,0xed,0x15,0x67,0x10,0x34,0x1f,0x38,0xee,
-    0x22,0x66,0x83,0xbe,0xe5,0xd2,0x17,0x7b,0x35,0x34,0xdf,0x93,0x84,0xca,0xcc,0x25,
-    0x5b,0x4a,0xeb,0x1c,0xa8,0x79,0xe,0xd4,0xe1,0x35,0xd0,0x5a,0xb4,0xdd,0x67,0xf4,
-
-    // Record 81: Address = 0x3880, Length = 128
-    0x3880,0x80,
-    0x5e,0xb6,0x5d,0x89,0x13,0xee,0x9,0x6e,0x7d,0xd6,0xd,0x40,0xff,0xef,0xf8,0xfd,
-    0x57,0x8c,0x93,0xb1,0x71,0x67,0x62,0x44,0xeb,0x21,0x8e,0xf4,0x24,0xdc,0x93,0xa,
-    0x26,0x75,0x4a,0x5b,0x58,0xda,0x63,0x29,0xd5,0x8a,0xa8,0xbd,0x4a,0x16,0x71,0x22,
-    0x1a,0x33,0x67,0xde,0xda,0x52,0x7b,0x48,0x44,0x52,0x7e,0xfe,0x99,0xcc,0xc6,0x56,
-    0xed,0xd1,0x67,0xab,0x4,0x5c,0x2d,0x5,0xb9,0xf,0xaa,0x62,0x51,0x2c,0x2f,0x32,
-    0x4e,0xe0,0xcb,0x81,0xbd,0x5c,0x4,0xec,0x11,0x6e,0xc5,0x9f,0xf5,0xa1,0xe3,0xd9,
-    0x15,0x33,0x92,0x88,0x42,0x5b,0x4f,0x25,0x9e,0x46,0xe,0x29,0x27,0x10,0xb5,0xa7,
-    0xda,0x9e,0x3,0x7,0xb8,0x3c,0x34,0xe,0x41,0xbf,0xaa,0x93,0xc7,0xf5,0xc,0x44,
-
-    // Record 82: Address = 0x3900, Length = 128
-    0x3900,0x80,
-    0x6e,0x4d,0x7b,0x78,0x60,0x25,0xaa,0xac,0x1c,0x4f,0x50,0x48,0xeb,0xbd,0xc,0x3e,
-    0xce,0xcb,0xce,0x5c,0x7a,0xeb,0xa3,0xb2,0x87,0xab,0x11,0xaa,0xd8,0x43,0x76,0x8,
-    0x63,0x16,0xfa,0xb1,0x7,0x1a,0x88,0xb1,0xb,0x23,0x3,0xa4,0xca,0x64,0xdb,0x96,
-    0x2a,0x72,0xef,0xb1,0x51,0xf3,0xcd,0xfe,0xf,0x4a,0xf,0x9c,0x5,0x1d,0xfd,0xd1,
-    0xa5,0xb7,0x7d,0xcb,0x2d,0xe2,0xa9,0x33,0x68,0x38,0x62,0x58,0x32,0x1e,0xe,0x20,
-    0xd6,0xd1,0xed,0xb5,0x93,0x66,0xd3,0xa3,0x94,0xc,0xac,0xe8,0x68,0x4e,0xde,0x50,
-    0x86,0x5,0x90,0x82,0xf6,0x20,0xb3,0xa7,0x21,0x22,0xe,0xa1,0x41,0xee,0xda,0xbd,
-    0x68,0x98,0xfd,0x3b,0xfb,0xdb,0xe6,0x8,0xd0,0x71,0xf6,0xa2,0x8d,0x14,0x24,0xa1,
-
-    // Record 83: Address = 0x3980, Length = 128
-    0x3980,0x80,
-    0xbe,0x38,0x3f,0x35,0x85,0xa,0x23,0xd8,0x49,0x97,0x7f,0xc6,0xcd,0x72,0x99,0x88,
-    0xb5,0x10,0x8a,0xae,0x98,0x1c,0x5b,0x23,0xb0,0x32,0x5f,0xde,0x33,0x5b,0xba,0x55,
-    0xfc,0xc0,0x9d,0xf,0xc8,0x5a,0xb9,0x49,0xaf,0xef,0xdc,0x8c,0x9f,0xd4,0x89,0xa4,
-    0x3d,0xf5,0xb9,0xa0,0x57,0x0,0x7e,0x6a,0x9e,0x51,0xb2,0xbf,0x35,0x23,0xdb,0x42,
-    0x71,0x16,0xba,0x5d,0x63,0x7e,0xa3,0xf4,0xa1,0xc9,0x99,0xb5,0x1a,0xe7,0xba,0xd7,
-    0x8f,0xc7,0xcf,0x7e,0x5f,0x1,0xe,0x9b,0x52,0x7b,0x20,0xa,0x15,0x3f,0x20,0x1b,
-    0x84,0x2a,0x3c,0x67,0xbd,0x17,0x35,0x62,0x64,0xb8,0x28,0x68,0x6a,0x4f,0xf5,0x8d,
-    0xf0,0x60,0xbb,0xae,0x59,0xf6,0xbc,0xaf,0x40,0x9,0x9,0xfd,0xc8,0x88,0x39,0x8e,
-
-    // Record 84: Address = 0x3a00, Length = 128
-    0x3a00,0x80,
-    0x66,0xcd,0xac,0xb1,0x6e,0x9e,0x74,0x5f,0xc3,0x66,0xd9,0xf,0xe,0x9a,0xb,0x5c,
-    0xed,0xe0,0x3c,0x7,0xc1,0x93,0xb9,0x81,0xf8,0xcd,0x31,0x10,0x3d,0xd3,0x50,0x3f,
-    0xe3,0xb7,0xa1,0x19,0xca,0xa5,0x32,0x5f,0xc3,0xf2,0xfa,0xd3,0x58,0x4c,0x42,0xea,
-    0x55,0x42,0x54,0xb9,0xaf,0x80,0x6,0xd,0xb0,0x59,0x84,0xb1,0xa8,0xa5,0x5d,0xd8,
-    0x4c,0xe5,0x20,0x53,0x3b,0xaf,0xf4,0x35,0xee,0x1,0x2c,0xe1,0x8d,0xbe,0x5a,0xff,
-    0x25,0xe8,0x78,0xe7,0x14,0xee,0xab,0xda,0x3,0x1,0xaa,0x68,0x84,0x55,0x1a,0x37,
-    0xd6,0x41,0x13,0x1d,0x5d,0x7e,0xd7,0x23,0x22,0x70,0xdf,0x2a,0xa,0xb2,0x33,0xcd,
-    0x80,0xf,0xf5,0x75,0xf7,0xaa,0xd7,0xb3,0xfc,0x7e,0x38,0xc2,0x3e,0xdb,0x17,0xf7,
-
-    // Record 85: Address = 0x3a80, Length = 128
-    0x3a80,0x80,
-    0xd6,0xbe,0x5b,0x6f,0x70,0xab,0xfa,0xeb,0xda,0xbb,0xcd,0x2,0xfc,0xcf,0xec,0xec,
-    0x99,0x95,0x27,0x1e,0x22,0x44,0xbf,0xf5,0x23,0x83,0x74,0x51,0x35,0x7a,0x1b,0x6b,
-    0x9d,0x75,0xbc,0xd1,0xd5,0x29,0x61,0x47,0x51,0xfd,0x13,0xb5,0x84,0xca,0x34,0x78,
-    0xc1,0x3e,0x17,0xdc,0xea,0x4,0xc4,0xaf,0x49,0x49,0xc3,0xd3,0xb,0x9,0xd9,0x27,
-    0xfc,0xf6,0xa6,0x8b,0x6e,0xec,0x7a,0xd5,0x1d,0xf0,0x96,0xa7,0x37,0x3d,0x9b,0x27,
-    0xc6,0x5c,0x18,0x8,0x4b,0x39,0x6b,0x1,0x94,0xc4,0xe0,0xf2,0xa6,0x33,0x84,0x7f,
-    0xea,0xbc,0x6b,0xf0,0x7a,0x2b,0xe3,0xb0,0x48,0xca,0x8a,0x7e,0xba,0xc7,0x6,0x3b,
-    0xb1,0xf4,0xb2,0x5c,0xc0,0xd7,0xe9,0x9,0x48,0x95,0x95,0x10,0xb6,0x40,0x87,0xb5,
-
-    // Record 86: Address = 0x3b00, Length = 128
-    0x3b00,0x80,
-    0x98,0xc0,0xed,0x9c,0xc3,0x8a,0xc3,0x6c,0x82,0x73,0x47,0xdf,0x14,0x1f,0x7b,0xb2,
-    0x24,0xa2,0x10,0xe8,0x61,0xd2,0xc6,0x69,0x3e,0xa8,0xcd,0x28,0xac,0x93,0x31,0x10,
-    0xb9,0x49,0x70,0x22,0xe2,0xc6,0x4e,0xc0,0xdb,0xd1,0xb4,0x48,0x89,0xc0,0xb7,0xa,
-    0x39,0xbb,0xea,0xfc,0x5e,0x9a,0x7a,0xd6,0xf6,0x7c,0x11,0xe9,0x3a,0xbc,0x10,0x6d,
-    0xda,0xf8,0x6c,0x20,0xbe,0x8a,0xd8,0x51,0x79,0x8f,0x24,0x1a,0xe7,0xb8,0xb4,0x3b,
-    0x1f,0xbd,0xdf,0x8b,0x4b,0xa7,0x2d,0x7a,0xf6,0x40,0x2,0xf3,0x57,0xa9,0xc9,0x6d,
-    0x47,0xe8,0x21,0x5a,0x26,0xdf,0x2c,0x4a,0xc6,0xb9,0xbc,0xb9,0x2a,0x1d,0x7c,0x50,
-    0x7b,0x31,0xaf,0x8b,0x3f,0xd8,0x2b,0xcc,0x8d,0x85,0x65,0xc2,0xc4,0xe6,0x6e,0x31,
-
-    // Record 87: Address = 0x3b80, Length = 128
-    0x3b80,0x80,
-    0xb4,0x30,0xa4,0x48,0xfe,0x4a,0xaf,0xf,0xe8,0x8d,0x24,0x46,0xc5,0xf9,0x6a,0x68,
-    0xa0,0x12,0x12,0xb,0xd2,0x92,0xe5,0x1,0x9c,0x69,0xd0,0xb3,0x34,0xc8,0xf,0xfb,
-    0xe8,0x56,0xb8,0xe4,0xf8,0x20,0x3d,0x27,0x49,0xae,0x62,0xd5,0x3b,0x99,0xa8,0xaf,
-    0xd9,0x6f,0x78,0xbd,0x78,0xa,0x9b,0x63,0x32,0xf6,0xd,0xb9,0x25,0x4b,0x27,0xdc,
-    0xf5,0xa2,0x4b,0x84,0xb5,0xfc,0x40,0x4c,0x71,0x7,0xc6,0x5c,0xd1,0x39,0x50,0xc5,
-    0x79,0x83,0xf8,0xcb,0x8e,0x22,0x22,0x1d,0x72,0x1f,0xe9,0x81,0xc9,0x94,0xa3,0x5d,
-    0x7a,0x3f,0x19,0xd4,0x96,0xb1,0xbf,0xa3,0xf3,0x8a,0x84,0xff,0x2d,0x6e,0x20,0xce,
-    0xa2,0x74,0x54,0x96,0xf2,0x73,0xc,0xbc,0xf2,0xe6,0xe2,0xac,0x63,0xc5,0x78,0x53,
-
-    // Record 88: Address = 0x3c00, Length = 128
-    0x3c00,0x80,
-    0xea,0x9,0x87,0x22,0x4,0x2d,0x58,0x8c,0x25,0x71,0xb8,0xdb,0xac,0xda,0x39,0x3f,
-    0x5b,0xd7,0xcf,0x2,0xaf,0x13,0x4c,0xdf,0x9,0xcd,0x7c,0x3f,0x59,0xf,0x8,0xd8,
-    0xbe,0xd8,0x96,0x61,0xd4,0x64,0x9d,0x51,0x56,0x71,0x10,0x28,0x1b,0xd9,0x3c,0x9e,
-    0xae,0xdb,0x10,0x20,0x65,0xf8,0xf5,0x21,0xda,0xd0,0x9f,0x21,0x2e,0xec,0xd1,0xb9,
-    0x12,0x18,0x6b,0x73,0x76,0x3d,0x42,0x8c,0x9e,0x8d,0x44,0x60,0x79,0xcc,0x53,0xd3,
-    0xf3,0xf9,0x2,0xcb,0x2a,0x14,0x54,0x49,0x50,0x8a,0x7,0xc7,0xa9,0xd3,0xf9,0x5e,
-    0x1e,0x4e,0x18,0x30,0x2d,0x61,0xa5,0x50,0xcc,0x98,0x43,0xf6,0xbd,0x8,0x1e,0x27,
-    0xe0,0xad,0xc7,0x97,0x77,0x60,0x55,0xa9,0xe5,0x4b,0x8e,0xeb,0x88,0xfa,0x5c,0xc1,
-
-    // Record 89: Address = 0x3c80, Length = 128
-    0x3c80,0x80,
-    0xa6,0xfc,0x18,0xc1,0xd7,0x33,0x3,0x5b,0xf3,0x73,0xec,0x8c,0x21,0x60,0x27,0x38,
-    0x8f,0xac,0x98,0xbe,0x85,0xec,0x8f,0x2c,0x37,0x44,0x9e,0xf,0xfa,0x43,0x4f,0xa8,
-    0x13,0xbc,0x76,0xa,0xca,0x60,0xa4,0x8d,0xe9,0x77,0x3e,0xbe,0xd6,0x73,0xb0,0x27,
-    0x95,0xea,0x75,0xd6,0xe4,0xaf,0xb9,0xda,0xae,0x4f,0x15,0x0,0x2,0x23,0x52,0xf2,
-    0xb9,0xc7,0x44,0xad,0x46,0xef,0xc8,0xdc,0x61,0x44,0xc8,0xa5,0xae,0x41,0xc4,0xe9,
-    0x77,0xf3,0x73,0x53,0xc0,0x7e,0x1d,0xe7,0xd6,0x83,0xa3,0xd9,0xc8,0x5d,0xfb,0x76,
-    0xca,0x0,0xaa,0x37,0x93,0xc2,0xaf,0xe7,0xb,0xca,0x4e,0xb9,0x8a,0x1a,0xd5,0xfc,
-    0x2d,0x8a,0xfc,0xc,0x9d,0x2e,0xd3,0x44,0x9f,0xab,0xd0,0xf7,0xe7,0x23,0x36,0x45,
-
-    // Record 90: Address = 0x3d00, Length = 128
-    0x3d00,0x80,
-    0xce,0xcd,0xb6,0xc9,0x14,0x1b,0x44,0xc8,0xf,0xdd,0x5,0xcf,0xa8,0xfb,0xca,0xe2,
-    0x9f,0x9e,0xa8,0xc4,0x1e,0x71,0xc7,0x33,0x1b,0x90,0x8a,0xd8,0x59,0xa0,0xfc,0x39,
-    0xa2,0x19,0xd8,0x41,0xe4,0x5a,0xc7,0x1e,0xb5,0x17,0x2,0xf2,0xc1,0x76,0xae,0x4e,
-    0xde,0x79,0x9,0xfc,0x81,0xc0,0x9,0x11,0x1c,0xbf,0x8b,0x26,0xef,0x54,0x9e,0x65,
-    0x65,0x66,0xdb,0x90,0x86,0xe8,0xc3,0xd0,0x19,0xe5,0xc4,0x33,0x81,0xab,0xb4,0x57,
-    0x27,0x66,0x52,0x7a,0xae,0xa0,0xd5,0xae,0xe4,0x72,0xa7,0xe7,0xb8,0x94,0xf7,0x2f,
-    0x76,0x51,0x28,0x91,0xa6,0x56,0x6a,0xe8,0x9d,0xfc,0xde,0xb8,0xa9,0x8a,0x78,0x7b,
-    0xa5,0xf5,0xe,0xae,0xa,0x50,0x43,0x8,0xbd,0xa1,0x91,0x1d,0xfe,0x4b,0x63,0xc1,
-
-    // Record 91: Address = 0x3d80, Length = 128
-    0x3d80,0x80,
-    0xec,0xeb,0xe6,0x22,0x57,0x4c,0xa5,0x0,0x60,0x21,0x47,0xfc,0xc2,0xb5,0xd8,0xac,
-    0x59,0x7e,0xb2,0x73,0xfe,0xee,0x7,0x27,0x2b,0xee,0xf5,0x8a,0xd4,0x75,0x60,0x8a,
-    0x8f,0xe9,0x53,0xd2,0x44,0x21,0xf0,0xe3,0xd3,0x39,0xd,0xa4,0xf9,0x6f,0x39,0x23,
-    0xfe,0x4b,0x17,0x89,0x2a,0x6c,0x12,0xae,0x9c,0x3a,0x38,0xa0,0x53,0x32,0xe3,0x6a,
-    0x36,0xde,0x59,0x47,0xcc,0x7b,0x81,0x41,0x59,0xf9,0x67,0x2e,0xe2,0x80,0xb8,0xa6,
-    0x77,0x94,0xbe,0xf4,0x49,0x9c,0x89,0xd0,0x5b,0xef,0xf8,0xd7,0xcb,0x1d,0x15,0xf1,
-    0xcc,0xef,0x7c,0xa2,0xd9,0xca,0x7,0xe4,0x78,0x83,0x13,0x58,0xfe,0x46,0x9c,0xa1,
-    0xc,0xe3,0x46,0x78,0x70,0xc6,0x3e,0x3b,0xaa,0x79,0x6a,0xa1,0x75,0x56,0xe7,0x8e,
-
-    // Record 92: Address = 0x3e00, Length = 128
-    0x3e00,0x80,
-    0xa6,0xb3,0x7d,0x34,0xad,0xe0,0x5a,0xf,0xf,0x17,0x66,0xea,0x7e,0x50,0x3,0x64,
-    0x75,0x1c,0x47,0x9a,0x8,0xf0,0xcd,0x10,0xed,0xa1,0x99,0x8e,0x57,0x74,0xdf,0x64,
-    0x79,0x95,0xa5,0xe4,0x36,0xb4,0x18,0xb9,0x1c,0xa,0x4,0x53,0x51,0xc1,0xb,0x9a,
-    0xd1,0x92,0x81,0x45,0xf3,0xf0,0xaf,0xf9,0xa4,0xb,0x99,0xd9,0xc9,0x5c,0xe4,0x29,
-    0xa,0x61,0x8e,0x99,0xf0,0xd4,0xc2,0x8d,0x3e,0xc5,0x4,0x77,0x21,0x93,0x85,0xab,
-    0xf1,0x68,0x81,0xb,0x17,0x87,0x37,0xad,0x32,0x61,0x39,0xea,0x9c,0x86,0x3d,0x72,
-    0xb2,0x9b,0x98,0xed,0x8c,0xdb,0x8b,0x61,0x6c,0x17,0x1b,0xc7,0x2d,0xcf,0xf7,0x3f,
-    0xa1,0xa6,0x38,0xb1,0x93,0xfb,0xc9,0x90,0x98,0x8c,0x59,0x17,0x2f,0x58,0xbc,0x6c,
-
-    // Record 93: Address = 0x3e80, Length = 128
-    0x3e80,0x80,
-    0x6c,0x9a,0x1c,0x34,0xa2,0x3f,0x7b,0x41,0xd5,0x47,0xce,0x63,0x95,0xf1,0x81,0xfa,
-    0xb1,0xcf,0x11,0xda,0x16,0x29,0x50,0xe6,0x6b,0xaf,0xdc,0x80,0x86,0xb5,0xc1,0xf4,
-    0x79,0xbe,0xc6,0x2,0xde,0x3d,0xd5,0xa0,0x49,0xbd,0xa7,0xca,0xcd,0x82,0xc0,0xe3,
-    0xa5,0x97,0x5f,0xf6,0x4e,0x4d,0xea,0xce,0xcd,0x4a,0x3,0x22,0x4,0x3e,0x62,0x75,
-    0x48,0x8f,0xe8,0x41,0x4,0xdc,0xbf,0xe7,0x47,0x19,0x96,0x3c,0x98,0x56,0x38,0x5b,
-    0xee,0x64,0x44,0x7f,0x59,0x55,0x15,0xd0,0xd8,0x7f,0xb3,0x19,0x3,0x29,0x30,0xf1,
-    0x6d,0x44,0x75,0x97,0xfb,0x86,0x38,0x38,0x26,0xc9,0xa4,0xdc,0xc0,0x46,0x9b,0xdc,
-    0xc1,0x89,0x5a,0x34,0x79,0x7b,0xab,0xb7,0x3e,0xce,0x65,0x69,0x43,0x19,0x20,0x50,
-
-    // Record 94: Address = 0x3f00, Length = 128
-    0x3f00,0x80,
-    0x39,0x9a,0x1d,0x92,0xb7,0x1a,0x79,0xf5,0x30,0x2a,0x65,0x32,0xe5,0x8a,0x53,0xc8,
-    0xd8,0xeb,0xe5,0x76,0xc6,0xf6,0xa1,0x30,0xbb,0x86,0xe0,0xb7,0x99,0xa2,0xd2,0xbc,
-    0x3a,0xeb,0x4d,0xbb,0xcf,0x84,0x8c,0xb3,0x60,0xb4,0x26,0xc7,0xf9,0x16,0xc0,0xc7,
-    0xd1,0x97,0x3f,0x52,0xa6,0x36,0xd5,0x5e,0xa3,0xdc,0x8,0x39,0x3b,0xad,0x7c,0xbe,
-    0x74,0xae,0x11,0x9c,0x7,0xa3,0xb2,0x3f,0xda,0xde,0xbe,0xbe,0xa6,0xc2,0xa2,0xef,
-    0xb2,0xa7,0x5c,0x82,0x29,0xec,0x70,0x66,0xc0,0x9d,0x58,0x5c,0xee,0x85,0x2f,0xad,
-    0xc4,0xeb,0x5c,0x7e,0x92,0xec,0xfb,0x8d,0x2,0x64,0xb6,0xc3,0x72,0xd2,0xc9,0x8d,
-    0x81,0x23,0x31,0x8e,0xb3,0xc6,0x48,0x20,0x65,0x54,0xa5,0xfa,0xf1,0x56,0x83,0xc1,
-
-    // Record 95: Address = 0x3f80, Length = 128
-    0x3f80,0x80,
-    0x3f,0xac,0x87,0x32,0xbf,0xaa,0x91,0xa8,0x76,0xf8,0x26,0xcf,0x6d,0xd8,0x6a,0x47,
-    0x9c,0x79,0x12,0xc8,0x7f,0x95,0xed,0xf9,0xaf,0x5d,0xf4,0x58,0x82,0x67,0x22,0x46,
-    0x2a,0x91,0xfc,0x68,0xc6,0xf5,0x1d,0x70,0xf3,0x18,0x8b,0xc4,0xa9,0xb5,0x71,0x9b,
-    0xf5,0x61,0xfd,0xb2,0xee,0x14,0x82,0x70,0x28,0x3b,0x69,0xa6,0x7c,0x87,0xe6,0x8b,
-    0x61,0xd6,0x98,0x32,0x65,0x96,0x45,0x2e,0xe2,0xfb,0xea,0x85,0x15,0x43,0xcc,0x3a,
-    0xb6,0xfb,0x79,0xe7,0xdf,0xfc,0x14,0x1e,0x27,0xc8,0xba,0x71,0xd0,0x1f,0x51,0x11,
-    0x84,0x18,0xde,0xbe,0x4,0x24,0xcb,0x45,0xaf,0x2d,0x69,0xbe,0xad,0x34,0x6,0x36,
-    0x53,0xd5,0x10,0x31,0x9f,0x6b,0xf3,0x82,0xda,0xbd,0x11,0x88,0x5e,0x30,0xd,0x15,
-
-    // Record 96: Address = 0x4000, Length = 128
-    0x4000,0x80,
-    0xf5,0x16,0x94,0xb6,0x99,0x8c,0xbc,0x7e,0x14,0xae,0x48,0x4f,0xb9,0xd6,0x8c,0x77,
-    0xc9,0xc0,0xa0,0xbf,0xff,0x80,0xff,0x63,0xca,0xaa,0xb4,0xf4,0x6,0x1,0x8d,0x10,
-    0xb6,0x5,0x2c,0xa3,0xe7,0x22,0x26,0x5a,0xab,0xb2,0xd7,0xa6,0x11,0x2,0x3c,0xe6,
-    0x15,0x69,0xde,0x6b,0x5,0xba,0x8b,0x3e,0xb2,0x6f,0x39,0x5,0x58,0xe,0x79,0x4,
-    0xa6,0x75,0x36,0xc,0xfa,0x31,0xb,0xd4,0xca,0x5c,0xdc,0x7,0xd,0x2a,0x1a,0xc5,
-    0xa1,0x24,0xf0,0x10,0x13,0xeb,0xce,0x83,0xef,0xea,0x8a,0x2a,0xb4,0x20,0x45,0x8e,
-    0xd5,0xed,0x67,0x13,0xf2,0x1,0xb8,0xd3,0x9a,0x50,0xb,0xeb,0xbc,0x38,0x5d,0x2a,
-    0x6a,0x18,0xab,0xe6,0x37,0xa8,0x24,0x57,0xf,0x13,0x37,0x35,0x33,0x18,0xc7,0xf4,
-
-    // Record 97: Address = 0x4080, Length = 128
-    0x4080,0x80,
-    0x17,0x42,0xd8,0x49,0xf9,0x32,0x82,0x54,0xd2,0xf6,0xd2,0x95,0xa7,0x56,0x2c,0xba,
-    0x8d,0xf9,0xe,0xb6,0x71,0xbf,0x79,0xc7,0x58,0x1f,0x6f,0xd3,0x27,0x8f,0xfa,0x59,
-    0x31,0x5d,0xaa,0x7d,0x54,0x79,0x46,0xce,0xd4,0x50,0x76,0x88,0xd0,0x6c,0xe0,0x74,
-    0xb0,0xe4,0x20,0xf5,0xdf,0xd0,0x5a,0x16,0x89,0x40,0x8a,0x69,0xf0,0x2f,0x4f,0xbc,
-    0xb2,0x95,0xfe,0x30,0x74,0xda,0x93,0x1a,0xe5,0xfa,0xda,0xae,0xfc,0x68,0xb7,0xd1,
-    0x9f,0x35,0x65,0xf4,0x59,0x48,0x87,0x0,0x79,0xb1,0x41,0xc8,0xa6,0xca,0x42,0x91,
-    0xfe,0x21,0x3b,0xc2,0x26,0x60,0xf0,0x9a,0xa6,0xa8,0xca,0x5f,0x93,0x81,0x3,0xa8,
-    0xfe,0x25,0x87,0xff,0xb2,0xb2,0x16,0x69,0xb2,0x4d,0x38,0xfa,0x3b,0x1f,0x3b,0xb8,
-
-    // Record 98: Address = 0x4100, Length = 128
-    0x4100,0x80,
-    0x53,0xbb,0xa5,0x44,0x9,0xc1,0x35,0x32,0x1,0xb1,0xfd,0x9e,0x83,0x32,0x7a,0x8a,
-    0x63,0xbd,0xee,0xd0,0xce,0x81,0x9d,0x47,0xe0,0x39,0x4c,0x94,0x26,0x3,0xeb,0xe5,
-    0xd5,0xd1,0xee,0x0,0x87,0xb,0x8,0xaf,0xbf,0x8c,0xad,0x55,0xbb,0xee,0x6d,0x95,
-    0x40,0xa,0x33,0x6c,0xfe,0x64,0xc9,0xda,0x2a,0xde,0x49,0x79,0x3e,0x2a,0xe6,0x12,
-    0x68,0xde,0x7c,0xc2,0xab,0x30,0xe9,0xb,0x80,0x9c,0x29,0xc3,0x10,0x81,0xf7,0x1e,
-    0xbf,0x6c,0x5c,0xee,0x43,0xae,0x82,0xc5,0xcb,0xcf,0xf5,0x65,0xc8,0x7c,0xcd,0xb8,
-    0x1d,0x1,0x79,0x61,0x21,0xe7,0x0,0x42,0x47,0xee,0x2c,0xdc,0x68,0x50,0x4c,0xa5,
-    0x1e,0xd2,0x58,0x59,0x80,0xbc,0xc1,0x2,0x83,0x14,0x70,0x10,0x3c,0xa6,0xb9,0xf1,
-
-    // Record 99: Address = 0x4180, Length = 128
-    0x4180,0x80,
-    0x87,0x50,0xeb,0x30,0x99,0x29,0xe0,0xbd,0x94,0x79,0x2e,0x4f,0xd0,0x3e,0x6c,0x92,
-    0xf1,0x39,0x1d,0x54,0x32,0x8,0x47,0x3,0xde,0xb6,0xb7,0xec,0x4d,0x18,0xd0,0x2a,
-    0xe3,0x60,0x45,0xf3,0x65,0x23,0x56,0x96,0xb6,0x79,0xcb,0xe8,0xd0,0xe1,0x93,0x9a,
-    0x43,0xac,0x71,0xc6,0xa8,0x8d,0x7f,0x13,0xdd,0xaa,0xf8,0x50,0x6,0xb3,0xa6,0x65,
-    0xdb,0xa9,0xc5,0xa7,0x8f,0xc3,0xa7,0xef,0x5f,0xf3,0x9c,0xb7,0x5f,0x56,0x76,0x2c,
-    0x33,0x9d,0x4e,0x6c,0x75,0x5d,0xa3,0xfa,0x26,0xb5,0xe7,0xbe,0x7f,0x96,0x73,0x1f,
-    0x61,0xe3,0x17,0xb5,0x83,0x4a,0x11,0x9d,0xca,0x9,0xd8,0x2e,0xb7,0x3a,0x72,0xb4,
-    0x79,0x2e,0xb2,0x73,0xb0,0x9d,0x88,0xdb,0x64,0x3e,0xb,0xb7,0x62,0xda,0x63,0xf8,
-
-    // Record 100: Address = 0x4200, Length = 128
-    0x4200,0x80,
-    0x9,0x43,0xca,0x24,0xda,0xa7,0xe2,0x97,0x63,0x88,0xf1,0x5a,0x3c,0x78,0xf0,0xe3,
-    0xea,0xd8,0x40,0x2b,0x26,0x44,0xcc,0xe1,0xca,0x2e,0xda,0x16,0xb6,0x38,0x57,0x4e,
-    0xa7,0xbc,0x94,0x2f,0x4c,0x9d,0x15,0x41,0x85,0xec,0xb7,0x90,0xec,0x56,0xc5,0x1d,
-    0x4f,0xc,0xe9,0x94,0x9,0xf2,0xcb,0x62,0xc3,0x85,0xfe,0x66,0xaf,0x8c,0xc5,0x35,
-    0xf1,0x8f,0xc6,0xfc,0x56,0xa0,0x32,0xfd,0x41,0x33,0x74,0xe9,0x68,0x30,0xc6,0x44,
-    0x3d,0x5,0x19,0x4f,0xbb,0x6b,0x76,0x61,0xd4,0x22,0xd6,0x22,0xa7,0x8e,0x53,0x87,
-    0x33,0xfe,0xd1,0x36,0xac,0x6d,0x54,0x57,0x41,0x4,0xd8,0xc2,0x5b,0xf8,0xfa,0x6f,
-    0x84,0x7f,0x52,0x25,0x4e,0xec,0x30,0x52,0xd4,0xce,0xc2,0x2f,0x32,0xd0,0xd1,0x98,
-
-    // Record 101: Address = 0x4280, Length = 128
-    0x4280,0x80,
-    0x4e,0x3d,0x0,0xc0,0xd4,0xa9,0xce,0xbe,0xcf,0x4,0x8f,0x23,0x68,0x54,0x63,0xd0,
-    0xff,0x82,0xa3,0x43,0x7a,0x52,0xa2,0xda,0x4,0x11,0x5a,0xf2,0x4d,0xbe,0xc5,0xae,
-    0xe,0x10,0x91,0xfb,0x23,0x9b,0x29,0x76,0x6b,0x53,0x36,0xc9,0x1f,0x6,0x98,0xc7,
-    0x1,0xf2,0x9b,0x73,0x7f,0x1a,0xcf,0x7d,0xb4,0x70,0xe1,0xa2,0x28,0x68,0x5c,0xaa,
-    0xd8,0xf5,0x57,0x3c,0xb2,0x52,0xdc,0x28,0x33,0xaf,0x99,0x84,0xfe,0xa4,0x85,0xda,
-    0xa0,0x99,0xe4,0xab,0xf4,0x44,0x1e,0xf8,0xc6,0x80,0x1a,0x44,0x8b,0x31,0x8d,0x32,
-    0x52,0xd3,0x39,0xcc,0xbc,0xfc,0xe9,0x58,0x6c,0x98,0xf,0xf3,0x25,0x34,0x55,0x0,
-    0x3c,0x94,0x84,0xe2,0xaa,0xe3,0xa5,0xea,0xb2,0xac,0xb3,0xea,0x56,0xb4,0x5d,0xa1,
-
-    // Record 102: Address = 0x4300, Length = 128
-    0x4300,0x80,
-    0x9e,0x62,0xbf,0xb9,0xa0,0xc4,0xad,0xc2,0xd,0x9b,0xf3,0x31,0x51,0xba,0x10,0x83,
-    0x93,0x4c,0x36,0x58,0x72,0x3e,0xf1,0xc4,0xb7,0x78,0xe7,0xf4,0x7f,0xcf,0x92,0x3d,
-    0x6b,0x84,0x1c,0xb2,0x8,0x6c,0x51,0xe9,0x67,0x4e,0xf1,0x14,0x5f,0xff,0x30,0x5,
-    0xa6,0xb5,0xb,0x7a,0x1a,0xb6,0x73,0x34,0xc2,0xe7,0x26,0x61,0x74,0x4c,0x83,0x3,
-    0xe1,0xd7,0x3,0x88,0x53,0x48,0x6b,0x70,0x6a,0xf5,0xf8,0x64,0x23,0x15,0x4e,0xf,
-    0xd8,0x71,0xfe,0xd,0xfb,0x95,0xab,0x64,0xc4,0xb6,0x70,0x62,0x80,0x67,0x41,0x98,
-    0xbd,0x89,0x76,0x11,0xf4,0x74,0x46,0xe7,0xc8,0x44,0xf8,0xe2,0x1b,0x22,0x61,0x80,
-    0xa8,0x89,0xcf,0x36,0xc3,0x8f,0x90,0xe9,0xea,0xcd,0xd4,0x48,0xb3,0xf9,0x3d,0x7e,
-
-    // Record 103: Address = 0x4380, Length = 128
-    0x4380,0x80,
-    0x2d,0x57,0x82,0x2f,0x6e,0xfb,0x53,0xac,0x6b,0x7a,0x67,0x79,0x66,0xf4,0xa9,0x9a,
-    0xff,0xe7,0xcd,0x76,0x75,0xd4,0xd5,0x77,0xaf,0xe4,0x5e,0x42,0x83,0xcc,0x1c,0xd6,
-    0x1d,0xa2,0xd1,0x83,0x8d,0x18,0x56,0x6,0xf8,0x2d,0x83,0x91,0x93,0xe4,0x32,0xda,
-    0x4,0xaf,0xa4,0xcf,0x8,0xd9,0x1c,0x71,0x33,0x48,0x22,0x9a,0xf8,0xfb,0x1c,0x1f,
-    0x7f,0x3b,0x6d,0x20,0x23,0x67,0x17,0x5a,0xb5,0xb6,0x65,0xd,0x90,0x7f,0x91,0xf0,
-    0xda,0xa7,0x3a,0x4d,0x2,0x66,0xd2,0x6c,0x8a,0xc,0x5e,0x47,0x97,0x3c,0xb1,0x85,
-    0x40,0x45,0xd7,0x16,0x84,0x2d,0x31,0x6f,0x1a,0xfc,0x46,0x1b,0xb0,0x42,0xb,0x53,
-    0x74,0xd6,0x5d,0xc8,0x23,0x46,0x87,0x88,0xf8,0x2c,0x51,0x3,0x9d,0x43,0x3c,0x13,
-
-    // Record 104: Address = 0x4400, Length = 128
-    0x4400,0x80,
-    0x38,0xf0,0x96,0x4f,0x57,0xfb,0xe7,0x92,0x5,0xf0,0x32,0xa6,0xd5,0xa2,0x8e,0xeb,
-    0x38,0xae,0x24,0xd,0xb7,0xc8,0x3b,0xe6,0x97,0xb8,0x9,0xdb,0xf2,0xa0,0x76,0xd0,
-    0x51,0x40,0x9c,0x20,0x40,0x4f,0x31,0x15,0x3f,0x81,0x4e,0x3c,0xa7,0x6f,0x2e,0xcd,
-    0x12,0x22,0x28,0x68,0xc0,0xaa,0xc,0x4a,0x34,0x2e,0x1d,0xe3,0x3a,0xb8,0x35,0x8d,
-    0x68,0x91,0x34,0x4a,0x3d,0x63,0xb,0x34,0x9d,0x16,0x4c,0xf3,0x32,0x79,0xcb,0xd0,
-    0x69,0x46,0x2a,0x9a,0x95,0xab,0x93,0x17,0x36,0xe5,0xf3,0xf3,0x11,0x5e,0x6a,0xdd,
-    0xef,0xa,0x8c,0x19,0x98,0x50,0xec,0xd0,0xc4,0xff,0x38,0xa1,0x7c,0x3e,0x4e,0xf4,
-    0xd6,0xe3,0x8e,0xde,0x35,0x27,0xaa,0x37,0x6a,0xa3,0x4e,0xe2,0xc3,0x7f,0x6c,0x22,
-
-    // Record 105: Address = 0x4480, Length = 128
-    0x4480,0x80,
-    0xa8,0x1,0xa7,0x58,0xd8,0x20,0x72,0x86,0x12,0xa8,0x96,0x17,0x69,0xcb,0xcf,0x8b,
-    0x2b,0x92,0xf2,0x89,0x7a,0x2e,0x55,0x98,0x49,0x54,0x8,0x7a,0x9f,0x47,0xe3,0x3b,
-    0xb,0x9b,0xdb,0x2,0x4b,0x75,0x6f,0x5e,0xb6,0x50,0x6d,0x85,0xb3,0x1f,0x80,0xc8,
-    0xdc,0x6f,0xc5,0xa8,0x55,0x7f,0x63,0x84,0x73,0xca,0x15,0x89,0x1d,0xf7,0xc8,0x53,
-    0xba,0x3b,0x9,0x2a,0xbe,0xbb,0x38,0x1c,0x9e,0xb7,0x79,0x2,0x85,0xf0,0xbf,0xa,
-    0x8e,0x87,0x52,0x63,0xd7,0xa5,0x76,0x50,0xbf,0x78,0x64,0x91,0x8f,0x1b,0x30,0xd1,
-    0x3,0xd7,0x28,0x75,0x64,0xf,0x8,0xcd,0x46,0x62,0x2d,0xde,0x90,0x7d,0x79,0xc9,
-    0xfa,0x49,0x38,0xe2,0x7a,0xb8,0x7d,0x37,0x47,0xf1,0xd9,0xe5,0xb,0xfe,0xe,0x3e,
-
-    // Record 106: Address = 0x4500, Length = 128
-    0x4500,0x80,
-    0x93,0x18,0x93,0xad,0x1,0x38,0xd3,0xbe,0x23,0xf4,0xf2,0x46,0x3a,0xed,0x70,0x98,
-    0x6d,0x41,0x1,0x56,0x6a,0xa0,0x41,0x42,0x2f,0x52,0x57,0x3b,0x2e,0x9d,0x37,0xc1,
-    0xc5,0xa,0xf5,0xe5,0x5b,0xdf,0x51,0xb6,0x6b,0x78,0xf4,0x1c,0x92,0xe8,0xf6,0x26,
-    0x4f,0x98,0x3b,0x2a,0x83,0x9,0x58,0xd6,0xad,0xed,0x16,0x9d,0x6e,0x6b,0x36,0x16,
-    0x3,0x1f,0x43,0x78,0x3,0x44,0xbc,0xf1,0xeb,0xa,0x9f,0xb8,0x13,0xca,0x21,0xb0,
-    0x16,0x64,0x4b,0x45,0x4c,0xa0,0xef,0xa5,0xb5,0xd2,0xb8,0x18,0x87,0x2b,0x9a,0x4c,
-    0x83,0xed,0x3c,0x4d,0x87,0xf2,0xe7,0x6d,0x24,0xef,0x1e,0x6a,0x25,0x75,0x35,0xa7,
-    0xf1,0x74,0x36,0x26,0xc6,0xce,0xad,0x3d,0x5a,0x49,0xec,0xc0,0xcb,0x56,0xd3,0x83,
-
-    // Record 107: Address = 0x4580, Length = 128
-    0x4580,0x80,
-    0x39,0xa2,0x72,0x1f,0xe6,0x77,0x50,0xf7,0x13,0x34,0x26,0x39,0xdc,0x62,0x10,0xf0,
-    0x4e,0xe8,0x12,0x4c,0x2,0xfc,0xeb,0x11,0xe4,0xed,0x87,0x66,0xa5,0xc,0xd6,0x4a,
-    0xb6,0xd4,0xf4,0xa7,0x6,0x6a,0x67,0xe,0xad,0xf7,0x43,0x69,0x2f,0x3c,0x39,0xb8,
-    0xfe,0x0,0xdb,0x19,0xc,0xa7,0x8,0xd0,0x92,0x4d,0x33,0xca,0xa7,0x45,0xfc,0xd1,
-    0xe0,0x36,0x2,0x9a,0x51,0xc7,0x2a,0x83,0xa2,0xc1,0x5c,0xcd,0xfb,0x73,0xe8,0x8d,
-    0x56,0x2c,0xce,0x66,0x41,0x91,0xff,0x4e,0xad,0x30,0x0,0x18,0xe7,0xd5,0xc2,0x4,
-    0x2,0x63,0x20,0x15,0xb7,0x80,0x76,0x25,0x42,0x65,0xeb,0xf2,0x9,0xf9,0x38,0x12,
-    0x90,0xfc,0xe5,0xf1,0xcd,0x41,0xfa,0xfa,0xff,0x55,0x6c,0x7e,0x10,0xe6,0x2b,0x7c,
-
-    // Record 108: Address = 0x4600, Length = 96
-    0x4600,0x60,
-    0xf6,0x34,0x41,0x27,0x6f,0x4a,0xf6,0x95,0xb7,0xdb,0xf8,0x89,0xfb,0x42,0x67,0xfe,
-    0xc8,0x53,0xbb,0x53,0xad,0x12,0x24,0xba,0xd3,0xfd,0x6d,0x7b,0xff,0xfc,0xb8,0x34,
-    0xd8,0xe6,0x93,0x29,0x7e,0x85,0xeb,0x65,0x8b,0x27,0xd7,0xea,0x84,0x71,0x0,0xa2,
-    0x20,0x88,0xdd,0xa4,0x52,0xcb,0x4b,0x57,0x1d,0xc1,0xd6,0xa9,0x14,0x30,0xc,0x38,
-    0xc9,0xe2,0x9b,0xfd,0xb2,0xb4,0x44,0x26,0x30,0x5a,0x19,0xbf,0xe7,0x8,0xae,0xe6,
-    0x70,0x9d,0xdb,0x6,0x28,0xe3,0x17,0xa9,0xb0,0x75,0x7c,0xb8,0x99,0xf3,0x23,0xb7,
-    0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-    0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,
-};
@@ -25,127 +25,479 @@
 
 #include <gestic_api.h>
 
+#include <pthread.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#include <time.h>
+#include <unistd.h>
 
 #define stricmp strcasecmp
 
-// Declaration of Library and Loader
-// NOTE:
-//    The structure of those variables is compatible with gestic_flash_image_t
-//    Therefore we declare them here directly as gestic_flash_image_t to avoid
-//    a redeclaration of the type and later cast
-extern gestic_flash_image_t Library;
-extern gestic_flash_image_t Loader;
+// Devices that are flashed concurrently with -d
+#define MAX_DEVICES 32
 
-int flash(gestic_t *gestic, gestic_flash_image_t *image, gestic_UpdateFunction_t mode)
+// Library and Loader as loaded from the .enz archive
+static gestic_flash_image_t *Library;
+static gestic_flash_image_t *Loader;
+
+static double now_ms(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000.0 + ts.tv_nsec / 1e6;
+}
+
+static void CDECL progress(void *opaque, int done, int total)
+{
+    (void)opaque;
+
+    printf("\rWritten %d of %d records", done, total);
+    if(done == total)
+        printf("\n");
+    fflush(stdout);
+}
+
+/* Returns the record the journal would resume the image at or 0 */
+static int journal_position(const char *journal, gestic_flash_image_t *image)
+{
+    gestic_flash_journal_t state;
+    FILE *file = journal ? fopen(journal, "rb") : NULL;
+    int found;
+
+    if(!file)
+        return 0;
+    found = fread(&state, sizeof(state), 1, file) == 1 &&
+            state.image_hash == gestic_flash_image_hash(image);
+    fclose(file);
+
+    return found ? state.acked : 0;
+}
+
+int flash(gestic_t *gestic, gestic_flash_image_t *image,
+          gestic_UpdateFunction_t mode, const char *journal)
 {
     const unsigned int session_id = 1;
-    int i = 0;
-    gestic_flash_record_t *record;
+    double start = now_ms();
+    int error;
 
-    /* Start flash-session */
-    if(gestic_flash_begin(gestic, session_id, image->iv, mode, 100) < 0) {
-        fprintf(stderr, "Could not start flashing.\n");
+    /* Runs the whole session with the window set by gestic_set_flash_window */
+    if(journal)
+        error = gestic_flash_resume_file(gestic, image, mode, journal, 3, 100);
+    else
+        error = gestic_flash_image(gestic, session_id, image, mode, 100);
+    if(error < 0) {
+        fprintf(stderr, "\nCould not flash image.\n");
         return -1;
     }
 
-    /* Write records */
-    for(i = 0; i < image->record_count; ++i) {
-        record = image->data + i;
-        printf("Writing to 0x%04x\n", record->address);
-        if(gestic_flash_write(gestic, record->address, record->length,
-                              record->data, mode, 100) < 0)
-        {
-            fprintf(stderr, "Could not flash data at address %d.\n",
-                    record->address);
-            return -1;
+    printf("Flashing completed successfully.\n");
+    printf("%d records in %.1f ms.\n", image->record_count, now_ms() - start);
+
+    return 0;
+}
+
+typedef enum {
+    device_pending,
+    device_opening,
+    device_verifying,
+    device_loader,
+    device_loader_update,
+    device_library,
+    device_up_to_date,
+    device_flashed,
+    device_failed
+} device_state_t;
+
+static const char *device_state_names[] = {
+    "pending", "opening", "verifying", "flashing loader", "updating loader",
+    "flashing library", "up to date", "flashed", "failed"
+};
+
+/* State of one device of a multi-device run. The fields below lock are
+ * written by the thread of the device and read by main while holding it.
+ */
+typedef struct {
+    const char *uri;
+    char journal[256];
+    int verify;
+    int window;
+    pthread_t thread;
+    pthread_mutex_t *lock;
+    device_state_t state;
+    int done;
+    int total;
+    int error;
+    double time;
+} device_t;
+
+static void device_set_state(device_t *device, device_state_t state) {
+    pthread_mutex_lock(device->lock);
+    device->state = state;
+    device->done = 0;
+    device->total = 0;
+    pthread_mutex_unlock(device->lock);
+}
+
+static void CDECL device_progress(void *opaque, int done, int total)
+{
+    device_t *device = (device_t *)opaque;
+
+    pthread_mutex_lock(device->lock);
+    device->done = done;
+    device->total = total;
+    pthread_mutex_unlock(device->lock);
+}
+
+static int device_flash(gestic_t *gestic, gestic_flash_image_t *image,
+                        const char *journal)
+{
+    if(journal)
+        return gestic_flash_resume_file(gestic, image,
+                                        gestic_UpdateFunction_ProgramFlash,
+                                        journal, 3, 100);
+    return gestic_flash_image(gestic, 1, image,
+                              gestic_UpdateFunction_ProgramFlash, 100);
+}
+
+/* Runs the same steps as the single device update in main without asking.
+ * Every device has its own instance and the images are shared read-only.
+ */
+static void *device_run(void *opaque)
+{
+    device_t *device = (device_t *)opaque;
+    const char *journal = device->journal[0] ? device->journal : NULL;
+    gestic_t *gestic = gestic_create();
+    double start = now_ms();
+    char version[120];
+    int matches = 0;
+    int resume;
+    int error;
+
+    gestic_initialize(gestic);
+    gestic_set_flash_window(gestic, device->window);
+    gestic_set_flash_progress(gestic, device_progress, device);
+    resume = journal_position(journal, Library);
+
+    device_set_state(device, device_opening);
+    error = gestic_open_uri(gestic, device->uri);
+    if(!error) {
+        if(device->verify && !resume) {
+            device_set_state(device, device_verifying);
+            error = gestic_query_fw_version(gestic, version, sizeof(version),
+                                            100);
+            version[119] = '\0';
+            matches = !error && !strncmp(version,
+                                         (const char *)Library->fw_version,
+                                         sizeof(version));
+            if(!error && !matches)
+                error = gestic_flash_verify(gestic, 1, Library, &matches, 100);
+        }
+        if(!error && !matches && !resume) {
+            device_set_state(device, device_loader);
+            error = device_flash(gestic, Loader, journal);
+            if(!error) {
+                device_set_state(device, device_loader_update);
+                error = gestic_flash_wait_loader_updated(gestic, 20000);
+            }
+        }
+        if(!error && !matches) {
+            device_set_state(device, device_library);
+            error = device_flash(gestic, Library, journal);
+        }
+        gestic_close(gestic);
+    }
+    gestic_cleanup(gestic);
+    gestic_free(gestic);
+
+    pthread_mutex_lock(device->lock);
+    device->error = error;
+    device->state = error ? device_failed :
+                    matches ? device_up_to_date : device_flashed;
+    device->time = now_ms() - start;
+    pthread_mutex_unlock(device->lock);
+
+    return NULL;
+}
+
+/* Flashes all devices concurrently, reports every change of their state
+ * and returns the count of devices that failed.
+ */
+static int flash_devices(device_t *devices, int count)
+{
+    pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+    device_state_t shown[MAX_DEVICES];
+    int started[MAX_DEVICES];
+    int results[device_failed + 1];
+    double start = now_ms();
+    int finished = 0;
+    int i;
+
+    for(i = 0; i < count; ++i) {
+        devices[i].lock = &lock;
+        devices[i].state = device_pending;
+        shown[i] = device_pending;
+        started[i] = !pthread_create(&devices[i].thread, NULL, device_run,
+                                     &devices[i]);
+        if(!started[i]) {
+            devices[i].state = device_failed;
+            devices[i].error = GESTIC_IO_ERROR;
         }
     }
 
-    /* Finish flash-session */
-    if(gestic_flash_end(gestic, image->fw_version, 100) < 0) {
-        fprintf(stderr, "Could not finish flashing.\n");
-        return -1;
+    while(finished < count) {
+        usleep(100000);
+        finished = 0;
+        pthread_mutex_lock(&lock);
+        for(i = 0; i < count; ++i) {
+            if(devices[i].state != shown[i]) {
+                shown[i] = devices[i].state;
+                printf("%2d %-32s %s\n", i, devices[i].uri,
+                       device_state_names[shown[i]]);
+            }
+            if(shown[i] >= device_up_to_date)
+                ++finished;
+        }
+        pthread_mutex_unlock(&lock);
+        fflush(stdout);
     }
 
-    printf("Flashing completed successfully.\n");
+    memset(results, 0, sizeof(results));
+    printf("\n%2s %-32s %-12s %10s  %s\n", "#", "Device", "Result", "Time",
+           "Error");
+    for(i = 0; i < count; ++i) {
+        if(started[i])
+            pthread_join(devices[i].thread, NULL);
+        ++results[devices[i].state];
+        printf("%2d %-32s %-12s %7.1f ms  %d\n", i, devices[i].uri,
+               device_state_names[devices[i].state], devices[i].time,
+               devices[i].error);
+    }
+    printf("\n%d flashed, %d up to date, %d failed in %.1f ms.\n",
+           results[device_flashed], results[device_up_to_date],
+           results[device_failed], now_ms() - start);
 
-    return 0;
+    return results[device_failed];
 }
 
-int main()
+static int confirmed(int yes) {
+    char confirm[80];
+
+    if(yes)
+        return 1;
+
+    printf("Do you really want to flash the new images (yes,no)? ");
+    fflush(stdout);
+    if(!fgets(confirm, sizeof(confirm), stdin))
+        return 0;
+
+    return !stricmp(confirm, "yes\n") || !stricmp(confirm, "y\n");
+}
+
+static void cleanup(gestic_t *gestic) {
+    gestic_cleanup(gestic);
+    gestic_free(gestic);
+    gestic_free_flash_image(Library);
+    gestic_free_flash_image(Loader);
+}
+
+static int load(const char *path, const char *name,
+                gestic_flash_image_t **image)
+{
+    int error = gestic_load_enz(path, name, image);
+
+    if(error < 0)
+        fprintf(stderr, "Could not load %s from %s (%d).\n", name, path, error);
+
+    return error;
+}
+
+int main(int argc, char *argv[])
 {
     gestic_t *gestic = gestic_create();
+    static device_t devices[MAX_DEVICES];
+    const char *enz = NULL;
     char version[120];
-    char confirm[80];
+    const char *journal = NULL;
+    int count = 0;
+    int failed;
+    int resume = 0;
+    int verify = 0;
+    int matches;
+    int window = 1;
+    int yes = 0;
+    double start;
+    int i;
+
+    for(i = 1; i < argc; ++i) {
+        if(!strcmp(argv[i], "-y")) {
+            yes = 1;
+        } else if(!strcmp(argv[i], "-w") && i + 1 < argc) {
+            window = atoi(argv[++i]);
+        } else if(!strcmp(argv[i], "-j") && i + 1 < argc) {
+            journal = argv[++i];
+        } else if(!strcmp(argv[i], "-v")) {
+            verify = 1;
+        } else if(!strcmp(argv[i], "-d") && i + 1 < argc &&
+                  count < MAX_DEVICES)
+        {
+            devices[count++].uri = argv[++i];
+        } else if(argv[i][0] != '-' && !enz) {
+            enz = argv[i];
+        } else {
+            enz = NULL;
+            break;
+        }
+    }
+    if(!enz) {
+        fprintf(stderr, "Usage: %s [-y] [-v] [-w window] [-j journal] "
+                "[-d uri]... firmware.enz\n\n"
+                "  -y          Flash without asking\n"
+                "  -v          Skip the update when the library is running\n"
+                "              already or verifies against the flash\n"
+                "  -w window   Records in flight before waiting for the\n"
+                "              responses (default 1)\n"
+                "  -j journal  Resume an interrupted update recorded in the\n"
+                "              journal file and retry failed sessions\n"
+                "  -d uri      Device to flash instead of the default one.\n"
+                "              Up to %d devices are flashed concurrently,\n"
+                "              each with the journal file suffixed by .N\n",
+                argv[0], MAX_DEVICES);
+        gestic_free(gestic);
+        return 1;
+    }
 
     printf("GestIC-ENC-Flash Demo version %s\n\n", gestic_version_str());
 
     /* Initialize all variables and required resources of gestic */
     gestic_initialize(gestic);
+    gestic_set_flash_window(gestic, window);
+    gestic_set_flash_progress(gestic, progress, NULL);
+
+    /* Read both images straight from the archive */
+    if(load(enz, "Loader.enc", &Loader) < 0 ||
+       load(enz, "Library.enc", &Library) < 0)
+    {
+        cleanup(gestic);
+        return -1;
+    }
+
+    if(count > 1) {
+        printf("[ GestIC Library ]\n\n"
+               "To be flashed on %d devices:\n%s\n\n"
+               "[ GestIC Library Loader\n\n"
+               "To be flashed:\n%s\n\n",
+               count, Library->fw_version, Loader->fw_version);
+        if(!confirmed(yes)) {
+            cleanup(gestic);
+            return 0;
+        }
+
+        for(i = 0; i < count; ++i) {
+            devices[i].verify = verify;
+            devices[i].window = window;
+            if(journal)
+                snprintf(devices[i].journal, sizeof(devices[i].journal),
+                         "%s.%d", journal, i);
+        }
+        failed = flash_devices(devices, count);
+        cleanup(gestic);
+        return failed ? -1 : 0;
+    }
+
+    /* The loader is complete when the journal belongs to the library */
+    resume = journal_position(journal, Library);
 
     /* Try to open a connection to the device */
-    if(gestic_open(gestic) < 0) {
+    if((count ? gestic_open_uri(gestic, devices[0].uri)
+              : gestic_open(gestic)) < 0)
+    {
         fprintf(stderr, "Could not open connection to device.\n");
-        gestic_cleanup(gestic);
-        gestic_free(gestic);
+        cleanup(gestic);
         return -1;
     }
 
     /* Read the running firmware version */
+    start = now_ms();
     if(gestic_query_fw_version(gestic, version, sizeof(version), 100) < 0) {
         fprintf(stderr, "Could not read running firmware version.\n");
 #ifndef ON_ERROR_RESUME_NEXT
-        gestic_cleanup(gestic);
-        gestic_free(gestic);
-        return -1;
+        /* A device in the middle of an update might not tell */
+        if(!resume) {
+            cleanup(gestic);
+            return -1;
+        }
 #endif
+        strcpy(version, "unknown");
     }
     /* The version should already include an terminating \0 but
      * as it was get via IO from external source we take extra care.
      */
     version[119] = '\0';
 
+    if(verify && !resume) {
+        printf("Version checked in %.1f ms.\n", now_ms() - start);
+        matches = !strncmp(version, (const char *)Library->fw_version,
+                           sizeof(version));
+
+        /* The loader is staged where the library goes, so only the library
+         * can be verified
+         */
+        if(!matches) {
+            start = now_ms();
+            if(gestic_flash_verify(gestic, 1, Library, &matches, 100) < 0) {
+                fprintf(stderr, "\nCould not verify library.\n");
+                matches = 0;
+            }
+            printf("\nLibrary verified in %.1f ms: %s.\n", now_ms() - start,
+                   matches ? "already in flash" : "differs");
+        }
+
+        if(matches) {
+            printf("Library is up to date.\n");
+            gestic_close(gestic);
+            cleanup(gestic);
+            return 0;
+        }
+    }
+
     /* Ask whether the firmware should really be flashed */
     printf("[ GestIC Library ]\n\n"
            "Currently running:\n%s\n\n"
            "To be flashed:\n%s\n\n"
            "[ GestIC Library Loader\n\n"
            "To be flashed:\n%s\n\n",
-           version, Library.fw_version, Loader.fw_version);
-    printf("Do you really want to flash the new images (yes,no)? ");
-    fflush(stdout);
-    fgets(confirm, sizeof(confirm), stdin);
-    if(stricmp(confirm, "yes\n") != 0 && stricmp(confirm, "y\n") != 0) {
-        gestic_cleanup(gestic);
-        gestic_free(gestic);
+           version, Library->fw_version, Loader->fw_version);
+    if(!confirmed(yes)) {
+        cleanup(gestic);
         return 0;
     }
 
     /* Do the actual flashing */
-    printf("Flashing library-loader.\n");
-    flash(gestic, &Loader, gestic_UpdateFunction_ProgramFlash);
+    if(resume) {
+        printf("Resuming library at record %d.\n", resume);
+    } else {
+        printf("Flashing library-loader.\n");
+        flash(gestic, Loader, gestic_UpdateFunction_ProgramFlash, journal);
 
-    printf("Waiting until loader-update is completed.\n");
-    if(gestic_flash_wait_loader_updated(gestic, 20000) != 0) {
-        fprintf(stderr, "Loader-update seems to have failed. Aborting.\n");
+        printf("Waiting until loader-update is completed.\n");
+        if(gestic_flash_wait_loader_updated(gestic, 20000) != 0) {
+            fprintf(stderr, "Loader-update seems to have failed. Aborting.\n");
 #ifndef ON_ERROR_RESUME_NEXT
-        gestic_cleanup(gestic);
-        gestic_free(gestic);
-        return -1;
+            cleanup(gestic);
+            return -1;
 #endif
-    }
+        }
 
-    printf("Flashing library.\n");
-    flash(gestic, &Library, gestic_UpdateFunction_ProgramFlash);
+        printf("Flashing library.\n");
+    }
+    flash(gestic, Library, gestic_UpdateFunction_ProgramFlash, journal);
 
     /* Close connection to device */
     gestic_close(gestic);
 
     /* Release further resources that were used by gestic */
-    gestic_cleanup(gestic);
-    gestic_free(gestic);
+    cleanup(gestic);
 
     return 0;
 }
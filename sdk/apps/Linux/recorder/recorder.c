@@ -0,0 +1,121 @@
+/******************************************************************************
+ *
+ * Copyright (C) 2014 Microchip Technology Inc. and its
+ *                    subsidiaries ("Microchip").
+ *
+ * All rights reserved.
+ *
+ * You are permitted to use the Aurea software, GestIC API, and other
+ * accompanying software with Microchip products.  Refer to the license
+ * agreement accompanying this software, if any, for additional info regarding
+ * your rights and obligations.
+ *
+ * SOFTWARE AND DOCUMENTATION ARE PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION, ANY WARRANTY OF
+ * MERCHANTABILITY, TITLE, NON-INFRINGEMENT AND FITNESS FOR A PARTICULAR
+ * PURPOSE. IN NO EVENT SHALL MICROCHIP, SMSC, OR ITS LICENSORS BE LIABLE OR
+ * OBLIGATED UNDER CONTRACT, NEGLIGENCE, STRICT LIABILITY, CONTRIBUTION, BREACH
+ * OF WARRANTY, OR OTHER LEGAL EQUITABLE THEORY FOR ANY DIRECT OR INDIRECT
+ * DAMAGES OR EXPENSES INCLUDING BUT NOT LIMITED TO ANY INCIDENTAL, SPECIAL,
+ * INDIRECT OR CONSEQUENTIAL DAMAGES, OR OTHER SIMILAR COSTS.
+ *
+ ******************************************************************************/
+#include <gestic_api.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+/* This tool records the traffic of a device in a capture file (see
+ * gestic_start_capture) until it is interrupted or the duration given with
+ * -d passed. The device defaults to the one of gestic_open.
+ */
+
+static volatile sig_atomic_t stopped;
+
+static void on_signal(int signal) {
+    (void)signal;
+    stopped = 1;
+}
+
+static double now_s(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+int main(int argc, char *argv[]) {
+    gestic_t *gestic;
+    gestic_capture_stats_t stats;
+    const char *uri = NULL;
+    int mask = gestic_data_mask_all;
+    double duration = 0;
+    double start;
+    long frames = 0;
+    int skipped;
+    int first = 1;
+    int error;
+
+    if(first + 1 < argc && !strcmp(argv[first], "-d")) {
+        duration = atof(argv[first + 1]);
+        first += 2;
+    }
+    if(argc <= first) {
+        fprintf(stderr, "Usage: %s [-d seconds] <capture.gcap> [uri] [mask]\n"
+                        "  e.g. %s sensor.gcap tty:/tmp/gestic-sim\n",
+                argv[0], argv[0]);
+        return -1;
+    }
+    if(argc > first + 1)
+        uri = argv[first + 1];
+    if(argc > first + 2)
+        mask = strtol(argv[first + 2], NULL, 0);
+
+    gestic = gestic_create();
+    gestic_initialize(gestic);
+
+    if((uri ? gestic_open_uri(gestic, uri) : gestic_open(gestic)) < 0) {
+        fprintf(stderr, "Could not open %s.\n", uri ? uri : "device");
+        return -1;
+    }
+
+    /* Started before the first command so that it is recorded, too */
+    if(gestic_start_capture(gestic, argv[first]) < 0) {
+        fprintf(stderr, "Could not create %s.\n", argv[first]);
+        return -1;
+    }
+
+    if(gestic_set_output_enable_mask(gestic, mask, mask,
+                                     gestic_data_mask_all, 100) < 0)
+    {
+        fprintf(stderr, "Could not set output-mask for streaming.\n");
+        return -1;
+    }
+
+    signal(SIGINT, on_signal);
+    signal(SIGTERM, on_signal);
+
+    start = now_s();
+    while(!stopped && (duration <= 0 || now_s() - start < duration)) {
+        /* The first update skips the frames since the start of the device */
+        if(!gestic_data_stream_update(gestic, &skipped))
+            frames += frames ? 1 + skipped : 1;
+        else
+            usleep(1000);
+    }
+
+    error = gestic_stop_capture(gestic, &stats);
+    printf("%ld frames in %.1f s: %u records in %u chunks, %llu bytes, "
+           "%u dropped\n", frames, now_s() - start, stats.records,
+           stats.chunks, stats.bytes, stats.dropped);
+    if(error)
+        fprintf(stderr, "Could not write %s completely.\n", argv[first]);
+
+    gestic_close(gestic);
+    gestic_cleanup(gestic);
+    gestic_free(gestic);
+
+    return error ? -1 : 0;
+}
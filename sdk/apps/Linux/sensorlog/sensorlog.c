@@ -0,0 +1,398 @@
+/******************************************************************************
+ *
+ * Copyright (C) 2014 Microchip Technology Inc. and its
+ *                    subsidiaries ("Microchip").
+ *
+ * All rights reserved.
+ *
+ * You are permitted to use the Aurea software, GestIC API, and other
+ * accompanying software with Microchip products.  Refer to the license
+ * agreement accompanying this software, if any, for additional info regarding
+ * your rights and obligations.
+ *
+ * SOFTWARE AND DOCUMENTATION ARE PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION, ANY WARRANTY OF
+ * MERCHANTABILITY, TITLE, NON-INFRINGEMENT AND FITNESS FOR A PARTICULAR
+ * PURPOSE. IN NO EVENT SHALL MICROCHIP, SMSC, OR ITS LICENSORS BE LIABLE OR
+ * OBLIGATED UNDER CONTRACT, NEGLIGENCE, STRICT LIABILITY, CONTRIBUTION, BREACH
+ * OF WARRANTY, OR OTHER LEGAL EQUITABLE THEORY FOR ANY DIRECT OR INDIRECT
+ * DAMAGES OR EXPENSES INCLUDING BUT NOT LIMITED TO ANY INCIDENTAL, SPECIAL,
+ * INDIRECT OR CONSEQUENTIAL DAMAGES, OR OTHER SIMILAR COSTS.
+ *
+ ******************************************************************************/
+#include <gestic_api.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+/* This tool writes and reads sensor logs (see gestic_sensorlog_create).
+ *
+ * - Without option it logs the data of a device until it is interrupted or
+ *   the duration given with -d passed.
+ * - With -c it converts the frames of a capture file (see
+ *   gestic_start_capture) into a log, reads the log back and reports the
+ *   compression and speed of both directions.
+ * - With -p it prints the frames of a log as CSV.
+ */
+
+static volatile sig_atomic_t stopped;
+
+static void on_signal(int signal) {
+    (void)signal;
+    stopped = 1;
+}
+
+static double now_s(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+/* Clears what is not logged with mask, as it reads back as 0 */
+static void apply_mask(gestic_input_data_t *data, int mask) {
+    data->pos.reserved = 0;
+    if(!(mask & gestic_data_mask_dsp_status)) {
+        memset(&data->calib, 0, sizeof(data->calib));
+        memset(&data->frequency, 0, sizeof(data->frequency));
+    }
+    if(!(mask & gestic_data_mask_gesture))
+        memset(&data->gesture, 0, sizeof(data->gesture));
+    if(!(mask & gestic_data_mask_touch))
+        memset(&data->touch, 0, sizeof(data->touch));
+    if(!(mask & gestic_data_mask_airwheel))
+        memset(&data->air_wheel, 0, sizeof(data->air_wheel));
+    if(!(mask & gestic_data_mask_position))
+        memset(&data->pos, 0, sizeof(data->pos));
+    if(!(mask & gestic_data_mask_noise_power))
+        memset(&data->noise_power, 0, sizeof(data->noise_power));
+    if(!(mask & gestic_data_mask_cic))
+        memset(&data->cic, 0, sizeof(data->cic));
+    if(!(mask & gestic_data_mask_sd))
+        memset(&data->sd, 0, sizeof(data->sd));
+}
+
+/* Converts the internal data into gestic->result the way
+ * gestic_data_stream_update does, i.e. with the ages of the events
+ */
+static void make_result(gestic_t *gestic, int last_counter) {
+    gestic_input_data_t *result = &gestic->result;
+    int current = gestic->internal.frame_counter;
+
+    *result = gestic->internal;
+    if(result->gesture.last_event <= last_counter) {
+        result->gesture.gesture = 0;
+        result->gesture.flags &= gestic_gesture_in_progress;
+    }
+    result->gesture.last_event = current - result->gesture.last_event;
+    result->touch.last_event = current - result->touch.last_event;
+    if(result->touch.last_tap_event <= last_counter)
+        result->touch.tap_flags = 0;
+    result->touch.last_tap_event = current - result->touch.last_tap_event;
+    result->touch.last_touch_event_start =
+        current - result->touch.last_touch_event_start;
+    result->air_wheel.last_event = current - result->air_wheel.last_event;
+    if(result->calib.last_event <= last_counter)
+        result->calib.reason = 0;
+    result->calib.last_event = current - result->calib.last_event;
+    if(result->frequency.last_event <= last_counter)
+        result->frequency.freq_changed = 0;
+    result->frequency.last_event = current - result->frequency.last_event;
+}
+
+/* Decodes the Sensor_Data_Output messages of a capture into frames.
+ * Returns the count of frames or -1.
+ */
+static int read_capture(const char *path, gestic_input_data_t **frames) {
+    static gestic_t gestic;
+    gestic_capture_header_t header;
+    gestic_capture_chunk_t chunk;
+    const unsigned char *data, *record, *end, *msg;
+    gestic_input_data_t *grown;
+    unsigned long long offset;
+    struct stat st;
+    int capacity = 0, count = 0;
+    int last_counter;
+    int fd, size;
+
+    *frames = NULL;
+    fd = open(path, O_RDONLY);
+    if(fd < 0 || fstat(fd, &st) || st.st_size < (off_t)sizeof(header))
+        return -1;
+    data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if(data == MAP_FAILED)
+        return -1;
+    memcpy(&header, data, sizeof(header));
+    if(memcmp(header.magic, "GCAP", 4) || header.version != 1) {
+        munmap((void *)data, st.st_size);
+        return -1;
+    }
+
+    gestic_initialize(&gestic);
+
+    /* The chunks follow each other up to the index, if there is one */
+    for(offset = header.header_size;
+        offset + sizeof(chunk) <= (unsigned long long)st.st_size;
+        offset += sizeof(chunk) + chunk.size)
+    {
+        memcpy(&chunk, data + offset, sizeof(chunk));
+        if(memcmp(chunk.magic, "GCHK", 4) ||
+           offset + sizeof(chunk) + chunk.size > (unsigned long long)st.st_size)
+            break;
+        record = data + offset + sizeof(chunk);
+        end = record + chunk.size;
+        if(gestic_crc32(0, record, chunk.size) != chunk.crc)
+            continue;
+
+        for(; record + 6 <= end; record = msg + size) {
+            size = record[5];
+            msg = record + 6;
+            if(msg + size > end || size < 4)
+                break;
+            if(record[4] != gestic_capture_received ||
+               msg[3] != gestic_msg_Sensor_Data_Output)
+                continue;
+
+            last_counter = gestic.result.frame_counter;
+            gestic_message_handle(&gestic, msg, size);
+            if(gestic.internal.frame_counter == last_counter)
+                continue;
+            make_result(&gestic, last_counter);
+
+            if(count == capacity) {
+                capacity = capacity ? capacity * 2 : 4096;
+                grown = realloc(*frames, capacity * sizeof(**frames));
+                if(!grown)
+                    break;
+                *frames = grown;
+            }
+            (*frames)[count++] = gestic.result;
+        }
+    }
+
+    gestic_cleanup(&gestic);
+    munmap((void *)data, st.st_size);
+    return count;
+}
+
+static int convert(const char *capture, const char *path, int mask,
+                   int block_frames)
+{
+    gestic_sensorlog_t *log;
+    gestic_sensorlog_stats_t written, read;
+    gestic_input_data_t *frames;
+    gestic_input_data_t frame;
+    double start, encode, decode;
+    int count, mismatches = 0, errors = 0;
+    int error, i;
+
+    count = read_capture(capture, &frames);
+    if(count < 0) {
+        fprintf(stderr, "%s is no capture file.\n", capture);
+        return -1;
+    }
+    for(i = 0; i < count; ++i)
+        apply_mask(&frames[i], mask);
+
+    error = gestic_sensorlog_create(path, mask, block_frames, &log);
+    if(error) {
+        fprintf(stderr, "Could not create %s.\n", path);
+        return -1;
+    }
+    start = now_s();
+    for(i = 0; i < count && !error; ++i)
+        error = gestic_sensorlog_write(log, &frames[i]);
+    if(gestic_sensorlog_close(log, &written) || error) {
+        fprintf(stderr, "Could not write %s.\n", path);
+        return -1;
+    }
+    encode = now_s() - start;
+
+    if(gestic_sensorlog_open(path, &log)) {
+        fprintf(stderr, "Could not open %s.\n", path);
+        return -1;
+    }
+    start = now_s();
+    for(i = 0; (error = gestic_sensorlog_read(log, &frame)) != GESTIC_NO_DATA;) {
+        if(error) {
+            ++errors;
+            continue;
+        }
+        if(i >= count || memcmp(&frame, &frames[i], sizeof(frame)))
+            ++mismatches;
+        ++i;
+    }
+    decode = now_s() - start;
+    gestic_sensorlog_close(log, &read);
+    if(i != count)
+        mismatches += i > count ? i - count : count - i;
+
+    printf("%d frames, mask 0x%04x, %u blocks\n", count, mask,
+           written.blocks);
+    printf("%llu bytes logged, %.1f bytes per frame\n", written.bytes,
+           count ? (double)written.bytes / count : 0);
+    printf("Ratio %.2f to 32-bit fields (%llu bytes), %.2f to "
+           "gestic_input_data_t (%llu bytes)\n",
+           written.bytes ? (double)written.raw_bytes / written.bytes : 0,
+           written.raw_bytes,
+           written.bytes ? (double)count * sizeof(frame) / written.bytes : 0,
+           (unsigned long long)count * sizeof(frame));
+    printf("Encoded in %.1f ms, %.1f MB/s, %.0f frames/s\n", encode * 1e3,
+           encode > 0 ? written.raw_bytes / 1e6 / encode : 0,
+           encode > 0 ? count / encode : 0);
+    printf("Decoded in %.1f ms, %.1f MB/s, %.0f frames/s\n", decode * 1e3,
+           decode > 0 ? read.raw_bytes / 1e6 / decode : 0,
+           decode > 0 ? read.frames / decode : 0);
+    printf("%d damaged blocks, %d frames differ\n", errors, mismatches);
+
+    free(frames);
+    return errors || mismatches ? 1 : 0;
+}
+
+static int print(const char *path) {
+    gestic_sensorlog_t *log;
+    gestic_input_data_t data;
+    int error, errors = 0;
+
+    if(gestic_sensorlog_open(path, &log)) {
+        fprintf(stderr, "Could not open %s.\n", path);
+        return -1;
+    }
+
+    printf("frame,x,y,z,gesture,gesture_flags,touch,tap,airwheel,calib,"
+           "frequency,noise,cic0,cic1,cic2,cic3,cic4,sd0,sd1,sd2,sd3,sd4\n");
+    while((error = gestic_sensorlog_read(log, &data)) != GESTIC_NO_DATA) {
+        if(error) {
+            ++errors;
+            continue;
+        }
+        printf("%d,%d,%d,%d,%d,0x%x,0x%x,0x%x,%d,0x%x,%d,%g,"
+               "%g,%g,%g,%g,%g,%g,%g,%g,%g,%g\n",
+               data.frame_counter, data.pos.x, data.pos.y, data.pos.z,
+               data.gesture.gesture, data.gesture.flags, data.touch.flags,
+               data.touch.tap_flags, data.air_wheel.counter,
+               data.calib.reason, data.frequency.frequency,
+               data.noise_power.value,
+               data.cic.channel[0], data.cic.channel[1], data.cic.channel[2],
+               data.cic.channel[3], data.cic.channel[4],
+               data.sd.channel[0], data.sd.channel[1], data.sd.channel[2],
+               data.sd.channel[3], data.sd.channel[4]);
+    }
+    gestic_sensorlog_close(log, NULL);
+
+    if(errors)
+        fprintf(stderr, "%d damaged blocks in %s.\n", errors, path);
+    return errors ? 1 : 0;
+}
+
+static int record(const char *path, const char *uri, int mask,
+                  int block_frames, double duration)
+{
+    static gestic_t gestic_data;
+    gestic_t *gestic = &gestic_data;
+    gestic_sensorlog_t *log;
+    gestic_sensorlog_stats_t stats;
+    double start;
+    long skipped_total = 0;
+    long frames = 0;
+    int skipped;
+    int error;
+
+    gestic_initialize(gestic);
+
+    if((uri ? gestic_open_uri(gestic, uri) : gestic_open(gestic)) < 0) {
+        fprintf(stderr, "Could not open %s.\n", uri ? uri : "device");
+        return -1;
+    }
+
+    if(gestic_set_output_enable_mask(gestic, mask, mask,
+                                     gestic_data_mask_all, 100) < 0)
+    {
+        fprintf(stderr, "Could not set output-mask for streaming.\n");
+        return -1;
+    }
+
+    if(gestic_sensorlog_create(path, mask, block_frames, &log)) {
+        fprintf(stderr, "Could not create %s.\n", path);
+        return -1;
+    }
+
+    signal(SIGINT, on_signal);
+    signal(SIGTERM, on_signal);
+
+    error = 0;
+    start = now_s();
+    while(!stopped && !error && (duration <= 0 || now_s() - start < duration)) {
+        if(!gestic_data_stream_update(gestic, &skipped)) {
+            /* The first update skips the frames since the start of the device */
+            if(frames++)
+                skipped_total += skipped;
+            error = gestic_sensorlog_write(log, &gestic->result);
+        } else {
+            usleep(1000);
+        }
+    }
+
+    if(gestic_sensorlog_close(log, &stats))
+        error = 1;
+    printf("%u frames in %.1f s (%ld skipped): %u blocks, %llu bytes, "
+           "ratio %.2f\n", stats.frames, now_s() - start, skipped_total,
+           stats.blocks, stats.bytes,
+           stats.bytes ? (double)stats.raw_bytes / stats.bytes : 0);
+    if(error)
+        fprintf(stderr, "Could not write %s completely.\n", path);
+
+    gestic_close(gestic);
+    gestic_cleanup(gestic);
+
+    return error ? -1 : 0;
+}
+
+int main(int argc, char *argv[]) {
+    const char *capture = NULL;
+    const char *uri = NULL;
+    int mask = gestic_data_mask_all;
+    int block_frames = 0;
+    double duration = 0;
+    int first = 1;
+
+    while(first + 1 < argc && argv[first][0] == '-') {
+        if(!strcmp(argv[first], "-p"))
+            return print(argv[first + 1]);
+        if(!strcmp(argv[first], "-d"))
+            duration = atof(argv[first + 1]);
+        else if(!strcmp(argv[first], "-b"))
+            block_frames = atoi(argv[first + 1]);
+        else if(!strcmp(argv[first], "-c"))
+            capture = argv[first + 1];
+        else
+            break;
+        first += 2;
+    }
+    if(argc <= first) {
+        fprintf(stderr, "Usage: %s [-d seconds] [-b frames] <log> [uri] [mask]\n"
+                        "       %s -c <capture.gcap> [-b frames] <log> [mask]\n"
+                        "       %s -p <log>\n"
+                        "  e.g. %s sensor.glog tty:/tmp/gestic-sim\n",
+                argv[0], argv[0], argv[0], argv[0]);
+        return -1;
+    }
+
+    if(capture) {
+        if(argc > first + 1)
+            mask = strtol(argv[first + 1], NULL, 0);
+        return convert(capture, argv[first], mask, block_frames);
+    }
+
+    if(argc > first + 1)
+        uri = argv[first + 1];
+    if(argc > first + 2)
+        mask = strtol(argv[first + 2], NULL, 0);
+    return record(argv[first], uri, mask, block_frames, duration);
+}
@@ -0,0 +1,854 @@
+/******************************************************************************
+ *
+ * Copyright (C) 2014 Microchip Technology Inc. and its
+ *                    subsidiaries ("Microchip").
+ *
+ * All rights reserved.
+ *
+ * You are permitted to use the Aurea software, GestIC API, and other
+ * accompanying software with Microchip products.  Refer to the license
+ * agreement accompanying this software, if any, for additional info regarding
+ * your rights and obligations.
+ *
+ * SOFTWARE AND DOCUMENTATION ARE PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION, ANY WARRANTY OF
+ * MERCHANTABILITY, TITLE, NON-INFRINGEMENT AND FITNESS FOR A PARTICULAR
+ * PURPOSE. IN NO EVENT SHALL MICROCHIP, SMSC, OR ITS LICENSORS BE LIABLE OR
+ * OBLIGATED UNDER CONTRACT, NEGLIGENCE, STRICT LIABILITY, CONTRIBUTION, BREACH
+ * OF WARRANTY, OR OTHER LEGAL EQUITABLE THEORY FOR ANY DIRECT OR INDIRECT
+ * DAMAGES OR EXPENSES INCLUDING BUT NOT LIMITED TO ANY INCIDENTAL, SPECIAL,
+ * INDIRECT OR CONSEQUENTIAL DAMAGES, OR OTHER SIMILAR COSTS.
+ *
+ ******************************************************************************/
+/* For the pty functions and cfmakeraw */
+#define _GNU_SOURCE
+
+#include <gestic_api.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <math.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+/* This tool simulates a MGC3130 behind the kernel module on a pty.
+ *
+ * It answers the messages the SDK sends and streams Sensor_Data_Output
+ * messages from a synthetic or recorded trajectory. Point the SDK at the
+ * printed device (or the created link) to use it instead of /dev/gestic.
+ * Alternatively it listens on a Unix domain socket for one client at a time.
+ *
+ * SIGUSR1 wedges the simulated device: it stops streaming and answering until
+ * it gets reset. A reset restores the parameters the simulator started with.
+ *
+ * With -d every message to the host is held back for the given time, which
+ * makes the round trips comparable to a device behind a slow bus.
+ */
+
+/* The device takes 200 samples per second */
+#define SAMPLE_RATE 200
+
+/* Synthetic trajectory: 2 seconds absent, 6 seconds present, 2 seconds absent */
+#define CYCLE 2000
+#define PRESENT_START 400
+#define PRESENT_END 1600
+
+#define MAX_PARAMS 64
+#define MAX_TRAJECTORY 100000
+#define MAX_DELAYED 256
+#define FLASH_SIZE 0x10000
+
+typedef struct {
+    int present;
+    int x, y, z;
+    int touch;
+    int tap;
+    int gesture;
+    int air_wheel;
+    float sd[5];
+} sample_t;
+
+typedef struct {
+    unsigned short param;
+    unsigned int arg0;
+    unsigned int arg1;
+} param_t;
+
+/* Message to the host held back by the simulated latency */
+typedef struct {
+    long long due;
+    int size;
+    unsigned char data[2 + 256];
+} delayed_t;
+
+typedef struct {
+    /* pty master or connected client, negative without client */
+    int master;
+    int slave;
+    int listener;
+    int verbose;
+
+    /* Extraction of incoming messages */
+    unsigned char in[512];
+    int in_size;
+
+    /* Runtime parameters */
+    param_t params[MAX_PARAMS];
+    int param_count;
+
+    /* Stream state */
+    int rate;
+    int startup_mask;
+    unsigned int sample;
+    unsigned char seq;
+    int request_mask;
+    int calibration;
+    int frequency;
+    int last_touch;
+    int touch_start;
+
+    /* Update state */
+    unsigned char fw_valid;
+    char version[120];
+    char pending_version[120];
+    unsigned int session_id;
+    int blocks;
+    /* Content of the flash as sent in the records and the blocks written
+     * in the current session
+     */
+    unsigned char flash[FLASH_SIZE + 128];
+    unsigned char written[FLASH_SIZE / 128 + 1];
+
+    /* Recorded trajectory */
+    sample_t *trajectory;
+    int trajectory_size;
+
+    /* Latency of messages to the host in microseconds */
+    int latency;
+    delayed_t delayed[MAX_DELAYED];
+    int delayed_first;
+    int delayed_count;
+} sim_t;
+
+static volatile sig_atomic_t running = 1;
+static volatile sig_atomic_t stalled = 0;
+
+static void on_signal(int sig) {
+    (void)sig;
+    running = 0;
+}
+
+static void on_stall(int sig) {
+    (void)sig;
+    stalled = 1;
+}
+
+static unsigned int crc32(const unsigned char *data, int size) {
+    unsigned int crc = 0xFFFFFFFF;
+    int i, j;
+
+    for(i = 0; i < size; ++i) {
+        crc ^= data[i];
+        for(j = 0; j < 8; ++j)
+            crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+    }
+    return crc ^ 0xFFFFFFFF;
+}
+
+static void put_u16(unsigned char *p, unsigned int v) {
+    p[0] = v & 0xFF;
+    p[1] = (v >> 8) & 0xFF;
+}
+
+static void put_u32(unsigned char *p, unsigned int v) {
+    put_u16(p, v & 0xFFFF);
+    put_u16(p + 2, v >> 16);
+}
+
+static void put_f32(unsigned char *p, float f) {
+    unsigned int v;
+    memcpy(&v, &f, sizeof(v));
+    put_u32(p, v);
+}
+
+static unsigned int get_u16(const unsigned char *p) {
+    return p[0] | (p[1] << 8);
+}
+
+static unsigned int get_u32(const unsigned char *p) {
+    return get_u16(p) | (get_u16(p + 2) << 16);
+}
+
+/* ======== Runtime Parameters ======== */
+
+/* Same distinction as the SDK: AFE parameters and the frequency selection
+ * are set as a whole, for others arg1 selects the changed bits of arg0.
+ */
+static int param_masked(unsigned short param) {
+    if(param >= gestic_param_afeRxAtt_S && param <= gestic_param_afeRxAtt_C)
+        return 0;
+    if(param >= gestic_param_channelmapping_S && param <= gestic_param_channelmapping_C)
+        return 0;
+    return param != gestic_param_transFreqSelect;
+}
+
+static param_t *find_param(sim_t *sim, unsigned short param, int create) {
+    int i;
+
+    for(i = 0; i < sim->param_count; ++i) {
+        if(sim->params[i].param == param)
+            return &sim->params[i];
+    }
+    if(!create || sim->param_count >= MAX_PARAMS)
+        return NULL;
+
+    sim->params[sim->param_count].param = param;
+    sim->params[sim->param_count].arg0 = 0;
+    sim->params[sim->param_count].arg1 = 0;
+    return &sim->params[sim->param_count++];
+}
+
+static void set_param(sim_t *sim, unsigned short param, unsigned int arg0,
+                      unsigned int arg1)
+{
+    param_t *p = find_param(sim, param, 1);
+
+    if(!p)
+        return;
+    if(param_masked(param)) {
+        p->arg0 = (p->arg0 & ~arg1) | (arg0 & arg1);
+    } else {
+        p->arg0 = arg0;
+        p->arg1 = arg1;
+    }
+}
+
+static unsigned int get_param(sim_t *sim, unsigned short param) {
+    param_t *p = find_param(sim, param, 0);
+    return p ? p->arg0 : 0;
+}
+
+/* Parameters after start-up of the library */
+static void reset_params(sim_t *sim, int output_mask) {
+    sim->param_count = 0;
+    set_param(sim, gestic_param_dspCalOpMode, 0x00, 0x3F);
+    set_param(sim, gestic_param_transFreqSelect, 5, 0x43210);
+    set_param(sim, gestic_param_dspGestureMask, 0x7F, 0x7F);
+    set_param(sim, gestic_param_dspAirWheelConfig, 0x20, 0x20);
+    set_param(sim, gestic_param_dspTouchConfig, 0x08, 0x08);
+    set_param(sim, gestic_param_dataOutputEnableMask, output_mask, 0xFFFFFFFF);
+    set_param(sim, gestic_param_dataOutputLockMask, 0, 0xFFFFFFFF);
+    sim->request_mask = 0;
+    sim->calibration = gestic_startup_calib;
+    sim->frequency = 115;
+}
+
+/* ======== Message Output ======== */
+
+static long long now_us(void);
+
+static void write_msg(sim_t *sim, const unsigned char *buffer, int size) {
+    if(write(sim->master, buffer, size) != size && sim->verbose)
+        fprintf(stderr, "Could not write message 0x%02X.\n", buffer[5]);
+}
+
+static void send_msg(sim_t *sim, unsigned char *msg, int size) {
+    unsigned char buffer[2 + 256];
+    delayed_t *delayed;
+
+    if(sim->master < 0)
+        return;
+
+    msg[0] = size;
+    msg[2] = sim->seq++;
+    buffer[0] = 0xFE;
+    buffer[1] = 0xFF;
+    memcpy(buffer + 2, msg, size);
+
+    /* Messages keep their order, a full queue just gets written */
+    if(!sim->latency || sim->delayed_count == MAX_DELAYED) {
+        write_msg(sim, buffer, size + 2);
+        return;
+    }
+
+    delayed = &sim->delayed[(sim->delayed_first + sim->delayed_count++) %
+                            MAX_DELAYED];
+    delayed->due = now_us() + sim->latency;
+    delayed->size = size + 2;
+    memcpy(delayed->data, buffer, size + 2);
+}
+
+/* Writes the held back messages that are due and returns the time until the
+ * next one in microseconds or -1 when none is left.
+ */
+static long long flush_delayed(sim_t *sim) {
+    long long now = now_us();
+    delayed_t *delayed;
+
+    while(sim->delayed_count) {
+        delayed = &sim->delayed[sim->delayed_first];
+        if(delayed->due > now)
+            return delayed->due - now;
+        if(sim->master >= 0)
+            write_msg(sim, delayed->data, delayed->size);
+        sim->delayed_first = (sim->delayed_first + 1) % MAX_DELAYED;
+        --sim->delayed_count;
+    }
+
+    return -1;
+}
+
+static void send_status(sim_t *sim, int msg_id, int error) {
+    unsigned char msg[16];
+
+    memset(msg, 0, sizeof(msg));
+    msg[3] = gestic_msg_System_Status;
+    msg[4] = msg_id;
+    put_u16(msg + 6, error);
+    send_msg(sim, msg, sizeof(msg));
+
+    if(sim->verbose)
+        printf("< System_Status 0x%02X error 0x%02X\n", msg_id, error);
+}
+
+static void send_version(sim_t *sim) {
+    unsigned char msg[132];
+
+    memset(msg, 0, sizeof(msg));
+    msg[3] = gestic_msg_Fw_Version_Info;
+    msg[4] = sim->fw_valid;
+    /* The last byte of the version stays 0 */
+    memcpy(msg + 12, sim->version, sizeof(sim->version) - 1);
+    send_msg(sim, msg, sizeof(msg));
+
+    if(sim->verbose)
+        printf("< Fw_Version_Info %s\n", sim->version);
+}
+
+static void send_param(sim_t *sim, unsigned short param) {
+    unsigned char msg[16];
+    param_t *p = find_param(sim, param, 0);
+
+    memset(msg, 0, sizeof(msg));
+    msg[3] = gestic_msg_Set_Runtime_Parameter;
+    put_u16(msg + 4, param);
+    if(p) {
+        put_u32(msg + 8, p->arg0);
+        put_u32(msg + 12, p->arg1);
+    }
+    send_msg(sim, msg, sizeof(msg));
+}
+
+/* ======== Trajectories ======== */
+
+static void synthetic_sample(unsigned int sample, sample_t *s) {
+    int t = sample % CYCLE;
+    double phase = 2 * M_PI * t / 400.0;
+    int i;
+
+    memset(s, 0, sizeof(*s));
+    s->present = t >= PRESENT_START && t < PRESENT_END;
+
+    for(i = 0; i < 5; ++i)
+        s->sd[i] = (float)(2.0 * sin(0.1 * sample + i));
+
+    if(!s->present)
+        return;
+
+    /* Circle around the center while approaching and leaving */
+    s->x = (int)(32768 + 16000 * cos(phase));
+    s->y = (int)(32768 + 16000 * sin(phase));
+    s->z = t < 1000 ? 65535 - (t - PRESENT_START) * 80 : 17535 + (t - 1000) * 80;
+    s->air_wheel = (t - PRESENT_START) / 4;
+
+    /* Flicks, a touch and a tap at fixed points of the cycle */
+    if(t == 600)
+        s->gesture = gestic_flick_w2e + 1;
+    else if(t == 1400)
+        s->gesture = gestic_flick_s2n + 1;
+    if(t >= 950 && t < 1050)
+        s->touch = gestic_touch_center;
+    if(t == 1200)
+        s->tap = gestic_tap_center;
+
+    for(i = 0; i < 5; ++i)
+        s->sd[i] += (float)(60000.0 / (s->z / 256 + 20) * (1.0 + 0.2 * cos(phase + i)));
+}
+
+/* Loads lines of "x y z [touch [gesture]]" where x = -1 marks absence */
+static int load_trajectory(sim_t *sim, const char *filename) {
+    FILE *file = fopen(filename, "r");
+    char line[256];
+
+    if(!file)
+        return -1;
+
+    sim->trajectory = calloc(MAX_TRAJECTORY, sizeof(sample_t));
+    while(sim->trajectory && fgets(line, sizeof(line), file) &&
+          sim->trajectory_size < MAX_TRAJECTORY)
+    {
+        sample_t *s = &sim->trajectory[sim->trajectory_size];
+        int i;
+
+        if(line[0] == '#' || line[0] == '\n')
+            continue;
+        if(sscanf(line, "%d %d %d %i %d", &s->x, &s->y, &s->z, &s->touch,
+                  &s->gesture) < 3)
+            continue;
+        s->present = s->x >= 0;
+        for(i = 0; i < 5 && s->present; ++i)
+            s->sd[i] = (float)(60000.0 / (s->z / 256 + 20));
+        ++sim->trajectory_size;
+    }
+
+    fclose(file);
+    return sim->trajectory_size > 0 ? 0 : -1;
+}
+
+/* ======== Sensor Data Output ======== */
+
+static void send_frame(sim_t *sim, int mask) {
+    unsigned char msg[256];
+    unsigned char *cursor = msg + 8;
+    int system_info = gestic_SystemInfo_DSPRunning;
+    sample_t s;
+    int i;
+
+    if(sim->trajectory)
+        s = sim->trajectory[sim->sample % sim->trajectory_size];
+    else
+        synthetic_sample(sim->sample, &s);
+
+    if(s.present)
+        system_info |= gestic_SystemInfo_PositionValid | gestic_SystemInfo_AirWheelValid;
+    system_info |= gestic_SystemInfo_RawDataValid | gestic_SystemInfo_NoisePowerValid;
+
+    /* The touch counter holds the duration of the current touch */
+    if(s.touch != sim->last_touch)
+        sim->touch_start = sim->sample;
+    sim->last_touch = s.touch;
+
+    memset(msg, 0, sizeof(msg));
+    msg[3] = gestic_msg_Sensor_Data_Output;
+    /* Five electrodes */
+    put_u16(msg + 4, (mask & gestic_data_mask_all) | 0x0100);
+    msg[6] = (unsigned char)sim->sample;
+    msg[7] = system_info;
+
+    if(mask & gestic_data_mask_dsp_status) {
+        cursor[0] = sim->calibration;
+        cursor[1] = sim->frequency;
+        sim->calibration = 0;
+        cursor += 2;
+    }
+    if(mask & gestic_data_mask_gesture) {
+        put_u32(cursor, s.gesture);
+        cursor += 4;
+    }
+    if(mask & gestic_data_mask_touch) {
+        int duration = s.touch ? sim->sample - sim->touch_start : 0;
+        put_u32(cursor, s.touch | s.tap | ((duration > 255 ? 255 : duration) << 16));
+        cursor += 4;
+    }
+    if(mask & gestic_data_mask_airwheel) {
+        cursor[0] = (unsigned char)s.air_wheel;
+        cursor += 2;
+    }
+    if(mask & gestic_data_mask_position) {
+        put_u16(cursor, s.x);
+        put_u16(cursor + 2, s.y);
+        put_u16(cursor + 4, s.z);
+        cursor += 6;
+    }
+    if(mask & gestic_data_mask_noise_power) {
+        put_f32(cursor, 1.5f);
+        cursor += 4;
+    }
+    if(mask & gestic_data_mask_cic) {
+        for(i = 0; i < 5; ++i)
+            put_f32(cursor + 4 * i, 10000.0f + s.sd[i]);
+        cursor += 20;
+    }
+    if(mask & gestic_data_mask_sd) {
+        for(i = 0; i < 5; ++i)
+            put_f32(cursor + 4 * i, s.sd[i]);
+        cursor += 20;
+    }
+
+    send_msg(sim, msg, cursor - msg);
+}
+
+/* ======== Message Input ======== */
+
+static void restart(sim_t *sim) {
+    stalled = 0;
+    /* A reset ends the update session */
+    sim->session_id = 0;
+    reset_params(sim, sim->startup_mask);
+    send_version(sim);
+}
+
+static void handle_update(sim_t *sim, const unsigned char *msg, int size) {
+    int id = msg[3];
+    int expected = id == gestic_msg_Fw_Update_Start ? 28 :
+                   id == gestic_msg_Fw_Update_Block ? 140 : 136;
+
+    if(size != expected) {
+        send_status(sim, id, gestic_system_InvalidLength);
+        return;
+    }
+    if(crc32(msg + 8, size - 8) != get_u32(msg + 4)) {
+        send_status(sim, id, gestic_system_InvalidCrc);
+        return;
+    }
+
+    if(id == gestic_msg_Fw_Update_Start) {
+        sim->session_id = get_u32(msg + 8);
+        sim->blocks = 0;
+        memset(sim->written, 0, sizeof(sim->written));
+        send_status(sim, id, gestic_system_NoError);
+    } else if(!sim->session_id) {
+        send_status(sim, id, gestic_system_InvalidSessionid);
+    } else if(id == gestic_msg_Fw_Update_Block) {
+        unsigned int address = get_u16(msg + 8);
+        ++sim->blocks;
+        if(msg[11] == gestic_UpdateFunction_VerifyOnly) {
+            send_status(sim, id, memcmp(sim->flash + address, msg + 12, 128) ?
+                        gestic_system_ContentMismatch : gestic_system_NoError);
+        } else {
+            memcpy(sim->flash + address, msg + 12, 128);
+            sim->written[address / 128] = 1;
+            send_status(sim, id, gestic_system_NoError);
+        }
+    } else if(get_u32(msg + 8) != sim->session_id) {
+        send_status(sim, id, gestic_system_InvalidSessionid);
+    } else if(msg[12] != gestic_UpdateFunction_Restart) {
+        /* Verification leaves the version as it is */
+        if(msg[12] == gestic_UpdateFunction_ProgramFlash)
+            memcpy(sim->pending_version, msg + 13, 119);
+        send_status(sim, id, gestic_system_NoError);
+    } else {
+        send_status(sim, id, gestic_system_NoError);
+        if(!strncmp(sim->pending_version, "LL", 2)) {
+            unsigned int block;
+            /* The new loader erases the library */
+            for(block = 0; block < sizeof(sim->written); ++block) {
+                if(!sim->written[block])
+                    memset(sim->flash + block * 128, 0xFF, 128);
+            }
+            send_status(sim, 0, gestic_system_LoaderUpdateStarted);
+            send_status(sim, 0, gestic_system_LoaderUpdateFinished);
+            sim->fw_valid = 0;
+        } else if(sim->pending_version[0]) {
+            memcpy(sim->version, sim->pending_version, sizeof(sim->version));
+            sim->fw_valid = 0xAA;
+        }
+        sim->pending_version[0] = 0;
+        restart(sim);
+    }
+}
+
+static void handle_msg(sim_t *sim, const unsigned char *msg, int size) {
+    int id = msg[3];
+
+    if(sim->verbose)
+        printf("> message 0x%02X size %d\n", id, size);
+
+    switch(id) {
+    case gestic_msg_Set_Runtime_Parameter: {
+        unsigned short param = get_u16(msg + 4);
+        unsigned int arg0 = get_u32(msg + 8);
+        unsigned int arg1 = get_u32(msg + 12);
+        if(size != 16) {
+            send_status(sim, id, gestic_system_InvalidLength);
+        } else if(param == gestic_param_trigger) {
+            if(arg0 == gestic_trigger_calibration)
+                sim->calibration = gestic_forced_calib;
+            send_status(sim, id, gestic_system_NoError);
+        } else if(param == gestic_param_dataOutputRequestMask) {
+            sim->request_mask = arg0 & gestic_data_mask_all;
+            send_status(sim, id, gestic_system_NoError);
+        } else if(param == gestic_param_makePersistent) {
+            send_status(sim, id, gestic_system_NoError);
+        } else {
+            set_param(sim, param, arg0, arg1);
+            send_status(sim, id, gestic_system_NoError);
+        }
+        break;
+    }
+    case gestic_msg_Request_Message:
+        if(msg[4] == gestic_msg_Fw_Version_Info) {
+            send_version(sim);
+            send_status(sim, id, gestic_system_NoError);
+        } else if(msg[4] == gestic_msg_Set_Runtime_Parameter) {
+            send_param(sim, (unsigned short)get_u32(msg + 8));
+            send_status(sim, id, gestic_system_NoError);
+        } else {
+            send_status(sim, id, gestic_system_UnknownCommand);
+        }
+        break;
+    case gestic_msg_Fw_Update_Start:
+    case gestic_msg_Fw_Update_Block:
+    case gestic_msg_Fw_Update_Completed:
+        handle_update(sim, msg, size);
+        break;
+    default:
+        send_status(sim, id, gestic_system_UnknownCommand);
+        break;
+    }
+}
+
+/* Extracts messages the same way the kernel module does */
+static void handle_input(sim_t *sim) {
+    int consumed;
+
+    for(;;) {
+        int skip = 0;
+
+        /* Resynchronize on FE FF */
+        while(skip + 1 < sim->in_size &&
+              (sim->in[skip] != 0xFE || sim->in[skip + 1] != 0xFF))
+            ++skip;
+        if(skip) {
+            memmove(sim->in, sim->in + skip, sim->in_size - skip);
+            sim->in_size -= skip;
+        }
+        if(sim->in_size < 6)
+            return;
+
+        if(sim->in[2] == 0) {
+            /* Control message of the kernel module */
+            if(sim->in_size < 8)
+                return;
+            if(sim->in[3] == 0x11) {
+                if(sim->verbose)
+                    printf("> reset\n");
+                restart(sim);
+            }
+            consumed = 8;
+        } else {
+            if(sim->in_size < 2 + sim->in[2])
+                return;
+            if(sim->in[2] >= 4 && !stalled)
+                handle_msg(sim, sim->in + 2, sim->in[2]);
+            consumed = 2 + sim->in[2];
+        }
+
+        memmove(sim->in, sim->in + consumed, sim->in_size - consumed);
+        sim->in_size -= consumed;
+    }
+}
+
+/* ======== Main Loop ======== */
+
+static long long now_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000LL + ts.tv_nsec / 1000;
+}
+
+static int open_pty(sim_t *sim, const char *link) {
+    struct termios io;
+    const char *name;
+
+    sim->master = posix_openpt(O_RDWR | O_NOCTTY);
+    if(sim->master < 0 || grantpt(sim->master) || unlockpt(sim->master))
+        return -1;
+
+    name = ptsname(sim->master);
+    if(!name)
+        return -1;
+
+    /* Keep the slave open so that the SDK could reconnect any time */
+    sim->slave = open(name, O_RDWR | O_NOCTTY);
+    if(sim->slave < 0 || tcgetattr(sim->slave, &io))
+        return -1;
+    cfmakeraw(&io);
+    if(tcsetattr(sim->slave, TCSANOW, &io))
+        return -1;
+
+    fcntl(sim->master, F_SETFL, fcntl(sim->master, F_GETFL) | O_NONBLOCK);
+
+    if(link) {
+        unlink(link);
+        if(symlink(name, link)) {
+            fprintf(stderr, "Could not create link %s.\n", link);
+            return -1;
+        }
+    }
+
+    printf("Simulating device at %s%s%s\n", name, link ? " linked as " : "",
+           link ? link : "");
+    fflush(stdout);
+    return 0;
+}
+
+static int open_socket(sim_t *sim, const char *path) {
+    struct sockaddr_un address;
+
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    strncpy(address.sun_path, path, sizeof(address.sun_path) - 1);
+
+    sim->master = -1;
+    sim->listener = socket(AF_UNIX, SOCK_STREAM, 0);
+    unlink(path);
+    if(sim->listener < 0 ||
+       bind(sim->listener, (struct sockaddr *)&address, sizeof(address)) ||
+       listen(sim->listener, 1))
+        return -1;
+
+    printf("Simulating device at unix:%s\n", path);
+    fflush(stdout);
+    return 0;
+}
+
+/* Replaces the current client of the socket */
+static void accept_client(sim_t *sim) {
+    int client = accept(sim->listener, NULL, NULL);
+
+    if(client < 0)
+        return;
+    if(sim->master >= 0)
+        close(sim->master);
+    fcntl(client, F_SETFL, fcntl(client, F_GETFL) | O_NONBLOCK);
+    sim->master = client;
+    sim->in_size = 0;
+    sim->delayed_count = 0;
+
+    if(sim->verbose)
+        printf("> client connected\n");
+}
+
+int main(int argc, char *argv[]) {
+    sim_t sim;
+    const char *link = NULL;
+    const char *socket_path = NULL;
+    const char *trajectory = NULL;
+    int mask = gestic_data_mask_dsp_status | gestic_data_mask_gesture |
+               gestic_data_mask_touch | gestic_data_mask_airwheel |
+               gestic_data_mask_position;
+    long long next;
+    int opt;
+
+    memset(&sim, 0, sizeof(sim));
+    sim.listener = -1;
+    sim.rate = SAMPLE_RATE;
+    sim.fw_valid = 0xAA;
+    memset(sim.flash, 0xFF, sizeof(sim.flash));
+    strcpy(sim.version, "1.0.0;p:Simulator;x:Simulator;s:Simulator;");
+
+    while((opt = getopt(argc, argv, "l:s:r:m:t:d:v")) != -1) {
+        switch(opt) {
+        case 'l': link = optarg; break;
+        case 's': socket_path = optarg; break;
+        case 'r': sim.rate = atoi(optarg); break;
+        case 'm': mask = strtol(optarg, NULL, 0); break;
+        case 't': trajectory = optarg; break;
+        case 'd': sim.latency = atoi(optarg); break;
+        case 'v': sim.verbose = 1; break;
+        default:
+            fprintf(stderr,
+                    "Usage: %s [-l link | -s socket] [-r rate] [-m mask] [-t trajectory] [-d usec] [-v]\n"
+                    "  -l  Create a symbolic link to the pty\n"
+                    "  -s  Listen on a Unix domain socket instead of a pty\n"
+                    "  -r  Messages per second, at most %d (default %d)\n"
+                    "  -m  Initial output mask (default 0x%X)\n"
+                    "  -t  Replay lines of \"x y z [touch [gesture]]\" per sample,\n"
+                    "      x = -1 for no hand (default synthetic trajectory)\n"
+                    "  -d  Delay messages to the host by usec (default 0)\n"
+                    "  -v  Print the exchanged messages\n",
+                    argv[0], SAMPLE_RATE, SAMPLE_RATE, mask);
+            return -1;
+        }
+    }
+
+    if(sim.rate < 1 || sim.rate > SAMPLE_RATE) {
+        fprintf(stderr, "Rate has to be between 1 and %d.\n", SAMPLE_RATE);
+        return -1;
+    }
+    if(trajectory && load_trajectory(&sim, trajectory)) {
+        fprintf(stderr, "Could not load trajectory %s.\n", trajectory);
+        return -1;
+    }
+    if(socket_path && open_socket(&sim, socket_path)) {
+        fprintf(stderr, "Could not listen on %s: %s\n", socket_path, strerror(errno));
+        return -1;
+    }
+    if(!socket_path && open_pty(&sim, link)) {
+        fprintf(stderr, "Could not create pty: %s\n", strerror(errno));
+        return -1;
+    }
+
+    sim.startup_mask = mask;
+    reset_params(&sim, mask);
+
+    signal(SIGINT, on_signal);
+    signal(SIGTERM, on_signal);
+    signal(SIGUSR1, on_stall);
+
+    next = now_us();
+    while(running) {
+        struct pollfd pfd[2];
+        long long wait = next - now_us();
+        long long delay = flush_delayed(&sim);
+        int count;
+
+        if(delay >= 0 && delay < wait)
+            wait = delay;
+
+        pfd[0].fd = sim.master;
+        pfd[0].events = POLLIN;
+        pfd[0].revents = 0;
+        pfd[1].fd = sim.listener;
+        pfd[1].events = POLLIN;
+        pfd[1].revents = 0;
+        if(poll(pfd, 2, wait > 0 ? (int)((wait + 999) / 1000) : 0) > 0) {
+            if(pfd[1].revents & POLLIN)
+                accept_client(&sim);
+
+            if(pfd[0].revents & (POLLIN | POLLHUP)) {
+                count = read(sim.master, sim.in + sim.in_size,
+                             sizeof(sim.in) - sim.in_size);
+                if(count > 0) {
+                    sim.in_size += count;
+                    handle_input(&sim);
+                } else if(sim.listener >= 0 && count == 0) {
+                    /* The client disconnected */
+                    close(sim.master);
+                    sim.master = -1;
+                }
+            }
+        }
+
+        if(now_us() >= next) {
+            int enabled = get_param(&sim, gestic_param_dataOutputEnableMask);
+
+            sim.sample += SAMPLE_RATE / sim.rate;
+            if(stalled) {
+                /* Nothing leaves a wedged device */
+            } else if(sim.request_mask) {
+                send_frame(&sim, sim.request_mask);
+                sim.request_mask = 0;
+            } else if(enabled & gestic_data_mask_all) {
+                send_frame(&sim, enabled);
+            }
+            next += 1000000 / sim.rate;
+        }
+    }
+
+    if(link)
+        unlink(link);
+    if(socket_path)
+        unlink(socket_path);
+    free(sim.trajectory);
+    return 0;
+}
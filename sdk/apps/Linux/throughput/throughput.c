@@ -0,0 +1,115 @@
+/******************************************************************************
+ *
+ * Copyright (C) 2014 Microchip Technology Inc. and its
+ *                    subsidiaries ("Microchip").
+ *
+ * All rights reserved.
+ *
+ * You are permitted to use the Aurea software, GestIC API, and other
+ * accompanying software with Microchip products.  Refer to the license
+ * agreement accompanying this software, if any, for additional info regarding
+ * your rights and obligations.
+ *
+ * SOFTWARE AND DOCUMENTATION ARE PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION, ANY WARRANTY OF
+ * MERCHANTABILITY, TITLE, NON-INFRINGEMENT AND FITNESS FOR A PARTICULAR
+ * PURPOSE. IN NO EVENT SHALL MICROCHIP, SMSC, OR ITS LICENSORS BE LIABLE OR
+ * OBLIGATED UNDER CONTRACT, NEGLIGENCE, STRICT LIABILITY, CONTRIBUTION, BREACH
+ * OF WARRANTY, OR OTHER LEGAL EQUITABLE THEORY FOR ANY DIRECT OR INDIRECT
+ * DAMAGES OR EXPENSES INCLUDING BUT NOT LIMITED TO ANY INCIDENTAL, SPECIAL,
+ * INDIRECT OR CONSEQUENTIAL DAMAGES, OR OTHER SIMILAR COSTS.
+ *
+ ******************************************************************************/
+#include <gestic_api.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+/* This tool measures how fast the SDK processes the data stream of a
+ * connection opened with gestic_open_uri, e.g. of a replay at maximum speed.
+ * With -p the metrics of the SDK are written in the Prometheus textfile
+ * format afterwards, with -t the trace ring is dumped for tracedump.
+ */
+
+/* The stream counts as finished after that long without data */
+#define IDLE_TIMEOUT_US 1000000
+
+static long long now_us(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1000000LL + now.tv_nsec / 1000;
+}
+
+int main(int argc, char *argv[]) {
+    gestic_t *gestic;
+    const char *metrics = NULL;
+    const char *trace = NULL;
+    int mask = gestic_data_mask_all;
+    long long start, last_data, elapsed;
+    long frames = 0, updates = 0;
+    int skipped;
+    int first = 1;
+
+    for(; first + 1 < argc; first += 2) {
+        if(!strcmp(argv[first], "-p"))
+            metrics = argv[first + 1];
+        else if(!strcmp(argv[first], "-t"))
+            trace = argv[first + 1];
+        else
+            break;
+    }
+    if(argc <= first) {
+        fprintf(stderr, "Usage: %s [-p metrics.prom] [-t trace.bin] <uri> [mask]\n"
+                        "  e.g. %s replay:capture.raw?speed=max\n",
+                argv[0], argv[0]);
+        return -1;
+    }
+    if(argc > first + 1)
+        mask = strtol(argv[first + 1], NULL, 0);
+
+    gestic = gestic_create();
+    gestic_initialize(gestic);
+
+    if(gestic_open_uri(gestic, argv[first]) < 0) {
+        fprintf(stderr, "Could not open %s.\n", argv[first]);
+        return -1;
+    }
+
+    if(gestic_set_output_enable_mask(gestic, mask, mask,
+                                     gestic_data_mask_all, 100) < 0)
+    {
+        fprintf(stderr, "Could not set output-mask for streaming.\n");
+        return -1;
+    }
+
+    start = last_data = now_us();
+    while(now_us() - last_data < IDLE_TIMEOUT_US) {
+        if(!gestic_data_stream_update(gestic, &skipped)) {
+            frames += 1 + skipped;
+            ++updates;
+            last_data = now_us();
+        } else {
+            usleep(1000);
+        }
+    }
+
+    elapsed = last_data - start;
+    printf("%ld frames in %ld updates within %.1f ms", frames, updates,
+           elapsed / 1000.0);
+    if(elapsed > 0)
+        printf(", %.0f frames/s", frames * 1000000.0 / elapsed);
+    printf("\n");
+
+    if(metrics && gestic_write_metrics(gestic, metrics, NULL))
+        fprintf(stderr, "Could not write metrics to %s.\n", metrics);
+    if(trace && gestic_write_trace(gestic, trace))
+        fprintf(stderr, "Could not write trace to %s.\n", trace);
+
+    gestic_close(gestic);
+    gestic_cleanup(gestic);
+    gestic_free(gestic);
+
+    return 0;
+}
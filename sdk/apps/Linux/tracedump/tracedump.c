@@ -0,0 +1,127 @@
+/******************************************************************************
+ *
+ * Copyright (C) 2014 Microchip Technology Inc. and its
+ *                    subsidiaries ("Microchip").
+ *
+ * All rights reserved.
+ *
+ * You are permitted to use the Aurea software, GestIC API, and other
+ * accompanying software with Microchip products.  Refer to the license
+ * agreement accompanying this software, if any, for additional info regarding
+ * your rights and obligations.
+ *
+ * SOFTWARE AND DOCUMENTATION ARE PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION, ANY WARRANTY OF
+ * MERCHANTABILITY, TITLE, NON-INFRINGEMENT AND FITNESS FOR A PARTICULAR
+ * PURPOSE. IN NO EVENT SHALL MICROCHIP, SMSC, OR ITS LICENSORS BE LIABLE OR
+ * OBLIGATED UNDER CONTRACT, NEGLIGENCE, STRICT LIABILITY, CONTRIBUTION, BREACH
+ * OF WARRANTY, OR OTHER LEGAL EQUITABLE THEORY FOR ANY DIRECT OR INDIRECT
+ * DAMAGES OR EXPENSES INCLUDING BUT NOT LIMITED TO ANY INCIDENTAL, SPECIAL,
+ * INDIRECT OR CONSEQUENTIAL DAMAGES, OR OTHER SIMILAR COSTS.
+ *
+ ******************************************************************************/
+#include <gestic_api.h>
+#include <stdio.h>
+#include <string.h>
+
+/* This tool prints a trace ring as dumped with gestic_write_trace:
+ *
+ *   tracedump trace.bin
+ *
+ * Times are given in milliseconds before the last entry of the dump.
+ */
+
+typedef struct {
+    int event;
+    const char *name;
+    /* printf format of the three arguments */
+    const char *format;
+} event_format_t;
+
+static const event_format_t formats[] = {
+    { gestic_trace_message, "message", "id=0x%02X size=%d" },
+    { gestic_trace_frame, "frame", "counter=%d mask=0x%04X" },
+    { gestic_trace_cmd_sent, "cmd_sent", "id=0x%02X attempt=%d timeout=%dms" },
+    { gestic_trace_cmd_ack, "cmd_ack", "id=0x%02X error=%d rtt=%dus" },
+    { gestic_trace_cmd_timeout, "cmd_timeout", "id=0x%02X attempt=%d timeout=%dms" },
+    { gestic_trace_param, "param", "param=0x%04X arg0=0x%08X arg1=0x%08X" },
+    { gestic_trace_resync, "resync", "pending=%d" },
+    { gestic_trace_bad_size, "bad_size", "id=0x%02X size=%d" },
+    { gestic_trace_reset, "reset", "error=%d" },
+    { gestic_trace_recovery, "recovery", "duration=%dms error=%d" }
+};
+
+static const char *levels[] = { "?", "E", "I", "D" };
+
+static void print_entry(const gestic_trace_entry_t *entry, unsigned int last) {
+    const event_format_t *format = NULL;
+    size_t i;
+
+    for(i = 0; i < sizeof(formats) / sizeof(formats[0]); ++i) {
+        if(formats[i].event == entry->event)
+            format = &formats[i];
+    }
+
+    printf("%10u %12.3f %s ", entry->seq,
+           -(double)(unsigned int)(last - entry->time) / 1000.0,
+           entry->level < 4 ? levels[entry->level] : levels[0]);
+    if(format) {
+        printf("%-12s ", format->name);
+        printf(format->format, entry->args[0], entry->args[1], entry->args[2]);
+    } else {
+        printf("event %-6d %d %d %d", entry->event, entry->args[0],
+               entry->args[1], entry->args[2]);
+    }
+    printf("\n");
+}
+
+int main(int argc, char *argv[]) {
+    gestic_trace_header_t header;
+    gestic_trace_entry_t entries[2];
+    unsigned int i, last = 0;
+    long first_entry;
+    FILE *file;
+
+    if(argc != 2) {
+        fprintf(stderr, "Usage: %s <dump>\n", argv[0]);
+        return -1;
+    }
+
+    file = fopen(argv[1], "rb");
+    if(!file) {
+        fprintf(stderr, "Could not open %s.\n", argv[1]);
+        return -1;
+    }
+
+    if(fread(&header, sizeof(header), 1, file) != 1 ||
+       memcmp(header.magic, "GTRC", 4) || header.version != 1 ||
+       header.entry_size != sizeof(gestic_trace_entry_t))
+    {
+        fprintf(stderr, "%s is no trace dump of this version.\n", argv[1]);
+        fclose(file);
+        return -1;
+    }
+
+    /* The times are relative to the last entry */
+    first_entry = ftell(file);
+    if(header.count > 0 &&
+       !fseek(file, (long)(header.count - 1) * sizeof(gestic_trace_entry_t), SEEK_CUR) &&
+       fread(&entries[1], sizeof(gestic_trace_entry_t), 1, file) == 1)
+    {
+        last = entries[1].time;
+    }
+    fseek(file, first_entry, SEEK_SET);
+
+    printf("%10s %12s %s %-12s %s\n", "seq", "ms", "L", "event", "arguments");
+    for(i = 0; i < header.count; ++i) {
+        if(fread(&entries[0], sizeof(gestic_trace_entry_t), 1, file) != 1) {
+            fprintf(stderr, "Dump ends after %u of %u entries.\n", i,
+                    header.count);
+            break;
+        }
+        print_entry(&entries[0], last);
+    }
+
+    fclose(file);
+    return 0;
+}